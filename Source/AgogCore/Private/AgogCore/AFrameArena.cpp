@@ -0,0 +1,305 @@
+//=======================================================================================
+// Agog Labs C++ library.
+// Copyright (c) 2015 Agog Labs Inc.,
+// All rights reserved.
+//
+// Bump allocator for memory that only lives until the end of the current update/frame
+// # Notes:
+//=======================================================================================
+
+
+//=======================================================================================
+// Includes
+//=======================================================================================
+
+#include "AgogCore/AFrameArena.hpp"
+#include "AgogCore/AString.hpp"
+#include <stdio.h>      // Uses:  vsnprintf
+#include <stdarg.h>     // Uses:  va_start, va_end, va_copy
+
+
+//=======================================================================================
+// Local Global Structures
+//=======================================================================================
+
+namespace
+  {
+
+  //---------------------------------------------------------------------------------------
+  // Formats into arena memory - shared by AFrameArena::cstr_format() and str_format()
+  char * arena_vformat(AFrameArena * arena_p, const char * format_str_p, va_list args, uint32_t * length_p)
+    {
+    va_list args_copy;
+
+    va_copy(args_copy, args);
+
+    int length = vsnprintf(nullptr, 0u, format_str_p, args_copy);
+
+    va_end(args_copy);
+
+    if (length < 0)
+      {
+      length = 0;
+      }
+
+    char * cstr_p = static_cast<char *>(arena_p->allocate(size_t(length) + 1u, 1u));
+
+    vsnprintf(cstr_p, size_t(length) + 1u, format_str_p, args);
+
+    cstr_p[length] = '\0';
+    *length_p      = uint32_t(length);
+
+    return cstr_p;
+    }
+
+  }  // End unnamed namespace
+
+
+//=======================================================================================
+// AFrameArena Method Definitions
+//=======================================================================================
+
+//---------------------------------------------------------------------------------------
+// Constructor - no memory is allocated until first needed
+// Arg         chunk_size - minimum byte size of each chunk of memory to get from AMemory
+AFrameArena::AFrameArena(
+  uint32_t chunk_size // = AFrameArena_chunk_size_def
+  ) :
+  m_cur_p(nullptr),
+  m_end_p(nullptr),
+  m_chunk_p(nullptr),
+  m_finalizers_p(nullptr),
+  m_bytes_retired(0u),
+  m_bytes_peak(0u),
+  m_chunk_size(chunk_size)
+  {
+  }
+
+//---------------------------------------------------------------------------------------
+// Destructor - destructs any remaining objects and frees all chunks
+AFrameArena::~AFrameArena()
+  {
+  reset();
+  free_chunks();
+  }
+
+//---------------------------------------------------------------------------------------
+// # Returns:  bytes of memory currently obtained from AMemory (not including headers)
+size_t AFrameArena::get_bytes_reserved() const
+  {
+  size_t  bytes   = 0u;
+  Chunk * chunk_p = m_chunk_p;
+
+  while (chunk_p)
+    {
+    bytes  += chunk_p->m_size;
+    chunk_p = chunk_p->m_next_p;
+    }
+
+  return bytes;
+  }
+
+//---------------------------------------------------------------------------------------
+// # Returns:  true if memory is within one of the chunks of this arena
+// # Notes:    Useful to ensure that arena memory is not about to escape
+bool AFrameArena::is_owned(const void * mem_p) const
+  {
+  const uint8_t * byte_p  = static_cast<const uint8_t *>(mem_p);
+  Chunk *         chunk_p = m_chunk_p;
+
+  while (chunk_p)
+    {
+    if ((byte_p >= chunk_p->get_data()) && (byte_p < (chunk_p->get_data() + chunk_p->m_size)))
+      {
+      return true;
+      }
+
+    chunk_p = chunk_p->m_next_p;
+    }
+
+  return false;
+  }
+
+//---------------------------------------------------------------------------------------
+// Copies a string into arena memory.
+// # Returns:  null terminated copy of string valid until reset()
+// Arg         cstr_p - string to copy
+// Arg         length - number of characters to copy
+char * AFrameArena::cstr_copy(
+  const char * cstr_p,
+  uint32_t     length
+  )
+  {
+  char * copy_p = static_cast<char *>(allocate(length + 1u, 1u));
+
+  ::memcpy(copy_p, cstr_p, length);
+  copy_p[length] = '\0';
+
+  return copy_p;
+  }
+
+//---------------------------------------------------------------------------------------
+// Formats a string into arena memory - a transient alternative to a_cstr_format() with
+// no length limit.
+// # Returns:  formatted string valid until reset()
+// Arg         format_str_p - printf() style format string followed by its arguments
+char * AFrameArena::cstr_format(const char * format_str_p, ...)
+  {
+  uint32_t length;
+  va_list  args;
+
+  va_start(args, format_str_p);
+  char * cstr_p = arena_vformat(this, format_str_p, args, &length);
+  va_end(args);
+
+  return cstr_p;
+  }
+
+//---------------------------------------------------------------------------------------
+// Formats a string into arena memory and wraps it in an AString - a transient
+// alternative to a_str_format() that does not allocate a character buffer.
+// # Returns:  formatted string whose buffer is valid until reset()
+// Arg         format_str_p - printf() style format string followed by its arguments
+// # Notes:    The returned string (and any copies of it) must not be used after reset()
+//             unless it has been modified so that it needed a larger buffer.
+AString AFrameArena::str_format(const char * format_str_p, ...)
+  {
+  uint32_t length;
+  va_list  args;
+
+  va_start(args, format_str_p);
+  char * cstr_p = arena_vformat(this, format_str_p, args, &length);
+  va_end(args);
+
+  return AString(cstr_p, length + 1u, length, false);
+  }
+
+//---------------------------------------------------------------------------------------
+// Destructs all objects created in the arena and makes all of its memory available
+// again.  Everything allocated from the arena is invalid afterwards.
+//
+// If more than one chunk was needed since the last reset they are replaced by a single
+// chunk large enough for all of it.
+void AFrameArena::reset()
+  {
+  // Destruct objects - most recent first
+  Finalizer * finalizer_p = m_finalizers_p;
+
+  while (finalizer_p)
+    {
+    (finalizer_p->m_destruct_f)(finalizer_p->m_obj_p);
+    finalizer_p = finalizer_p->m_next_p;
+    }
+
+  m_finalizers_p = nullptr;
+
+  if (m_chunk_p == nullptr)
+    {
+    return;
+    }
+
+  size_t bytes_used = get_bytes_used();
+
+  if (bytes_used > m_bytes_peak)
+    {
+    m_bytes_peak = bytes_used;
+    }
+
+  #ifdef A_EXTRA_CHECK
+    // Make any use of memory after reset more obvious - only the bytes used since the
+    // last reset need clearing and multiple chunks are about to be freed anyway.
+    if (m_chunk_p->m_next_p == nullptr)
+      {
+      ::memset(m_chunk_p->get_data(), 0xDD, size_t(m_cur_p - m_chunk_p->get_data()));
+      }
+  #endif
+
+  if (m_chunk_p->m_next_p)
+    {
+    // Coalesce - with a bit extra for alignment padding
+    free_chunks();
+    allocate_chunk(bytes_used + (bytes_used >> 3u), 1u);
+    }
+
+  m_bytes_retired = 0u;
+  m_cur_p         = m_chunk_p->get_data();
+  m_end_p         = m_cur_p + m_chunk_p->m_size;
+  }
+
+//---------------------------------------------------------------------------------------
+// Returns the arena that is reset at the end of each update - for example by the game
+// engine tick after SkookumScript has been updated.
+AFrameArena & AFrameArena::get_frame()
+  {
+  static AFrameArena s_frame_arena;
+
+  return s_frame_arena;
+  }
+
+//---------------------------------------------------------------------------------------
+// Adds a new current chunk when the current one does not have room and then allocates
+// from it - see allocate().
+void * AFrameArena::allocate_chunk(
+  size_t size,
+  size_t alignment
+  )
+  {
+  if (m_chunk_p)
+    {
+    m_bytes_retired += size_t(m_cur_p - m_chunk_p->get_data());
+    }
+
+  size_t chunk_size = size + alignment;
+
+  if (chunk_size < m_chunk_size)
+    {
+    chunk_size = m_chunk_size;
+    }
+
+  Chunk * chunk_p = static_cast<Chunk *>(AMemory::malloc(sizeof(Chunk) + chunk_size, "AFrameArena.chunk"));
+
+  A_VERIFY_MEMORY(chunk_p != nullptr, AFrameArena);
+
+  chunk_p->m_next_p = m_chunk_p;
+  chunk_p->m_size   = chunk_size;
+  m_chunk_p         = chunk_p;
+  m_cur_p           = chunk_p->get_data();
+  m_end_p           = m_cur_p + chunk_size;
+
+  return allocate(size, alignment);
+  }
+
+//---------------------------------------------------------------------------------------
+// Records an object to be destructed at reset()
+void AFrameArena::add_finalizer(
+  void * obj_p,
+  void (* destruct_f)(void * obj_p)
+  )
+  {
+  Finalizer * finalizer_p = static_cast<Finalizer *>(allocate(sizeof(Finalizer), sizeof(void *)));
+
+  finalizer_p->m_next_p     = m_finalizers_p;
+  finalizer_p->m_obj_p      = obj_p;
+  finalizer_p->m_destruct_f = destruct_f;
+  m_finalizers_p            = finalizer_p;
+  }
+
+//---------------------------------------------------------------------------------------
+// Returns all chunks to AMemory
+void AFrameArena::free_chunks()
+  {
+  Chunk * chunk_p = m_chunk_p;
+  Chunk * next_p;
+
+  while (chunk_p)
+    {
+    next_p = chunk_p->m_next_p;
+    AMemory::free(chunk_p);
+    chunk_p = next_p;
+    }
+
+  m_chunk_p       = nullptr;
+  m_cur_p         = nullptr;
+  m_end_p         = nullptr;
+  m_bytes_retired = 0u;
+  }
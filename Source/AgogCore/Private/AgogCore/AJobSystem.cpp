@@ -0,0 +1,705 @@
+//=======================================================================================
+// Agog Labs C++ library.
+// Copyright (c) 2015 Agog Labs Inc.,
+// All rights reserved.
+//
+// Job system - fixed pool of worker threads with work-stealing job queues
+// # Notes:
+//=======================================================================================
+
+
+//=======================================================================================
+// Includes
+//=======================================================================================
+
+#include "AgogCore/AJobSystem.hpp"
+#include "AgogCore/AMemory.hpp"
+
+
+//=======================================================================================
+// AJobSystem Class Data
+//=======================================================================================
+
+A_THREAD_LOCAL AJobSystem::Worker * AJobSystem::ms_worker_p = nullptr;
+
+
+//=======================================================================================
+// AJobSystem Method Definitions
+//=======================================================================================
+
+//---------------------------------------------------------------------------------------
+// Constructor - starts the worker threads.  The calling thread becomes worker 0.
+// # Returns:  itself
+// Arg         worker_count - number of workers including the calling thread.  If 0 the
+//             number of hardware threads is used.
+// Arg         queue_size - number of jobs each worker queue can hold.  Rounded up to a
+//             power of 2.
+AJobSystem::AJobSystem(
+  uint32_t worker_count, // = 0u
+  uint32_t queue_size    // = AJobSystem_queue_size_def
+  ) :
+  m_workers_a(nullptr),
+  m_worker_count(worker_count ? worker_count : get_hardware_thread_count()),
+  m_inject_head_p(nullptr),
+  m_inject_tail_p(nullptr),
+  m_inject_count(0),
+  m_queued(0),
+  m_sleeping(0u),
+  m_quit(false)
+  {
+  A_ASSERTX(ms_worker_p == nullptr, "AJobSystem - the calling thread is already a worker of another job system!");
+
+  uint32_t mask = 1u;
+
+  while (mask < queue_size)
+    {
+    mask <<= 1u;
+    }
+
+  mask--;
+
+  m_workers_a = static_cast<Worker *>(AMemory::malloc(sizeof(Worker) * m_worker_count, "AJobSystem.Worker"));
+
+  uint32_t idx;
+
+  for (idx = 0u; idx < m_worker_count; idx++)
+    {
+    Worker * worker_p = new (m_workers_a + idx) Worker;
+
+    worker_p->m_top.store(0, std::memory_order_relaxed);
+    worker_p->m_bottom.store(0, std::memory_order_relaxed);
+    worker_p->m_jobs_a   = static_cast<std::atomic<AJob *> *>(AMemory::malloc(sizeof(std::atomic<AJob *>) * (mask + 1u), "AJobSystem.Queue"));
+    worker_p->m_mask     = mask;
+    worker_p->m_idx      = idx;
+    worker_p->m_random   = (idx + 1u) * 0x9E3779B9u;
+    worker_p->m_system_p = this;
+
+    for (uint32_t job_idx = 0u; job_idx <= mask; job_idx++)
+      {
+      new (worker_p->m_jobs_a + job_idx) std::atomic<AJob *>(nullptr);
+      }
+    }
+
+  ms_worker_p = m_workers_a;
+
+  // Start workers once they are all set up since they may steal from each other right away
+  for (idx = 1u; idx < m_worker_count; idx++)
+    {
+    m_workers_a[idx].m_thread = std::thread(&AJobSystem::worker_loop, this, m_workers_a + idx);
+    }
+  }
+
+//---------------------------------------------------------------------------------------
+// Destructor - stops the worker threads.
+// # Notes:    Must be called by the thread that created the job system once all jobs
+//             are done.
+AJobSystem::~AJobSystem()
+  {
+  A_ASSERTX(ms_worker_p == m_workers_a, "AJobSystem must be destroyed by the thread that created it!");
+  A_ASSERTX(m_queued.load() == 0, "AJobSystem destroyed with jobs that have not been run!");
+
+  m_sleep_mutex.lock();
+  m_quit.store(true);
+  m_wake_cond.notify_all();
+  m_sleep_mutex.unlock();
+
+  uint32_t idx;
+
+  for (idx = 1u; idx < m_worker_count; idx++)
+    {
+    m_workers_a[idx].m_thread.join();
+    }
+
+  for (idx = 0u; idx < m_worker_count; idx++)
+    {
+    AMemory::free(m_workers_a[idx].m_jobs_a);
+    m_workers_a[idx].~Worker();
+    }
+
+  AMemory::free(m_workers_a);
+
+  ms_worker_p = nullptr;
+  }
+
+//---------------------------------------------------------------------------------------
+// # Returns:  index of the worker the calling thread is or -1 if it is not a worker of
+//             this job system.  Worker 0 is the thread that created the job system.
+int32_t AJobSystem::get_worker_idx() const
+  {
+  Worker * worker_p = get_worker();
+
+  return worker_p ? int32_t(worker_p->m_idx) : -1;
+  }
+
+//---------------------------------------------------------------------------------------
+// Runs jobs - they may start before this method returns.
+// Arg         jobs_p - array of jobs to run.  They must stay valid until counter_p has
+//             been waited on.
+// Arg         job_count - number of jobs in jobs_p
+// Arg         counter_p - counter that is increased by job_count and decreased as each
+//             job is done.  Use wait() to wait for the jobs to be done.
+// # See:      run_after(), wait(), parallel_for()
+void AJobSystem::run(
+  AJob *        jobs_p,
+  uint32_t      job_count,
+  AJobCounter * counter_p
+  )
+  {
+  A_ASSERTX(counter_p, "AJobSystem::run() - jobs must be given a counter!");
+
+  if (job_count == 0u)
+    {
+    return;
+    }
+
+  counter_p->m_count.fetch_add(job_count, std::memory_order_relaxed);
+
+  Worker * worker_p = get_worker();
+  AJob *   jobs_end_p = jobs_p + job_count;
+
+  for (AJob * job_p = jobs_p; job_p < jobs_end_p; job_p++)
+    {
+    job_p->m_counter_p = counter_p;
+    submit(worker_p, job_p);
+    }
+
+  wake(job_count);
+  }
+
+//---------------------------------------------------------------------------------------
+// Runs jobs once all the jobs counted by depend_p are done.
+// Arg         depend_p - counter of jobs that must be done first.  If it is already
+//             done then the jobs are run right away.
+// Arg         jobs_p - array of jobs to run.  They must stay valid until counter_p has
+//             been waited on.
+// Arg         job_count - number of jobs in jobs_p
+// Arg         counter_p - counter that is increased by job_count right away and
+//             decreased as each job is done.  Waiting on it also waits on depend_p.
+// # Notes:    depend_p must not be destroyed before its dependent jobs have started -
+//             waiting on counter_p ensures this.
+// # See:      run(), wait()
+void AJobSystem::run_after(
+  AJobCounter * depend_p,
+  AJob *        jobs_p,
+  uint32_t      job_count,
+  AJobCounter * counter_p
+  )
+  {
+  A_ASSERTX(counter_p && (counter_p != depend_p), "AJobSystem::run_after() - jobs must be given a counter other than the one they depend on!");
+
+  if (job_count == 0u)
+    {
+    return;
+    }
+
+  counter_p->m_count.fetch_add(job_count, std::memory_order_relaxed);
+
+  AJob * jobs_end_p = jobs_p + job_count;
+  AJob * job_p;
+
+  for (job_p = jobs_p; job_p < jobs_end_p; job_p++)
+    {
+    job_p->m_counter_p = counter_p;
+    }
+
+  // The last job of depend_p is completed under its lock so the jobs are either added to
+  // its pending list before it is done or run here.
+  depend_p->m_mutex.lock();
+
+  if (depend_p->m_count.load(std::memory_order_acquire))
+    {
+    for (job_p = jobs_p; job_p < jobs_end_p; job_p++)
+      {
+      job_p->m_next_p       = depend_p->m_pending_p;
+      depend_p->m_pending_p = job_p;
+      }
+
+    depend_p->m_mutex.unlock();
+
+    return;
+    }
+
+  depend_p->m_mutex.unlock();
+
+  Worker * worker_p = get_worker();
+
+  for (job_p = jobs_p; job_p < jobs_end_p; job_p++)
+    {
+    submit(worker_p, job_p);
+    }
+
+  wake(job_count);
+  }
+
+//---------------------------------------------------------------------------------------
+// Returns once all the jobs counted by counter_p are done - running other jobs while it
+// waits.
+// # Notes:    May be called by any thread including from within a job.  The counter may
+//             be reused or destroyed once this returns.
+void AJobSystem::wait(AJobCounter * counter_p)
+  {
+  Worker * worker_p = get_worker();
+  AJob *   job_p;
+
+  while (counter_p->m_count.load(std::memory_order_acquire))
+    {
+    job_p = find_job(worker_p);
+
+    if (job_p)
+      {
+      execute(job_p);
+      }
+    else
+      {
+      std::this_thread::yield();
+      }
+    }
+
+  // Ensure the thread that completed the last job is no longer using the counter
+  counter_p->m_mutex.lock();
+  counter_p->m_mutex.unlock();
+  }
+
+//---------------------------------------------------------------------------------------
+// Calls func_p(data_p, begin, end) in parallel for sub-ranges that together cover 0 to
+// count - 1 and returns once all of them are done.
+// Arg         count - number of indexes to process
+// Arg         grain - number of indexes in each sub-range.  If 0 the range is split
+//             into AJobSystem_for_splits sub-ranges per worker.
+// Arg         func_p - function called with a begin (inclusive) and end (exclusive)
+//             index - it is called from several threads at once.
+// Arg         data_p - user data passed to func_p
+void AJobSystem::parallel_for(
+  uint32_t       count,
+  uint32_t       grain,
+  tAJobRangeFunc func_p,
+  void *         data_p
+  )
+  {
+  if (count == 0u)
+    {
+    return;
+    }
+
+  if (grain == 0u)
+    {
+    // Done in 64 bits so a huge worker count cannot overflow the split count
+    grain = uint32_t(count / (uint64_t(m_worker_count) * AJobSystem_for_splits));
+
+    if (grain == 0u)
+      {
+      grain = 1u;
+      }
+    }
+
+  // Rounded up without count + grain which could overflow
+  uint32_t job_count = count / grain + ((count % grain) != 0u);
+
+  // Not worth splitting up
+  if (job_count == 1u)
+    {
+    (func_p)(data_p, 0u, count);
+
+    return;
+    }
+
+  // Jobs and their sub-ranges are allocated together
+  AJob *  jobs_p   = static_cast<AJob *>(AMemory::malloc((sizeof(AJob) + sizeof(Range)) * job_count, "AJobSystem.parallel_for"));
+  Range * ranges_p = reinterpret_cast<Range *>(jobs_p + job_count);
+  Range * range_p  = ranges_p;
+  AJob *  job_p    = jobs_p;
+  uint64_t begin   = 0u;  // 64 bits so begin += grain cannot wrap past count
+
+  for (; begin < count; begin += grain, range_p++, job_p++)
+    {
+    range_p->m_func_p = func_p;
+    range_p->m_data_p = data_p;
+    range_p->m_begin  = uint32_t(begin);
+    range_p->m_end    = ((count - begin) > grain) ? uint32_t(begin + grain) : count;
+
+    new (job_p) AJob(invoke_range, range_p);
+    }
+
+  AJobCounter counter;
+
+  run(jobs_p, job_count, &counter);
+  wait(&counter);
+
+  AMemory::free(jobs_p);
+  }
+
+//---------------------------------------------------------------------------------------
+// # Returns:  number of threads the hardware can run at once - at least 1
+uint32_t AJobSystem::get_hardware_thread_count()
+  {
+  uint32_t count = std::thread::hardware_concurrency();
+
+  return count ? count : 1u;
+  }
+
+//---------------------------------------------------------------------------------------
+// Runs jobs until the job system is destroyed - sleeping when there are none.
+// # Modifiers: protected
+void AJobSystem::worker_loop(Worker * worker_p)
+  {
+  ms_worker_p = worker_p;
+
+  AJob *   job_p;
+  uint32_t spins = 0u;
+
+  while (!m_quit.load(std::memory_order_relaxed))
+    {
+    job_p = find_job(worker_p);
+
+    if (job_p)
+      {
+      execute(job_p);
+      spins = 0u;
+      continue;
+      }
+
+    if (++spins < AJobSystem_idle_spins)
+      {
+      std::this_thread::yield();
+      continue;
+      }
+
+    // Sleep until more jobs are run.  m_sleeping is increased before m_queued is checked
+    // and run() increases m_queued before checking m_sleeping so no wake up is missed.
+    std::unique_lock<std::mutex> lock(m_sleep_mutex);
+
+    m_sleeping.fetch_add(1u);
+
+    while ((m_queued.load() <= 0) && !m_quit.load())
+      {
+      m_wake_cond.wait(lock);
+      }
+
+    m_sleeping.fetch_sub(1u);
+    spins = 0u;
+    }
+
+  ms_worker_p = nullptr;
+  }
+
+//---------------------------------------------------------------------------------------
+// Adds a job to the calling worker's queue or to the shared list if the calling thread
+// is not a worker.  If the worker queue is full the job is run right away.
+// # Modifiers: protected
+void AJobSystem::submit(
+  Worker * worker_p,
+  AJob *   job_p
+  )
+  {
+  m_queued.fetch_add(1);
+
+  if (worker_p)
+    {
+    if (!queue_push(worker_p, job_p))
+      {
+      m_queued.fetch_sub(1);
+      execute(job_p);
+      }
+
+    return;
+    }
+
+  m_inject_mutex.lock();
+
+  job_p->m_next_p = nullptr;
+
+  if (m_inject_tail_p)
+    {
+    m_inject_tail_p->m_next_p = job_p;
+    }
+  else
+    {
+    m_inject_head_p = job_p;
+    }
+
+  m_inject_tail_p = job_p;
+  m_inject_count.fetch_add(1, std::memory_order_release);
+
+  m_inject_mutex.unlock();
+  }
+
+//---------------------------------------------------------------------------------------
+// Runs a job and marks it as done.
+// # Modifiers: protected
+void AJobSystem::execute(AJob * job_p)
+  {
+  AJobCounter * counter_p = job_p->m_counter_p;
+
+  (job_p->m_func_p)(job_p->m_data_p);
+
+  complete(counter_p);
+  }
+
+//---------------------------------------------------------------------------------------
+// Decreases a counter after one of its jobs is done and runs any jobs waiting on it if
+// it was the last one.
+// # Modifiers: protected
+void AJobSystem::complete(AJobCounter * counter_p)
+  {
+  uint32_t count = counter_p->m_count.load(std::memory_order_relaxed);
+
+  // Not the last job - no need to lock
+  while (count > 1u)
+    {
+    if (counter_p->m_count.compare_exchange_weak(count, count - 1u, std::memory_order_acq_rel, std::memory_order_relaxed))
+      {
+      return;
+      }
+    }
+
+  // Possibly the last job - the lock is held so wait() does not return while the counter
+  // is still in use and so run_after() sees either the pending list or the final count.
+  counter_p->m_mutex.lock();
+
+  AJob * pending_p = nullptr;
+
+  if (counter_p->m_count.fetch_sub(1u, std::memory_order_acq_rel) == 1u)
+    {
+    pending_p              = counter_p->m_pending_p;
+    counter_p->m_pending_p = nullptr;
+    }
+
+  counter_p->m_mutex.unlock();
+
+  if (pending_p)
+    {
+    Worker * worker_p  = get_worker();
+    uint32_t job_count = 0u;
+    AJob *   next_p;
+
+    do
+      {
+      next_p = pending_p->m_next_p;
+      submit(worker_p, pending_p);
+      pending_p = next_p;
+      job_count++;
+      }
+    while (pending_p);
+
+    wake(job_count);
+    }
+  }
+
+//---------------------------------------------------------------------------------------
+// Wakes sleeping workers after jobs have been added.
+// # Modifiers: protected
+void AJobSystem::wake(uint32_t job_count)
+  {
+  if (m_sleeping.load())
+    {
+    m_sleep_mutex.lock();
+
+    if (job_count > 1u)
+      {
+      m_wake_cond.notify_all();
+      }
+    else
+      {
+      m_wake_cond.notify_one();
+      }
+
+    m_sleep_mutex.unlock();
+    }
+  }
+
+//---------------------------------------------------------------------------------------
+// # Returns:  next job for the calling thread to run or nullptr if none was found.
+//             Looks in the worker's own queue, then the shared list and then tries to
+//             steal from the other workers.
+// # Modifiers: protected
+AJob * AJobSystem::find_job(Worker * worker_p)
+  {
+  AJob * job_p = worker_p ? queue_pop(worker_p) : nullptr;
+
+  if (job_p == nullptr)
+    {
+    if (m_inject_count.load(std::memory_order_acquire) > 0)
+      {
+      job_p = inject_pop();
+      }
+
+    if (job_p == nullptr)
+      {
+      // Start with a random worker so thieves spread out
+      uint32_t self_idx = worker_p ? worker_p->m_idx : m_worker_count;
+      uint32_t random   = worker_p ? worker_p->m_random : uint32_t(reinterpret_cast<uintptr_t>(&job_p) >> 4u);
+
+      random ^= random << 13u;
+      random ^= random >> 17u;
+      random ^= random << 5u;
+
+      if (worker_p)
+        {
+        worker_p->m_random = random;
+        }
+
+      uint32_t worker_count = m_worker_count;
+      uint32_t victim_idx   = random % worker_count;
+
+      for (uint32_t tries = 0u; tries < worker_count; tries++)
+        {
+        if (victim_idx != self_idx)
+          {
+          job_p = queue_steal(m_workers_a + victim_idx);
+
+          if (job_p)
+            {
+            break;
+            }
+          }
+
+        victim_idx = (victim_idx + 1u < worker_count) ? victim_idx + 1u : 0u;
+        }
+
+      if (job_p == nullptr)
+        {
+        return nullptr;
+        }
+      }
+    }
+
+  m_queued.fetch_sub(1);
+
+  return job_p;
+  }
+
+//---------------------------------------------------------------------------------------
+// # Returns:  oldest job from the shared list or nullptr if it is empty
+// # Modifiers: protected
+AJob * AJobSystem::inject_pop()
+  {
+  m_inject_mutex.lock();
+
+  AJob * job_p = m_inject_head_p;
+
+  if (job_p)
+    {
+    m_inject_head_p = job_p->m_next_p;
+
+    if (m_inject_head_p == nullptr)
+      {
+      m_inject_tail_p = nullptr;
+      }
+
+    m_inject_count.fetch_sub(1, std::memory_order_relaxed);
+    }
+
+  m_inject_mutex.unlock();
+
+  return job_p;
+  }
+
+//---------------------------------------------------------------------------------------
+// # Returns:  worker for the calling thread or nullptr if it is not a worker of this job
+//             system
+// # Modifiers: protected
+AJobSystem::Worker * AJobSystem::get_worker() const
+  {
+  Worker * worker_p = ms_worker_p;
+
+  return (worker_p && (worker_p->m_system_p == this)) ? worker_p : nullptr;
+  }
+
+//---------------------------------------------------------------------------------------
+// Adds a job to the bottom of a worker's queue - only called by the owning worker.
+// # Returns:  false if the queue is full
+// # Modifiers: protected, static
+bool AJobSystem::queue_push(
+  Worker * worker_p,
+  AJob *   job_p
+  )
+  {
+  int64_t bottom = worker_p->m_bottom.load(std::memory_order_relaxed);
+  int64_t top    = worker_p->m_top.load(std::memory_order_acquire);
+
+  if ((bottom - top) > int64_t(worker_p->m_mask))
+    {
+    return false;
+    }
+
+  worker_p->m_jobs_a[bottom & worker_p->m_mask].store(job_p, std::memory_order_relaxed);
+  std::atomic_thread_fence(std::memory_order_release);
+  worker_p->m_bottom.store(bottom + 1, std::memory_order_relaxed);
+
+  return true;
+  }
+
+//---------------------------------------------------------------------------------------
+// Removes the newest job from the bottom of a worker's queue - only called by the
+// owning worker.
+// # Returns:  job or nullptr if the queue is empty
+// # Modifiers: protected, static
+AJob * AJobSystem::queue_pop(Worker * worker_p)
+  {
+  int64_t bottom = worker_p->m_bottom.load(std::memory_order_relaxed) - 1;
+
+  worker_p->m_bottom.store(bottom, std::memory_order_relaxed);
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+
+  int64_t top = worker_p->m_top.load(std::memory_order_relaxed);
+
+  if (top > bottom)
+    {
+    // Empty
+    worker_p->m_bottom.store(bottom + 1, std::memory_order_relaxed);
+
+    return nullptr;
+    }
+
+  AJob * job_p = worker_p->m_jobs_a[bottom & worker_p->m_mask].load(std::memory_order_relaxed);
+
+  if (top == bottom)
+    {
+    // Last job - race any thieves for it
+    if (!worker_p->m_top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+      {
+      job_p = nullptr;
+      }
+
+    worker_p->m_bottom.store(bottom + 1, std::memory_order_relaxed);
+    }
+
+  return job_p;
+  }
+
+//---------------------------------------------------------------------------------------
+// Removes the oldest job from the top of another worker's queue.
+// # Returns:  job or nullptr if the queue is empty or another thread took the job first
+// # Modifiers: protected, static
+AJob * AJobSystem::queue_steal(Worker * worker_p)
+  {
+  int64_t top = worker_p->m_top.load(std::memory_order_acquire);
+
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+
+  int64_t bottom = worker_p->m_bottom.load(std::memory_order_acquire);
+
+  if (top >= bottom)
+    {
+    return nullptr;
+    }
+
+  AJob * job_p = worker_p->m_jobs_a[top & worker_p->m_mask].load(std::memory_order_acquire);
+
+  if (!worker_p->m_top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+    {
+    return nullptr;
+    }
+
+  return job_p;
+  }
+
+//---------------------------------------------------------------------------------------
+// Job function for parallel_for() sub-ranges
+// # Modifiers: protected, static
+void AJobSystem::invoke_range(void * range_p)
+  {
+  Range * info_p = static_cast<Range *>(range_p);
+
+  (info_p->m_func_p)(info_p->m_data_p, info_p->m_begin, info_p->m_end);
+  }
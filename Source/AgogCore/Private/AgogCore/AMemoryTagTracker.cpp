@@ -0,0 +1,494 @@
+//=======================================================================================
+// Agog Labs C++ library.
+// Copyright (c) 2015 Agog Labs Inc.,
+// All rights reserved.
+//
+// Live allocation tracking per AMemory name tag
+// # Notes:
+//=======================================================================================
+
+
+//=======================================================================================
+// Includes
+//=======================================================================================
+
+#include "AgogCore/AMemoryTagTracker.hpp"
+#include <mutex>     // Uses: std::recursive_mutex
+#include <string.h>
+
+
+//=======================================================================================
+// Local Global Structures
+//=======================================================================================
+
+namespace
+  {
+
+  //---------------------------------------------------------------------------------------
+  // Live allocation table entry - empty if m_mem_p is nullptr
+  struct AMemTagSlot
+    {
+    void *   m_mem_p;
+    size_t   m_size;
+    uint32_t m_tag_idx;
+    };
+
+  //---------------------------------------------------------------------------------------
+  // Tag name pointer cache entry
+  struct AMemTagName
+    {
+    const char * m_name_p;
+    uint32_t     m_tag_idx;
+    };
+
+
+  AMemoryTagInfo g_tags[AMemTag_tag_max];
+  uint32_t       g_tag_count = 0u;
+
+  // Direct mapped cache of name pointer to tag index so names are rarely compared
+  AMemTagName g_name_cache[AMemTag_name_cache_size];
+
+  // Open addressing (linear probing) table of live allocations keyed on address
+  AMemTagSlot * g_slots_a    = nullptr;
+  uint32_t      g_slot_mask  = 0u;
+  uint32_t      g_slot_count = 0u;
+
+  size_t g_bytes_live = 0u;
+
+  // Protects all of the above - allocations may come from any thread.  Recursive since
+  // print_stats() holds it while printing and printing may allocate.
+  std::recursive_mutex g_mutex;
+
+
+  //---------------------------------------------------------------------------------------
+  // Fibonacci hash of a pointer - low bits are dropped since they are usually 0.
+  inline uint32_t hash_ptr(const void * ptr)
+    {
+    return uint32_t((uint64_t(reinterpret_cast<uintptr_t>(ptr) >> 3u) * 0x9E3779B97F4A7C15ull) >> 32u);
+    }
+
+  //---------------------------------------------------------------------------------------
+  // Finds or adds the tag for the specified name.
+  uint32_t get_tag_idx(const char * name_p)
+    {
+    if (name_p == nullptr)
+      {
+      name_p = "(untagged)";
+      }
+
+    AMemTagName & cache = g_name_cache[hash_ptr(name_p) & (AMemTag_name_cache_size - 1u)];
+
+    if (cache.m_name_p == name_p)
+      {
+      return cache.m_tag_idx;
+      }
+
+    // Not cached so compare names
+    size_t   length  = ::strlen(name_p);
+    uint32_t tag_idx = 0u;
+
+    if (length > AMemTag_name_length_max)
+      {
+      length = AMemTag_name_length_max;
+      }
+
+    while ((tag_idx < g_tag_count)
+      && ((::strncmp(g_tags[tag_idx].m_name, name_p, length) != 0) || (g_tags[tag_idx].m_name[length] != '\0')))
+      {
+      tag_idx++;
+      }
+
+    if (tag_idx == g_tag_count)
+      {
+      if (g_tag_count == AMemTag_tag_max)
+        {
+        // Out of tags - lump in with the others
+        tag_idx = AMemTag_tag_max - 1u;
+        }
+      else
+        {
+        AMemoryTagInfo & tag        = g_tags[tag_idx];
+        const char *     tag_name_p = name_p;
+
+        if (tag_idx == (AMemTag_tag_max - 1u))
+          {
+          tag_name_p = "(other)";
+          length     = ::strlen(tag_name_p);
+          }
+
+        ::memcpy(tag.m_name, tag_name_p, length);
+        tag.m_name[length]          = '\0';
+        tag.m_bytes_live            = 0u;
+        tag.m_bytes_peak            = 0u;
+        tag.m_count_live            = 0u;
+        tag.m_alloc_count           = 0u;
+        tag.m_alloc_count_interval  = 0u;
+        g_tag_count++;
+        }
+      }
+
+    cache.m_name_p  = name_p;
+    cache.m_tag_idx = tag_idx;
+
+    return tag_idx;
+    }
+
+  //---------------------------------------------------------------------------------------
+  // Adds an allocation to a table that is known to have a free slot.
+  inline void slot_insert(AMemTagSlot * slots_a, uint32_t mask, void * mem_p, size_t size, uint32_t tag_idx)
+    {
+    uint32_t idx = hash_ptr(mem_p) & mask;
+
+    while (slots_a[idx].m_mem_p)
+      {
+      idx = (idx + 1u) & mask;
+      }
+
+    AMemTagSlot & slot = slots_a[idx];
+
+    slot.m_mem_p   = mem_p;
+    slot.m_size    = size;
+    slot.m_tag_idx = tag_idx;
+    }
+
+  //---------------------------------------------------------------------------------------
+  // Doubles the size of the live allocation table.  Returns false if out of memory.
+  bool slots_grow(tAMallocFunc malloc_func, tAFreeFunc free_func)
+    {
+    uint32_t      size        = g_slots_a ? ((g_slot_mask + 1u) << 1u) : uint32_t(AMemTag_table_initial);
+    AMemTagSlot * new_slots_a = static_cast<AMemTagSlot *>(malloc_func(size * sizeof(AMemTagSlot), "AMemoryTagTracker.table"));
+
+    if (new_slots_a == nullptr)
+      {
+      return false;
+      }
+
+    ::memset(new_slots_a, 0, size * sizeof(AMemTagSlot));
+
+    if (g_slots_a)
+      {
+      AMemTagSlot * slot_p     = g_slots_a;
+      AMemTagSlot * slot_end_p = g_slots_a + g_slot_mask + 1u;
+
+      for (; slot_p < slot_end_p; slot_p++)
+        {
+        if (slot_p->m_mem_p)
+          {
+          slot_insert(new_slots_a, size - 1u, slot_p->m_mem_p, slot_p->m_size, slot_p->m_tag_idx);
+          }
+        }
+
+      free_func(g_slots_a);
+      }
+
+    g_slots_a   = new_slots_a;
+    g_slot_mask = size - 1u;
+
+    return true;
+    }
+
+  //---------------------------------------------------------------------------------------
+  // Removes an allocation from the table and updates its tag.  Returns false if the
+  // allocation is not in the table - i.e. it was made before tracking started.
+  bool slot_remove(void * mem_p)
+    {
+    if (g_slots_a == nullptr)
+      {
+      return false;
+      }
+
+    uint32_t idx = hash_ptr(mem_p) & g_slot_mask;
+
+    while (g_slots_a[idx].m_mem_p != mem_p)
+      {
+      if (g_slots_a[idx].m_mem_p == nullptr)
+        {
+        return false;
+        }
+
+      idx = (idx + 1u) & g_slot_mask;
+      }
+
+    AMemTagSlot &    slot = g_slots_a[idx];
+    AMemoryTagInfo & tag  = g_tags[slot.m_tag_idx];
+
+    tag.m_bytes_live -= slot.m_size;
+    tag.m_count_live--;
+    g_bytes_live     -= slot.m_size;
+    g_slot_count--;
+
+    // Backward shift deletion - move up any following entries that would no longer be
+    // found past the emptied slot.
+    uint32_t next_idx = idx;
+    uint32_t home_idx;
+
+    while (true)
+      {
+      next_idx = (next_idx + 1u) & g_slot_mask;
+
+      if (g_slots_a[next_idx].m_mem_p == nullptr)
+        {
+        break;
+        }
+
+      home_idx = hash_ptr(g_slots_a[next_idx].m_mem_p) & g_slot_mask;
+
+      // Only move entries whose home slot is not cyclically within (idx, next_idx]
+      if (((next_idx - home_idx) & g_slot_mask) >= ((next_idx - idx) & g_slot_mask))
+        {
+        g_slots_a[idx] = g_slots_a[next_idx];
+        idx = next_idx;
+        }
+      }
+
+    g_slots_a[idx].m_mem_p = nullptr;
+
+    return true;
+    }
+
+  }  // End unnamed namespace
+
+
+//=======================================================================================
+// AMemoryTagTracker Class Data
+//=======================================================================================
+
+tAMallocFunc      AMemoryTagTracker::ms_backing_malloc_func        = nullptr;
+tAFreeFunc        AMemoryTagTracker::ms_backing_free_func          = nullptr;
+tAReqByteSizeFunc AMemoryTagTracker::ms_backing_req_byte_size_func = nullptr;
+
+
+//=======================================================================================
+// AMemoryTagTracker Method Definitions
+//=======================================================================================
+
+//---------------------------------------------------------------------------------------
+// Wraps the currently installed AMemory functions so that all subsequent AMemory
+// allocations are tracked.
+//
+// # Notes:
+//   Install any custom allocator first - such as ASlabAllocator or engine functions.
+//
+// # See: deinitialize(), AMemory::override_functions()
+void AMemoryTagTracker::install()
+  {
+  A_ASSERTX(!is_installed(), "AMemoryTagTracker::install() - already installed!");
+
+  ms_backing_malloc_func        = AMemory::get_malloc_func();
+  ms_backing_free_func          = AMemory::get_free_func();
+  ms_backing_req_byte_size_func = AMemory::get_req_byte_size_func();
+
+  AMemory::override_functions(malloc, free, ms_backing_req_byte_size_func);
+  }
+
+//---------------------------------------------------------------------------------------
+// Restores the wrapped AMemory functions and discards all statistics.
+//
+// # Notes:
+//   Since memory is always obtained from the wrapped functions, memory that is still
+//   outstanding remains valid and may be freed afterwards.
+void AMemoryTagTracker::deinitialize()
+  {
+  if (!is_installed())
+    {
+    return;
+    }
+
+  AMemory::override_functions(ms_backing_malloc_func, ms_backing_free_func, ms_backing_req_byte_size_func);
+
+  std::lock_guard<std::recursive_mutex> lock(g_mutex);
+
+  ms_backing_free_func(g_slots_a);
+  ::memset(g_name_cache, 0, sizeof(g_name_cache));
+
+  g_slots_a                     = nullptr;
+  g_slot_mask                   = 0u;
+  g_slot_count                  = 0u;
+  g_tag_count                   = 0u;
+  g_bytes_live                  = 0u;
+  ms_backing_malloc_func        = nullptr;
+  ms_backing_free_func          = nullptr;
+  ms_backing_req_byte_size_func = nullptr;
+  }
+
+//---------------------------------------------------------------------------------------
+// Allocates memory with the wrapped allocator and records it - see tAMallocFunc
+void * AMemoryTagTracker::malloc(size_t size, const char * name_p)
+  {
+  void * mem_p = ms_backing_malloc_func(size, name_p);
+
+  if (mem_p == nullptr)
+    {
+    return nullptr;
+    }
+
+  std::lock_guard<std::recursive_mutex> lock(g_mutex);
+
+  // Keep load at or below 50%
+  if (((g_slot_count + 1u) << 1u) > (g_slots_a ? (g_slot_mask + 1u) : 0u))
+    {
+    if (!slots_grow(ms_backing_malloc_func, ms_backing_free_func))
+      {
+      // Not tracked - will just be passed through when freed
+      return mem_p;
+      }
+    }
+
+  uint32_t         tag_idx = get_tag_idx(name_p);
+  AMemoryTagInfo & tag     = g_tags[tag_idx];
+
+  slot_insert(g_slots_a, g_slot_mask, mem_p, size, tag_idx);
+  g_slot_count++;
+  g_bytes_live += size;
+
+  tag.m_bytes_live += size;
+  tag.m_count_live++;
+  tag.m_alloc_count++;
+  tag.m_alloc_count_interval++;
+
+  if (tag.m_bytes_live > tag.m_bytes_peak)
+    {
+    tag.m_bytes_peak = tag.m_bytes_live;
+    }
+
+  return mem_p;
+  }
+
+//---------------------------------------------------------------------------------------
+// Removes memory from tracking and frees it with the wrapped allocator - see tAFreeFunc
+void AMemoryTagTracker::free(void * mem_p)
+  {
+  if (mem_p == nullptr)
+    {
+    return;
+    }
+
+    {
+    std::lock_guard<std::recursive_mutex> lock(g_mutex);
+
+    slot_remove(mem_p);
+    }
+
+  ms_backing_free_func(mem_p);
+  }
+
+//---------------------------------------------------------------------------------------
+// # Returns: Number of distinct tags seen so far
+uint32_t AMemoryTagTracker::get_tag_count()
+  {
+  return g_tag_count;
+  }
+
+//---------------------------------------------------------------------------------------
+// # Returns: Statistics for tag at specified index (0 to get_tag_count() - 1)
+const AMemoryTagInfo & AMemoryTagTracker::get_tag(uint32_t tag_idx)
+  {
+  A_ASSERTX(tag_idx < g_tag_count, a_cstr_format("AMemoryTagTracker::get_tag(%u) - only %u tags!", tag_idx, g_tag_count));
+
+  return g_tags[tag_idx];
+  }
+
+//---------------------------------------------------------------------------------------
+// # Returns: Statistics for the named tag or nullptr if no such tag has been seen
+const AMemoryTagInfo * AMemoryTagTracker::find_tag(const char * name_p)
+  {
+  std::lock_guard<std::recursive_mutex> lock(g_mutex);
+
+  for (uint32_t tag_idx = 0u; tag_idx < g_tag_count; tag_idx++)
+    {
+    if (::strcmp(g_tags[tag_idx].m_name, name_p) == 0)
+      {
+      return &g_tags[tag_idx];
+      }
+    }
+
+  return nullptr;
+  }
+
+//---------------------------------------------------------------------------------------
+// # Returns: Number of bytes in all tracked live allocations
+size_t AMemoryTagTracker::get_bytes_live()
+  {
+  return g_bytes_live;
+  }
+
+//---------------------------------------------------------------------------------------
+// # Returns: Number of tracked live allocations
+uint32_t AMemoryTagTracker::get_count_live()
+  {
+  return g_slot_count;
+  }
+
+//---------------------------------------------------------------------------------------
+// Starts a new interval for AMemoryTagInfo::m_alloc_count_interval - for example once a
+// frame or each time stats are printed.
+void AMemoryTagTracker::reset_interval()
+  {
+  std::lock_guard<std::recursive_mutex> lock(g_mutex);
+
+  for (uint32_t tag_idx = 0u; tag_idx < g_tag_count; tag_idx++)
+    {
+    g_tags[tag_idx].m_alloc_count_interval = 0u;
+    }
+  }
+
+//---------------------------------------------------------------------------------------
+// Prints out tags with live allocations or allocations since the last print, largest
+// live bytes first, to the default output and then starts a new interval.
+//
+// # Notes: Can be registered with SSDebug::set_print_memory_ext_func() via an AFunction.
+void AMemoryTagTracker::print_stats()
+  {
+  std::lock_guard<std::recursive_mutex> lock(g_mutex);
+
+  // Sort tag indexes by live bytes - insertion sort is fine for a debug dump
+  uint16_t order_a[AMemTag_tag_max];
+  uint32_t order_count = 0u;
+  uint32_t pos;
+
+  for (uint32_t tag_idx = 0u; tag_idx < g_tag_count; tag_idx++)
+    {
+    const AMemoryTagInfo & tag = g_tags[tag_idx];
+
+    if (tag.m_count_live || tag.m_alloc_count_interval)
+      {
+      pos = order_count;
+
+      while ((pos > 0u) && (g_tags[order_a[pos - 1u]].m_bytes_live < tag.m_bytes_live))
+        {
+        order_a[pos] = order_a[pos - 1u];
+        pos--;
+        }
+
+      order_a[pos] = uint16_t(tag_idx);
+      order_count++;
+      }
+    }
+
+  ADebug::print(
+    "\nLive allocations by AMemory tag (allocs since last print):\n"
+    "   Live bytes |   Peak bytes |   Count |   Allocs | Tag\n"
+    "--------------+--------------+---------+----------+----------------\n");
+
+  for (pos = 0u; pos < order_count; pos++)
+    {
+    const AMemoryTagInfo & tag = g_tags[order_a[pos]];
+
+    ADebug::print_format(
+      " %12llu | %12llu | %7u | %8u | %s\n",
+      (unsigned long long)tag.m_bytes_live,
+      (unsigned long long)tag.m_bytes_peak,
+      tag.m_count_live,
+      tag.m_alloc_count_interval,
+      tag.m_name);
+    }
+
+  ADebug::print_format(
+    "--------------+--------------+---------+----------+----------------\n"
+    "  Tags: %u  Live bytes: %llu  Live allocs: %u\n\n",
+    g_tag_count,
+    (unsigned long long)g_bytes_live,
+    g_slot_count);
+
+  reset_interval();
+  }
@@ -0,0 +1,293 @@
+//=======================================================================================
+// Agog Labs C++ library.
+// Copyright (c) 2015 Agog Labs Inc.,
+// All rights reserved.
+//
+// Recorded object pool high-water marks used to pre-size pools
+// # Notes:
+//=======================================================================================
+
+
+//=======================================================================================
+// Includes
+//=======================================================================================
+
+#include "AgogCore/AObjPoolProfile.hpp"
+#include "AgogCore/AString.hpp"
+
+
+//=======================================================================================
+// AObjPoolProfile Class Data
+//=======================================================================================
+
+AObjPoolProfile::Entry AObjPoolProfile::ms_entries[AObjPoolProfile_entry_max];
+uint32_t               AObjPoolProfile::ms_entry_count = 0u;
+
+
+//=======================================================================================
+// AObjPoolProfile Method Definitions
+//=======================================================================================
+
+//---------------------------------------------------------------------------------------
+// # Returns:  recorded high-water mark of named pool or 0 if it is not in the profile
+// Arg         name_p - name of pool
+uint32_t AObjPoolProfile::get_count(const char * name_p)
+  {
+  Entry * entry_p = get_entry(name_p, ALength_calculate, false);
+
+  return entry_p ? entry_p->m_count : 0u;
+  }
+
+//---------------------------------------------------------------------------------------
+// Sets the recorded high-water mark of the named pool - adding it if needed
+// Arg         name_p - name of pool
+// Arg         count - number of objects to record
+void AObjPoolProfile::set_count(
+  const char * name_p,
+  uint32_t     count
+  )
+  {
+  Entry * entry_p = get_entry(name_p, ALength_calculate, true);
+
+  if (entry_p)
+    {
+    entry_p->m_count = count;
+    }
+  }
+
+//---------------------------------------------------------------------------------------
+// Raises the recorded count of each registered pool to its current high-water mark.
+// Counts are never lowered so a profile accumulates the peaks of several sessions.
+// # See:      as_string()
+void AObjPoolProfile::update_counts()
+  {
+  uint32_t count;
+  Entry *  entry_p     = ms_entries;
+  Entry *  entry_end_p = ms_entries + ms_entry_count;
+
+  for (; entry_p < entry_end_p; entry_p++)
+    {
+    if (entry_p->m_pool_p)
+      {
+      count = (entry_p->m_count_max_f)(entry_p->m_pool_p);
+
+      if (count > entry_p->m_count)
+        {
+        entry_p->m_count = count;
+        }
+      }
+    }
+  }
+
+//---------------------------------------------------------------------------------------
+// Removes all recorded counts and registered pools - registered pools get back the grow
+// callback they had before they were registered.
+void AObjPoolProfile::empty()
+  {
+  Entry * entry_p     = ms_entries;
+  Entry * entry_end_p = ms_entries + ms_entry_count;
+
+  for (; entry_p < entry_end_p; entry_p++)
+    {
+    if (entry_p->m_restore_grow_f)
+      {
+      (entry_p->m_restore_grow_f)(*entry_p);
+      }
+    }
+
+  ms_entry_count = 0u;
+  }
+
+//---------------------------------------------------------------------------------------
+// Appends the profile in text form - suitable for saving to file and later parse().
+// Arg         str_p - string to append to
+// # See:      parse(), update_counts()
+void AObjPoolProfile::as_string(AString * str_p)
+  {
+  str_p->append("// Object pool high-water marks - name count\n");
+
+  Entry * entry_p     = ms_entries;
+  Entry * entry_end_p = ms_entries + ms_entry_count;
+
+  for (; entry_p < entry_end_p; entry_p++)
+    {
+    str_p->append_format("%s %u\n", entry_p->m_name, entry_p->m_count);
+    }
+  }
+
+//---------------------------------------------------------------------------------------
+// Loads counts from profile text created by as_string().  Loaded counts replace any
+// counts already recorded for the same pools.
+// # Returns:  number of pool counts loaded
+// Arg         cstr_p - profile text - need not be null terminated
+// Arg         length - number of characters in cstr_p
+// # See:      as_string(), register_pool()
+// # Notes:    Malformed lines are skipped.  If a pool was already registered its newly
+//             loaded count is not reserved until it is registered again.
+uint32_t AObjPoolProfile::parse(
+  const char * cstr_p,
+  uint32_t     length
+  )
+  {
+  uint32_t     loaded    = 0u;
+  const char * end_p     = cstr_p + length;
+  const char * name_p;
+  uint32_t     name_length;
+  uint32_t     count;
+  Entry *      entry_p;
+
+  while (cstr_p < end_p)
+    {
+    // Skip whitespace and blank lines
+    while ((cstr_p < end_p) && (*cstr_p <= ' '))
+      {
+      cstr_p++;
+      }
+
+    name_p = cstr_p;
+
+    while ((cstr_p < end_p) && (*cstr_p > ' '))
+      {
+      cstr_p++;
+      }
+
+    name_length = uint32_t(cstr_p - name_p);
+
+    // Skip spaces between name and count
+    while ((cstr_p < end_p) && ((*cstr_p == ' ') || (*cstr_p == '\t')))
+      {
+      cstr_p++;
+      }
+
+    count = 0u;
+
+    if ((name_length >= 2u) && (name_p[0] == '/') && (name_p[1] == '/'))
+      {
+      // Comment
+      name_length = 0u;
+      }
+    else
+      {
+      if ((cstr_p == end_p) || (*cstr_p < '0') || (*cstr_p > '9'))
+        {
+        // Missing count
+        name_length = 0u;
+        }
+
+      while ((cstr_p < end_p) && (*cstr_p >= '0') && (*cstr_p <= '9'))
+        {
+        count = (count * 10u) + uint32_t(*cstr_p - '0');
+        cstr_p++;
+        }
+      }
+
+    if (name_length)
+      {
+      entry_p = get_entry(name_p, name_length, true);
+
+      if (entry_p)
+        {
+        entry_p->m_count = count;
+        loaded++;
+        }
+      }
+
+    // Skip to next line
+    while ((cstr_p < end_p) && (*cstr_p != '\n'))
+      {
+      cstr_p++;
+      }
+    }
+
+  return loaded;
+  }
+
+//---------------------------------------------------------------------------------------
+// Finds the entry for the named pool - optionally adding it if it is not found.
+// # Returns:  entry or nullptr if not found and not created.
+// Arg         name_p - name of pool
+// Arg         length - number of characters in name_p or ALength_calculate if it is null
+//             terminated.  Names longer than AObjPoolProfile_name_length_max are truncated.
+// Arg         create_b - if true add an entry with a count of 0 if not found
+AObjPoolProfile::Entry * AObjPoolProfile::get_entry(
+  const char * name_p,
+  uint32_t     length,
+  bool         create_b
+  )
+  {
+  if (length == ALength_calculate)
+    {
+    length = uint32_t(::strlen(name_p));
+    }
+
+  if (length > AObjPoolProfile_name_length_max)
+    {
+    length = AObjPoolProfile_name_length_max;
+    }
+
+  Entry * entry_p     = ms_entries;
+  Entry * entry_end_p = ms_entries + ms_entry_count;
+
+  for (; entry_p < entry_end_p; entry_p++)
+    {
+    if ((::strncmp(entry_p->m_name, name_p, length) == 0) && (entry_p->m_name[length] == '\0'))
+      {
+      return entry_p;
+      }
+    }
+
+  if (!create_b)
+    {
+    return nullptr;
+    }
+
+  A_VERIFY(
+    ms_entry_count < AObjPoolProfile_entry_max,
+    a_cstr_format("Too many pools in profile - only %u allowed!", AObjPoolProfile_entry_max),
+    AErrId_generic,
+    AObjPoolProfile);
+
+  if (ms_entry_count == AObjPoolProfile_entry_max)
+    {
+    return nullptr;
+    }
+
+  ms_entry_count++;
+  ::memcpy(entry_p->m_name, name_p, length);
+  entry_p->m_name[length]   = '\0';
+  entry_p->m_count          = 0u;
+  entry_p->m_pool_p         = nullptr;
+  entry_p->m_count_max_f    = nullptr;
+  entry_p->m_prev_grow_f    = nullptr;
+  entry_p->m_restore_grow_f = nullptr;
+
+  return entry_p;
+  }
+
+//---------------------------------------------------------------------------------------
+// Reports growth of a registered pool - called via AObjReusePool::m_grow_f
+// # Returns:  grow callback the pool had before it was registered or nullptr
+// Arg         pool_p - pool that is about to grow
+// Arg         capacity - number of objects pool had room for prior to growing
+AObjPoolProfile::tGrowFuncGeneric AObjPoolProfile::on_grow(
+  const void * pool_p,
+  uint32_t     capacity
+  )
+  {
+  Entry * entry_p     = ms_entries;
+  Entry * entry_end_p = ms_entries + ms_entry_count;
+
+  for (; entry_p < entry_end_p; entry_p++)
+    {
+    if (entry_p->m_pool_p == pool_p)
+      {
+      A_DPRINT(
+        "AObjPoolProfile - pool '%s' growing past %u objects (profile has %u)\n",
+        entry_p->m_name, capacity, entry_p->m_count);
+
+      return entry_p->m_prev_grow_f;
+      }
+    }
+
+  return nullptr;
+  }
@@ -0,0 +1,169 @@
+//=======================================================================================
+// Agog Labs C++ library.
+// Copyright (c) 2015 Agog Labs Inc.,
+// All rights reserved.
+//
+//  Thread-safe Object Reuse Pool class template
+// # Notes:
+//=======================================================================================
+
+
+//=======================================================================================
+// Includes
+//=======================================================================================
+
+#include "AgogCore/AObjReusePoolMT.hpp"
+
+#if defined(A_PLAT_PC) || defined(A_PLAT_X_ONE)
+  #include <windows.h>   // Uses: FlsAlloc(), FlsSetValue()
+  #define AORPOOLMT_THREAD_EXIT_FLS
+#elif defined(A_PLAT_LINUX64) || defined(A_PLAT_OSX) || defined(A_PLAT_iOS) || defined(A_PLAT_PS4)
+  #include <pthread.h>   // Uses: pthread_key_create(), pthread_setspecific()
+  #define AORPOOLMT_THREAD_EXIT_PTHREAD
+#endif
+
+
+//=======================================================================================
+// Local Global Structures
+//=======================================================================================
+
+namespace
+  {
+
+  // Thread indexes released by exited threads - protected by g_thread_idx_mutex
+  uint32_t   g_free_idxs[AORPoolMT_thread_max];
+  uint32_t   g_free_idx_count = 0u;
+  std::mutex g_thread_idx_mutex;
+
+  #if defined(AORPOOLMT_THREAD_EXIT_FLS)
+
+    DWORD          g_thread_exit_key = FLS_OUT_OF_INDEXES;
+    std::once_flag g_thread_exit_once;
+
+    //-------------------------------------------------------------------------------------
+    // Called when a thread that was given an index exits
+    VOID WINAPI on_thread_exit(PVOID value_p)
+      {
+      if (value_p)
+        {
+        AObjReusePoolMTBase::release_thread_idx(uint32_t(reinterpret_cast<uintptr_t>(value_p)) - 1u);
+        }
+      }
+
+    //-------------------------------------------------------------------------------------
+    // Arranges for the index of the calling thread to be released when it exits
+    void watch_thread_exit(uint32_t idx)
+      {
+      std::call_once(g_thread_exit_once, []() { g_thread_exit_key = FlsAlloc(on_thread_exit); });
+
+      if (g_thread_exit_key != FLS_OUT_OF_INDEXES)
+        {
+        FlsSetValue(g_thread_exit_key, reinterpret_cast<PVOID>(uintptr_t(idx) + 1u));
+        }
+      }
+
+  #elif defined(AORPOOLMT_THREAD_EXIT_PTHREAD)
+
+    pthread_key_t  g_thread_exit_key;
+    bool           g_thread_exit_key_valid = false;
+    std::once_flag g_thread_exit_once;
+
+    //-------------------------------------------------------------------------------------
+    // Called when a thread that was given an index exits
+    void on_thread_exit(void * value_p)
+      {
+      AObjReusePoolMTBase::release_thread_idx(uint32_t(reinterpret_cast<uintptr_t>(value_p)) - 1u);
+      }
+
+    //-------------------------------------------------------------------------------------
+    // Arranges for the index of the calling thread to be released when it exits
+    void watch_thread_exit(uint32_t idx)
+      {
+      std::call_once(g_thread_exit_once, []() { g_thread_exit_key_valid = (pthread_key_create(&g_thread_exit_key, on_thread_exit) == 0); });
+
+      if (g_thread_exit_key_valid)
+        {
+        pthread_setspecific(g_thread_exit_key, reinterpret_cast<void *>(uintptr_t(idx) + 1u));
+        }
+      }
+
+  #else
+
+    //-------------------------------------------------------------------------------------
+    // No thread exit notification on this platform - indexes are not recycled
+    void watch_thread_exit(uint32_t /*idx*/)
+      {
+      }
+
+  #endif
+
+  }  // End unnamed namespace
+
+
+//=======================================================================================
+// AObjReusePoolMTBase Class Data
+//=======================================================================================
+
+A_THREAD_LOCAL uint32_t AObjReusePoolMTBase::ms_thread_idx = 0u;
+std::atomic<uint32_t>   AObjReusePoolMTBase::ms_thread_count(0u);
+
+
+//=======================================================================================
+// AObjReusePoolMTBase Method Definitions
+//=======================================================================================
+
+//---------------------------------------------------------------------------------------
+// Hands out a thread index to the calling thread the first time it uses any thread-safe
+// pool - reusing the index of an exited thread if there is one.
+// # Returns:  0-based index of calling thread
+// # See:      get_thread_idx(), release_thread_idx()
+uint32_t AObjReusePoolMTBase::assign_thread_idx()
+  {
+  uint32_t idx;
+
+  g_thread_idx_mutex.lock();
+
+  if (g_free_idx_count)
+    {
+    g_free_idx_count--;
+    idx = g_free_idxs[g_free_idx_count];
+    }
+  else
+    {
+    idx = ms_thread_count.fetch_add(1u, std::memory_order_relaxed);
+    }
+
+  g_thread_idx_mutex.unlock();
+
+  ms_thread_idx = idx + 1u;
+
+  // Only indexes with their own cache are worth recycling
+  if (idx < AORPoolMT_thread_max)
+    {
+    watch_thread_exit(idx);
+    }
+
+  return idx;
+  }
+
+//---------------------------------------------------------------------------------------
+// Makes the index of the calling thread available to the next new thread - must only be
+// called by a thread that is exiting.  Called automatically on thread exit where the
+// platform supports it.
+// Arg         idx - 0-based index of exiting thread
+// # Notes:    Any objects left in the per-thread caches of the exited thread are used by
+//             the thread that is given its index next.
+void AObjReusePoolMTBase::release_thread_idx(uint32_t idx)
+  {
+  ms_thread_idx = 0u;
+
+  g_thread_idx_mutex.lock();
+
+  if (g_free_idx_count < AORPoolMT_thread_max)
+    {
+    g_free_idxs[g_free_idx_count] = idx;
+    g_free_idx_count++;
+    }
+
+  g_thread_idx_mutex.unlock();
+  }
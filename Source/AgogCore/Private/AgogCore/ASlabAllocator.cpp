@@ -0,0 +1,495 @@
+//=======================================================================================
+// Agog Labs C++ library.
+// Copyright (c) 2015 Agog Labs Inc.,
+// All rights reserved.
+//
+// Size-class slab allocator that may be plugged into AMemory
+// # Notes:
+//=======================================================================================
+
+
+//=======================================================================================
+// Includes
+//=======================================================================================
+
+#include "AgogCore/ASlabAllocator.hpp"
+#include <atomic>  // Uses: std::atomic
+#include <mutex>   // Uses: std::mutex, std::lock_guard
+
+
+//=======================================================================================
+// Local Global Structures
+//=======================================================================================
+
+namespace
+  {
+
+  //---------------------------------------------------------------------------------------
+  // Contiguous block of ASlab_region_pages pages obtained from the backing allocator
+  struct ASlabRegion
+    {
+    // Page aligned start of region memory
+    uint8_t * m_mem_p;
+
+    // Pointer originally returned by backing allocator (may be before m_mem_p)
+    void * m_alloc_p;
+
+    // Number of pages that have been handed out to size classes so far
+    uint32_t m_pages_used;
+
+    // Size class index of each page
+    uint8_t m_page_class[ASlab_region_pages];
+    };
+
+  //---------------------------------------------------------------------------------------
+  // Bookkeeping for a single size class
+  struct ASlabClass
+    {
+    // Intrusive singly linked list of freed objects - next pointer stored in object
+    void * m_free_p;
+
+    // Never used space remaining in the most recently acquired page
+    uint8_t * m_carve_p;
+    uint8_t * m_carve_end_p;
+
+    // Byte size of objects in this class
+    uint32_t m_size;
+
+    // Number of objects currently handed out
+    uint32_t m_count_used;
+
+    // Peak of m_count_used
+    uint32_t m_count_max;
+
+    // Number of pages acquired
+    uint32_t m_page_count;
+
+    // Guards all of the above other than m_size
+    std::mutex m_mutex;
+    };
+
+
+  // Byte size of each size class - 16 byte steps to 128 then 4 steps per power of 2
+  const uint32_t g_class_sizes[ASlab_class_count] =
+    {
+      16u,   32u,   48u,   64u,   80u,   96u,  112u,  128u,
+     160u,  192u,  224u,  256u,  320u,  384u,  448u,  512u,
+     640u,  768u,  896u, 1024u, 1280u, 1536u, 1792u, 2048u
+    };
+
+  // Maps ((size + 15) >> 4) to its size class index
+  uint8_t g_size_to_class[(ASlab_size_max >> 4u) + 1u];
+
+  ASlabClass g_classes[ASlab_class_count];
+
+  // Regions sorted by address so pointer ownership can be found with a binary search
+  ASlabRegion * g_regions[ASlab_region_max];
+  uint32_t      g_region_count = 0u;
+
+  // Most recently added region - it is the only one with pages not yet handed out since
+  // pages are never given back to a region.
+  ASlabRegion * g_region_carve_p = nullptr;
+
+  // Guards g_regions, g_region_count, g_region_carve_p and the regions themselves.
+  // A size class lock may be held while taking it, but never the other way around.
+  std::mutex g_region_mutex;
+
+  // Small requests that had to go to the backing allocator since regions ran out
+  std::atomic<uint32_t> g_overflow_count(0u);
+
+
+  //---------------------------------------------------------------------------------------
+  // Finds region containing specified memory or nullptr if it was not slab allocated.
+  // g_region_mutex must be locked by the caller.
+  inline ASlabRegion * find_region(const void * mem_p)
+    {
+    const uint8_t * byte_p = static_cast<const uint8_t *>(mem_p);
+    uint32_t        first  = 0u;
+    uint32_t        last   = g_region_count;
+    uint32_t        middle;
+
+    // Find first region that starts after mem_p
+    while (first < last)
+      {
+      middle = (first + last) >> 1u;
+
+      if (byte_p < g_regions[middle]->m_mem_p)
+        {
+        last = middle;
+        }
+      else
+        {
+        first = middle + 1u;
+        }
+      }
+
+    if (first == 0u)
+      {
+      return nullptr;
+      }
+
+    ASlabRegion * region_p = g_regions[first - 1u];
+
+    return (byte_p < (region_p->m_mem_p + ASlab_region_bytes)) ? region_p : nullptr;
+    }
+
+  //---------------------------------------------------------------------------------------
+  // Gets a new region from the backing allocator and adds it to the sorted region list.
+  // g_region_mutex must be locked by the caller.
+  ASlabRegion * append_region(tAMallocFunc malloc_func, tAFreeFunc free_func)
+    {
+    if (g_region_count >= ASlab_region_max)
+      {
+      return nullptr;
+      }
+
+    ASlabRegion * region_p = static_cast<ASlabRegion *>(malloc_func(sizeof(ASlabRegion), "ASlabRegion"));
+
+    if (region_p == nullptr)
+      {
+      return nullptr;
+      }
+
+    // Over-allocate by a page so that the region can be page aligned
+    void * alloc_p = malloc_func(ASlab_region_bytes + ASlab_page_bytes, "ASlabRegion.pages");
+
+    if (alloc_p == nullptr)
+      {
+      free_func(region_p);
+
+      return nullptr;
+      }
+
+    region_p->m_alloc_p    = alloc_p;
+    region_p->m_mem_p      = reinterpret_cast<uint8_t *>((reinterpret_cast<uintptr_t>(alloc_p) + (ASlab_page_bytes - 1u)) & ~uintptr_t(ASlab_page_bytes - 1u));
+    region_p->m_pages_used = 0u;
+
+    // Insert sorted by address
+    uint32_t idx = g_region_count;
+
+    while ((idx > 0u) && (g_regions[idx - 1u]->m_mem_p > region_p->m_mem_p))
+      {
+      g_regions[idx] = g_regions[idx - 1u];
+      idx--;
+      }
+
+    g_regions[idx] = region_p;
+    g_region_count++;
+
+    return region_p;
+    }
+
+  //---------------------------------------------------------------------------------------
+  // Gives the specified size class a fresh page to carve objects from.
+  // Returns false if no more pages are available.
+  // The lock of the size class must be held by the caller.
+  bool append_page(uint32_t class_idx, tAMallocFunc malloc_func, tAFreeFunc free_func)
+    {
+    std::lock_guard<std::mutex> lock(g_region_mutex);
+
+    if ((g_region_carve_p == nullptr) || (g_region_carve_p->m_pages_used >= ASlab_region_pages))
+      {
+      g_region_carve_p = append_region(malloc_func, free_func);
+
+      if (g_region_carve_p == nullptr)
+        {
+        return false;
+        }
+      }
+
+    uint32_t     page_idx = g_region_carve_p->m_pages_used++;
+    ASlabClass & slab     = g_classes[class_idx];
+
+    g_region_carve_p->m_page_class[page_idx] = uint8_t(class_idx);
+    slab.m_carve_p     = g_region_carve_p->m_mem_p + (page_idx << ASlab_page_shift);
+    slab.m_carve_end_p = slab.m_carve_p + ASlab_page_bytes;
+    slab.m_page_count++;
+
+    return true;
+    }
+
+  }  // End unnamed namespace
+
+
+//=======================================================================================
+// ASlabAllocator Class Data
+//=======================================================================================
+
+tAMallocFunc ASlabAllocator::ms_backing_malloc_func = nullptr;
+tAFreeFunc   ASlabAllocator::ms_backing_free_func   = nullptr;
+
+tAMallocFunc      ASlabAllocator::ms_prev_malloc_func        = nullptr;
+tAFreeFunc        ASlabAllocator::ms_prev_free_func          = nullptr;
+tAReqByteSizeFunc ASlabAllocator::ms_prev_req_byte_size_func = nullptr;
+
+
+//=======================================================================================
+// ASlabAllocator Method Definitions
+//=======================================================================================
+
+//---------------------------------------------------------------------------------------
+// Sets up size classes and registers the slab allocator with AMemory so that all
+// subsequent AMemory allocations go through it.
+//
+// # Params:
+//   backing_malloc_func:
+//     allocator used to get regions and for requests larger than ASlab_size_max - defaults
+//     to the current AMemory function so any allocator installed earlier is layered on
+//   backing_free_func: counterpart to backing_malloc_func
+//
+// # See: deinitialize(), AMemory::override_functions()
+void ASlabAllocator::install(
+  tAMallocFunc backing_malloc_func, // = AMemory::get_malloc_func()
+  tAFreeFunc   backing_free_func    // = AMemory::get_free_func()
+  )
+  {
+  A_ASSERTX(!is_installed(), "ASlabAllocator::install() - already installed!");
+
+  ms_backing_malloc_func     = backing_malloc_func;
+  ms_backing_free_func       = backing_free_func;
+  ms_prev_malloc_func        = AMemory::get_malloc_func();
+  ms_prev_free_func          = AMemory::get_free_func();
+  ms_prev_req_byte_size_func = AMemory::get_req_byte_size_func();
+
+  // Build size to size class lookup
+  uint32_t class_idx = 0u;
+
+  for (uint32_t step = 0u; step <= (ASlab_size_max >> 4u); step++)
+    {
+    while (g_class_sizes[class_idx] < (step << 4u))
+      {
+      class_idx++;
+      }
+
+    g_size_to_class[step] = uint8_t(class_idx);
+    }
+
+  for (class_idx = 0u; class_idx < ASlab_class_count; class_idx++)
+    {
+    ASlabClass & slab = g_classes[class_idx];
+
+    slab.m_free_p      = nullptr;
+    slab.m_carve_p     = nullptr;
+    slab.m_carve_end_p = nullptr;
+    slab.m_size        = g_class_sizes[class_idx];
+    slab.m_count_used  = 0u;
+    slab.m_count_max   = 0u;
+    slab.m_page_count  = 0u;
+    }
+
+  AMemory::override_functions(malloc, free, request_byte_size);
+  }
+
+//---------------------------------------------------------------------------------------
+// Releases all regions back to the backing allocator and restores the AMemory functions
+// that were in place before install().
+//
+// # Notes:
+//   Any memory still outstanding from the slab allocator becomes invalid so this should
+//   only be called at shutdown after everything allocated through AMemory is freed.
+void ASlabAllocator::deinitialize()
+  {
+  if (!is_installed())
+    {
+    return;
+    }
+
+  AMemory::override_functions(ms_prev_malloc_func, ms_prev_free_func, ms_prev_req_byte_size_func);
+
+  for (uint32_t idx = 0u; idx < g_region_count; idx++)
+    {
+    ms_backing_free_func(g_regions[idx]->m_alloc_p);
+    ms_backing_free_func(g_regions[idx]);
+    }
+
+  g_region_count             = 0u;
+  g_region_carve_p           = nullptr;
+  g_overflow_count           = 0u;
+  ms_backing_malloc_func     = nullptr;
+  ms_backing_free_func       = nullptr;
+  ms_prev_malloc_func        = nullptr;
+  ms_prev_free_func          = nullptr;
+  ms_prev_req_byte_size_func = nullptr;
+  }
+
+//---------------------------------------------------------------------------------------
+// Allocates memory - see tAMallocFunc
+//
+// # Returns: memory at least `size` bytes large (actual size is request_byte_size(size))
+void * ASlabAllocator::malloc(size_t size, const char * name_p)
+  {
+  if (size > ASlab_size_max)
+    {
+    return ms_backing_malloc_func(size, name_p);
+    }
+
+  uint32_t     class_idx = g_size_to_class[(uint32_t(size) + 15u) >> 4u];
+  ASlabClass & slab      = g_classes[class_idx];
+
+  std::lock_guard<std::mutex> lock(slab.m_mutex);
+
+  void * mem_p = slab.m_free_p;
+
+  if (mem_p)
+    {
+    slab.m_free_p = *static_cast<void **>(mem_p);
+    }
+  else
+    {
+    if (uint32_t(slab.m_carve_end_p - slab.m_carve_p) < slab.m_size)
+      {
+      if (!append_page(class_idx, ms_backing_malloc_func, ms_backing_free_func))
+        {
+        // Out of regions - use size class size so request_byte_size() is still valid
+        g_overflow_count++;
+
+        return ms_backing_malloc_func(slab.m_size, name_p);
+        }
+      }
+
+    mem_p = slab.m_carve_p;
+    slab.m_carve_p += slab.m_size;
+    }
+
+  slab.m_count_used++;
+
+  if (slab.m_count_used > slab.m_count_max)
+    {
+    slab.m_count_max = slab.m_count_used;
+    }
+
+  return mem_p;
+  }
+
+//---------------------------------------------------------------------------------------
+// Frees memory - see tAFreeFunc
+//
+// # Notes:
+//   Memory not from a slab region (large requests or memory allocated before install())
+//   is given to the backing free function.
+void ASlabAllocator::free(void * mem_p)
+  {
+  if (mem_p == nullptr)
+    {
+    return;
+    }
+
+  uint32_t class_idx = 0u;
+
+  // Regions and the size class of their handed out pages never change while installed,
+  // so the region lock is not needed once the size class is known.
+  g_region_mutex.lock();
+
+  ASlabRegion * region_p = find_region(mem_p);
+
+  if (region_p)
+    {
+    class_idx = region_p->m_page_class[uint32_t((static_cast<uint8_t *>(mem_p) - region_p->m_mem_p) >> ASlab_page_shift)];
+    }
+
+  g_region_mutex.unlock();
+
+  if (region_p == nullptr)
+    {
+    ms_backing_free_func(mem_p);
+
+    return;
+    }
+
+  ASlabClass & slab = g_classes[class_idx];
+
+  std::lock_guard<std::mutex> lock(slab.m_mutex);
+
+  *static_cast<void **>(mem_p) = slab.m_free_p;
+  slab.m_free_p = mem_p;
+  slab.m_count_used--;
+  }
+
+//---------------------------------------------------------------------------------------
+// Converts the size requested to allocate to the actual amount allocated - i.e. the byte
+// size of the size class that the request falls into.
+//
+// # Returns: Actual amount allocated (in bytes)
+// # See:     AMemory::request_byte_size()
+uint32_t ASlabAllocator::request_byte_size(uint32_t size_requested)
+  {
+  return (size_requested > ASlab_size_max)
+    ? size_requested
+    : g_class_sizes[g_size_to_class[(size_requested + 15u) >> 4u]];
+  }
+
+//---------------------------------------------------------------------------------------
+// # Returns: Number of bytes in all regions obtained from the backing allocator
+uint32_t ASlabAllocator::get_bytes_reserved()
+  {
+  return get_region_count() * ASlab_region_bytes;
+  }
+
+//---------------------------------------------------------------------------------------
+// # Returns: Number of bytes currently handed out from slab pages (rounded to class size)
+uint32_t ASlabAllocator::get_bytes_used()
+  {
+  uint32_t bytes = 0u;
+
+  for (uint32_t class_idx = 0u; class_idx < ASlab_class_count; class_idx++)
+    {
+    ASlabClass & slab = g_classes[class_idx];
+
+    std::lock_guard<std::mutex> lock(slab.m_mutex);
+
+    bytes += slab.m_count_used * slab.m_size;
+    }
+
+  return bytes;
+  }
+
+//---------------------------------------------------------------------------------------
+// # Returns: Number of regions obtained from the backing allocator
+uint32_t ASlabAllocator::get_region_count()
+  {
+  std::lock_guard<std::mutex> lock(g_region_mutex);
+
+  return g_region_count;
+  }
+
+//---------------------------------------------------------------------------------------
+// Prints out usage per size class to the default output.
+void ASlabAllocator::print_stats()
+  {
+  ADebug::print(
+    "\nSlab allocator size classes:\n"
+    "   Size |     Used |     Peak |  Pages |  Reserved\n"
+    "--------+----------+----------+--------+----------\n");
+
+  for (uint32_t class_idx = 0u; class_idx < ASlab_class_count; class_idx++)
+    {
+    ASlabClass & slab = g_classes[class_idx];
+
+    slab.m_mutex.lock();
+
+    uint32_t count_used = slab.m_count_used;
+    uint32_t count_max  = slab.m_count_max;
+    uint32_t page_count = slab.m_page_count;
+
+    slab.m_mutex.unlock();
+
+    if (page_count)
+      {
+      ADebug::print_format(
+        "  %5u | %8u | %8u | %6u | %9u\n",
+        slab.m_size,
+        count_used,
+        count_max,
+        page_count,
+        page_count * ASlab_page_bytes);
+      }
+    }
+
+  ADebug::print_format(
+    "--------+----------+----------+--------+----------\n"
+    "  Regions: %u  Reserved: %u  Used: %u  Overflow allocs: %u\n\n",
+    get_region_count(),
+    get_bytes_reserved(),
+    get_bytes_used(),
+    g_overflow_count.load());
+  }
@@ -30,4749 +30,6478 @@
 
 
 //=======================================================================================
-// AString Class Data Members
+// Local Macros / Defines
 //=======================================================================================
 
-// Defined in AgogCore/AgogCore.cpp
+// SSE2 is always present on x64 and is the default target on x86 for current compilers
+#if !defined(A_NO_SSE) && (defined(_M_X64) || defined(__SSE2__) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2)))
+  #define A_STR_SSE2
+  #include <emmintrin.h>  // Uses:  _mm_cmpeq_epi8(), _mm_movemask_epi8(), etc.
+  #ifdef _MSC_VER
+    #include <intrin.h>   // Uses:  _BitScanForward(), _BitScanReverse()
+  #endif
+#endif
 
 
 //=======================================================================================
-// Method Definitions
+// Local Global Structures
 //=======================================================================================
 
-//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
-// Converter methods
-//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+namespace
+{
 
-//---------------------------------------------------------------------------------------
-// Constructor from character array buffer.  Refers to a persistent
-//             null-terminated C-String or makes its own copy of an existing character
-//             array.
-// # Returns:  itself
-// Arg         cstr_p - pointer to array of characters.  'cstr_p' should never be nullptr.
-//             'cstr_p' will usually be a string literal or if 'persistent' is false,
-//             'cstr_p' may be any C-String that this string should make a copy of.
-// Arg         persistent - Indicates whether the data pointed to by cstr_p will be
-//             available for the lifetime of this string.  If 'persistent' is true, the
-//             memory pointed to by 'cstr_p' will be used rather than having this object
-//             allocate its own memory - also the memory pointed to by 'cstr_p' will not
-//             be written to.  If 'persistent' is false, then this AString object will
-//             allocate its own memory and copy the contents of 'cstr_p' to it.
-//             (Default true)
-// # See:      AString(cstr_p), AString(buffer_p, size, length, deallocate)
-// # Notes:    If any modifying methods are called on this string, it will first make
-//             its own unique copy of the C-String before it writes to it.
-// # Author(s): Conan Reis
-AString::AString(
-  const char * cstr_p,
-  bool         persistent
-  )
-  {
-  //A_ASSERT(cstr_p != nullptr, "Given nullptr instead of valid C-String", ErrId_null_cstr, AString);
+  // Search kernels used by the character and substring find and count methods.  Ranges
+  // are inclusive [cstr_p, cstr_end_p] like the methods that use them and no bytes
+  // outside of the range are read.  When SSE2 is available 16 bytes are tested at a time
+  // using unaligned loads and any remaining bytes are tested one at a time.
 
-  uint32_t length = uint32_t(::strlen(cstr_p));
+  #ifdef A_STR_SSE2
 
-  m_str_ref_p = (persistent)
-    ? AStringRef::pool_new(cstr_p, length, length + 1u, 1u, false, true)
-    : AStringRef::pool_new_copy(cstr_p, length);
-  }
+  //---------------------------------------------------------------------------------------
+  // Returns index of lowest set bit - mask must not be 0
+  inline uint32_t a_bit_first(uint32_t mask)
+    {
+    #ifdef _MSC_VER
+      unsigned long idx;
 
-//---------------------------------------------------------------------------------------
-// Constructor from character array buffer.  Refers to a persistent
-//             null-terminated C-String or makes its own copy of an existing character
-//             array.
-// # Returns:  itself
-// Arg         cstr_p - pointer to array of characters (does not need to be null
-//             terminated unless length is equal to ALength_calculate).  'cstr_p' should
-//             never be nullptr.  'cstr_p' will usually be a string literal or if
-//             'persistent' is false, 'cstr_p' may be any C-String that this string
-//             should make a copy of.
-// Arg         length - number of characters to use in 'cstr_p' and the index position to
-//             place a terminating null character.  The given length must not be more
-//             than the size of 'cstr_p' and the C-String buffer pointed to by 'cstr_p'
-//             should not have any null characters less then the given length.  A null
-//             terminator is placed only if 'persistent' is not true.
-//             'length' may also be set to ALength_calculate in which case the character
-//             length is calculated by finding the first terminating null character
-//             already present in 'cstr_p'.
-// Arg         persistent - Indicates whether the data pointed to by cstr_p will be
-//             available for the lifetime of this string.  If 'persistent' is true, the
-//             memory pointed to by 'cstr_p' will be used rather than having this object
-//             allocate its own memory - also the memory pointed to by 'cstr_p' will not
-//             be written to.  If 'persistent' is false, then this AString object will
-//             allocate its own memory and copy the contents of 'cstr_p' to it.
-// # See:      AString(cstr_p), AString(buffer_p, size, length, deallocate)
-// # Notes:    If any modifying methods are called on this string, it will first make
-//             its own unique copy of the C-String before it writes to it.
-// # Author(s): Conan Reis
-AString::AString(
-  const char * cstr_p,
-  uint32_t     length,
-  bool         persistent // = true
-  )
-  {
-  //A_ASSERT(cstr_p != nullptr, "Given nullptr instead of valid C-String", ErrId_null_cstr, AString);
+      _BitScanForward(&idx, mask);
 
-  if (length == ALength_calculate)
+      return idx;
+    #else
+      return uint32_t(__builtin_ctz(mask));
+    #endif
+    }
+
+  //---------------------------------------------------------------------------------------
+  // Returns index of highest set bit - mask must not be 0
+  inline uint32_t a_bit_last(uint32_t mask)
     {
-    length = uint32_t(::strlen(cstr_p));
+    #ifdef _MSC_VER
+      unsigned long idx;
+
+      _BitScanReverse(&idx, mask);
+
+      return idx;
+    #else
+      return 31u - uint32_t(__builtin_clz(mask));
+    #endif
     }
 
-  m_str_ref_p = (persistent)
-    ? AStringRef::pool_new(cstr_p, length, length + 1u, 1u, false, true)
-    : AStringRef::pool_new_copy(cstr_p, length);
-  }
+  #endif  // A_STR_SSE2
 
-//---------------------------------------------------------------------------------------
-// Constructor from character array buffer.  See the description of the
-//             argument 'buffer_p' for the three possible uses of this constructor.
-// # Returns:  itself
-// Arg         buffer_p - pointer to array of characters (does not need to be null
-//             terminated unless 'length' is equal to ALength_calculate).  If 'buffer_p'
-//             is nullptr, 'length' and 'deallocate' are ignored.  There are in general 3
-//             different types of values that 'buffer_p' will be given:
-//               1. A temporary buffer which is allocated on the stack or is recovered
-//                  by some other means.
-//               2. A pre-allocated character array that this AString object should take
-//                  over responsibility for.
-//               3. nullptr.  This then creates an empty string with a space of 'size'
-//                  already allocated including the null terminating character.
-// Arg         size - This is the size in bytes of the memory pointed to by 'buffer_p'
-//             or if 'buffer_p' is nullptr, it is the initial memory size that should be 
-//             allocated by this string.  Also note that this size must include the null
-//             terminating character, so 'size' should never be less than 1 and it
-//             should always be greater then the length.
-// Arg         length - number of characters to use in 'buffer_p' and the index position
-//             to place a terminating null character.  The given length must not be more
-//             than the size of 'buffer_p' and the C-String buffer pointed to by
-//             'buffer_p' should not have any null characters less then the given length.
-//             'length' may also be set to ALength_calculate in which case the character
-//             length is calculated by finding the first terminating null character
-//             already present in 'buffer_p'.
-// Arg         deallocate - Indicates whether this string (or more specifically the
-//             AStringRef) should take control of the memory pointed to by buffer_p and
-//             do deallocate it when it is no longer in use.
-// # See:      AString(cstr_p), AString(cstr_p, length, persistent)
-// # Notes:    To make a copy of a C-String call AString(cstr_p, length, persistent = false).
-//             To reference a C-String literal call AString(cstr_p) or
-//             AString(cstr_p, length, persistent = true)
-// # Author(s): Conan Reis
-AString::AString(
-  const char * buffer_p,
-  uint32_t     size,
-  uint32_t     length,
-  bool         deallocate // = false
-  )
-  {
-  if (buffer_p)
+  //---------------------------------------------------------------------------------------
+  // Returns address of first ch in range or nullptr if not found
+  const char * a_find_char(const char * cstr_p, const char * cstr_end_p, char ch)
     {
-    if (length == ALength_calculate)
+    #ifdef A_STR_SSE2
+      uint32_t mask;
+      __m128i  ch_v = _mm_set1_epi8(ch);
+
+      while ((cstr_end_p - cstr_p) >= 15)
+        {
+        mask = uint32_t(_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i *>(cstr_p)), ch_v)));
+
+        if (mask)
+          {
+          return cstr_p + a_bit_first(mask);
+          }
+
+        cstr_p += 16;
+        }
+    #endif
+
+    for (; cstr_p <= cstr_end_p; cstr_p++)
       {
-      length = uint32_t(::strlen(buffer_p));
+      if (*cstr_p == ch)
+        {
+        return cstr_p;
+        }
       }
 
-    A_ASSERT(size > length, a_cstr_format("Supplied size (%u) is not large enough for supplied length (%u)", size, length), ErrId_null_cstr, AString);
-
-    m_str_ref_p = AStringRef::pool_new(buffer_p, length, size, 1u, deallocate, false);
-    m_str_ref_p->m_cstr_p[length] = '\0';  // Put in null-terminator
+    return nullptr;
     }
-  else  // nullptr, so create empty AString with specified buffer size
+
+  //---------------------------------------------------------------------------------------
+  // Returns address of last ch in range or nullptr if not found
+  const char * a_find_char_reverse(const char * cstr_p, const char * cstr_end_p, char ch)
     {
-    size        = AStringRef::request_char_count(size);
-    m_str_ref_p = AStringRef::pool_new(AStringRef::alloc_buffer(size), 0u, size, 1u, true, false);
-    m_str_ref_p->m_cstr_p[0] = '\0';  // Put in null-terminator
-    }
-  }
+    #ifdef A_STR_SSE2
+      uint32_t mask;
+      __m128i  ch_v = _mm_set1_epi8(ch);
 
-//---------------------------------------------------------------------------------------
-// Constructor / converter from a formatted string.
-// # Returns:  a reference to itself
-// Arg         max_size - sets the initial character buffer size (not including the null
-//             terminator character).  This is essentially the maximum allowable
-//             characters - if the number of the characters in the expanded format
-//             string are larger than 'max_size' then any characters above and beyond 
-//             that number will be truncated.
-// Arg         format_str_p - follows the same format as the C printf(), sprintf(), etc.
-//             See the MSDev online help for 'Format Specification Fields' for a
-//             description. 
-// Arg         ... - variable length arguments expected by the formatted string.
-//
-//             #### IMPORTANT #### When using the string format type specifier (%s) in
-//             the format string and a AString object (or a ASymbol object) is passed in
-//             as one of the variable length arguments, use 'str.as_cstr()'.
-//             Variable length arguments do not specify a type to the compiler, instead
-//             the types of the passed arguments are determined via the standard C
-//             string formatting functions - i.e %s, %u, %f, etc.  So if a string type
-//             (%s) is specified in the format string and a AString object is passed as
-//             one of the untyped variable length arguments, the compiler will not know
-//             to coerce the AString object to a C-String - it will instead treat the
-//             address of the AString object argument as if it were a C-String character
-//             array with disastrous results.
-//
-// # Examples: AString begin("The answer");  // Example substring to append
-//             AString str(100u, "%s to %s is %i", begin.as_cstr(), "everything", 42);
-//             // str is equal to "The answer to everything is 42"
-//             // character length is 30, buffer size is 101
-//
-// # See:      format(), append_format()
-// # Author(s): Conan Reis
-AString::AString(
-  uint         max_size,
-  const char * format_str_p,
-  ...
-  )
-  {
-  va_list  args;  // initialize argument list
-  uint32_t size   = AStringRef::request_char_count(max_size);
-  char *   cstr_p = AStringRef::alloc_buffer(size);  // allocate buffer
+      while ((cstr_end_p - cstr_p) >= 15)
+        {
+        mask = uint32_t(_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i *>(cstr_end_p - 15)), ch_v)));
 
-  va_start(args, format_str_p);
+        if (mask)
+          {
+          return cstr_end_p - 15 + a_bit_last(mask);
+          }
 
-  #if defined(A_PLAT_PS3) || defined(A_PLAT_PS4)
-    int length = vsnprintf(cstr_p, size_t(max_size + 1), format_str_p, args);
-  #else
-    int length = _vsnprintf(cstr_p, size_t(max_size), format_str_p, args);
-  #endif
+        cstr_end_p -= 16;
+        }
+    #endif
 
-  va_end(args);  // end argument list processing
+    for (; cstr_end_p >= cstr_p; cstr_end_p--)
+      {
+      if (*cstr_end_p == ch)
+        {
+        return cstr_end_p;
+        }
+      }
 
-  if ((length == -1) || (length == int(max_size))) // More characters than buffer has, so truncate
-    {
-    length           = int(max_size);
-    cstr_p[max_size] = '\0';     // Put in null-terminator
+    return nullptr;
     }
 
-  m_str_ref_p = AStringRef::pool_new(
-    cstr_p,
-    uint32_t(length),
-    size,
-    1u,
-    true,
-    false);
-  }
+  //---------------------------------------------------------------------------------------
+  // Returns number of ch in range
+  uint32_t a_count_char(const char * cstr_p, const char * cstr_end_p, char ch)
+    {
+    uint32_t num_count = 0u;
 
-//---------------------------------------------------------------------------------------
-// Constructor from byte stream info
-// Arg         source_stream_pp - Pointer to address to read byte stream / binary
-//             serialization info from and to increment - previously filled using
-//             as_binary() or a similar mechanism.
-// # See:      as_binary(), assign_binary()
-// # Notes:    Used in combination with as_binary()
-//
-//             Binary composition:
-//               4 bytes - string length
-//               n bytes - string
-// # Author(s):  Conan Reis
-AString::AString(const void ** source_stream_pp)
-  {
-  // 4 bytes - string length
-  uint32_t length = A_BYTE_STREAM_UI32_INC(source_stream_pp);
-  uint32_t size   = AStringRef::request_char_count(length);
+    #ifdef A_STR_SSE2
+      uint32_t blocks;
+      __m128i  sums_v;
+      __m128i  ch_v   = _mm_set1_epi8(ch);
+      __m128i  zero_v = _mm_setzero_si128();
 
-  m_str_ref_p = AStringRef::pool_new(
-    AStringRef::alloc_buffer(size), // C-String
-    length,                         // Length
-    size,                           // Size
-    1u,                             // References
-    true,                           // Deallocate
-    false);                         // Not Read-Only
+      while ((cstr_end_p - cstr_p) >= 15)
+        {
+        // Each matching byte is -1 so subtracting adds 1 to the byte count of its lane -
+        // at most 255 blocks are tallied before the lanes are summed so they can't overflow.
+        blocks = a_min(uint32_t((cstr_end_p - cstr_p + 1) >> 4), 255u);
+        sums_v = zero_v;
 
-  // n bytes - string
-  memcpy(m_str_ref_p->m_cstr_p, *(char **)source_stream_pp, length);
-  m_str_ref_p->m_cstr_p[length] = '\0';
-  (*(uint8_t **)source_stream_pp) += length;
-  }
+        for (; blocks; blocks--)
+          {
+          sums_v = _mm_sub_epi8(sums_v, _mm_cmpeq_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i *>(cstr_p)), ch_v));
+          cstr_p += 16;
+          }
 
-//---------------------------------------------------------------------------------------
-// Assignment from byte stream info
-// Arg         source_stream_pp - Pointer to address to read byte stream / binary
-//             serialization info from and to increment - previously filled using
-//             as_binary() or a similar mechanism.
-// # See:      as_binary(), assign_binary()
-// # Notes:    Used in combination with as_binary()
-//
-//             Binary composition:
-//               4 bytes - string length
-//               n bytes - string
-// # Author(s):  Conan Reis
-AString & AString::assign_binary(const void ** source_stream_pp)
-  {
-  // 4 bytes - string length
-  uint32_t length = A_BYTE_STREAM_UI32_INC(source_stream_pp);
+        sums_v     = _mm_sad_epu8(sums_v, zero_v);
+        num_count += uint32_t(_mm_cvtsi128_si32(sums_v) + _mm_extract_epi16(sums_v, 4));
+        }
+    #endif
 
-  // n bytes - string
-  set_cstr(*(char **)source_stream_pp, length, false);
-  (*(uint8_t **)source_stream_pp) += length;
-
-  return *this;
-  }
+    for (; cstr_p <= cstr_end_p; cstr_p++)
+      {
+      if (*cstr_p == ch)
+        {
+        num_count++;
+        }
+      }
 
-//---------------------------------------------------------------------------------------
-// APArrayLogical<AString> constructor.  Concatenates all elements with separator 
-//             between them.
-// # Returns:  itself
-// Arg         strings - Array of AString objects to convert to a single string.  Ensure
-//             that none of the pointers are nullptr.
-// Arg         separator - This is the separator to insert between each string of the
-//             array.  (Default no separator - all the Strings are squished together)
-// # See:      tokenize(), get_token()
-// # Notes:    No separator is put in front of the first element.
-// # Author(s): Conan Reis
-AString::AString(
-  const APArrayLogical<AString> & strings,
-  const AString &                 separator // = ms_empty
-  )
-  {
-  uint32_t length = strings.get_length();
+    return num_count;
+    }
 
-  if (length)
+  //---------------------------------------------------------------------------------------
+  // Returns address of first character in range that is in match_table_p or nullptr
+  // if not found.  Tests 8 characters before branching.
+  const uint8_t * a_find_match(const uint8_t * cstr_p, const uint8_t * cstr_end_p, const bool * match_table_p)
     {
-    uint32_t   total_length = ((length - 1u) * separator.m_str_ref_p->m_length);  // separators
-    AString ** array_p      = strings.get_array();  // for faster than class member access
-    AString ** array_end_p  = array_p + length;
+    while ((cstr_end_p - cstr_p) >= 7)
+      {
+      if (match_table_p[cstr_p[0]] | match_table_p[cstr_p[1]] | match_table_p[cstr_p[2]] | match_table_p[cstr_p[3]]
+        | match_table_p[cstr_p[4]] | match_table_p[cstr_p[5]] | match_table_p[cstr_p[6]] | match_table_p[cstr_p[7]])
+        {
+        break;
+        }
 
-    // Accumulate string lengths to pre-allocate sufficient cstr array
-    for (; array_p < array_end_p; array_p++)
+      cstr_p += 8;
+      }
+
+    for (; cstr_p <= cstr_end_p; cstr_p++)
       {
-      total_length += (*array_p)->m_str_ref_p->m_length;
+      if (match_table_p[*cstr_p])
+        {
+        return cstr_p;
+        }
       }
 
-    uint32_t size   = AStringRef::request_char_count(total_length);
-    char *   cstr_p = AStringRef::alloc_buffer(size);
+    return nullptr;
+    }
 
-    m_str_ref_p = AStringRef::pool_new(cstr_p, total_length, size, 1u, true, false);
+  //---------------------------------------------------------------------------------------
+  // Returns number of characters in range that are in match_table_p
+  uint32_t a_count_match(const uint8_t * cstr_p, const uint8_t * cstr_end_p, const bool * match_table_p)
+    {
+    // Separate tallies so that the adds are independent
+    uint32_t count0 = 0u;
+    uint32_t count1 = 0u;
+    uint32_t count2 = 0u;
+    uint32_t count3 = 0u;
 
-    // Accumulate strings
-    total_length = 0u;
-    length       = separator.m_str_ref_p->m_length;
-    array_p      = strings.get_array();
+    while ((cstr_end_p - cstr_p) >= 3)
+      {
+      count0 += match_table_p[cstr_p[0]];
+      count1 += match_table_p[cstr_p[1]];
+      count2 += match_table_p[cstr_p[2]];
+      count3 += match_table_p[cstr_p[3]];
+      cstr_p += 4;
+      }
 
-    if (length)
+    for (; cstr_p <= cstr_end_p; cstr_p++)
       {
-      const char * seperator_cstr_p = separator.m_str_ref_p->m_cstr_p;
+      count0 += match_table_p[*cstr_p];
+      }
 
-      array_end_p = array_p + (length - 1);  // Last string is not followed with separator
+    return count0 + count1 + count2 + count3;
+    }
 
-      for (; array_p < array_end_p; array_p++)
+  //---------------------------------------------------------------------------------------
+  // Determines if pattern is at cstr_p
+  inline bool a_is_substr(const char * cstr_p, const char * pattern_p, uint32_t length, eAStrCase case_check)
+    {
+    if (case_check == AStrCase_sensitive)
+      {
+      return ::memcmp(cstr_p, pattern_p, length) == 0;
+      }
+
+    const char * pattern_end_p = pattern_p + length;
+
+    for (; pattern_p < pattern_end_p; pattern_p++, cstr_p++)
+      {
+      if (AString::compare_insensitive(*cstr_p, *pattern_p))
         {
-        memcpy(cstr_p + total_length, (*array_p)->m_str_ref_p->m_cstr_p, size_t((*array_p)->m_str_ref_p->m_length));
-        total_length += (*array_p)->m_str_ref_p->m_length;
-        memcpy(cstr_p + total_length, seperator_cstr_p, size_t(length));
-        total_length += length;
+        return false;
         }
-
-      memcpy(cstr_p + total_length, (*array_p)->m_str_ref_p->m_cstr_p, size_t((*array_p)->m_str_ref_p->m_length + 1u));
       }
-    else  // No separator
+
+    return true;
+    }
+
+  //---------------------------------------------------------------------------------------
+  // Returns address of first occurrence of pattern that starts in range [cstr_p,
+  // cstr_last_p] or nullptr if not found.  pattern_length must be at least 1 and the
+  // whole pattern must fit in the string when started at cstr_last_p.
+  // Candidates are first filtered by matching both the first and last pattern characters
+  // (in either case if ignoring case) and only then the whole pattern is compared.
+  const char * a_find_substr(
+    const char * cstr_p,
+    const char * cstr_last_p,
+    const char * pattern_p,
+    uint32_t     pattern_length,
+    eAStrCase    case_check
+    )
+    {
+    char first     = pattern_p[0u];
+    char last      = pattern_p[pattern_length - 1u];
+    char first_alt = first;
+    char last_alt  = last;
+
+    if (case_check == AStrCase_ignore)
       {
-      for (; array_p < array_end_p; array_p++)
+      first     = AString::ms_char2lower[uint8_t(first)];
+      last      = AString::ms_char2lower[uint8_t(last)];
+      first_alt = AString::ms_char2uppper[uint8_t(first)];
+      last_alt  = AString::ms_char2uppper[uint8_t(last)];
+      }
+
+    #ifdef A_STR_SSE2
+      uint32_t mask;
+      __m128i  first_v;
+      __m128i  last_v;
+      __m128i  first_a_v  = _mm_set1_epi8(first);
+      __m128i  first_b_v  = _mm_set1_epi8(first_alt);
+      __m128i  last_a_v   = _mm_set1_epi8(last);
+      __m128i  last_b_v   = _mm_set1_epi8(last_alt);
+      uint32_t last_offset = pattern_length - 1u;
+
+      while ((cstr_last_p - cstr_p) >= 15)
         {
-        memcpy(cstr_p + total_length, (*array_p)->m_str_ref_p->m_cstr_p, size_t((*array_p)->m_str_ref_p->m_length));
-        total_length += (*array_p)->m_str_ref_p->m_length;
+        first_v = _mm_loadu_si128(reinterpret_cast<const __m128i *>(cstr_p));
+        last_v  = _mm_loadu_si128(reinterpret_cast<const __m128i *>(cstr_p + last_offset));
+        mask    = uint32_t(_mm_movemask_epi8(_mm_and_si128(
+          _mm_or_si128(_mm_cmpeq_epi8(first_v, first_a_v), _mm_cmpeq_epi8(first_v, first_b_v)),
+          _mm_or_si128(_mm_cmpeq_epi8(last_v, last_a_v), _mm_cmpeq_epi8(last_v, last_b_v)))));
+
+        while (mask)
+          {
+          const char * match_p = cstr_p + a_bit_first(mask);
+
+          if (a_is_substr(match_p, pattern_p, pattern_length, case_check))
+            {
+            return match_p;
+            }
+
+          mask &= mask - 1u;
+          }
+
+        cstr_p += 16;
         }
+    #endif
 
-      m_str_ref_p->m_cstr_p[m_str_ref_p->m_length] = '\0';
+    for (; cstr_p <= cstr_last_p; cstr_p++)
+      {
+      if (((*cstr_p == first) || (*cstr_p == first_alt))
+        && a_is_substr(cstr_p, pattern_p, pattern_length, case_check))
+        {
+        return cstr_p;
+        }
       }
+
+    return nullptr;
     }
-  else  // Array strings is empty
+
+  //---------------------------------------------------------------------------------------
+  // Returns address of first occurrence of pattern that lies entirely within [cstr_p,
+  // cstr_end_p) or nullptr if not found.  Unlike a_find_substr() the range need not be
+  // followed by anything - as is the case with AStringView - and pattern_length may be 0.
+  inline const char * a_find_substr_range(
+    const char * cstr_p,
+    const char * cstr_end_p,
+    const char * pattern_p,
+    uint32_t     pattern_length,
+    eAStrCase    case_check
+    )
     {
-    m_str_ref_p = AStringRef::get_empty();
-    m_str_ref_p->m_ref_count++;
+    if ((cstr_end_p < cstr_p) || (uint32_t(cstr_end_p - cstr_p) < pattern_length))
+      {
+      return nullptr;
+      }
+
+    return pattern_length
+      ? a_find_substr(cstr_p, cstr_end_p - pattern_length, pattern_p, pattern_length, case_check)
+      : cstr_p;
     }
-  }
 
-//---------------------------------------------------------------------------------------
-// Constructor / converter from a signed integer
-// # Returns:  String version of the number
-// Arg         integer - signed integer to convert to a string
-// Arg         base - base (or radix) to use for conversion.  10 is decimal, 16 is
-//             hexadecimal, 2 is binary, etc.
-// # Examples: str = AString::ctor_int(5);
-// # See:      as_int32(), as_uint32_t(), as_float64(), AString(max_size, format_str_p, ...)
-// # Modifiers: static
-// # Author(s): Conan Reis
-AString AString::ctor_int(
-  int integer,
-  uint base // = AString_def_base (10)
-  )
-  {
-  uint32_t size   = AStringRef::request_char_count(AString_int32_max_chars);
-  char *   cstr_p = AStringRef::alloc_buffer(size);
+  //---------------------------------------------------------------------------------------
+  // Null terminated copy of the number at the start of an AStringView so it can be handed
+  // to strtod(), strtol(), etc. without those reading past the end of the view.
+  //
+  // Only the leading run of characters that can be part of a number (sign, digits,
+  // letters for radix prefixes / digits above 9 / exponents / "inf" / "nan", '.') is
+  // copied and it is capped at the size of the stack buffer - so parsing one number after
+  // another from a large view does not copy the rest of the view each time.  Leading
+  // white space (which strtod() etc. skip) is not copied - use get_stop_pos() to get the
+  // index of where conversion stopped relative to the start of the view.
+  class AViewCStr
+    {
+    public:
 
-  // $Revisit - CReis Should probably write custom _itoa()
-  // This should only be called during development, so don't worry too much for now.
-  #ifndef A_NO_NUM2STR_FUNCS
-    ::_itoa(integer, cstr_p, int(base));
-  #else
-    // $Vital - CReis Base is ignored
-    ::_snprintf(cstr_p, AString_int32_max_chars - 1, "%i", integer);
-  #endif
+      AViewCStr(const char * cstr_p, uint32_t length)
+        {
+        const char * end_p   = cstr_p + length;
+        const char * start_p = cstr_p;
+
+        while ((start_p < end_p) && AString::ms_char_match_table[ACharMatch_white_space][uint8_t(*start_p)])
+          {
+          start_p++;
+          }
 
+        const char * num_end_p = ((end_p - start_p) < ptrdiff_t(sizeof(m_cstr_p))) ? end_p : (start_p + sizeof(m_cstr_p) - 1u);
+        const char * num_p     = start_p;
 
-  return AStringRef::pool_new(cstr_p, uint32_t(::strlen(cstr_p)), size, 0u, true, false);
-  }
+        while ((num_p < num_end_p)
+          && (AString::ms_char_match_table[ACharMatch_alphanumeric][uint8_t(*num_p)]
+            || (*num_p == '.') || (*num_p == '+') || (*num_p == '-')))
+          {
+          num_p++;
+          }
 
-//---------------------------------------------------------------------------------------
-// Constructor / converter from an unsigned integer
-// # Returns:  itself
-// Arg         natural - unsigned integer to convert to a string
-// Arg         base - base (or radix) to use for conversion.  10 is decimal, 16 is
-//             hexadecimal, 2 is binary, etc.
-// # Examples: str = AString::ctor_uint(5u);
-// # See:      as_int32(), as_uint32_t(), as_float64(), AString(max_size, format_str_p, ...)
-// # Modifiers: static
-// # Author(s): Conan Reis
-AString AString::ctor_uint(
-  uint32_t natural,
-  uint32_t base // = AString_def_base (10)
-  )
-  {
-  uint32_t size   = AStringRef::request_char_count(AString_int32_max_chars);
-  char *   cstr_p = AStringRef::alloc_buffer(size);
+        m_skip_length = uint32_t(start_p - cstr_p);
+        ::memcpy(m_cstr_p, start_p, size_t(num_p - start_p));
+        m_cstr_p[num_p - start_p] = '\0';
+        }
 
-  // $Revisit - CReis Should probably write custom _itoa()
-  // This should only be called during development, so don't worry too much for now.
-  #ifndef A_NO_NUM2STR_FUNCS
-    ::_ultoa(natural, cstr_p, int(base));
-  #else
-    // $Vital - CReis Base is ignored
-    ::_snprintf(cstr_p, AString_int32_max_chars - 1, "%u", natural);
-  #endif
+      // Returns number of characters from the start of the view to stop_p - which is
+      // where strtod() etc. stopped in m_cstr_p
+      uint32_t get_stop_pos(const char * stop_p) const
+        {
+        // Nothing converted - strtod() etc. stop before any white space
+        return (stop_p == m_cstr_p) ? 0u : (m_skip_length + uint32_t(stop_p - m_cstr_p));
+        }
 
-  return AStringRef::pool_new(cstr_p, uint32_t(::strlen(cstr_p)), size, 0u, true, false);
-  }
+      char     m_cstr_p[128];
+      uint32_t m_skip_length;
+    };
 
-//---------------------------------------------------------------------------------------
-// Constructor / converter from a f32 (float)
-// # Returns:  itself
-// Arg         real - f32 to convert to a string
-// Arg         significant - number of significant digits / characters to attempt to fit
-//             'real' into.  If it can't fit, it will use a scientific notation with a
-//             lowercase 'e'.
-// # Examples: str = AString::ctor_f32(5.0f);
-// # See:      as_int32(), as_uint32_t(), as_float64(), AString(max_size, format_str_p, ...)
-// # Modifiers: explicit
-// # Author(s): Conan Reis
-AString AString::ctor_float(
-  f32      real,
-  uint32_t significant // = AString_float_sig_digits_def
-  )
-  {
-  uint32_t size   = AStringRef::request_char_count(significant + AString_real_extra_chars);
-  char *   cstr_p = AStringRef::alloc_buffer(size);  // for sign, exponent, etc.
+  // Number formatting kernels used by ctor_int(), ctor_float(), append_int(), etc.  Digits
+  // are written straight into the destination buffer rather than going through printf().
 
-  #ifndef A_NO_NUM2STR_FUNCS
-    // $Revisit - CReis change this to _fcvt() if _fcvt() is really more efficient for floats - it still takes a f64???
-    ::_gcvt(real, int(significant), cstr_p);
-  #else
-    _snprintf(cstr_p, significant + AString_real_extra_chars, "%g", f64(real));
-  #endif
+  // Digit characters for bases up to AString_max_base
+  const char g_digits[] = "0123456789abcdefghijklmnopqrstuvwxyz";
 
-  uint32_t     length    = uint32_t(::strlen(cstr_p));
-  AStringRef * str_ref_p = AStringRef::pool_new(cstr_p, length, size, 0u, true, false);
+  // Pairs of decimal digits "00" - "99" so that integers can be converted 2 digits at a time
+  const char g_digit_pairs[] =
+    "0001020304050607080910111213141516171819"
+    "2021222324252627282930313233343536373839"
+    "4041424344454647484950515253545556575859"
+    "6061626364656667686970717273747576777879"
+    "8081828384858687888990919293949596979899";
 
-  // Ensure that it ends with a digit
-  if (cstr_p[length - 1u] == '.')
+  // Powers of 10 that are exactly representable as f64
+  const f64 g_pow10_f64[] =
     {
-    cstr_p[length]      = '0';
-    cstr_p[length + 1u] = '\0';
-    str_ref_p->m_length++;
-    }
+    1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11, 1e12, 1e13, 1e14, 1e15,
+    1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+    };
 
-  return str_ref_p;
-  }
+  // Powers of 10 that fit in 64 bits
+  const uint64_t g_pow10[] =
+    {
+    1ULL, 10ULL, 100ULL, 1000ULL, 10000ULL, 100000ULL, 1000000ULL, 10000000ULL,
+    100000000ULL, 1000000000ULL, 10000000000ULL, 100000000000ULL, 1000000000000ULL,
+    10000000000000ULL, 100000000000000ULL, 1000000000000000ULL, 10000000000000000ULL,
+    100000000000000000ULL, 1000000000000000000ULL, 10000000000000000000ULL
+    };
 
-//---------------------------------------------------------------------------------------
-// Constructor / converter from a f64 (double)
-// # Returns:  itself
-// Arg         real - f64 to convert to a string
-// Arg         significant - number of significant digits / characters to attempt to fit
-//             'real' into.  If it can't fit, it will use a scientific notation with a
-//             lowercase 'e'.
-// # Examples: str = AString::ctor_f64(5.0);
-// # See:      as_int32(), as_uint32_t(), as_float64(), AString(max_size, format_str_p, ...)
-// # Modifiers: static
-// # Author(s): Conan Reis
-AString AString::ctor_float64(
-  f64      real,
-  uint32_t significant // = AString_double_sig_digits_def
-  )
-  {
-  uint32_t size   = AStringRef::request_char_count(significant + AString_real_extra_chars);
-  char *   cstr_p = AStringRef::alloc_buffer(size);  // for sign, exponent, etc.
+  //---------------------------------------------------------------------------------------
+  // Returns number of decimal digits needed for natural - at most 4 comparisons
+  inline uint32_t a_decimal_digits(uint32_t natural)
+    {
+    if (natural < 100000u)
+      {
+      if (natural < 100u)
+        {
+        return (natural < 10u) ? 1u : 2u;
+        }
 
-  #ifndef A_NO_NUM2STR_FUNCS
-    // $Revisit - CReis change this to _fcvt() if _fcvt() is really more efficient for floats - it still takes a f64???
-    ::_gcvt(real, int(significant), cstr_p);
-  #else
-    _snprintf(cstr_p, significant + AString_real_extra_chars, "%g", real);
-  #endif
+      return (natural < 1000u) ? 3u : ((natural < 10000u) ? 4u : 5u);
+      }
 
-  uint32_t     length    = uint32_t(::strlen(cstr_p));
-  AStringRef * str_ref_p = AStringRef::pool_new(cstr_p, length, size, 0u, true, false);
+    if (natural < 10000000u)
+      {
+      return (natural < 1000000u) ? 6u : 7u;
+      }
 
-  // Ensure that it ends with a digit
-  if (cstr_p[length - 1u] == '.')
-    {
-    cstr_p[length]      = '0';
-    cstr_p[length + 1u] = '\0';
-    str_ref_p->m_length++;
+    return (natural < 100000000u) ? 8u : ((natural < 1000000000u) ? 9u : 10u);
     }
 
-  return str_ref_p;
-  }
+  //---------------------------------------------------------------------------------------
+  // Writes unsigned integer in the given base without a terminating null character.
+  // # Returns:  number of characters written - at most 32
+  uint32_t a_uint_to_cstr(
+    uint32_t natural,
+    uint32_t base,
+    char *   cstr_p
+    )
+    {
+    A_ASSERTX((base >= 2u) && (base <= AString_max_base), "Invalid base for integer to string conversion!");
 
-//---------------------------------------------------------------------------------------
-// Constructor / converter from stream.
-// # Returns:  a reference to itself
-// # Author(s): Conan Reis
-//AString::AString(strstream & strm)
-//  {
-//  strm << ends;                    // terminate stream with a null
-//  m_str_ref_p->m_length = uint32_t(::strlen(strm.str()));   // get number of characters in stream
-//  m_str_ref_p->m_size   = m_str_ref_p->m_length + 1;         // calculate size
-//  m_str_ref_p->m_cstr_p = AStringRef::alloc_buffer(m_str_ref_p->m_size);
-//  memcpy(m_str_ref_p->m_cstr_p, strm.str(), size_t(m_str_ref_p->m_length + 1));  // copy characters from stream
-//  }
+    uint32_t length;
 
+    if (base == 10u)
+      {
+      uint32_t pair;
+      char *   end_p;
 
-//---------------------------------------------------------------------------------------
-// Converter / constructor from wide character (Unicode) C-String.
-// 
-// # Params:
-//   wcstr_p: wide character (unicode) string to convert.
-//   
-// # Author(s): Conan Reis
-AString::AString(const wchar_t * wcstr_p)
-  {
-  // $Vital - CReis Test this and switch to UTF-8 as soon as possible.
-  if (wcstr_p)
-    {
-    uint32_t length = uint32_t(::wcslen(wcstr_p));
+      length = a_decimal_digits(natural);
+      end_p  = cstr_p + length;
 
-    if (length)
-      {
-      uint32_t size   = AStringRef::request_char_count(length);
-      char *   cstr_p = AStringRef::alloc_buffer(size);
+      while (natural >= 100u)
+        {
+        pair     = (natural % 100u) * 2u;
+        natural /= 100u;
+        end_p   -= 2;
+        end_p[0] = g_digit_pairs[pair];
+        end_p[1] = g_digit_pairs[pair + 1u];
+        }
 
-      #ifdef A_PLAT_PC
-        WideCharToMultiByte(CP_ACP, 0, wcstr_p, length, cstr_p, size, NULL, NULL);
-      #else
-        ::wcstombs(cstr_p, wcstr_p, size_t(length + 1u));
-      #endif
+      if (natural >= 10u)
+        {
+        cstr_p[0] = g_digit_pairs[natural * 2u];
+        cstr_p[1] = g_digit_pairs[natural * 2u + 1u];
+        }
+      else
+        {
+        cstr_p[0] = char('0' + natural);
+        }
 
-      cstr_p[length] = '\0';  // Put in null-terminator
-      m_str_ref_p    = AStringRef::pool_new(cstr_p, length, size, 1u, true, false);
+      return length;
+      }
 
-      return;
+    // Other bases are generated in reverse and then copied
+    char rev_a[32];
+
+    length = 0u;
+
+    do
+      {
+      rev_a[length++] = g_digits[natural % base];
+      natural /= base;
       }
+    while (natural);
+
+    for (uint32_t idx = length; idx > 0u; idx--)
+      {
+      *cstr_p++ = rev_a[idx - 1u];
+      }
+
+    return length;
     }
 
-  m_str_ref_p = AStringRef::get_empty();
-  m_str_ref_p->m_ref_count++;
-  }
-
-//---------------------------------------------------------------------------------------
-// Converter / constructor from wide character (Unicode) C-String.
-// 
-// # Params:
-//   wcstr_p: wide character (unicode) string to convert.
-//   length: number of characters - not bytes - in wcstr_p
-//   
-// # Author(s): Conan Reis
-AString::AString(
-  const wchar_t * wcstr_p,
-  uint32_t        length
-  )
-  {
-  // $Vital - CReis Test this and switch to UTF-8 as soon as possible.
-  if (wcstr_p && length)
+  //---------------------------------------------------------------------------------------
+  // Writes signed integer in the given base without a terminating null character.  Like
+  // _itoa() only base 10 uses a minus sign - other bases write the two's complement bits.
+  // # Returns:  number of characters written - at most 33
+  inline uint32_t a_int_to_cstr(
+    int      integer,
+    uint32_t base,
+    char *   cstr_p
+    )
     {
-    uint32_t size   = AStringRef::request_char_count(length);
-    char *   cstr_p = AStringRef::alloc_buffer(size);
-
-    #ifdef A_PLAT_PC
-      WideCharToMultiByte(CP_ACP, 0, wcstr_p, length, cstr_p, size, NULL, NULL);
-    #else
-      ::wcstombs(cstr_p, wcstr_p, size_t(length + 1u));
-    #endif
+    if ((integer < 0) && (base == 10u))
+      {
+      *cstr_p = '-';
 
-    cstr_p[length] = '\0';  // Put in null-terminator
-    m_str_ref_p    = AStringRef::pool_new(cstr_p, length, size, 1u, true, false);
+      return a_uint_to_cstr(0u - uint32_t(integer), 10u, cstr_p + 1) + 1u;
+      }
 
-    return;
+    return a_uint_to_cstr(uint32_t(integer), base, cstr_p);
     }
 
-  m_str_ref_p = AStringRef::get_empty();
-  m_str_ref_p->m_ref_count++;
-  }
-
-//#ifdef ASTR_ENABLE_WIDE_CHAR
-//---------------------------------------------------------------------------------------
-// Cast / convert a string to a wide character (Unicode) C-String.
-// # Notes:    ***Warning*** returns dynamic data
-// # Author(s): Conan Reis
-//AString::operator const wchar_t * () const
-//  {
-//  wchar_t * buffer_p = new wchar_t[m_str_ref_p->m_length + 1];
-//
-//  A_VERIFY_MEMORY(buffer_p == nullptr, AString);
-//  mbstowcs(buffer_p, m_str_ref_p->m_cstr_p, size_t(m_str_ref_p->m_length + 1));
-//  return buffer_p;
-//  // $Revisit - CReis Should be something like this so memory is managed: return WString(*this);
-//  // Alternatively use a big reusable buffer for quick and dirty converts.
-//  }
-//#endif
+  //---------------------------------------------------------------------------------------
+  // "Do-it-yourself floating point" - value is m_f * 2^m_e.  Used by the Grisu2 algorithm
+  // from Florian Loitsch's "Printing Floating-Point Numbers Quickly and Accurately with
+  // Integers" which generates the shortest (in all but rare cases) digits that still read
+  // back as exactly the same value.
+  struct ADiyFp
+    {
+    uint64_t m_f;
+    int      m_e;
+    };
 
-//---------------------------------------------------------------------------------------
-// Stream assignment - allows assignment stringization S = S = S
-// # Returns:  itself
-// Arg         strstream & strm - 
-// # Author(s): Conan Reis
-//AString & AString::operator=(strstream & strm)
-//  {
-//  strm << ends;                                 // terminate stream with a null
-//  m_str_ref_p->m_length = ::strlen(strm.str());                // get number of characters in stream
-//  ensure_size_buffer(m_str_ref_p->m_length);
-//  memcpy(m_str_ref_p->m_cstr_p, strm.str(), size_t(m_str_ref_p->m_length + 1));  // copy characters from stream
-//  return *this;
-//  }
+  // Normalized 10^k for k = -348, -340, ..., 340 - see a_grisu2()
+  const ADiyFp g_cached_pow10[] =
+    {
+      { 0xfa8fd5a0081c0288ULL, -1220 }, { 0xbaaee17fa23ebf76ULL, -1193 }, { 0x8b16fb203055ac76ULL, -1166 },
+      { 0xcf42894a5dce35eaULL, -1140 }, { 0x9a6bb0aa55653b2dULL, -1113 }, { 0xe61acf033d1a45dfULL, -1087 },
+      { 0xab70fe17c79ac6caULL, -1060 }, { 0xff77b1fcbebcdc4fULL, -1034 }, { 0xbe5691ef416bd60cULL, -1007 },
+      { 0x8dd01fad907ffc3cULL,  -980 }, { 0xd3515c2831559a83ULL,  -954 }, { 0x9d71ac8fada6c9b5ULL,  -927 },
+      { 0xea9c227723ee8bcbULL,  -901 }, { 0xaecc49914078536dULL,  -874 }, { 0x823c12795db6ce57ULL,  -847 },
+      { 0xc21094364dfb5637ULL,  -821 }, { 0x9096ea6f3848984fULL,  -794 }, { 0xd77485cb25823ac7ULL,  -768 },
+      { 0xa086cfcd97bf97f4ULL,  -741 }, { 0xef340a98172aace5ULL,  -715 }, { 0xb23867fb2a35b28eULL,  -688 },
+      { 0x84c8d4dfd2c63f3bULL,  -661 }, { 0xc5dd44271ad3cdbaULL,  -635 }, { 0x936b9fcebb25c996ULL,  -608 },
+      { 0xdbac6c247d62a584ULL,  -582 }, { 0xa3ab66580d5fdaf6ULL,  -555 }, { 0xf3e2f893dec3f126ULL,  -529 },
+      { 0xb5b5ada8aaff80b8ULL,  -502 }, { 0x87625f056c7c4a8bULL,  -475 }, { 0xc9bcff6034c13053ULL,  -449 },
+      { 0x964e858c91ba2655ULL,  -422 }, { 0xdff9772470297ebdULL,  -396 }, { 0xa6dfbd9fb8e5b88fULL,  -369 },
+      { 0xf8a95fcf88747d94ULL,  -343 }, { 0xb94470938fa89bcfULL,  -316 }, { 0x8a08f0f8bf0f156bULL,  -289 },
+      { 0xcdb02555653131b6ULL,  -263 }, { 0x993fe2c6d07b7facULL,  -236 }, { 0xe45c10c42a2b3b06ULL,  -210 },
+      { 0xaa242499697392d3ULL,  -183 }, { 0xfd87b5f28300ca0eULL,  -157 }, { 0xbce5086492111aebULL,  -130 },
+      { 0x8cbccc096f5088ccULL,  -103 }, { 0xd1b71758e219652cULL,   -77 }, { 0x9c40000000000000ULL,   -50 },
+      { 0xe8d4a51000000000ULL,   -24 }, { 0xad78ebc5ac620000ULL,     3 }, { 0x813f3978f8940984ULL,    30 },
+      { 0xc097ce7bc90715b3ULL,    56 }, { 0x8f7e32ce7bea5c70ULL,    83 }, { 0xd5d238a4abe98068ULL,   109 },
+      { 0x9f4f2726179a2245ULL,   136 }, { 0xed63a231d4c4fb27ULL,   162 }, { 0xb0de65388cc8ada8ULL,   189 },
+      { 0x83c7088e1aab65dbULL,   216 }, { 0xc45d1df942711d9aULL,   242 }, { 0x924d692ca61be758ULL,   269 },
+      { 0xda01ee641a708deaULL,   295 }, { 0xa26da3999aef774aULL,   322 }, { 0xf209787bb47d6b85ULL,   348 },
+      { 0xb454e4a179dd1877ULL,   375 }, { 0x865b86925b9bc5c2ULL,   402 }, { 0xc83553c5c8965d3dULL,   428 },
+      { 0x952ab45cfa97a0b3ULL,   455 }, { 0xde469fbd99a05fe3ULL,   481 }, { 0xa59bc234db398c25ULL,   508 },
+      { 0xf6c69a72a3989f5cULL,   534 }, { 0xb7dcbf5354e9beceULL,   561 }, { 0x88fcf317f22241e2ULL,   588 },
+      { 0xcc20ce9bd35c78a5ULL,   614 }, { 0x98165af37b2153dfULL,   641 }, { 0xe2a0b5dc971f303aULL,   667 },
+      { 0xa8d9d1535ce3b396ULL,   694 }, { 0xfb9b7cd9a4a7443cULL,   720 }, { 0xbb764c4ca7a44410ULL,   747 },
+      { 0x8bab8eefb6409c1aULL,   774 }, { 0xd01fef10a657842cULL,   800 }, { 0x9b10a4e5e9913129ULL,   827 },
+      { 0xe7109bfba19c0c9dULL,   853 }, { 0xac2820d9623bf429ULL,   880 }, { 0x80444b5e7aa7cf85ULL,   907 },
+      { 0xbf21e44003acdd2dULL,   933 }, { 0x8e679c2f5e44ff8fULL,   960 }, { 0xd433179d9c8cb841ULL,   986 },
+      { 0x9e19db92b4e31ba9ULL,  1013 }, { 0xeb96bf6ebadf77d9ULL,  1039 }, { 0xaf87023b9bf0ee6bULL,  1066 }
+    };
 
-//---------------------------------------------------------------------------------------
-// Converter to f64.
-// # Returns:  a f64 interpretation of the specified section
-// Arg         start_pos - index position to start parsing string.
-// Arg         stop_pos_p - Address to store the index position where conversion stops.
-//             If it is set to nullptr, it is ignored.  (Default nullptr)
-// # Examples: f64 num = num_str.as_float64();
-// # See:      AString(real, significant), as_int32(), as_uint32_t()
-// # Notes:    The acceptable string form is as following:
-//
-//             [whitespace] [sign] [digits] [.digits] [{d | D | e | E} [sign] digits]
-//
-//             Whitespace may consist of space and tab characters, which are ignored.
-//             sign is either plus (+) or minus (-) and digits are one or more decimal
-//             digits.  If no digits appear before the radix character, at least one
-//             must appear after the radix character.  The decimal digits can be
-//             followed by an exponent, which consists of an introductory letter
-//             (d, D, e, or E) and an optionally signed integer.  If neither an exponent
-//             part nor a radix character appears, a radix character is assumed to
-//             follow the last digit in the string.  The first character that does not
-//             fit this form stops the scan.
-// # Author(s): Conan Reis
-f64 AString::as_float64(
-  uint32_t   start_pos,  // = 0u
-  uint32_t * stop_pos_p  // = nullptr
-  ) const
-  {
-  #ifdef A_BOUNDS_CHECK
-    bounds_check(start_pos, "as_float64");
-  #endif
+  //---------------------------------------------------------------------------------------
+  // Returns x * y rounded to the upper 64 bits of the 128-bit product
+  inline ADiyFp a_diyfp_mul(const ADiyFp & x, const ADiyFp & y)
+    {
+    uint64_t a   = x.m_f >> 32;
+    uint64_t b   = x.m_f & 0xffffffffu;
+    uint64_t c   = y.m_f >> 32;
+    uint64_t d   = y.m_f & 0xffffffffu;
+    uint64_t ac  = a * c;
+    uint64_t bc  = b * c;
+    uint64_t ad  = a * d;
+    uint64_t bd  = b * d;
+    uint64_t tmp = (bd >> 32) + (ad & 0xffffffffu) + (bc & 0xffffffffu) + (1u << 31);
+
+    ADiyFp result = {ac + (ad >> 32) + (bc >> 32) + (tmp >> 32), x.m_e + y.m_e + 64};
+
+    return result;
+    }
 
-  char * stop_char_p;
-  f64    value = ::strtod(&m_str_ref_p->m_cstr_p[start_pos], &stop_char_p);  // convert
+  //---------------------------------------------------------------------------------------
+  // Shifts value so that its highest bit is set - value must not be 0
+  inline ADiyFp a_diyfp_normalize(ADiyFp x)
+    {
+    if ((x.m_f >> 32) == 0u) { x.m_f <<= 32; x.m_e -= 32; }
+    if ((x.m_f >> 48) == 0u) { x.m_f <<= 16; x.m_e -= 16; }
+    if ((x.m_f >> 56) == 0u) { x.m_f <<= 8;  x.m_e -= 8; }
+    if ((x.m_f >> 60) == 0u) { x.m_f <<= 4;  x.m_e -= 4; }
+    if ((x.m_f >> 62) == 0u) { x.m_f <<= 2;  x.m_e -= 2; }
+    if ((x.m_f >> 63) == 0u) { x.m_f <<= 1;  x.m_e -= 1; }
+
+    return x;
+    }
 
-  if (stop_pos_p)
+  //---------------------------------------------------------------------------------------
+  // Nudges the last digit down while the result stays inside the rounding range and gets
+  // closer to the actual value.
+  inline void a_grisu_round(
+    char *   digits_p,
+    int      length,
+    uint64_t delta,
+    uint64_t rest,
+    uint64_t ten_kappa,
+    uint64_t wp_w
+    )
     {
-    *stop_pos_p = uint32_t(stop_char_p - m_str_ref_p->m_cstr_p);  // determine pos where conversion ended
+    while ((rest < wp_w) && ((delta - rest) >= ten_kappa)
+      && (((rest + ten_kappa) < wp_w) || ((wp_w - rest) > (rest + ten_kappa - wp_w))))
+      {
+      digits_p[length - 1]--;
+      rest += ten_kappa;
+      }
     }
-  return value;
-  }
 
-//---------------------------------------------------------------------------------------
-// Converter to f32.
-// # Returns:  a f32 interpretation of the specified section
-// Arg         start_pos - index position to start parsing string.
-// Arg         stop_pos_p - Address to store the index position where conversion stops.
-//             If it is set to nullptr, it is ignored.  (Default nullptr)
-// # Examples: f32 num = num_str.as_float32();
-// # See:      AString(real, significant), as_int32(), as_uint32_t()
-// # Notes:    The acceptable string form is as following:
-//
-//             [whitespace] [sign] [digits] [.digits] [{d | D | e | E} [sign] digits]
-//
-//             Whitespace may consist of space and tab characters, which are ignored.
-//             sign is either plus (+) or minus (-) and digits are one or more decimal
-//             digits.  If no digits appear before the radix character, at least one
-//             must appear after the radix character.  The decimal digits can be
-//             followed by an exponent, which consists of an introductory letter
-//             (d, D, e, or E) and an optionally signed integer.  If neither an exponent
-//             part nor a radix character appears, a radix character is assumed to
-//             follow the last digit in the string.  The first character that does not
-//             fit this form stops the scan.
-// # Author(s): Conan Reis
-f32 AString::as_float32(
-  uint32_t   start_pos,  // = 0u
-  uint32_t * stop_pos_p  // = nullptr
-  ) const
-  {
-  #ifdef A_BOUNDS_CHECK
-    bounds_check(start_pos, "as_float64");
-  #endif
+  //---------------------------------------------------------------------------------------
+  // Generates the shortest decimal digits for a value v = f * 2^e (f != 0) which has the
+  // given rounding boundaries.
+  // # Returns:  number of digits (at most 17) - value is digits_p * 10^(*exp10_p)
+  // Arg         f, e - value
+  // Arg         lower_closer - true if the lower boundary is half as far as the upper
+  //             boundary which happens at powers of 2.
+  // Arg         digits_p - buffer for digits - no sign, decimal point or null terminator
+  // Arg         exp10_p - address to store decimal exponent of last digit
+  int a_grisu2(
+    uint64_t f,
+    int      e,
+    bool     lower_closer,
+    char *   digits_p,
+    int *    exp10_p
+    )
+    {
+    // Boundaries are halfway to the adjacent representable values
+    ADiyFp v     = {f, e};
+    ADiyFp plus  = {(f << 1) + 1u, e - 1};
+    ADiyFp minus = lower_closer ? ADiyFp{(f << 2) - 1u, e - 2} : ADiyFp{(f << 1) - 1u, e - 1};
 
-  // $Revisit - CReis Temp code
-  char * stop_char_p;
-  f32    value = f32(::strtod(&m_str_ref_p->m_cstr_p[start_pos], &stop_char_p));  // convert
+    plus       = a_diyfp_normalize(plus);
+    minus.m_f <<= minus.m_e - plus.m_e;
+    minus.m_e  = plus.m_e;
 
-  if (stop_pos_p)
-    {
-    *stop_pos_p = uint32_t(stop_char_p - m_str_ref_p->m_cstr_p);  // determine pos where conversion ended
-    }
-  return value;
-  }
+    // Scale by a cached power of ten so that the exponent is in the range [-60, -32]
+    f64 dk    = f64(-61 - plus.m_e) * 0.30102999566398114 + 347.0;
+    int k     = int(dk);
 
-//---------------------------------------------------------------------------------------
-// Converter to int32_t
-// # Returns:  a int32_t interpretation of the specified section
-// Arg         start_pos - index position to start parsing string.  (Default 0u)
-// Arg         stop_pos_p - Address to store the index position where conversion stops.
-//             If it is set to nullptr, it is ignored.  (Default nullptr)
-// Arg         base - (or radix) sets the numerical base that should be expected.
-//             Acceptable values are from 2 to 36.  If base is AString_determine_base (0),
-//             the initial characters are used to determine the base.  If the first
-//             character is 0 and the second character is not 'x' or 'X', the string is
-//             interpreted as an octal (base 8) integer; otherwise, it is interpreted as
-//             a decimal number.  If the first character is '0' and the second character
-//             is 'x' or 'X', the string is interpreted as a hexadecimal integer.  If
-//             the first character is '1' through '9', the string is interpreted as a
-//             decimal integer.  (Default AString_determine_base)
-// # Examples: int32_t num = num_str.as_int32();
-// # See:      AString(integer, base), as_uint32_t(), as_real64()
-// # Notes:    The acceptable string form is as following:
-//
-//             [whitespace] [{+ | -}] [0 [{ x | X }]] [digits]
-//
-//             Whitespace may consist of space and tab characters, which are ignored.
-//             digits are one or more decimal digits.  The letters 'a' through 'z'
-//             (or 'A' through 'Z') are assigned the values 10 through 35; only letters
-//             whose assigned values are less than 'base' are permitted.  A plus (+) or
-//             minus (-) sign is allowed as a prefix; a leading minus sign indicates
-//             that the return value is negated.  The first character that does not fit
-//             this form stops the scan.  
-// # Author(s): Conan Reis
-int AString::as_int(
-  uint32_t   start_pos,  // = 0u
-  uint32_t * stop_pos_p, // = nullptr
-  uint32_t   base        // = AString_def_base
-  ) const
-  {
-  char *  stop_char_p;
-  int32_t value;
+    if ((dk - f64(k)) > 0.0)
+      {
+      k++;
+      }
 
-  #ifdef A_BOUNDS_CHECK
-    bounds_check(start_pos, "as_int32");
+    uint32_t        index = uint32_t((k >> 3) + 1);
+    const ADiyFp &  c_mk  = g_cached_pow10[index];
+
+    ADiyFp w  = a_diyfp_mul(a_diyfp_normalize(v), c_mk);
+    ADiyFp wp = a_diyfp_mul(plus, c_mk);
+    ADiyFp wm = a_diyfp_mul(minus, c_mk);
+
+    wm.m_f++;
+    wp.m_f--;
+
+    // Generate digits
+    int      kexp   = 348 - int(index << 3);
+    int      shift  = -wp.m_e;
+    uint64_t one_f  = uint64_t(1u) << shift;
+    uint64_t wp_w   = wp.m_f - w.m_f;
+    uint64_t delta  = wp.m_f - wm.m_f;
+    uint32_t p1     = uint32_t(wp.m_f >> shift);
+    uint64_t p2     = wp.m_f & (one_f - 1u);
+    int      kappa  = int(a_decimal_digits(p1));
+    int      length = 0;
+    uint32_t divisor;
+    uint32_t digit;
+    uint64_t rest;
+
+    while (kappa > 0)
+      {
+      divisor = uint32_t(g_pow10[kappa - 1]);
+      digit   = p1 / divisor;
+      p1     %= divisor;
 
-    A_VERIFY(a_is_ordered(AString_determine_base, base, AString_max_base), a_cstr_format("invalid numerical base/radix \nExpected 1-37, but given %u", base), ErrId_invalid_base, AString);
-  #endif
+      if (digit || length)
+        {
+        digits_p[length++] = char('0' + digit);
+        }
 
-  value = int32_t(strtol(&m_str_ref_p->m_cstr_p[start_pos], &stop_char_p, int(base)));
+      kappa--;
+      rest = (uint64_t(p1) << shift) + p2;
 
-  if (stop_pos_p)
-    {
-    *stop_pos_p = uint32_t(ptrdiff_t(stop_char_p) - ptrdiff_t(m_str_ref_p->m_cstr_p));  // determine pos where conversion ended
-    }
+      if (rest <= delta)
+        {
+        *exp10_p = kexp + kappa;
+        a_grisu_round(digits_p, length, delta, rest, g_pow10[kappa] << shift, wp_w);
 
-  return value;
-  }
+        return length;
+        }
+      }
 
-//---------------------------------------------------------------------------------------
-// Converter to uint32_t
-// # Returns:  a uint32_t interpretation of the specified section
-// Arg         start_pos - index position to start parsing string.  (Default 0u)
-// Arg         stop_pos_p - Address to store the index position where conversion stops.
-//             If it is set to nullptr, it is ignored.  (Default nullptr)
-// Arg         base - (or radix) sets the numerical base that should be expected.
-//             Acceptable values are from 2 to 36.  If base is AString_determine_base (0),
-//             the initial characters are used to determine the base.  If the first
-//             character is 0 and the second character is not 'x' or 'X', the string is
-//             interpreted as an octal (base 8) integer; otherwise, it is interpreted as
-//             a decimal number.  If the first character is '0' and the second character
-//             is 'x' or 'X', the string is interpreted as a hexadecimal integer.  If
-//             the first character is '1' through '9', the string is interpreted as a
-//             decimal integer.  (Default AString_determine_base)
-// # Examples: int32_t num = num_str.as_int32();
-// # Notes:    The acceptable string form is as following:
-//
-//             [whitespace] [0 [{ x | X }]] [digits]
-//
-//             Whitespace may consist of space and tab characters, which are ignored.
-//             digits are one or more decimal digits.  The letters 'a' through 'z'
-//             (or 'A' through 'Z') are assigned the values 10 through 35; only letters
-//             whose assigned values are less than 'base' are permitted.  The first
-//             character that does not fit this form stops the scan.  
-// # Author(s): Conan Reis
-uint AString::as_uint(
-  uint32_t   start_pos,  // = 0u
-  uint32_t * stop_pos_p, // = nullptr
-  uint       base        // = AString_def_base
-  ) const
-  {
-  char *   stop_char_p;
-  uint32_t value;
-  
-  #ifdef A_BOUNDS_CHECK
-    bounds_check(start_pos, "as_uint32_t");
+    A_LOOP_INFINITE
+      {
+      p2    *= 10u;
+      delta *= 10u;
+      digit  = uint32_t(p2 >> shift);
 
-    A_VERIFY(a_is_ordered(AString_determine_base, base, AString_max_base), a_cstr_format("invalid numerical base/radix \nExpected 1-37, but given %u", base), ErrId_invalid_base, AString);
-  #endif
+      if (digit || length)
+        {
+        digits_p[length++] = char('0' + digit);
+        }
 
-  value = uint32_t(strtoul(&m_str_ref_p->m_cstr_p[start_pos], &stop_char_p, int(base)));
+      p2 &= one_f - 1u;
+      kappa--;
 
-  if (stop_pos_p)
-    {
-    *stop_pos_p = uint32_t(stop_char_p - m_str_ref_p->m_cstr_p);  // determine pos where conversion ended
-    }
+      if (p2 < delta)
+        {
+        *exp10_p = kexp + kappa;
+        a_grisu_round(digits_p, length, delta, p2, one_f, (-kappa < 20) ? (wp_w * g_pow10[-kappa]) : 0u);
 
-  return value;
-  }
+        return length;
+        }
+      }
+    }
 
-//---------------------------------------------------------------------------------------
-//  Does a case-sensitive comparison of the current string at specified index
-//              to the supplied substring to determine if it is equal to, less than, or
-//              greater than it.
-// # Returns:   AEquate_equal, AEquate_less, or AEquate_greater
-// Arg          substr - sub-string to compare
-// # See:       icompare_sub() for a case-insensitive version.
-// # Author(s):  Conan Reis
-eAEquate AString::compare_sub(
-  const AString & substr,
-  uint32_t        index // = 0u
-  ) const
-  {
-  // $Revisit - CReis This should be profiled, but I believe that the custom code is faster
-  // than the commented out section below.
-  char * str1_p     = m_str_ref_p->m_cstr_p + index;
-  char * str1_end_p = str1_p + a_min(m_str_ref_p->m_length + 1u - index, substr.m_str_ref_p->m_length); // compare the # of characters in the shorter sub-string (without null)
-  char * str2_p     = substr.m_str_ref_p->m_cstr_p;
-
-  while (str1_p < str1_end_p)
+  //---------------------------------------------------------------------------------------
+  // Writes real number like printf("%g") with the given number of significant digits -
+  // though integral values in fixed notation keep a ".0" so that they still look like
+  // reals unless 'point_zero' is false.  Digits are the shortest that read back as the same value (see a_grisu2())
+  // which are then rounded if there are more than 'significant' of them.
+  // # Returns:  number of characters written without a terminating null character -
+  //             at most significant + AString_real_extra_chars - 1
+  // Arg         real - value to convert - if 'is_f32' is true it must be exactly
+  //             representable as a f32
+  // Arg         is_f32 - true if real came from a f32 so the shortest f32 digits are used
+  // Arg         significant - maximum number of significant digits
+  // Arg         point_zero - if true integral values in fixed notation end with ".0" and
+  //             if false they have no decimal point - exactly like printf("%g")
+  // Arg         cstr_p - buffer to write characters to
+  uint32_t a_real_to_cstr(
+    f64      real,
+    bool     is_f32,
+    uint32_t significant,
+    bool     point_zero,
+    char *   cstr_p
+    )
     {
-    if (*str1_p != *str2_p)  // if characters differ
+    char *   start_p = cstr_p;
+    bool     lower_closer;
+    int      exponent;
+    int      length;
+    int      idx;
+    char     digits_a[24];
+    uint64_t f;
+    int      e;
+    uint64_t bits;
+
+    memcpy(&bits, &real, sizeof(bits));
+
+    if ((bits >> 63) != 0u)
       {
-      // select appropriate result
-      return (*str1_p < *str2_p) ? AEquate_less : AEquate_greater;
+      *cstr_p++ = '-';
+      bits &= ~(uint64_t(1u) << 63);
       }
 
-    str1_p++;
-    str2_p++;
-    }
+    uint32_t biased = uint32_t(bits >> 52);
 
-  return AEquate_equal;
+    if (biased == 0x7ffu)
+      {
+      // Infinity or not a number
+      memcpy(cstr_p, ((bits << 12) != 0u) ? "nan" : "inf", 3u);
 
+      return uint32_t(cstr_p - start_p) + 3u;
+      }
 
-  // Alternate method using standard library functions.
-  //int result = ::strncmp(
-  //  m_str_ref_p->m_cstr_p + index,
-  //  substr.m_str_ref_p->m_cstr_p,
-  //  a_min(m_str_ref_p->m_length - index, substr.m_str_ref_p->m_length));
-  // 
-  // This is a funky way to convert < 0 to -1, > 0 to 1, and 0 to stay 0
-  //return static_cast<eAEquate>((result > 0) ? 1 : result >> 31);
-  }
+    if (bits == 0u)
+      {
+      memcpy(cstr_p, "0.0", 3u);
 
-//---------------------------------------------------------------------------------------
-//  Does a case-insensitive comparison of the current string at specified
-//              index to the supplied substring to determine if it is equal to, less than,
-//              or greater than it.
-// # Returns:   AEquate_equal, AEquate_less, or AEquate_greater
-// Arg          substr - sub-string to compare
-// # See:       compare_sub() for a case-sensitive version.
-// # Author(s):  Conan Reis
-eAEquate AString::icompare_sub(
-  const AString & substr,
-  uint32_t        index // = 0u
-  ) const
-  {
-  // $Revisit - CReis This should be profiled, but I believe that the custom code is faster
-  // than the commented out section below.
-  uint8_t * str1_p     = reinterpret_cast<uint8_t *>(m_str_ref_p->m_cstr_p + index);
-  uint8_t * str1_end_p = str1_p + a_min(m_str_ref_p->m_length + 1u - index, substr.m_str_ref_p->m_length); // compare the # of characters in the shorter sub-string (without null)
-  uint8_t * str2_p     = reinterpret_cast<uint8_t *>(substr.m_str_ref_p->m_cstr_p);
-  char ch1, ch2;
+      return uint32_t(cstr_p - start_p) + (point_zero ? 3u : 1u);
+      }
 
-  while (str1_p < str1_end_p)
-    {
-    ch1 = ms_char2lower[*str1_p];
-    ch2 = ms_char2lower[*str2_p];
+    if (is_f32)
+      {
+      f32      real32 = f32(real);
+      uint32_t bits32;
 
-    if (ch1 != ch2)  // if characters differ
+      memcpy(&bits32, &real32, sizeof(bits32));
+      biased = (bits32 >> 23) & 0xffu;
+      f      = bits32 & 0x7fffffu;
+      e      = biased ? (int(biased) - 150) : -149;
+
+      if (biased)
+        {
+        f |= 0x800000u;
+        }
+
+      lower_closer = (f == 0x800000u) && (biased > 1u);
+      }
+    else
       {
-      // select appropriate result
-      return (ch1 < ch2) ? AEquate_less : AEquate_greater;
+      f = bits & 0xfffffffffffffULL;
+      e = biased ? (int(biased) - 1075) : -1074;
+
+      if (biased)
+        {
+        f |= 0x10000000000000ULL;
+        }
+
+      lower_closer = (f == 0x10000000000000ULL) && (biased > 1u);
       }
 
-    str1_p++;
-    str2_p++;
-    }
+    length = a_grisu2(f, e, lower_closer, digits_a, &exponent);
 
-  return AEquate_equal;
+    if (significant == 0u)
+      {
+      significant = 1u;
+      }
 
+    // Round to requested precision
+    if (uint32_t(length) > significant)
+      {
+      int  sig_length = int(significant);
+      bool round_up   = digits_a[sig_length] >= '5';
+      bool use_crt    = false;
 
-  // Alternate method using standard library functions.
-  //int result = ::_strnicmp(
-  //  m_str_ref_p->m_cstr_p + index,
-  //  substr.m_str_ref_p->m_cstr_p,
-  //  a_min(m_str_ref_p->m_length - index, substr.m_str_ref_p->m_length));
-  // 
-  // This is a funky way to convert < 0 to -1, > 0 to 1, and 0 to stay 0
-  //return static_cast<eAEquate>((result > 0) ? 1 : result >> 31);
-  }
+      if ((length == (sig_length + 1)) && (digits_a[sig_length] == '5'))
+        {
+        // The shortest digits end on a tie though the actual value is usually slightly
+        // above or below it.  f32 values in the usual range are compared exactly against
+        // the midpoint using f64 math and anything else lets the C runtime do the exact
+        // rounding.
+        if (is_f32 && (exponent >= -22) && (exponent <= 22))
+          {
+          uint64_t mid_digits = 0u;
 
-//---------------------------------------------------------------------------------------
-//  Does a case-sensitive comparison of the current string to the supplied
-//              string to determine if they are equal.
-// # Returns:   true if equal, false if not
-// Arg          str - string to compare
-// # See:       is_equal() for a case-sensitive version.
-// # Author(s):  Conan Reis
-bool AString::is_equal(const AString & str) const
-  {
-  return m_str_ref_p->is_equal(*str.m_str_ref_p);
-  }
+          for (idx = 0; idx < length; idx++)
+            {
+            mid_digits = (mid_digits * 10u) + uint64_t(digits_a[idx] - '0');
+            }
 
-//---------------------------------------------------------------------------------------
-//  Does a case-insensitive comparison of the current string to the supplied
-//              string to determine if they are equal.
-// # Returns:   true if equal, false if not
-// Arg          str - string to compare
-// # See:       is_equal() for a case-sensitive version.
-// # Author(s):  Conan Reis
-bool AString::is_iequal(const AString & str) const
-  {
-  // $Revisit - CReis This should be profiled, but I believe that the custom code is faster
-  // than the standard library calls.
-  uint32_t length = m_str_ref_p->m_length;
+          f64 midpoint  = (exponent >= 0)
+            ? f64(mid_digits) * g_pow10_f64[exponent]
+            : f64(mid_digits) / g_pow10_f64[-exponent];
+          f64 magnitude = (real < 0.0) ? -real : real;
 
-  if (length != str.m_str_ref_p->m_length)
-    {
-    return false;
-    }
+          // Exact ties round to even like the C runtime
+          round_up = (magnitude > midpoint)
+            || ((magnitude == midpoint) && (((digits_a[sig_length - 1] - '0') & 1) != 0));
+          }
+        else
+          {
+          use_crt = true;
+          }
+        }
 
-  uint8_t * str1_p     = reinterpret_cast<uint8_t *>(m_str_ref_p->m_cstr_p);
-  uint8_t * str1_end_p = str1_p + length;  // Don't bother comparing null character
-  uint8_t * str2_p     = reinterpret_cast<uint8_t *>(str.m_str_ref_p->m_cstr_p);
-  char ch1, ch2;
+      if (use_crt)
+        {
+        char exact_a[40];
 
-  while (str1_p < str1_end_p)
-    {
-    ch1 = ms_char2lower[*str1_p];
-    ch2 = ms_char2lower[*str2_p];
+        ::_snprintf(exact_a, sizeof(exact_a), "%.*e", sig_length - 1, is_f32 ? f64(f32(real)) : real);
+        exact_a[sizeof(exact_a) - 1u] = '\0';
 
-    if (ch1 != ch2)  // if characters differ
+        char * exact_p = exact_a + ((exact_a[0] == '-') ? 1 : 0);
+        int    digit_count = 0;
+
+        for (; (*exact_p != 'e') && (*exact_p != '\0'); exact_p++)
+          {
+          if (*exact_p != '.')
+            {
+            digits_a[digit_count++] = *exact_p;
+            }
+          }
+
+        length   = digit_count;
+        exponent = ::atoi(exact_p + 1) - (length - 1);
+        }
+      else
+        {
+        exponent += length - sig_length;
+        length    = sig_length;
+
+        if (round_up)
+          {
+          int idx = length - 1;
+
+          while ((idx >= 0) && (digits_a[idx] == '9'))
+            {
+            idx--;
+            }
+
+          if (idx >= 0)
+            {
+            digits_a[idx]++;
+            length = idx + 1;
+            exponent += sig_length - length;
+            }
+          else
+            {
+            // All nines rolled over to a power of 10
+            digits_a[0] = '1';
+            exponent   += length;
+            length      = 1;
+            }
+          }
+        }
+      }
+
+    // Trailing zeros are not significant
+    while ((length > 1) && (digits_a[length - 1] == '0'))
       {
-      // select appropriate result
-      return false;
+      length--;
+      exponent++;
       }
 
-    str1_p++;
-    str2_p++;
+    // Decimal exponent of first digit
+    int exp10 = length + exponent - 1;
+
+    if ((exp10 < -4) || (exp10 >= int(significant)))
+      {
+      // Scientific notation
+      *cstr_p++ = digits_a[0];
+
+      if (length > 1)
+        {
+        *cstr_p++ = '.';
+        memcpy(cstr_p, digits_a + 1, size_t(length - 1));
+        cstr_p += length - 1;
+        }
+
+      *cstr_p++ = 'e';
+      *cstr_p++ = (exp10 < 0) ? '-' : '+';
+
+      if (exp10 < 0)
+        {
+        exp10 = -exp10;
+        }
+
+      if (exp10 < 10)
+        {
+        *cstr_p++ = '0';
+        }
+
+      cstr_p += a_uint_to_cstr(uint32_t(exp10), 10u, cstr_p);
+      }
+    else
+      {
+      if (exp10 >= 0)
+        {
+        // Integral part
+        for (idx = 0; idx <= exp10; idx++)
+          {
+          *cstr_p++ = (idx < length) ? digits_a[idx] : '0';
+          }
+
+        if (length > (exp10 + 1))
+          {
+          *cstr_p++ = '.';
+          memcpy(cstr_p, digits_a + exp10 + 1, size_t(length - exp10 - 1));
+          cstr_p += length - exp10 - 1;
+          }
+        else if (point_zero)
+          {
+          *cstr_p++ = '.';
+          *cstr_p++ = '0';
+          }
+        }
+      else
+        {
+        *cstr_p++ = '0';
+        *cstr_p++ = '.';
+
+        for (idx = exp10 + 1; idx < 0; idx++)
+          {
+          *cstr_p++ = '0';
+          }
+
+        memcpy(cstr_p, digits_a, size_t(length));
+        cstr_p += length;
+        }
+      }
+
+    return uint32_t(cstr_p - start_p);
     }
 
-  return true;
-  }
+} // End unnamed namespace
+
+
+//=======================================================================================
+// AString Class Data Members
+//=======================================================================================
+
+// Defined in AgogCore/AgogCore.cpp
+
 
+//=======================================================================================
+// Method Definitions
+//=======================================================================================
 
 //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
-// Modifying Methods
+// Converter methods
 //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
 
 //---------------------------------------------------------------------------------------
-// Appends a C-string to the current string.
+// Constructor from character array buffer.  Refers to a persistent
+//             null-terminated C-String or makes its own copy of an existing character
+//             array.
 // # Returns:  itself
-// Arg         cstr_p - pointer to array of characters to append (does not need to be
-//             null terminated unless length is equal to ALength_calculate).  'cstr_p'
-//             should never be nullptr.
-// Arg         length - number of characters to use in 'cstr_p'.
-//             'length' may also be set to ALength_calculate in which case the character
-//             length is calculated by finding the first terminating null character
-//             already present in the 'cstr_p'.
-// # See:      append(str), insert(), set_cstr(), set_buffer(), add(), operator+=(),
-//             operator+(), operator=()
+// Arg         cstr_p - pointer to array of characters.  'cstr_p' should never be nullptr.
+//             'cstr_p' will usually be a string literal or if 'persistent' is false,
+//             'cstr_p' may be any C-String that this string should make a copy of.
+// Arg         persistent - Indicates whether the data pointed to by cstr_p will be
+//             available for the lifetime of this string.  If 'persistent' is true, the
+//             memory pointed to by 'cstr_p' will be used rather than having this object
+//             allocate its own memory - also the memory pointed to by 'cstr_p' will not
+//             be written to.  If 'persistent' is false, then this AString object will
+//             allocate its own memory and copy the contents of 'cstr_p' to it.
+//             (Default true)
+// # See:      AString(cstr_p), AString(buffer_p, size, length, deallocate)
+// # Notes:    If any modifying methods are called on this string, it will first make
+//             its own unique copy of the C-String before it writes to it.
 // # Author(s): Conan Reis
-void AString::append(
+AString::AString(
   const char * cstr_p,
-  uint32_t     length // = ALength_calculate
+  bool         persistent
   )
   {
-  A_ASSERT(cstr_p != nullptr, "Given nullptr instead of valid C-String", ErrId_null_cstr, AString);
+  //A_ASSERT(cstr_p != nullptr, "Given nullptr instead of valid C-String", ErrId_null_cstr, AString);
 
-  if (length == ALength_calculate)
-    {
-    length = uint32_t(::strlen(cstr_p));
-    }
+  uint32_t length = uint32_t(::strlen(cstr_p));
 
-  if (length)
-    {
-    // Calculate total length of string
-    uint32_t total_length = m_str_ref_p->m_length + length;
-
-    ensure_size(total_length);
-    
-    // concatenate new string
-    memcpy(m_str_ref_p->m_cstr_p + m_str_ref_p->m_length, cstr_p, size_t(length));
-    
-    m_str_ref_p->m_length               = total_length;
-    m_str_ref_p->m_cstr_p[total_length] = '\0';    // Place a terminating character
-    }
+  m_str_ref_p = (persistent)
+    ? AStringRef::pool_new(cstr_p, length, length + 1u, 1u, false, true)
+    : AStringRef::pool_new_copy(cstr_p, length);
   }
 
 //---------------------------------------------------------------------------------------
-// Appends the the specified formatted string to the internal C-String.
-// Arg         format_str_p - follows the same format as the C printf(), sprintf(), etc.
-//             See the MSDev online help for 'Format Specification Fields' for a
-//             description. 
-// Arg         ... - variable length arguments expected by the formatted string.
-//
-//             #### IMPORTANT #### Since the variable length arguments do not specify a
-//             type to the compiler the types passes must be determined via the standard
-//             C string formatting functions.  So if a AString *object* is passed in as
-//             one of the untyped variable length arguments, the compiler will not know
-//             to coerce it to a C-String the C format functions will then treat the
-//             address of the AString object as if it were a C-String with disastrous
-//             results.  When using the string format type specifier (%s) and a AString
-//             object (or a ASymbol object) use 'str.as_cstr()'.
-//
-// # Examples: AString name("Joe");     // Example substring to append
-//             AString str("Hello");    // character length is 5 buffer size is 6
-//             str.ensure_size(100u);  // character length is 5 buffer size is 101
-//             str.append_format(" %i you %s %s", 2, name.as_cstr(), "Developer");
-//             // str is now "Hello 2 you Joe Developer"
-//             // character length is 25 buffer size is 101
-//
-// # See:      format(), AString(max_size, format_str_p, ...)
-// # Notes:    If the sum of the current number of characters and the characters in the
-//             expanded format string are larger than the size of this string's current
-//             character buffer, then any characters above and beyond the buffer size
-//             will be truncated.  So it is important that the maximum potential buffer
-//             size has been allocated before this method is called - this can be
-//             easily achieved by calling ensure_size() prior to calling this method.
+// Constructor from character array buffer.  Refers to a persistent
+//             null-terminated C-String or makes its own copy of an existing character
+//             array.
+// # Returns:  itself
+// Arg         cstr_p - pointer to array of characters (does not need to be null
+//             terminated unless length is equal to ALength_calculate).  'cstr_p' should
+//             never be nullptr.  'cstr_p' will usually be a string literal or if
+//             'persistent' is false, 'cstr_p' may be any C-String that this string
+//             should make a copy of.
+// Arg         length - number of characters to use in 'cstr_p' and the index position to
+//             place a terminating null character.  The given length must not be more
+//             than the size of 'cstr_p' and the C-String buffer pointed to by 'cstr_p'
+//             should not have any null characters less then the given length.  A null
+//             terminator is placed only if 'persistent' is not true.
+//             'length' may also be set to ALength_calculate in which case the character
+//             length is calculated by finding the first terminating null character
+//             already present in 'cstr_p'.
+// Arg         persistent - Indicates whether the data pointed to by cstr_p will be
+//             available for the lifetime of this string.  If 'persistent' is true, the
+//             memory pointed to by 'cstr_p' will be used rather than having this object
+//             allocate its own memory - also the memory pointed to by 'cstr_p' will not
+//             be written to.  If 'persistent' is false, then this AString object will
+//             allocate its own memory and copy the contents of 'cstr_p' to it.
+// # See:      AString(cstr_p), AString(buffer_p, size, length, deallocate)
+// # Notes:    If any modifying methods are called on this string, it will first make
+//             its own unique copy of the C-String before it writes to it.
 // # Author(s): Conan Reis
-void AString::append_format(const char * format_str_p, ...)
+AString::AString(
+  const char * cstr_p,
+  uint32_t     length,
+  bool         persistent // = true
+  )
   {
-  uint32_t length    = m_str_ref_p->m_length;
-  uint32_t size      = m_str_ref_p->m_size;
-  int      free_size = int(size - length) - 1;  // excluding null terminator
+  //A_ASSERT(cstr_p != nullptr, "Given nullptr instead of valid C-String", ErrId_null_cstr, AString);
 
-  if (free_size > 0)
+  if (length == ALength_calculate)
     {
-    va_list args;  // initialize argument list
-
-    // Ensure buffer is writable and remains the same size
-    ensure_size(size - 1u);
-
-    va_start(args, format_str_p);
-
-    #ifdef A_PLAT_PS3
-      int fmt_length = vsnprintf(m_str_ref_p->m_cstr_p + length, size_t(free_size + 1), format_str_p, args);
-    #else
-      int fmt_length = _vsnprintf(m_str_ref_p->m_cstr_p + length, size_t(free_size), format_str_p, args);
-    #endif
-
-    va_end(args);  // end argument list processing
-
-    if ((fmt_length == -1) || (fmt_length == free_size))  // More characters than buffer has, so truncate
-      {
-      fmt_length = free_size;
-      m_str_ref_p->m_cstr_p[length + fmt_length] = '\0';     // Put in null-terminator
-      }
-
-    m_str_ref_p->m_length += uint32_t(fmt_length);
+    length = uint32_t(::strlen(cstr_p));
     }
+
+  m_str_ref_p = (persistent)
+    ? AStringRef::pool_new(cstr_p, length, length + 1u, 1u, false, true)
+    : AStringRef::pool_new_copy(cstr_p, length);
   }
 
 //---------------------------------------------------------------------------------------
-// Removes all the characters but the substring starting at 'pos' with a
-//             length of 'char_count'.
-// Arg         pos - starting character index position of substring to crop
-// Arg         char_count - number of characters that the remaining substring should
-//             have.  If 'char_count' is ALength_remainder, the number of characters is
-//             equal to the 'length of the string' - 'pos'.  (Default ALength_remainder)
-// # Examples: AString str("  the quick brown fox  ");
-// 
-//             str.crop(3u, 12u);  // str is now "he quick bro"
-// # See:      crop_quick(), crop(match_type), trim(), truncate(),
-//             remove_all(match_type), find(match_type)
-// # Notes:    This method checks if 'pos' and 'char_count' are valid if A_BOUNDS_CHECK
-//             is defined (defined by default in debug builds).
+// Constructor from character array buffer.  See the description of the
+//             argument 'buffer_p' for the three possible uses of this constructor.
+// # Returns:  itself
+// Arg         buffer_p - pointer to array of characters (does not need to be null
+//             terminated unless 'length' is equal to ALength_calculate).  If 'buffer_p'
+//             is nullptr, 'length' and 'deallocate' are ignored.  There are in general 3
+//             different types of values that 'buffer_p' will be given:
+//               1. A temporary buffer which is allocated on the stack or is recovered
+//                  by some other means.
+//               2. A pre-allocated character array that this AString object should take
+//                  over responsibility for.
+//               3. nullptr.  This then creates an empty string with a space of 'size'
+//                  already allocated including the null terminating character.
+// Arg         size - This is the size in bytes of the memory pointed to by 'buffer_p'
+//             or if 'buffer_p' is nullptr, it is the initial memory size that should be 
+//             allocated by this string.  Also note that this size must include the null
+//             terminating character, so 'size' should never be less than 1 and it
+//             should always be greater then the length.
+// Arg         length - number of characters to use in 'buffer_p' and the index position
+//             to place a terminating null character.  The given length must not be more
+//             than the size of 'buffer_p' and the C-String buffer pointed to by
+//             'buffer_p' should not have any null characters less then the given length.
+//             'length' may also be set to ALength_calculate in which case the character
+//             length is calculated by finding the first terminating null character
+//             already present in 'buffer_p'.
+// Arg         deallocate - Indicates whether this string (or more specifically the
+//             AStringRef) should take control of the memory pointed to by buffer_p and
+//             do deallocate it when it is no longer in use.
+// # See:      AString(cstr_p), AString(cstr_p, length, persistent)
+// # Notes:    To make a copy of a C-String call AString(cstr_p, length, persistent = false).
+//             To reference a C-String literal call AString(cstr_p) or
+//             AString(cstr_p, length, persistent = true)
 // # Author(s): Conan Reis
-void AString::crop(
-  uint32_t pos,
-  uint32_t char_count // = ALength_remainder
+AString::AString(
+  const char * buffer_p,
+  uint32_t     size,
+  uint32_t     length,
+  bool         deallocate // = false
   )
   {
-  AStringRef * str_ref_p = m_str_ref_p;
-
-  if (char_count == ALength_remainder)
+  if (buffer_p)
     {
-    char_count = str_ref_p->m_length - pos;
-    }
+    if (length == ALength_calculate)
+      {
+      length = uint32_t(::strlen(buffer_p));
+      }
 
-  if (char_count)
-    {
-    #ifdef A_BOUNDS_CHECK
-      span_check(pos, char_count, "crop");
-    #endif
+    A_ASSERT(size > length, a_cstr_format("Supplied size (%u) is not large enough for supplied length (%u)", size, length), ErrId_null_cstr, AString);
 
-    crop_quick(pos, char_count);
+    m_str_ref_p = AStringRef::pool_new(buffer_p, length, size, 1u, deallocate, false);
+    m_str_ref_p->m_cstr_p[length] = '\0';  // Put in null-terminator
     }
-  else
+  else  // nullptr, so create empty AString with specified buffer size
     {
-    empty();
+    m_str_ref_p = AStringRef::pool_new_buffer(size, 0u, 1u);
+    m_str_ref_p->m_cstr_p[0] = '\0';  // Put in null-terminator
     }
   }
 
 //---------------------------------------------------------------------------------------
-// Removes all the characters of match_type from the beginning and the end
-//             of the string until it encounters a character that is not match_type.
-// Arg         match_type - classification of characters to remove.
-//             (Default ACharMatch_white_space)
-// # Examples: AString str("  the quick brown fox  ");
-// 
-//             str.crop();  // str is now "the quick brown fox"
-// # See:      trim(), truncate(), remove_all(match_type), find(match_type),
-//             not_char_type()
+// Constructor / converter from a formatted string.
+// # Returns:  a reference to itself
+// Arg         max_size - sets the initial character buffer size (not including the null
+//             terminator character).  This is essentially the maximum allowable
+//             characters - if the number of the characters in the expanded format
+//             string are larger than 'max_size' then any characters above and beyond 
+//             that number will be truncated.
+// Arg         format_str_p - follows the same format as the C printf(), sprintf(), etc.
+//             See the MSDev online help for 'Format Specification Fields' for a
+//             description. 
+// Arg         ... - variable length arguments expected by the formatted string.
+//
+//             #### IMPORTANT #### When using the string format type specifier (%s) in
+//             the format string and a AString object (or a ASymbol object) is passed in
+//             as one of the variable length arguments, use 'str.as_cstr()'.
+//             Variable length arguments do not specify a type to the compiler, instead
+//             the types of the passed arguments are determined via the standard C
+//             string formatting functions - i.e %s, %u, %f, etc.  So if a string type
+//             (%s) is specified in the format string and a AString object is passed as
+//             one of the untyped variable length arguments, the compiler will not know
+//             to coerce the AString object to a C-String - it will instead treat the
+//             address of the AString object argument as if it were a C-String character
+//             array with disastrous results.
+//
+// # Examples: AString begin("The answer");  // Example substring to append
+//             AString str(100u, "%s to %s is %i", begin.as_cstr(), "everything", 42);
+//             // str is equal to "The answer to everything is 42"
+//             // character length is 30, buffer size is 101
+//
+// # See:      format(), append_format()
 // # Author(s): Conan Reis
-AString & AString::crop(
-  eACharMatch match_type // = ACharMatch_white_space
+AString::AString(
+  uint         max_size,
+  const char * format_str_p,
+  ...
   )
   {
-  uint32_t    start_pos;
-  eACharMatch not_type = not_char_type(match_type);
+  va_list      args;  // initialize argument list
+  AStringRef * str_ref_p = AStringRef::pool_new_buffer(max_size, 0u, 1u);  // get buffer
+  char *       cstr_p    = str_ref_p->m_cstr_p;
 
-  if (find(not_type, 1u, &start_pos))
-    {
-    uint32_t end_pos;
+  va_start(args, format_str_p);
 
-    find_reverse(not_type, 1u, &end_pos);
-    crop_quick(start_pos, end_pos - start_pos + 1u);
-    }
-  else
+  #if defined(A_PLAT_PS3) || defined(A_PLAT_PS4)
+    int length = vsnprintf(cstr_p, size_t(max_size + 1), format_str_p, args);
+  #else
+    int length = _vsnprintf(cstr_p, size_t(max_size), format_str_p, args);
+  #endif
+
+  va_end(args);  // end argument list processing
+
+  if ((length == -1) || (length == int(max_size))) // More characters than buffer has, so truncate
     {
-    empty();
+    length           = int(max_size);
+    cstr_p[max_size] = '\0';     // Put in null-terminator
     }
 
-  return *this;
+  str_ref_p->m_length = uint32_t(length);
+  m_str_ref_p         = str_ref_p;
   }
 
 //---------------------------------------------------------------------------------------
-// Removes all the characters but the substring starting at 'pos' with a
-//             length of 'char_count'.
-// Arg         pos - starting character index position of substring to crop
-// Arg         char_count - number of characters that the remaining substring should
-//             have - it should be at least 1.
-// # Examples: AString str("  the quick brown fox  ");
-// 
-//             str.crop(3u, 12u);  // str is now "he quick bro"
-// # See:      crop_quick(), crop(match_type), trim(), truncate(),
-//             remove_all(match_type), find(match_type)
-// # Notes:    This method does *not* check if 'pos' and 'char_count' are valid even if
-//             A_BOUNDS_CHECK is defined.
-// # Author(s): Conan Reis
-void AString::crop_quick(
-  uint32_t pos,
-  uint32_t char_count
-  )
+// Constructor from byte stream info
+// Arg         source_stream_pp - Pointer to address to read byte stream / binary
+//             serialization info from and to increment - previously filled using
+//             as_binary() or a similar mechanism.
+// # See:      as_binary(), assign_binary()
+// # Notes:    Used in combination with as_binary()
+//
+//             Binary composition:
+//               4 bytes - string length
+//               n bytes - string
+// # Author(s):  Conan Reis
+AString::AString(const void ** source_stream_pp)
   {
-  AStringRef * str_ref_p = m_str_ref_p;
+  // 4 bytes - string length
+  uint32_t length = A_BYTE_STREAM_UI32_INC(source_stream_pp);
 
-  if (char_count == str_ref_p->m_length)
-    {
-    // Keeping whole string - no need to do anything
-    return;
-    }
+  m_str_ref_p = AStringRef::pool_new_buffer(length, length, 1u);
 
-  // If unique and writable
-  if ((str_ref_p->m_ref_count + str_ref_p->m_read_only) == 1u)
-    {
-    if (pos)
-      {
-      // Shift down
-      memmove(str_ref_p->m_cstr_p, str_ref_p->m_cstr_p + pos, char_count);
-      }
+  // n bytes - string
+  memcpy(m_str_ref_p->m_cstr_p, *(char **)source_stream_pp, length);
+  m_str_ref_p->m_cstr_p[length] = '\0';
+  (*(uint8_t **)source_stream_pp) += length;
+  }
 
-    str_ref_p->m_cstr_p[char_count] = '\0';
-    str_ref_p->m_length             = char_count;
-    }
-  else  // Shared or read-only
-    {
-    uint32_t size     = AStringRef::request_char_count(char_count + 1u);
-    char *   buffer_p = AStringRef::alloc_buffer(size);
+//---------------------------------------------------------------------------------------
+// Assignment from byte stream info
+// Arg         source_stream_pp - Pointer to address to read byte stream / binary
+//             serialization info from and to increment - previously filled using
+//             as_binary() or a similar mechanism.
+// # See:      as_binary(), assign_binary()
+// # Notes:    Used in combination with as_binary()
+//
+//             Binary composition:
+//               4 bytes - string length
+//               n bytes - string
+// # Author(s):  Conan Reis
+AString & AString::assign_binary(const void ** source_stream_pp)
+  {
+  // 4 bytes - string length
+  uint32_t length = A_BYTE_STREAM_UI32_INC(source_stream_pp);
 
-    memcpy(buffer_p, str_ref_p->m_cstr_p + pos, size_t(char_count));
-    buffer_p[char_count] = '\0';
+  // n bytes - string
+  set_cstr(*(char **)source_stream_pp, length, false);
+  (*(uint8_t **)source_stream_pp) += length;
 
-    m_str_ref_p = str_ref_p->reuse_or_new(buffer_p, char_count, size);
-    }
+  return *this;
   }
 
 //---------------------------------------------------------------------------------------
-// Sets the internal C-String to the specified formatted string.
-// Arg         format_str_p - follows the same format as the C printf(), sprintf(), etc.
-//             See the MSDev online help for 'Format Specification Fields' for a
-//             description. 
-// Arg         ... - variable length arguments expected by the formatted string.
-//
-//             #### IMPORTANT #### When using the string format type specifier (%s) in
-//             the format string and a AString object (or a ASymbol object) is passed in
-//             as one of the variable length arguments, use 'str.as_cstr()'.
-//             Variable length arguments do not specify a type to the compiler, instead
-//             the types of the passed arguments are determined via the standard C
-//             string formatting functions - i.e %s, %u, %f, etc.  So if a string type
-//             (%s) is specified in the format string and a AString object is passed as
-//             one of the untyped variable length arguments, the compiler will not know
-//             to coerce the AString object to a C-String - it will instead treat the
-//             address of the AString object argument as if it were a C-String character
-//             array with disastrous results.
-// # Examples: AString begin("The answer");  // Example substring to append
-//             AString str("Hello");         // character length is 5 buffer size is 6
-//             str.ensure_size(100u);       // character length is 5 buffer size is 101
-//             str.format("%s to %s is %i", begin.as_cstr(), "everything", 42);
-//             // str is now "The answer to everything is 42"
-//             // character length is 30 buffer size is 101
-//
-// # See:      append_format(), AString(max_size, format_str_p, ...)
-// # Notes:    If the number of characters in the expanded format string is larger than
-//             the size of this string's current character buffer, then any characters
-//             above and beyond the buffer size will be truncated.  So it is important
-//             that the maximum potential buffer size has been allocated before this
-//             method is called - this can be easily achieved by calling ensure_size()
-//             prior to calling this method.
+// APArrayLogical<AString> constructor.  Concatenates all elements with separator 
+//             between them.
+// # Returns:  itself
+// Arg         strings - Array of AString objects to convert to a single string.  Ensure
+//             that none of the pointers are nullptr.
+// Arg         separator - This is the separator to insert between each string of the
+//             array.  (Default no separator - all the Strings are squished together)
+// # See:      tokenize(), get_token()
+// # Notes:    No separator is put in front of the first element.
 // # Author(s): Conan Reis
-void AString::format(const char * format_str_p, ...)
+AString::AString(
+  const APArrayLogical<AString> & strings,
+  const AString &                 separator // = ms_empty
+  )
   {
-  va_list args;  // initialize argument list
-  int     char_size = int(m_str_ref_p->m_size) - 1;
+  uint32_t length = strings.get_length();
 
-  if (char_size > 0)
+  if (length)
     {
-    // Ensure buffer is writable, but don't bother copying existing data.
-    ensure_size_buffer(char_size);
+    uint32_t   total_length = ((length - 1u) * separator.m_str_ref_p->m_length);  // separators
+    AString ** array_p      = strings.get_array();  // for faster than class member access
+    AString ** array_end_p  = array_p + length;
 
-    va_start(args, format_str_p);
+    // Accumulate string lengths to pre-allocate sufficient cstr array
+    for (; array_p < array_end_p; array_p++)
+      {
+      total_length += (*array_p)->m_str_ref_p->m_length;
+      }
 
-  #if defined(A_PLAT_PS3) || defined(A_PLAT_PS4)
-      int length = vsnprintf(m_str_ref_p->m_cstr_p, size_t(char_size + 1), format_str_p, args);
-    #else
-      int length = _vsnprintf(m_str_ref_p->m_cstr_p, size_t(char_size), format_str_p, args);
-    #endif
+    m_str_ref_p = AStringRef::pool_new_buffer(total_length, total_length, 1u);
 
-    va_end(args);  // end argument list processing
+    char * cstr_p = m_str_ref_p->m_cstr_p;
 
-    if ((length == -1) || (length == char_size))  // More characters than buffer has, so truncate
+    // Accumulate strings
+    total_length = 0u;
+    length       = separator.m_str_ref_p->m_length;
+    array_p      = strings.get_array();
+
+    if (length)
       {
-      length = int(char_size);
-      m_str_ref_p->m_cstr_p[char_size] = '\0';     // Put in null-terminator
+      const char * seperator_cstr_p = separator.m_str_ref_p->m_cstr_p;
+
+      array_end_p = array_p + (length - 1);  // Last string is not followed with separator
+
+      for (; array_p < array_end_p; array_p++)
+        {
+        memcpy(cstr_p + total_length, (*array_p)->m_str_ref_p->m_cstr_p, size_t((*array_p)->m_str_ref_p->m_length));
+        total_length += (*array_p)->m_str_ref_p->m_length;
+        memcpy(cstr_p + total_length, seperator_cstr_p, size_t(length));
+        total_length += length;
+        }
+
+      memcpy(cstr_p + total_length, (*array_p)->m_str_ref_p->m_cstr_p, size_t((*array_p)->m_str_ref_p->m_length + 1u));
       }
+    else  // No separator
+      {
+      for (; array_p < array_end_p; array_p++)
+        {
+        memcpy(cstr_p + total_length, (*array_p)->m_str_ref_p->m_cstr_p, size_t((*array_p)->m_str_ref_p->m_length));
+        total_length += (*array_p)->m_str_ref_p->m_length;
+        }
 
-    m_str_ref_p->m_length = uint32_t(length);
+      m_str_ref_p->m_cstr_p[m_str_ref_p->m_length] = '\0';
+      }
+    }
+  else  // Array strings is empty
+    {
+    m_str_ref_p = AStringRef::get_empty();
+    m_str_ref_p->m_ref_count++;
     }
   }
 
 //---------------------------------------------------------------------------------------
-// Increments any postfixed number by amount specified.  If the string does
-//             not have a previously postfixed number then increment_by is appended to
-//             the string padded with zeros if necessary as specified by min_digits.
-// # Returns:  Postfixed value.
-// Arg         increment_by - step value / amount to increment by
-// Arg         min_digits - minimum number of digits to use for postfix value.  If a
-//             previous postfix value is present, its number of digits is used and this
-//             number is ignored.
+// Constructor / converter from a signed integer
+// # Returns:  String version of the number
+// Arg         integer - signed integer to convert to a string
+// Arg         base - base (or radix) to use for conversion.  10 is decimal, 16 is
+//             hexadecimal, 2 is binary, etc.
+// # Examples: str = AString::ctor_int(5);
+// # See:      as_int32(), as_uint32_t(), as_float64(), AString(max_size, format_str_p, ...)
+// # Modifiers: static
 // # Author(s): Conan Reis
-uint32_t AString::increment(
-  uint32_t increment_by, // = 1u
-  uint32_t min_digits    // = 4u
+AString AString::ctor_int(
+  int integer,
+  uint base // = AString_def_base (10)
   )
   {
-  uint32_t find_pos = 0u;
-  uint32_t value    = 0u;
-  uint32_t length   = m_str_ref_p->m_length;
-
-  // Look for previous value
-  find_reverse(ACharMatch_not_digit, 1u, &find_pos);
-
-  if ((find_pos + 1u) < length)
-    {
-    // Previous number postfix found
-    find_pos++;
-    value = as_uint(find_pos, nullptr, 10u);
-
-    min_digits = length - find_pos;
-
-    // remove old value prefix
-    length -= min_digits;
-    m_str_ref_p->m_length = length;
-    }
+  AStringRef * str_ref_p = AStringRef::pool_new_buffer(AString_int32_max_chars, 0u, 0u);
+  uint32_t     length    = a_int_to_cstr(integer, base, str_ref_p->m_cstr_p);
 
-  // Create new value
-  value += increment_by;
-
-  uint32_t new_digits = value < 10u
-    ? 1u
-    : a_log10ceil(value) + 1u;
+  str_ref_p->m_cstr_p[length] = '\0';
+  str_ref_p->m_length         = length;
 
-  ensure_size(length + a_max(new_digits, min_digits));
+  return str_ref_p;
+  }
 
-  if (new_digits < min_digits)
-    {
-    // Pad with zeros
-    append('0', min_digits - new_digits);
-    }
+//---------------------------------------------------------------------------------------
+// Constructor / converter from an unsigned integer
+// # Returns:  itself
+// Arg         natural - unsigned integer to convert to a string
+// Arg         base - base (or radix) to use for conversion.  10 is decimal, 16 is
+//             hexadecimal, 2 is binary, etc.
+// # Examples: str = AString::ctor_uint(5u);
+// # See:      as_int32(), as_uint32_t(), as_float64(), AString(max_size, format_str_p, ...)
+// # Modifiers: static
+// # Author(s): Conan Reis
+AString AString::ctor_uint(
+  uint32_t natural,
+  uint32_t base // = AString_def_base (10)
+  )
+  {
+  AStringRef * str_ref_p = AStringRef::pool_new_buffer(AString_int32_max_chars, 0u, 0u);
+  uint32_t     length    = a_uint_to_cstr(natural, base, str_ref_p->m_cstr_p);
 
-  append_format("%d", value);
+  str_ref_p->m_cstr_p[length] = '\0';
+  str_ref_p->m_length         = length;
 
-  return value;
+  return str_ref_p;
   }
 
 //---------------------------------------------------------------------------------------
-// Indents rows/lines by specified `space_count` spaces from `start_pos` to `end_pos`.
-// Works on line breaks that are in Unix style `\n` or DOS style `\r\n`.
-//
-// # Returns: number of line breaks over the range specified
-// # Params:
-//   space_count: number of space characters to indent
-//   start_pos:   starting index to begin indentation
-//   end_pos:     ending index to stop indentation
-//   
-// # Notes:
-//   - Spaces inserted just prior to first non-space (space or tab) character on each row.
-//   - Rows with no non-space characters are not indented.
-//   - If the range ends just after a line break, the following row is not indented - at
-//     least one character on a row must be included for it to be indented
-//   - Mimics behaviour of Visual Studio editor.
-// 
-// # See:       line_unindent(), line_*() functions, ARichEditOS::indent_selection()
+// Constructor / converter from a f32 (float)
+// # Returns:  itself
+// Arg         real - f32 to convert to a string
+// Arg         significant - number of significant digits / characters to attempt to fit
+//             'real' into.  If it can't fit, it will use a scientific notation with a
+//             lowercase 'e'.  Only as many digits as needed to read back the same value
+//             are used so AString_float_sig_digits_round_trip gives the shortest string
+//             that converts back exactly.
+// # Examples: str = AString::ctor_f32(5.0f);
+// # See:      as_int32(), as_uint32_t(), as_float64(), AString(max_size, format_str_p, ...)
+// # Modifiers: explicit
 // # Author(s): Conan Reis
-uint AString::line_indent(
-  uint space_count, // = AString_indent_spaces_def
-  uint start_pos,   // = 0u
-  uint end_pos      // = ALength_remainder
+AString AString::ctor_float(
+  f32      real,
+  uint32_t significant // = AString_float_sig_digits_def
   )
   {
-  // $Revisit - CReis Could use space_count=0 to indicate that spaces should be used to indent rather than spaces.
-  AStringRef * str_ref_p = m_str_ref_p;
-  uint32_t     length    = str_ref_p->m_length;
-
-  if (length == 0u)
-    {
-    return 0u;
-    }
-
-  if (end_pos == ALength_remainder)
-    {
-    end_pos = length - 1;
-    }
-
-  #ifdef A_BOUNDS_CHECK
-    bounds_check(start_pos, end_pos, "indent");
-  #endif
+  AStringRef * str_ref_p = AStringRef::pool_new_buffer(significant + AString_real_extra_chars, 0u, 0u);  // for sign, exponent, etc.
+  uint32_t     length    = a_real_to_cstr(f64(real), true, significant, true, str_ref_p->m_cstr_p);
 
+  str_ref_p->m_cstr_p[length] = '\0';
+  str_ref_p->m_length         = length;
 
-  //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
-  // Determine number of lines.
-  uint   line_count   = 1u;
-  char * buffer_p     = str_ref_p->m_cstr_p;
-  char * cstr_start_p = buffer_p + start_pos;
-  char * cstr_end_p   = buffer_p + end_pos;
-  char * cstr_p       = cstr_start_p;
-
-  // Use < rather than <= to intentionally stop before last character
-  while (cstr_p < cstr_end_p)
-    {
-    if (*cstr_p == '\n')
-      {
-      line_count++;
-      }
+  return str_ref_p;
+  }
 
-    cstr_p++;
-    }
+//---------------------------------------------------------------------------------------
+// Constructor / converter from a f64 (double)
+// # Returns:  itself
+// Arg         real - f64 to convert to a string
+// Arg         significant - number of significant digits / characters to attempt to fit
+//             'real' into.  If it can't fit, it will use a scientific notation with a
+//             lowercase 'e'.  Only as many digits as needed to read back the same value
+//             are used so AString_double_sig_digits_round_trip gives the shortest string
+//             that converts back exactly.
+// # Examples: str = AString::ctor_f64(5.0);
+// # See:      as_int32(), as_uint32_t(), as_float64(), AString(max_size, format_str_p, ...)
+// # Modifiers: static
+// # Author(s): Conan Reis
+AString AString::ctor_float64(
+  f64      real,
+  uint32_t significant // = AString_double_sig_digits_def
+  )
+  {
+  AStringRef * str_ref_p = AStringRef::pool_new_buffer(significant + AString_real_extra_chars, 0u, 0u);  // for sign, exponent, etc.
+  uint32_t     length    = a_real_to_cstr(real, false, significant, true, str_ref_p->m_cstr_p);
 
-  //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
-  // Ensure enough memory for indenting
-  size_t char_count;
-  char * dest_p;
-  char * source_p     = buffer_p;
-  uint   extra_chars  = line_count * space_count;
+  str_ref_p->m_cstr_p[length] = '\0';
+  str_ref_p->m_length         = length;
 
-  // $Revisit - CReis Could reuse existing buffer if it is large enough.
-  // Test to see if new buffer needed or if old one can be reused
-  //bool new_buffer_b = (str_ref_p->m_size < (length + extra_chars))
-  //  || ((str_ref_p->m_ref_count + str_ref_p->m_read_only) != 1u);
+  return str_ref_p;
+  }
 
-  uint32_t new_size     = AStringRef::request_char_count(length + extra_chars);
-  char *   new_buffer_p = AStringRef::alloc_buffer(new_size);
+//---------------------------------------------------------------------------------------
+// Constructor / converter from stream.
+// # Returns:  a reference to itself
+// # Author(s): Conan Reis
+//AString::AString(strstream & strm)
+//  {
+//  strm << ends;                    // terminate stream with a null
+//  m_str_ref_p->m_length = uint32_t(::strlen(strm.str()));   // get number of characters in stream
+//  m_str_ref_p->m_size   = m_str_ref_p->m_length + 1;         // calculate size
+//  m_str_ref_p->m_cstr_p = AStringRef::alloc_buffer(m_str_ref_p->m_size);
+//  memcpy(m_str_ref_p->m_cstr_p, strm.str(), size_t(m_str_ref_p->m_length + 1));  // copy characters from stream
+//  }
 
-  dest_p = new_buffer_p;
-  cstr_p = cstr_start_p;
 
-  do 
+//---------------------------------------------------------------------------------------
+// Converter / constructor from wide character (Unicode) C-String.
+// 
+// # Params:
+//   wcstr_p: wide character (unicode) string to convert.
+//   
+// # Author(s): Conan Reis
+AString::AString(const wchar_t * wcstr_p)
+  {
+  // $Vital - CReis Test this and switch to UTF-8 as soon as possible.
+  if (wcstr_p)
     {
-    //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
-    // Find first non-space
-    while ((cstr_p <= cstr_end_p)
-      && ((*cstr_p == ' ') || (*cstr_p == '\t')))
-      {
-      cstr_p++;
-      }
-
+    uint32_t length = uint32_t(::wcslen(wcstr_p));
 
-    //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
-    // Indent if some non-space chars before end of line
-    if ((cstr_p <= cstr_end_p) && (*cstr_p != '\r') && (*cstr_p != '\n'))
+    if (length)
       {
-      // Copy characters so far
-      char_count = size_t(cstr_p - source_p);
-      memcpy(dest_p, source_p, char_count);
-      source_p = cstr_p;
-      dest_p  += char_count;
+      m_str_ref_p = AStringRef::pool_new_buffer(length, length, 1u);
 
-      // Indent
-      memset(dest_p, ' ', space_count);
-      dest_p += space_count;
-      }
+      char * cstr_p = m_str_ref_p->m_cstr_p;
 
+      #ifdef A_PLAT_PC
+        WideCharToMultiByte(CP_ACP, 0, wcstr_p, length, cstr_p, m_str_ref_p->m_size, NULL, NULL);
+      #else
+        ::wcstombs(cstr_p, wcstr_p, size_t(length + 1u));
+      #endif
 
-    //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
-    // Skip past end of line (skip `\r` of `\r\n`) or to end of range
-    while (cstr_p <= cstr_end_p)
-      {
-      if (*cstr_p == '\n')
-        {
-        // Skip past newline
-        cstr_p++;
-        break;
-        }
+      cstr_p[length] = '\0';  // Put in null-terminator
 
-      cstr_p++;
+      return;
       }
     }
-  while (cstr_p <= cstr_end_p);
-
-  //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
-  // Copy any remainder of the string
-  char_count = size_t(cstr_p - source_p);
-  memcpy(dest_p, source_p, char_count);
-  dest_p += char_count;
 
-  length = uint32_t(dest_p - new_buffer_p);
-  new_buffer_p[length] = '\0';
-  m_str_ref_p = str_ref_p->reuse_or_new(new_buffer_p, length, new_size);
-
-  return line_count;
+  m_str_ref_p = AStringRef::get_empty();
+  m_str_ref_p->m_ref_count++;
   }
 
 //---------------------------------------------------------------------------------------
-// Indents all rows/lines after the first row by specified `space_count` spaces from
-// `start_pos` to `end_pos`. Works on line breaks that are in Unix style `\n` or DOS
-// style `\r\n`.
-//
-// # Returns: number of line breaks over the range specified
+// Converter / constructor from wide character (Unicode) C-String.
+// 
 // # Params:
-//   space_count: number of space characters to indent
-//   start_pos:   starting index to begin indentation
-//   end_pos:     ending index to stop indentation
+//   wcstr_p: wide character (unicode) string to convert.
+//   length: number of characters - not bytes - in wcstr_p
 //   
-// # Notes:
-//   - Spaces inserted just prior to first non-space (space or tab) character on each row.
-//   - Rows with no non-space characters are not indented.
-//   - If the range ends just after a line break, the following row is not indented - at
-//     least one character on a row must be included for it to be indented
-//   - Mimics behaviour of Visual Studio editor.
-// 
-// # See:       line_unindent(), line_*() functions, ARichEditOS::indent_selection()
 // # Author(s): Conan Reis
-uint AString::line_indent_next(
-  uint space_count, // = AString_indent_spaces_def
-  uint start_pos,   // = 0u
-  uint end_pos      // = ALength_remainder
+AString::AString(
+  const wchar_t * wcstr_p,
+  uint32_t        length
   )
   {
-  if (find('\n', 1u, &start_pos, start_pos, end_pos))
+  // $Vital - CReis Test this and switch to UTF-8 as soon as possible.
+  if (wcstr_p && length)
     {
-    return line_indent(space_count, start_pos + 1u, end_pos);
+    m_str_ref_p = AStringRef::pool_new_buffer(length, length, 1u);
+
+    char * cstr_p = m_str_ref_p->m_cstr_p;
+
+    #ifdef A_PLAT_PC
+      WideCharToMultiByte(CP_ACP, 0, wcstr_p, length, cstr_p, m_str_ref_p->m_size, NULL, NULL);
+    #else
+      ::wcstombs(cstr_p, wcstr_p, size_t(length + 1u));
+    #endif
+
+    cstr_p[length] = '\0';  // Put in null-terminator
+
+    return;
     }
 
-  return 0u;
+  m_str_ref_p = AStringRef::get_empty();
+  m_str_ref_p->m_ref_count++;
   }
 
+//#ifdef ASTR_ENABLE_WIDE_CHAR
 //---------------------------------------------------------------------------------------
-// Unindents rows/lines by specified `space_count` spaces from `start_pos` to `end_pos`.
-// Works on line breaks that are in Unix style `\n` or DOS style `\r\n`.
+// Cast / convert a string to a wide character (Unicode) C-String.
+// # Notes:    ***Warning*** returns dynamic data
+// # Author(s): Conan Reis
+//AString::operator const wchar_t * () const
+//  {
+//  wchar_t * buffer_p = new wchar_t[m_str_ref_p->m_length + 1];
 //
-// # Returns: number of line breaks over the range specified
-// # Params:
-//   space_count: number of space characters to unindent
-//   tab_stops:   tab stop count in spaces
-//   start_pos:   starting index to begin
-//   end_pos:     ending index to stop
-//   
-// # Notes:
-//   - Spaces removed just prior to first non-space (space or tab) character on each row.
-//   - Rows with no non-space characters are left as is
-//   - If the range ends just after a line break, the following row is not unindented - at
-//     least one character on a row must be included for it to be unindented
-// 
-// # See:       line_indent(), line_*() functions, ARichEditOS::unindent_selection()
+//  A_VERIFY_MEMORY(buffer_p == nullptr, AString);
+//  mbstowcs(buffer_p, m_str_ref_p->m_cstr_p, size_t(m_str_ref_p->m_length + 1));
+//  return buffer_p;
+//  // $Revisit - CReis Should be something like this so memory is managed: return WString(*this);
+//  // Alternatively use a big reusable buffer for quick and dirty converts.
+//  }
+//#endif
+
+//---------------------------------------------------------------------------------------
+// Stream assignment - allows assignment stringization S = S = S
+// # Returns:  itself
+// Arg         strstream & strm - 
 // # Author(s): Conan Reis
-uint AString::line_unindent(
-  uint space_count, // = AString_indent_spaces_def
-  uint tab_stops,   // = AString_tab_stop_def
-  uint start_pos,   // = 0u
-  uint end_pos      // = ALength_remainder
-  )
-  {
-  //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
-  struct Nested
-    {
-    static char * set_column(
-      char * cstr_p, uint column, uint tab_stops)
-      {
-      uint idx = 0u;
-      uint tab_spaces = 0u;
-
-      while (idx < column)
-        {
-        if (*cstr_p == ' ')
-          {
-          cstr_p++;
-          idx++;
-          }
-        else
-          {
-          // Must be a tab - determine its number of spaces
-          tab_spaces = tab_stops - (idx % tab_stops);
+//AString & AString::operator=(strstream & strm)
+//  {
+//  strm << ends;                                 // terminate stream with a null
+//  m_str_ref_p->m_length = ::strlen(strm.str());                // get number of characters in stream
+//  ensure_size_buffer(m_str_ref_p->m_length);
+//  memcpy(m_str_ref_p->m_cstr_p, strm.str(), size_t(m_str_ref_p->m_length + 1));  // copy characters from stream
+//  return *this;
+//  }
 
-          if ((idx + tab_spaces) >= column)
-            {
-            // Convert tab to spaces as needed and increment space difference
-            tab_spaces = column - idx;
-            memset(cstr_p, ' ', tab_spaces);
+//---------------------------------------------------------------------------------------
+// Converter to f64.
+// # Returns:  a f64 interpretation of the specified section
+// Arg         start_pos - index position to start parsing string.
+// Arg         stop_pos_p - Address to store the index position where conversion stops.
+//             If it is set to nullptr, it is ignored.  (Default nullptr)
+// # Examples: f64 num = num_str.as_float64();
+// # See:      AString(real, significant), as_int32(), as_uint32_t()
+// # Notes:    The acceptable string form is as following:
+//
+//             [whitespace] [sign] [digits] [.digits] [{d | D | e | E} [sign] digits]
+//
+//             Whitespace may consist of space and tab characters, which are ignored.
+//             sign is either plus (+) or minus (-) and digits are one or more decimal
+//             digits.  If no digits appear before the radix character, at least one
+//             must appear after the radix character.  The decimal digits can be
+//             followed by an exponent, which consists of an introductory letter
+//             (d, D, e, or E) and an optionally signed integer.  If neither an exponent
+//             part nor a radix character appears, a radix character is assumed to
+//             follow the last digit in the string.  The first character that does not
+//             fit this form stops the scan.
+// # Author(s): Conan Reis
+f64 AString::as_float64(
+  uint32_t   start_pos,  // = 0u
+  uint32_t * stop_pos_p  // = nullptr
+  ) const
+  {
+  #ifdef A_BOUNDS_CHECK
+    bounds_check(start_pos, "as_float64");
+  #endif
 
-            return cstr_p + tab_spaces;
-            }
+  char * stop_char_p;
+  f64    value = ::strtod(&m_str_ref_p->m_cstr_p[start_pos], &stop_char_p);  // convert
 
-          idx += tab_spaces;
-          }
-        }
+  if (stop_pos_p)
+    {
+    *stop_pos_p = uint32_t(stop_char_p - m_str_ref_p->m_cstr_p);  // determine pos where conversion ended
+    }
+  return value;
+  }
 
-      return cstr_p;
-      }
-    };
+//---------------------------------------------------------------------------------------
+// Converter to f32.
+// # Returns:  a f32 interpretation of the specified section
+// Arg         start_pos - index position to start parsing string.
+// Arg         stop_pos_p - Address to store the index position where conversion stops.
+//             If it is set to nullptr, it is ignored.  (Default nullptr)
+// # Examples: f32 num = num_str.as_float32();
+// # See:      AString(real, significant), as_int32(), as_uint32_t()
+// # Notes:    The acceptable string form is as following:
+//
+//             [whitespace] [sign] [digits] [.digits] [{d | D | e | E} [sign] digits]
+//
+//             Whitespace may consist of space and tab characters, which are ignored.
+//             sign is either plus (+) or minus (-) and digits are one or more decimal
+//             digits.  If no digits appear before the radix character, at least one
+//             must appear after the radix character.  The decimal digits can be
+//             followed by an exponent, which consists of an introductory letter
+//             (d, D, e, or E) and an optionally signed integer.  If neither an exponent
+//             part nor a radix character appears, a radix character is assumed to
+//             follow the last digit in the string.  The first character that does not
+//             fit this form stops the scan.
+// # Author(s): Conan Reis
+f32 AString::as_float32(
+  uint32_t   start_pos,  // = 0u
+  uint32_t * stop_pos_p  // = nullptr
+  ) const
+  {
+  #ifdef A_BOUNDS_CHECK
+    bounds_check(start_pos, "as_float64");
+  #endif
 
-  //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
-  AStringRef * str_ref_p = m_str_ref_p;
-  uint32_t     length    = str_ref_p->m_length;
+  // $Revisit - CReis Temp code
+  char * stop_char_p;
+  f32    value = f32(::strtod(&m_str_ref_p->m_cstr_p[start_pos], &stop_char_p));  // convert
 
-  if (length == 0u)
+  if (stop_pos_p)
     {
-    return 0u;
+    *stop_pos_p = uint32_t(stop_char_p - m_str_ref_p->m_cstr_p);  // determine pos where conversion ended
     }
+  return value;
+  }
 
-  if (end_pos == ALength_remainder)
-    {
-    end_pos = length - 1u;
-    }
+//---------------------------------------------------------------------------------------
+// Converter to int32_t
+// # Returns:  a int32_t interpretation of the specified section
+// Arg         start_pos - index position to start parsing string.  (Default 0u)
+// Arg         stop_pos_p - Address to store the index position where conversion stops.
+//             If it is set to nullptr, it is ignored.  (Default nullptr)
+// Arg         base - (or radix) sets the numerical base that should be expected.
+//             Acceptable values are from 2 to 36.  If base is AString_determine_base (0),
+//             the initial characters are used to determine the base.  If the first
+//             character is 0 and the second character is not 'x' or 'X', the string is
+//             interpreted as an octal (base 8) integer; otherwise, it is interpreted as
+//             a decimal number.  If the first character is '0' and the second character
+//             is 'x' or 'X', the string is interpreted as a hexadecimal integer.  If
+//             the first character is '1' through '9', the string is interpreted as a
+//             decimal integer.  (Default AString_determine_base)
+// # Examples: int32_t num = num_str.as_int32();
+// # See:      AString(integer, base), as_uint32_t(), as_real64()
+// # Notes:    The acceptable string form is as following:
+//
+//             [whitespace] [{+ | -}] [0 [{ x | X }]] [digits]
+//
+//             Whitespace may consist of space and tab characters, which are ignored.
+//             digits are one or more decimal digits.  The letters 'a' through 'z'
+//             (or 'A' through 'Z') are assigned the values 10 through 35; only letters
+//             whose assigned values are less than 'base' are permitted.  A plus (+) or
+//             minus (-) sign is allowed as a prefix; a leading minus sign indicates
+//             that the return value is negated.  The first character that does not fit
+//             this form stops the scan.  
+// # Author(s): Conan Reis
+int AString::as_int(
+  uint32_t   start_pos,  // = 0u
+  uint32_t * stop_pos_p, // = nullptr
+  uint32_t   base        // = AString_def_base
+  ) const
+  {
+  char *  stop_char_p;
+  int32_t value;
 
   #ifdef A_BOUNDS_CHECK
-    bounds_check(start_pos, end_pos, "indent");
-  #endif
+    bounds_check(start_pos, "as_int32");
 
+    A_VERIFY(a_is_ordered(AString_determine_base, base, AString_max_base), a_cstr_format("invalid numerical base/radix \nExpected 1-37, but given %u", base), ErrId_invalid_base, AString);
+  #endif
 
-  //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
-  // Determine number of lines.
-  uint   line_count   = 1u;
-  char * buffer_p     = str_ref_p->m_cstr_p;
-  char * cstr_start_p = buffer_p + start_pos;
-  char * cstr_end_p   = buffer_p + end_pos;
-  char * cstr_p       = cstr_start_p;
+  value = int32_t(strtol(&m_str_ref_p->m_cstr_p[start_pos], &stop_char_p, int(base)));
 
-  // Use < rather than <= to intentionally stop before last character
-  while (cstr_p < cstr_end_p)
+  if (stop_pos_p)
     {
-    if (*cstr_p == '\n')
-      {
-      line_count++;
-      }
-
-    cstr_p++;
+    *stop_pos_p = uint32_t(ptrdiff_t(stop_char_p) - ptrdiff_t(m_str_ref_p->m_cstr_p));  // determine pos where conversion ended
     }
 
-  //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
-  // Ensure enough memory for unindenting
-  // - Note that tabs are converted to spaces as they are reduced and they may add up to
-  //   more characters even after space_count characters have been removed.
-  size_t char_count;
-  char * line_p;
-  char * dest_p;
-  char * source_p     = buffer_p;
-  uint   extra_chars  = 0u;
-  uint   column       = 0u;
-  
-  if (tab_stops > space_count)
-    {
-    extra_chars = line_count * (tab_stops - space_count - 1);
-    }
+  return value;
+  }
 
-  // $Revisit - CReis Could reuse existing buffer if it is large enough.
-  // Test to see if new buffer needed or if old one can be reused
-  //bool new_buffer_b = (str_ref_p->m_size < (length + extra_chars))
-  //  || ((str_ref_p->m_ref_count + str_ref_p->m_read_only) != 1u);
+//---------------------------------------------------------------------------------------
+// Converter to uint32_t
+// # Returns:  a uint32_t interpretation of the specified section
+// Arg         start_pos - index position to start parsing string.  (Default 0u)
+// Arg         stop_pos_p - Address to store the index position where conversion stops.
+//             If it is set to nullptr, it is ignored.  (Default nullptr)
+// Arg         base - (or radix) sets the numerical base that should be expected.
+//             Acceptable values are from 2 to 36.  If base is AString_determine_base (0),
+//             the initial characters are used to determine the base.  If the first
+//             character is 0 and the second character is not 'x' or 'X', the string is
+//             interpreted as an octal (base 8) integer; otherwise, it is interpreted as
+//             a decimal number.  If the first character is '0' and the second character
+//             is 'x' or 'X', the string is interpreted as a hexadecimal integer.  If
+//             the first character is '1' through '9', the string is interpreted as a
+//             decimal integer.  (Default AString_determine_base)
+// # Examples: int32_t num = num_str.as_int32();
+// # Notes:    The acceptable string form is as following:
+//
+//             [whitespace] [0 [{ x | X }]] [digits]
+//
+//             Whitespace may consist of space and tab characters, which are ignored.
+//             digits are one or more decimal digits.  The letters 'a' through 'z'
+//             (or 'A' through 'Z') are assigned the values 10 through 35; only letters
+//             whose assigned values are less than 'base' are permitted.  The first
+//             character that does not fit this form stops the scan.  
+// # Author(s): Conan Reis
+uint AString::as_uint(
+  uint32_t   start_pos,  // = 0u
+  uint32_t * stop_pos_p, // = nullptr
+  uint       base        // = AString_def_base
+  ) const
+  {
+  char *   stop_char_p;
+  uint32_t value;
+  
+  #ifdef A_BOUNDS_CHECK
+    bounds_check(start_pos, "as_uint32_t");
 
-  uint32_t new_size     = AStringRef::request_char_count(length + extra_chars);
-  char *   new_buffer_p = AStringRef::alloc_buffer(new_size);
+    A_VERIFY(a_is_ordered(AString_determine_base, base, AString_max_base), a_cstr_format("invalid numerical base/radix \nExpected 1-37, but given %u", base), ErrId_invalid_base, AString);
+  #endif
 
-  dest_p = new_buffer_p;
-  cstr_p = cstr_start_p;
+  value = uint32_t(strtoul(&m_str_ref_p->m_cstr_p[start_pos], &stop_char_p, int(base)));
 
-  do 
+  if (stop_pos_p)
     {
-    //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
-    // Find first non-space
-    column = 0u;
-    line_p = dest_p + size_t(cstr_p - source_p);
+    *stop_pos_p = uint32_t(stop_char_p - m_str_ref_p->m_cstr_p);  // determine pos where conversion ended
+    }
 
-    while ((cstr_p <= cstr_end_p)
-      && ((*cstr_p == ' ') || (*cstr_p == '\t')))
-      {
-      column += (*cstr_p == '\t') ? (tab_stops - (column % tab_stops)) : 1u;
-      cstr_p++;
-      }
+  return value;
+  }
 
+//---------------------------------------------------------------------------------------
+//  Does a case-sensitive comparison of the current string at specified index
+//              to the supplied substring to determine if it is equal to, less than, or
+//              greater than it.
+// # Returns:   AEquate_equal, AEquate_less, or AEquate_greater
+// Arg          substr - sub-string to compare
+// # See:       icompare_sub() for a case-insensitive version.
+// # Author(s):  Conan Reis
+eAEquate AString::compare_sub(
+  const AString & substr,
+  uint32_t        index // = 0u
+  ) const
+  {
+  // $Revisit - CReis This should be profiled, but I believe that the custom code is faster
+  // than the commented out section below.
+  char * str1_p     = m_str_ref_p->m_cstr_p + index;
+  char * str1_end_p = str1_p + a_min(m_str_ref_p->m_length + 1u - index, substr.m_str_ref_p->m_length); // compare the # of characters in the shorter sub-string (without null)
+  char * str2_p     = substr.m_str_ref_p->m_cstr_p;
 
-    //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
-    // Unindent if some non-space chars before end of line
-    if ((cstr_p <= cstr_end_p) && (*cstr_p != '\r') && (*cstr_p != '\n'))
+  while (str1_p < str1_end_p)
+    {
+    if (*str1_p != *str2_p)  // if characters differ
       {
-      // Copy characters so far
-      char_count = size_t(cstr_p - source_p);
-      memcpy(dest_p, source_p, char_count);
-      source_p = cstr_p;
-
-      // Unindent
-      dest_p = Nested::set_column(
-        line_p, (column > space_count) ? column - space_count : 0u, tab_stops);
+      // select appropriate result
+      return (*str1_p < *str2_p) ? AEquate_less : AEquate_greater;
       }
 
-
-    //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
-    // Skip past end of line (skip `\r` of `\r\n`) or to end of range
-    while (cstr_p <= cstr_end_p)
-      {
-      if (*cstr_p == '\n')
-        {
-        // Skip past newline
-        cstr_p++;
-        break;
-        }
-
-      cstr_p++;
-      }
+    str1_p++;
+    str2_p++;
     }
-  while (cstr_p <= cstr_end_p);
 
-  //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
-  // Copy any remainder of the string
-  char_count = size_t(cstr_p - source_p);
-  memcpy(dest_p, source_p, char_count);
-  dest_p += char_count;
+  return AEquate_equal;
 
-  length = uint32_t(dest_p - new_buffer_p);
-  new_buffer_p[length] = '\0';
-  m_str_ref_p = str_ref_p->reuse_or_new(new_buffer_p, length, new_size);
 
-  return line_count;
+  // Alternate method using standard library functions.
+  //int result = ::strncmp(
+  //  m_str_ref_p->m_cstr_p + index,
+  //  substr.m_str_ref_p->m_cstr_p,
+  //  a_min(m_str_ref_p->m_length - index, substr.m_str_ref_p->m_length));
+  // 
+  // This is a funky way to convert < 0 to -1, > 0 to 1, and 0 to stay 0
+  //return static_cast<eAEquate>((result > 0) ? 1 : result >> 31);
   }
 
 //---------------------------------------------------------------------------------------
-// Substring character insertion.
-// # Returns:  a reference to itself
-// # Author(s): Conan Reis
-void AString::insert(
-  char ch,
-  uint32_t pos // = 0u
-  )
+//  Does a case-insensitive comparison of the current string at specified
+//              index to the supplied substring to determine if it is equal to, less than,
+//              or greater than it.
+// # Returns:   AEquate_equal, AEquate_less, or AEquate_greater
+// Arg          substr - sub-string to compare
+// # See:       compare_sub() for a case-sensitive version.
+// # Author(s):  Conan Reis
+eAEquate AString::icompare_sub(
+  const AString & substr,
+  uint32_t        index // = 0u
+  ) const
   {
-  #ifdef A_BOUNDS_CHECK
-    bounds_check(pos, "insert");
-  #endif
+  // $Revisit - CReis This should be profiled, but I believe that the custom code is faster
+  // than the commented out section below.
+  uint8_t * str1_p     = reinterpret_cast<uint8_t *>(m_str_ref_p->m_cstr_p + index);
+  uint8_t * str1_end_p = str1_p + a_min(m_str_ref_p->m_length + 1u - index, substr.m_str_ref_p->m_length); // compare the # of characters in the shorter sub-string (without null)
+  uint8_t * str2_p     = reinterpret_cast<uint8_t *>(substr.m_str_ref_p->m_cstr_p);
+  char ch1, ch2;
 
-  // $Revisit - CReis This could be optimized - the end may be copied twice
-  ensure_size(m_str_ref_p->m_length + 1u);
+  while (str1_p < str1_end_p)
+    {
+    ch1 = ms_char2lower[*str1_p];
+    ch2 = ms_char2lower[*str2_p];
 
-  memmove(m_str_ref_p->m_cstr_p + pos + 1u, m_str_ref_p->m_cstr_p + pos, size_t(m_str_ref_p->m_length - pos + 1u));
-  m_str_ref_p->m_cstr_p[pos] = ch;  // insert character
-  m_str_ref_p->m_length++;
-  }
+    if (ch1 != ch2)  // if characters differ
+      {
+      // select appropriate result
+      return (ch1 < ch2) ? AEquate_less : AEquate_greater;
+      }
 
-//---------------------------------------------------------------------------------------
-// Sub-string string insertion.
-// # Returns:  a reference to itself
-// # Author(s): Conan Reis
-void AString::insert(
-  const AString & str,
-  uint32_t        pos // = 0u
-  )
-  {
-  #ifdef A_BOUNDS_CHECK
-    bounds_check(pos, "insert");
-  #endif
+    str1_p++;
+    str2_p++;
+    }
 
-  // $Revisit - CReis This could be optimized - the end may be copied twice
-  ensure_size(m_str_ref_p->m_length + str.m_str_ref_p->m_length);
+  return AEquate_equal;
 
-  memmove(m_str_ref_p->m_cstr_p + pos + str.m_str_ref_p->m_length, m_str_ref_p->m_cstr_p + pos, size_t(m_str_ref_p->m_length - pos + 1u));
-  memcpy(m_str_ref_p->m_cstr_p + pos, str.m_str_ref_p->m_cstr_p, size_t(str.m_str_ref_p->m_length));
-  m_str_ref_p->m_length += str.m_str_ref_p->m_length;
+
+  // Alternate method using standard library functions.
+  //int result = ::_strnicmp(
+  //  m_str_ref_p->m_cstr_p + index,
+  //  substr.m_str_ref_p->m_cstr_p,
+  //  a_min(m_str_ref_p->m_length - index, substr.m_str_ref_p->m_length));
+  // 
+  // This is a funky way to convert < 0 to -1, > 0 to 1, and 0 to stay 0
+  //return static_cast<eAEquate>((result > 0) ? 1 : result >> 31);
   }
 
 //---------------------------------------------------------------------------------------
-// Converts line breaks from to Unix style (\n) to DOS style (\r\n).
-//             This method will also work if the string is already in DOS style.
-// # Returns:  Returns the number of line breaks that were converted.
-// # See:      line_*() functions
-// # Author(s): Conan Reis
-uint AString::line_break_unix2dos(
-  uint start_pos,  // = 0u
-  uint end_pos     // = ALength_remainder
-  )
+//  Does a case-sensitive comparison of the current string to the supplied
+//              string to determine if they are equal.
+// # Returns:   true if equal, false if not
+// Arg          str - string to compare
+// # See:       is_equal() for a case-sensitive version.
+// # Author(s):  Conan Reis
+bool AString::is_equal(const AString & str) const
   {
-  uint pre_remove = m_str_ref_p->m_length;
-
-  remove_all('\r', start_pos, end_pos);
-
-  end_pos = (end_pos == ALength_remainder)
-    ? m_str_ref_p->m_length - 1u
-    : end_pos - (pre_remove - m_str_ref_p->m_length);
-
-  return replace_all('\n', ms_dos_break, start_pos, end_pos);
+  return m_str_ref_p->is_equal(*str.m_str_ref_p);
   }
 
 //---------------------------------------------------------------------------------------
-// Substring search and removal. Finds Nth instance string str starting from start_pos
-// and stores the index position if found in find_pos. Returns true if found false if not.
-// # Author(s): Conan Reis
-bool AString::remove(
-  const AString & str,
-  uint32_t        instance,    // = 1u
-  uint32_t *      find_pos_p,  // = nullptr
-  uint32_t        start_pos,   // = 0u
-  uint32_t        end_pos,     // = ALength_remainder
-  eAStrCase       case_check   // = AStrCase_sensitive
-  )
+//  Does a case-insensitive comparison of the current string to the supplied
+//              string to determine if they are equal.
+// # Returns:   true if equal, false if not
+// Arg          str - string to compare
+// # See:       is_equal() for a case-sensitive version.
+// # Author(s):  Conan Reis
+bool AString::is_iequal(const AString & str) const
   {
-  uint32_t pos;
+  // $Revisit - CReis This should be profiled, but I believe that the custom code is faster
+  // than the standard library calls.
+  uint32_t length = m_str_ref_p->m_length;
 
-  if (find(str, instance, &pos, start_pos, end_pos, case_check))
+  if (length != str.m_str_ref_p->m_length)
     {
-    // $Revisit - CReis This could be optimized - the end may be copied twice
-    ensure_writable();
-
-    m_str_ref_p->m_length -= str.m_str_ref_p->m_length;  // length of new string
-    memmove(m_str_ref_p->m_cstr_p + pos, m_str_ref_p->m_cstr_p + pos + str.m_str_ref_p->m_length, size_t(m_str_ref_p->m_length - pos + 1u));
-
-    if (find_pos_p)
-      {
-      *find_pos_p = pos;
-      }
-      
-    return true;
+    return false;
     }
-    
-  return false;
-  }
 
-//---------------------------------------------------------------------------------------
-// Quick substring search and removal using the Boyer Moore algorithm.   
-//             Good for multiple searches for the same substring.  Finds Nth instance  
-//             of bm starting from start_pos and stores the index position if  
-//             found in find_pos. Returns true if found false if not.
-// # Author(s): Conan Reis
-bool AString::remove(
-  const AStringBM & bm,
-  uint32_t          instance,    // = 1u
-  uint32_t *        find_pos_p,  // = nullptr
-  uint32_t          start_pos,   // = 0u
-  uint32_t          end_pos      // = ALength_remainder
-  )
-  {
-  uint32_t pos;
+  uint8_t * str1_p     = reinterpret_cast<uint8_t *>(m_str_ref_p->m_cstr_p);
+  uint8_t * str1_end_p = str1_p + length;  // Don't bother comparing null character
+  uint8_t * str2_p     = reinterpret_cast<uint8_t *>(str.m_str_ref_p->m_cstr_p);
+  char ch1, ch2;
 
-  if (find(bm, instance, &pos, start_pos, end_pos))
+  while (str1_p < str1_end_p)
     {
-    // $Revisit - CReis This could be optimized - the end may be copied twice
-    ensure_writable();
-
-    m_str_ref_p->m_length -= bm.get_length();           // length of new string
-    memmove(m_str_ref_p->m_cstr_p + pos, m_str_ref_p->m_cstr_p + pos + bm.get_length(), size_t(m_str_ref_p->m_length - pos + 1u));
+    ch1 = ms_char2lower[*str1_p];
+    ch2 = ms_char2lower[*str2_p];
 
-    if (find_pos_p)
+    if (ch1 != ch2)  // if characters differ
       {
-      *find_pos_p = pos;
+      // select appropriate result
+      return false;
       }
 
-    return true;
+    str1_p++;
+    str2_p++;
     }
 
-  return false;
+  return true;
   }
 
-//---------------------------------------------------------------------------------------
-// Substring deletion method
-// # Returns:  a reference to itself
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// Modifying Methods
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+//---------------------------------------------------------------------------------------
+// Appends a C-string to the current string.
+// # Returns:  itself
+// Arg         cstr_p - pointer to array of characters to append (does not need to be
+//             null terminated unless length is equal to ALength_calculate).  'cstr_p'
+//             should never be nullptr.
+// Arg         length - number of characters to use in 'cstr_p'.
+//             'length' may also be set to ALength_calculate in which case the character
+//             length is calculated by finding the first terminating null character
+//             already present in the 'cstr_p'.
+// # See:      append(str), insert(), set_cstr(), set_buffer(), add(), operator+=(),
+//             operator+(), operator=()
 // # Author(s): Conan Reis
-void AString::remove_all(
-  uint32_t pos,
-  uint32_t char_count // = ALength_remainder
+void AString::append(
+  const char * cstr_p,
+  uint32_t     length // = ALength_calculate
   )
   {
-  if (char_count == ALength_remainder)
+  A_ASSERT(cstr_p != nullptr, "Given nullptr instead of valid C-String", ErrId_null_cstr, AString);
+
+  if (length == ALength_calculate)
     {
-    char_count = m_str_ref_p->m_length - pos;
+    length = uint32_t(::strlen(cstr_p));
     }
 
-  if (char_count)
+  if (length)
     {
+    // Calculate total length of string
+    uint32_t total_length = m_str_ref_p->m_length + length;
 
-    #ifdef A_BOUNDS_CHECK
-      span_check(pos, char_count, "remove_all");
-    #endif
-
-    // $Revisit - CReis This could be optimized - the end may be copied twice
-    ensure_writable();
-
-    m_str_ref_p->m_length -= char_count;           // length of new string
-    memmove(m_str_ref_p->m_cstr_p + pos, m_str_ref_p->m_cstr_p + pos + char_count, size_t(m_str_ref_p->m_length - pos + 1u));
+    ensure_size(total_length);
+    
+    // concatenate new string
+    memcpy(m_str_ref_p->m_cstr_p + m_str_ref_p->m_length, cstr_p, size_t(length));
+    
+    m_str_ref_p->m_length               = total_length;
+    m_str_ref_p->m_cstr_p[total_length] = '\0';    // Place a terminating character
     }
   }
 
 //---------------------------------------------------------------------------------------
-// Remove all characters of matching ch from start_pos to end_pos.
-// # Returns:  Returns the number of characters that were removed.
-// Arg         ch - character to match
-// Arg         start_pos - first position to start removing  (Default 0)
-// Arg         end_pos - last position to look for characters to remove.
-//             If end_pos is ALength_remainder, end_pos is set to the last index position of
-//             the string (length - 1).
-//             (Default ALength_remainder)
-// # Examples: AString str("  the quick brown fox  ");
-// 
-//             str.remove_all('o');  // str is now "  the quick brwn fx  "
-// # See:      trim(), truncate(), remove_all(match_type), remove_all(str),
-//             find(match_type)
+// Appends the the specified formatted string to the internal C-String.
+// Arg         format_str_p - follows the same format as the C printf(), sprintf(), etc.
+//             See the MSDev online help for 'Format Specification Fields' for a
+//             description. 
+// Arg         ... - variable length arguments expected by the formatted string.
+//
+//             #### IMPORTANT #### Since the variable length arguments do not specify a
+//             type to the compiler the types passes must be determined via the standard
+//             C string formatting functions.  So if a AString *object* is passed in as
+//             one of the untyped variable length arguments, the compiler will not know
+//             to coerce it to a C-String the C format functions will then treat the
+//             address of the AString object as if it were a C-String with disastrous
+//             results.  When using the string format type specifier (%s) and a AString
+//             object (or a ASymbol object) use 'str.as_cstr()'.
+//
+// # Examples: AString name("Joe");     // Example substring to append
+//             AString str("Hello");    // character length is 5 buffer size is 6
+//             str.ensure_size(100u);  // character length is 5 buffer size is 101
+//             str.append_format(" %i you %s %s", 2, name.as_cstr(), "Developer");
+//             // str is now "Hello 2 you Joe Developer"
+//             // character length is 25 buffer size is 101
+//
+// # See:      format(), AString(max_size, format_str_p, ...)
+// # Notes:    If the sum of the current number of characters and the characters in the
+//             expanded format string are larger than the size of this string's current
+//             character buffer, then any characters above and beyond the buffer size
+//             will be truncated.  So it is important that the maximum potential buffer
+//             size has been allocated before this method is called - this can be
+//             easily achieved by calling ensure_size() prior to calling this method.
 // # Author(s): Conan Reis
-uint AString::remove_all(
-  char ch,
-  uint32_t start_pos, // = 0u
-  uint32_t end_pos    // = ALength_remainder
-  )
+void AString::append_format(const char * format_str_p, ...)
   {
-  uint remove_count = 0u;
+  uint32_t length    = m_str_ref_p->m_length;
+  uint32_t size      = m_str_ref_p->m_size;
+  int      free_size = int(size - length) - 1;  // excluding null terminator
 
-  if (m_str_ref_p->m_length)
+  if (free_size > 0)
     {
-    if (end_pos == ALength_remainder)
-      {
-      end_pos = m_str_ref_p->m_length - 1;
-      }
+    va_list args;  // initialize argument list
 
-    #ifdef A_BOUNDS_CHECK
-      bounds_check(start_pos, end_pos, "remove_all");
-    #endif
+    // Ensure buffer is writable and remains the same size
+    ensure_size(size - 1u);
 
-    // $Revisit - CReis This could be optimized - some characters may be needlessly copied
-    ensure_writable();
+    va_start(args, format_str_p);
 
-    uint8_t * cstr_p     = reinterpret_cast<uint8_t *>(m_str_ref_p->m_cstr_p + start_pos);
-    uint8_t * rewrite_p  = cstr_p;
-    uint8_t * cstr_end_p = reinterpret_cast<uint8_t *>(m_str_ref_p->m_cstr_p + end_pos);
-    uint32_t  length     = m_str_ref_p->m_length;
+    #ifdef A_PLAT_PS3
+      int fmt_length = vsnprintf(m_str_ref_p->m_cstr_p + length, size_t(free_size + 1), format_str_p, args);
+    #else
+      int fmt_length = _vsnprintf(m_str_ref_p->m_cstr_p + length, size_t(free_size), format_str_p, args);
+    #endif
 
-    for (; cstr_p <= cstr_end_p; cstr_p++)
+    va_end(args);  // end argument list processing
+
+    if ((fmt_length == -1) || (fmt_length == free_size))  // More characters than buffer has, so truncate
       {
-      if (*cstr_p != ch)
-        {
-        // $Revisit - CReis assuming that a check to see if rewrite_p == cstr_p would just slow things down
-        *rewrite_p = *cstr_p;
-        rewrite_p++;
-        }
-      else
-        {
-        length--;
-        }
+      fmt_length = free_size;
+      m_str_ref_p->m_cstr_p[length + fmt_length] = '\0';     // Put in null-terminator
       }
 
-    *rewrite_p            = '\0';
-    remove_count          = m_str_ref_p->m_length - length;
-    m_str_ref_p->m_length = length;
+    m_str_ref_p->m_length += uint32_t(fmt_length);
     }
-
-  return remove_count;
   }
 
 //---------------------------------------------------------------------------------------
-// Remove all characters of match_type from start_pos to end_pos.
-// # Returns:  Returns the number of characters that were removed.
-// Arg         match_type - classification of characters to match
-// Arg         start_pos - first position to start removing  (Default 0)
-// Arg         end_pos - last position to look for characters to remove.
-//             If end_pos is ALength_remainder, end_pos is set to the last index position of
-//             the string (length - 1).
-//             (Default ALength_remainder)
-// # Examples: AString str("  the quick brown fox  ");
-// 
-//             str.remove_all(ACharMatch_white_space);  // str is now "thequickbrownfox"
-// # See:      trim(), truncate(), remove_all(str), remove_all(ch), find(match_type),
-//             not_char_type()
-// # Author(s): Conan Reis
-uint AString::remove_all(
-  eACharMatch match_type,
-  uint32_t    start_pos, // = 0u
-  uint32_t    end_pos    // = ALength_remainder
+// Appends a signed integer - like ctor_int() without making a separate string
+// Arg         integer - signed integer to append
+// Arg         base - base (or radix) to use for conversion.  10 is decimal, 16 is
+//             hexadecimal, 2 is binary, etc.
+// # See:      ctor_int(), append_uint(), append_format()
+void AString::append_int(
+  int  integer,
+  uint base // = AString_def_base (10)
   )
   {
-  uint remove_count = 0u;
+  uint32_t length = m_str_ref_p->m_length;
 
-  if (m_str_ref_p->m_length)
-    {
-    if (end_pos == ALength_remainder)
-      {
-      end_pos = m_str_ref_p->m_length - 1;
-      }
+  ensure_size(length + AString_int32_max_chars);
 
-    #ifdef A_BOUNDS_CHECK
-      bounds_check(start_pos, end_pos, "remove_all");
-    #endif
+  length += a_int_to_cstr(integer, base, m_str_ref_p->m_cstr_p + length);
 
-    // $Revisit - CReis This could be optimized - some characters may be needlessly copied
-    ensure_writable();
+  m_str_ref_p->m_cstr_p[length] = '\0';
+  m_str_ref_p->m_length         = length;
+  }
 
-    uint8_t * cstr_p        = reinterpret_cast<uint8_t *>(m_str_ref_p->m_cstr_p + start_pos);
-    uint8_t * rewrite_p     = cstr_p;
-    uint8_t * cstr_end_p    = reinterpret_cast<uint8_t *>(m_str_ref_p->m_cstr_p + end_pos);
-    bool *    match_table_p = ms_char_match_table[not_char_type(match_type)];
-    uint32_t  length        = m_str_ref_p->m_length;
+//---------------------------------------------------------------------------------------
+// Appends an unsigned integer - like ctor_uint() without making a separate string
+// Arg         natural - unsigned integer to append
+// Arg         base - base (or radix) to use for conversion.  10 is decimal, 16 is
+//             hexadecimal, 2 is binary, etc.
+// # See:      ctor_uint(), append_int(), append_format()
+void AString::append_uint(
+  uint natural,
+  uint base // = AString_def_base (10)
+  )
+  {
+  uint32_t length = m_str_ref_p->m_length;
 
-    for (; cstr_p <= cstr_end_p; cstr_p++)
-      {
-      if (match_table_p[*cstr_p])
-        {
-        *rewrite_p = *cstr_p;
-        rewrite_p++;
-        }
-      else
-        {
-        length--;
-        }
-      }
+  ensure_size(length + AString_int32_max_chars);
 
-    *rewrite_p            = '\0';
-    remove_count          = m_str_ref_p->m_length - length;
-    m_str_ref_p->m_length = length;
-    }
+  length += a_uint_to_cstr(natural, base, m_str_ref_p->m_cstr_p + length);
 
-  return remove_count;
+  m_str_ref_p->m_cstr_p[length] = '\0';
+  m_str_ref_p->m_length         = length;
   }
 
 //---------------------------------------------------------------------------------------
-// Remove all substrings matching str starting from start_pos to end_pos.
-// # Returns:  Returns the number of characters that were removed.
-// Arg         str - substring to match
-// Arg         start_pos - first position to start removing.
-// Arg         end_pos - last position to look for substring to remove.
-//             If end_pos is ALength_remainder, end_pos is set to the last index position
-//             of the string (length - 1).
-// Arg         case_check - indicates whether case should be AStrCase_sensitive or
-//             AStrCase_insensitive
-// # Author(s): Conan Reis
-uint32_t AString::remove_all(
-  const AString & str,
-  uint32_t        start_pos,  // = 0u
-  uint32_t        end_pos,    // = ALength_remainder
-  eAStrCase       case_check  // = AStrCase_sensitive
+// Appends a f32 - like ctor_float() without making a separate string
+// Arg         real - f32 to append
+// Arg         significant - number of significant digits - see ctor_float()
+// Arg         point_zero - if true integral values end with ".0" like ctor_float() and if
+//             false they have no decimal point like printf("%g")
+// # See:      ctor_float(), append_float64(), append_format()
+void AString::append_float(
+  f32  real,
+  uint significant, // = AString_float_sig_digits_def
+  bool point_zero   // = true
   )
   {
-  // $Revisit - CReis This could be optimized - some characters may be needlessly copied
-  // [Efficiency] Instead of moving from (end of the remove position) - (end of string)
-  // to (beginning of the delete position) for each remove, the move could be from (end
-  // of the remove position) - (beginning of next remove or end of string, whichever is
-  // nearer) to (end of last move or start of string, whichever is later).
+  uint32_t length = m_str_ref_p->m_length;
 
-  uint32_t   removed    = 0u;
-  uint32_t   str_length = str.m_str_ref_p->m_length;
-  uint32_t & length     = m_str_ref_p->m_length;  // Faster, but length must be up-to-date in find()
+  ensure_size(length + significant + AString_real_extra_chars);
 
-  if (str_length && length)
-    {
-    ensure_writable();
-  
-    char * cstr_p = m_str_ref_p->m_cstr_p;
-  
-    if (end_pos == ALength_remainder)
-      {
-      end_pos = length - 1u;
-      }
-  
-    while (find(str, 1u, &start_pos, start_pos, end_pos, case_check))
-      {
-      end_pos -= str_length;
-      length  -= str_length;  // length of new string
-      memmove(cstr_p + start_pos, cstr_p + start_pos + str_length, size_t(length - start_pos + 1u));
-      removed++;
-      }
-    }
+  length += a_real_to_cstr(f64(real), true, significant, point_zero, m_str_ref_p->m_cstr_p + length);
 
-  return removed;
+  m_str_ref_p->m_cstr_p[length] = '\0';
+  m_str_ref_p->m_length         = length;
   }
 
 //---------------------------------------------------------------------------------------
-// Remove all substrings matching fast finding Boyer-Moore str starting from
-//             start_pos to end_pos.
-// # Returns:  Returns the number of characters that were removed.
-// Arg         str - Boyer-Moore substring to match
-// Arg         start_pos - first position to start removing.
-// Arg         end_pos - last position to look for substring to remove.
-//             If end_pos is ALength_remainder, end_pos is set to the last index position
-//             of the string (length - 1).
-// Arg         case_check - indicates whether case should be AStrCase_sensitive or
-//             AStrCase_insensitive
-// # Author(s):  Conan Reis
-uint32_t AString::remove_all(
-  const AStringBM & bm,
-  uint32_t          start_pos,  // = 0u
-  uint32_t          end_pos     // = ALength_remainder
+// Appends a f64 - like ctor_float64() without making a separate string
+// Arg         real - f64 to append
+// Arg         significant - number of significant digits - see ctor_float64()
+// # See:      ctor_float64(), append_float(), append_format()
+void AString::append_float64(
+  f64  real,
+  uint significant // = AString_double_sig_digits_def
   )
   {
-  // $Revisit - CReis This could be optimized - some characters may be needlessly copied
-  // [Efficiency] Instead of moving from (end of the remove position) - (end of string)
-  // to (beginning of the delete position) for each remove, the move could be from (end
-  // of the remove position) - (beginning of next remove or end of string, whichever is
-  // nearer) to (end of last move or start of string, whichever is later).
+  uint32_t length = m_str_ref_p->m_length;
 
-  uint32_t   removed    = 0u;
-  uint32_t   str_length = bm.m_str_ref_p->m_length;
-  uint32_t & length     = m_str_ref_p->m_length;  // Faster, but length must be up-to-date in find()
-  
-  if (str_length && length)
-    {
-    ensure_writable();
-    
-    char * cstr_p = m_str_ref_p->m_cstr_p;
-  
-    if (end_pos == ALength_remainder)
-      {
-      end_pos = length - 1u;
-      }
-  
-    while (find(bm, 1u, &start_pos, start_pos, end_pos))
-      {
-      end_pos -= str_length;
-      length  -= str_length;  // length of new string
-      memmove(cstr_p + start_pos, cstr_p + start_pos + str_length, size_t(length - start_pos + 1u));
-      removed++;
-      }
-    }
-    
-  return removed;
-  }
+  ensure_size(length + significant + AString_real_extra_chars);
 
-//---------------------------------------------------------------------------------------
-//  Removes specified number of characters from the end of the string.
-// Arg          char_count - number of characters to remove from the end of the string.
-// # See:       set_length(), crop(), get_length(), remove(), trim(), truncate()
-// # Author(s):  Conan Reis
-void AString::remove_end(uint32_t char_count)
-  {
-  #ifdef A_BOUNDS_CHECK
-    A_VERIFY(char_count <= m_str_ref_p->m_length, a_cstr_format("- tried to remove %u characters out of %u", char_count, m_str_ref_p->m_length), AErrId_invalid_index_span, AString);
-  #endif
+  length += a_real_to_cstr(real, false, significant, true, m_str_ref_p->m_cstr_p + length);
 
-  set_length(m_str_ref_p->m_length - char_count);
+  m_str_ref_p->m_cstr_p[length] = '\0';
+  m_str_ref_p->m_length         = length;
   }
 
 //---------------------------------------------------------------------------------------
-// Replaces chars in string starting at pos with new_char_count chars from
-//             new_str at new_pos.  If the pos + new_char_count is greater than the
-//             current length of the string, it will extend its length.
-// # Returns:  a reference to itself
-// Arg         new_str - string to replace with
-// Arg         pos - position in this string to begin replace
-// Arg         char_count - number of chars to replace in this string.  If it is set to
-//             ALength_remainder, it is set to length of this string - pos.  To do an
-//             "overwrite" use new_str.get_length().  If this value is 0, it is the same
-//             as an "insert".
-// Arg         new_pos - position to start copying from new_str
-// Arg         new_char_count - number of chars to copy from new_str into this string.
-//             If it is set to ALength_remainder, it is set to length of new - new_pos.
+// Removes all the characters but the substring starting at 'pos' with a
+//             length of 'char_count'.
+// Arg         pos - starting character index position of substring to crop
+// Arg         char_count - number of characters that the remaining substring should
+//             have.  If 'char_count' is ALength_remainder, the number of characters is
+//             equal to the 'length of the string' - 'pos'.  (Default ALength_remainder)
+// # Examples: AString str("  the quick brown fox  ");
+// 
+//             str.crop(3u, 12u);  // str is now "he quick bro"
+// # See:      crop_quick(), crop(match_type), trim(), truncate(),
+//             remove_all(match_type), find(match_type)
+// # Notes:    This method checks if 'pos' and 'char_count' are valid if A_BOUNDS_CHECK
+//             is defined (defined by default in debug builds).
 // # Author(s): Conan Reis
-void AString::replace(
-  const AString & new_str,
-  uint32_t        pos,            // = 0
-  uint32_t        char_count,     // = ALength_remainder
-  uint32_t        new_pos,        // = 0
-  uint32_t        new_char_count // = ALength_remainder
+void AString::crop(
+  uint32_t pos,
+  uint32_t char_count // = ALength_remainder
   )
   {
-  if (new_char_count == ALength_remainder)
+  AStringRef * str_ref_p = m_str_ref_p;
+
+  if (char_count == ALength_remainder)
     {
-    new_char_count = new_str.m_str_ref_p->m_length - new_pos;
+    char_count = str_ref_p->m_length - pos;
     }
 
-  #ifdef A_BOUNDS_CHECK
-    new_str.span_check(new_pos, new_char_count, "replace");
-  #endif
-
-  if (new_char_count)
+  if (char_count)
     {
-    uint32_t rem_length = m_str_ref_p->m_length - pos;
-
-    char_count = (char_count == ALength_remainder)
-      ? rem_length
-      : a_min(char_count, rem_length);  // Only remove the characters available
-
     #ifdef A_BOUNDS_CHECK
-      span_check(pos, char_count, "replace");
+      span_check(pos, char_count, "crop");
     #endif
 
-    uint32_t     new_length = m_str_ref_p->m_length - char_count + new_char_count;
-    AStringRef * str_ref_p  = m_str_ref_p;
-
-    // $Revisit - CReis This could be optimized - the end may be copied twice
-    ensure_size(new_length);
-
-    // Move remaining characters following old_str up or down
-    if (pos + new_char_count <= new_length)
-      {
-      memmove(m_str_ref_p->m_cstr_p + pos + new_char_count, str_ref_p->m_cstr_p + pos + char_count, str_ref_p->m_length - pos - char_count + 1u);
-      }
-
-    // Copy new_str to its replacement position in the current string
-    memcpy(m_str_ref_p->m_cstr_p + pos, new_str.m_str_ref_p->m_cstr_p + new_pos, new_char_count);
-    m_str_ref_p->m_length = new_length;
+    crop_quick(pos, char_count);
+    }
+  else
+    {
+    empty();
     }
   }
 
 //---------------------------------------------------------------------------------------
-//  Substring search and replacement
-// # Author(s):  Conan Reis
-bool AString::replace(
-  const AString & old_str,
-  const AString & new_str,
-  uint32_t        instance,    // = 1u
-  uint32_t *      find_pos_p,  // = nullptr
-  uint32_t        start_pos,   // = 0u
-  uint32_t        end_pos,     // = ALength_remainder
-  eAStrCase       case_check   // = AStrCase_sensitive
+// Removes all the characters of match_type from the beginning and the end
+//             of the string until it encounters a character that is not match_type.
+// Arg         match_type - classification of characters to remove.
+//             (Default ACharMatch_white_space)
+// # Examples: AString str("  the quick brown fox  ");
+// 
+//             str.crop();  // str is now "the quick brown fox"
+// # See:      trim(), truncate(), remove_all(match_type), find(match_type),
+//             not_char_type()
+// # Author(s): Conan Reis
+AString & AString::crop(
+  eACharMatch match_type // = ACharMatch_white_space
   )
   {
-  uint32_t pos;
+  uint32_t    start_pos;
+  eACharMatch not_type = not_char_type(match_type);
 
-  if (find(old_str, instance, &pos, start_pos, end_pos, case_check))
+  if (find(not_type, 1u, &start_pos))
     {
-    uint32_t     old_length = old_str.m_str_ref_p->m_length;
-    uint32_t     new_length = new_str.m_str_ref_p->m_length;
-    uint32_t     length     = m_str_ref_p->m_length - old_length + new_length;
-    AStringRef * str_ref_p  = m_str_ref_p;
-
-    // $Revisit - CReis This could be optimized - the end may be copied twice
-    ensure_size(length);
-
-    // Move remaining characters following old_str up or down
-    if (pos + new_length < length)
-      {
-      memmove(m_str_ref_p->m_cstr_p + pos + new_length, str_ref_p->m_cstr_p + pos + old_length, str_ref_p->m_length - pos - old_length + 1u);
-      }
-
-    // Copy new_str to its replacement position in the current string
-    memcpy(m_str_ref_p->m_cstr_p + pos, new_str.m_str_ref_p->m_cstr_p, new_length);
-    m_str_ref_p->m_length = m_str_ref_p->m_length - old_length + new_length;
-
-    if (find_pos_p)
-      {
-      *find_pos_p = pos;
-      }
+    uint32_t end_pos;
 
-    return true;
+    find_reverse(not_type, 1u, &end_pos);
+    crop_quick(start_pos, end_pos - start_pos + 1u);
+    }
+  else
+    {
+    empty();
     }
 
-  return false;
+  return *this;
   }
 
 //---------------------------------------------------------------------------------------
-//  Substring search and replacement
-// # Author(s):  Conan Reis
-bool AString::replace(
-  const AStringBM & bm,
-  const AString &   new_str,
-  uint32_t          instance,    // = 1u
-  uint32_t *        find_pos_p,  // = nullptr
-  uint32_t          start_pos,   // = 0u
-  uint32_t          end_pos      // = ALength_remainder
+// Removes all the characters but the substring starting at 'pos' with a
+//             length of 'char_count'.
+// Arg         pos - starting character index position of substring to crop
+// Arg         char_count - number of characters that the remaining substring should
+//             have - it should be at least 1.
+// # Examples: AString str("  the quick brown fox  ");
+// 
+//             str.crop(3u, 12u);  // str is now "he quick bro"
+// # See:      crop_quick(), crop(match_type), trim(), truncate(),
+//             remove_all(match_type), find(match_type)
+// # Notes:    This method does *not* check if 'pos' and 'char_count' are valid even if
+//             A_BOUNDS_CHECK is defined.
+// # Author(s): Conan Reis
+void AString::crop_quick(
+  uint32_t pos,
+  uint32_t char_count
   )
   {
-  uint32_t pos;
+  AStringRef * str_ref_p = m_str_ref_p;
 
-  if (find(bm, instance, &pos, start_pos, end_pos))
+  if (char_count == str_ref_p->m_length)
     {
-    uint32_t old_length = bm.m_str_ref_p->m_length;
-    uint32_t new_length = new_str.m_str_ref_p->m_length;
-    uint32_t length     = m_str_ref_p->m_length - old_length + new_length;
-
-    // $Revisit - CReis This could be optimized - the end may be copied twice
-    ensure_size(length);
-
-    // Move remaining characters following bm up or down
-    memmove(m_str_ref_p->m_cstr_p + pos + new_length, m_str_ref_p->m_cstr_p + pos + old_length, m_str_ref_p->m_length - pos - old_length + 1u);
-
-    // Copy new_str to its replacement position in the current string
-    memcpy(m_str_ref_p->m_cstr_p + pos, new_str.m_str_ref_p->m_cstr_p, new_length);
-    m_str_ref_p->m_length = length;
+    // Keeping whole string - no need to do anything
+    return;
+    }
 
-    if (find_pos_p)
+  // If unique and writable
+  if ((str_ref_p->m_ref_count + str_ref_p->m_read_only) == 1u)
+    {
+    if (pos)
       {
-      *find_pos_p = pos;
+      // Shift down
+      memmove(str_ref_p->m_cstr_p, str_ref_p->m_cstr_p + pos, char_count);
       }
 
-    return true;
+    str_ref_p->m_cstr_p[char_count] = '\0';
+    str_ref_p->m_length             = char_count;
+    }
+  else  // Shared or read-only
+    {
+    m_str_ref_p = str_ref_p->reuse_or_new_buffer(char_count, str_ref_p->m_cstr_p + pos, char_count);
     }
-
-  return false;
   }
 
 //---------------------------------------------------------------------------------------
-//  Replace all old_ch with new_ch starting at start_pos and ending at end_pos.
-// # Returns:   Number of characters replaced.
-// # Author(s):  Conan Reis
-uint AString::replace_all(
-  char old_ch,
-  char new_ch,
-  uint start_pos,  // = 0u
-  uint end_pos     // = ALength_remainder
-  )
+// Sets the internal C-String to the specified formatted string.
+// Arg         format_str_p - follows the same format as the C printf(), sprintf(), etc.
+//             See the MSDev online help for 'Format Specification Fields' for a
+//             description. 
+// Arg         ... - variable length arguments expected by the formatted string.
+//
+//             #### IMPORTANT #### When using the string format type specifier (%s) in
+//             the format string and a AString object (or a ASymbol object) is passed in
+//             as one of the variable length arguments, use 'str.as_cstr()'.
+//             Variable length arguments do not specify a type to the compiler, instead
+//             the types of the passed arguments are determined via the standard C
+//             string formatting functions - i.e %s, %u, %f, etc.  So if a string type
+//             (%s) is specified in the format string and a AString object is passed as
+//             one of the untyped variable length arguments, the compiler will not know
+//             to coerce the AString object to a C-String - it will instead treat the
+//             address of the AString object argument as if it were a C-String character
+//             array with disastrous results.
+// # Examples: AString begin("The answer");  // Example substring to append
+//             AString str("Hello");         // character length is 5 buffer size is 6
+//             str.ensure_size(100u);       // character length is 5 buffer size is 101
+//             str.format("%s to %s is %i", begin.as_cstr(), "everything", 42);
+//             // str is now "The answer to everything is 42"
+//             // character length is 30 buffer size is 101
+//
+// # See:      append_format(), AString(max_size, format_str_p, ...)
+// # Notes:    If the number of characters in the expanded format string is larger than
+//             the size of this string's current character buffer, then any characters
+//             above and beyond the buffer size will be truncated.  So it is important
+//             that the maximum potential buffer size has been allocated before this
+//             method is called - this can be easily achieved by calling ensure_size()
+//             prior to calling this method.
+// # Author(s): Conan Reis
+void AString::format(const char * format_str_p, ...)
   {
-  uint  count  = 0u;
-  uint32_t length = m_str_ref_p->m_length;
-  
-  if (length)  // if not empty
+  va_list args;  // initialize argument list
+  int     char_size = int(m_str_ref_p->m_size) - 1;
+
+  if (char_size > 0)
     {
-    if (end_pos == ALength_remainder)
-      {
-      end_pos = length - 1;
-      }
+    // Ensure buffer is writable, but don't bother copying existing data.
+    ensure_size_buffer(char_size);
 
-    #ifdef A_BOUNDS_CHECK
-      bounds_check(start_pos, end_pos, "replace_all");
-    #endif
+    va_start(args, format_str_p);
 
-    ensure_writable();
+  #if defined(A_PLAT_PS3) || defined(A_PLAT_PS4)
+      int length = vsnprintf(m_str_ref_p->m_cstr_p, size_t(char_size + 1), format_str_p, args);
+    #else
+      int length = _vsnprintf(m_str_ref_p->m_cstr_p, size_t(char_size), format_str_p, args);
+    #endif
 
-    char * cstr_p     = m_str_ref_p->m_cstr_p;
-    char * cstr_end_p = cstr_p + length;
+    va_end(args);  // end argument list processing
 
-    while (cstr_p < cstr_end_p)
+    if ((length == -1) || (length == char_size))  // More characters than buffer has, so truncate
       {
-      if (*cstr_p == old_ch)
-        {
-        *cstr_p = new_ch;
-        count++;
-        }
-
-      cstr_p++;
+      length = int(char_size);
+      m_str_ref_p->m_cstr_p[char_size] = '\0';     // Put in null-terminator
       }
-    }
 
-  return count;
+    m_str_ref_p->m_length = uint32_t(length);
+    }
   }
 
 //---------------------------------------------------------------------------------------
-//  Replace all old_ch with new_str starting at start_pos and ending at end_pos.
-// # Returns:   Number of characters replaced.
-// Efficiency   See remove_all() efficiency comment for replacements where new_str is
-//              shorter than old_str.  It may also be more efficient to apply the same
-//              method for the reverse - just determine offset or tally the results.
-// Stability    Assumes that new_str is > 1 character in length
-uint32_t AString::replace_all(
-  char            old_ch,
-  const AString & new_str,
-  uint32_t        start_pos,  // = 0u
-  uint32_t        end_pos     // = ALength_remainder
+// Increments any postfixed number by amount specified.  If the string does
+//             not have a previously postfixed number then increment_by is appended to
+//             the string padded with zeros if necessary as specified by min_digits.
+// # Returns:  Postfixed value.
+// Arg         increment_by - step value / amount to increment by
+// Arg         min_digits - minimum number of digits to use for postfix value.  If a
+//             previous postfix value is present, its number of digits is used and this
+//             number is ignored.
+// # Author(s): Conan Reis
+uint32_t AString::increment(
+  uint32_t increment_by, // = 1u
+  uint32_t min_digits    // = 4u
   )
   {
-  uint32_t pos;
-  uint32_t found = 0u;
-  
-  if (m_str_ref_p->m_length)  // if not empty
+  uint32_t find_pos = 0u;
+  uint32_t value    = 0u;
+  uint32_t length   = m_str_ref_p->m_length;
+
+  // Look for previous value
+  find_reverse(ACharMatch_not_digit, 1u, &find_pos);
+
+  if ((find_pos + 1u) < length)
     {
-    if (end_pos == ALength_remainder)
-      {
-      end_pos = m_str_ref_p->m_length - 1;
-      }
+    // Previous number postfix found
+    find_pos++;
+    value = as_uint(find_pos, nullptr, 10u);
 
-    #ifdef A_BOUNDS_CHECK
-      bounds_check(start_pos, end_pos, "replace_all");
-    #endif
+    min_digits = length - find_pos;
 
-    found = count(old_ch, start_pos, end_pos);
+    // remove old value prefix
+    length -= min_digits;
+    m_str_ref_p->m_length = length;
+    }
 
-    if (found)
-      {
-      uint32_t new_length      = new_str.m_str_ref_p->m_length;
-      uint32_t size_difference = new_length - 1u;
+  // Create new value
+  value += increment_by;
 
-      ensure_size(m_str_ref_p->m_length + (found * size_difference));
+  uint32_t new_digits = value < 10u
+    ? 1u
+    : a_log10ceil(value) + 1u;
 
-      // These must be after the ensure_size() since the AStringRef and internal buffer could change
-      uint32_t & length     = m_str_ref_p->m_length;  // Faster, but length must be up-to-date in find()
-      char *     cstr_p     = m_str_ref_p->m_cstr_p;
-      char *     new_cstr_p = new_str.m_str_ref_p->m_cstr_p;
+  ensure_size(length + a_max(new_digits, min_digits));
 
-      while ((start_pos <= end_pos) && find(old_ch, 1u, &pos, start_pos, end_pos))
-        {
-        memmove(cstr_p + pos + new_length, cstr_p + pos + 1u, size_t(length - pos));
-        length  += size_difference;
-        end_pos += size_difference;
-        memcpy(cstr_p + pos, new_cstr_p, size_t(new_length));
-        start_pos = pos + new_length;
-        }
-      }
+  if (new_digits < min_digits)
+    {
+    // Pad with zeros
+    append('0', min_digits - new_digits);
     }
 
-  return found;
+  append_uint(value);
+
+  return value;
   }
 
 //---------------------------------------------------------------------------------------
-//  Replace all bm with new_str starting at start_pos
-// # Author(s):  Conan Reis
-// Efficiency   See remove_all() efficiency comment for replacements where new_str is
-//              shorter than old_str.  It may also be more efficient to apply the same
-//              method for the reverse - just determine offset or tally the results.
-uint32_t AString::replace_all(
-  const AStringBM & bm,
-  const AString &   new_str,
-  uint32_t          start_pos,  // = 0u
-  uint32_t          end_pos     // = ALength_remainder
+// Indents rows/lines by specified `space_count` spaces from `start_pos` to `end_pos`.
+// Works on line breaks that are in Unix style `\n` or DOS style `\r\n`.
+//
+// # Returns: number of line breaks over the range specified
+// # Params:
+//   space_count: number of space characters to indent
+//   start_pos:   starting index to begin indentation
+//   end_pos:     ending index to stop indentation
+//   
+// # Notes:
+//   - Spaces inserted just prior to first non-space (space or tab) character on each row.
+//   - Rows with no non-space characters are not indented.
+//   - If the range ends just after a line break, the following row is not indented - at
+//     least one character on a row must be included for it to be indented
+//   - Mimics behaviour of Visual Studio editor.
+// 
+// # See:       line_unindent(), line_*() functions, ARichEditOS::indent_selection()
+// # Author(s): Conan Reis
+uint AString::line_indent(
+  uint space_count, // = AString_indent_spaces_def
+  uint start_pos,   // = 0u
+  uint end_pos      // = ALength_remainder
   )
   {
-  uint32_t pos;
-  uint32_t found = 0u;
-  
-  if (m_str_ref_p->m_length)  // if not empty
+  // $Revisit - CReis Could use space_count=0 to indicate that spaces should be used to indent rather than spaces.
+  AStringRef * str_ref_p = m_str_ref_p;
+  uint32_t     length    = str_ref_p->m_length;
+
+  if (length == 0u)
     {
-    if (end_pos == ALength_remainder)
-      {
-      end_pos = m_str_ref_p->m_length - 1;
-      }
+    return 0u;
+    }
 
-    #ifdef A_BOUNDS_CHECK
-      bounds_check(start_pos, end_pos, "replace_all");
-    #endif
+  if (end_pos == ALength_remainder)
+    {
+    end_pos = length - 1;
+    }
 
-    found = count(bm, start_pos, end_pos);
+  #ifdef A_BOUNDS_CHECK
+    bounds_check(start_pos, end_pos, "indent");
+  #endif
 
-    if (found)
+
+  //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+  // Determine number of lines.
+  uint   line_count   = 1u;
+  char * buffer_p     = str_ref_p->m_cstr_p;
+  char * cstr_start_p = buffer_p + start_pos;
+  char * cstr_end_p   = buffer_p + end_pos;
+  char * cstr_p       = cstr_start_p;
+
+  // Use < rather than <= to intentionally stop before last character
+  while (cstr_p < cstr_end_p)
+    {
+    if (*cstr_p == '\n')
       {
-      uint32_t new_length      = new_str.m_str_ref_p->m_length;
-      uint32_t old_length      = bm.get_length();
-      int      size_difference = int(new_length) - int(old_length);
+      line_count++;
+      }
 
-      ensure_size(m_str_ref_p->m_length + (found * size_difference));
+    cstr_p++;
+    }
 
-      // These must be after the ensure_size() since the internal buffer could change
-      uint32_t & length     = m_str_ref_p->m_length;  // Faster, but length must be up-to-date in find()
-      char *     cstr_p     = m_str_ref_p->m_cstr_p;
-      char *     new_cstr_p = new_str.m_str_ref_p->m_cstr_p;
+  //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+  // Ensure enough memory for indenting
+  size_t char_count;
+  char * dest_p;
+  char * source_p     = buffer_p;
+  uint   extra_chars  = line_count * space_count;
 
-      while ((start_pos <= end_pos) && find(bm, 1u, &pos, start_pos, end_pos))
-        {
-        if (size_difference != 0)
-          {
-          memmove(cstr_p + pos + new_length, cstr_p + pos + old_length, size_t(length - old_length + 1u - pos));
-          length  += uint32_t(size_difference);  // Silly cast to stop compiler warning
-          end_pos += uint32_t(size_difference);
-          }
-
-        memcpy(cstr_p + pos, new_cstr_p, size_t(new_length));
-        start_pos = pos + new_length;
-        }
-      }
-    }
+  // $Revisit - CReis Could reuse existing buffer if it is large enough.
+  // Test to see if new buffer needed or if old one can be reused
+  //bool new_buffer_b = (str_ref_p->m_size < (length + extra_chars))
+  //  || ((str_ref_p->m_ref_count + str_ref_p->m_read_only) != 1u);
 
-  return found;
-  }
+  uint32_t new_size     = AStringRef::request_char_count(length + extra_chars);
+  char *   new_buffer_p = AStringRef::alloc_buffer(new_size);
 
-//---------------------------------------------------------------------------------------
-//  Reverse order of char_count characters starting at pos.
-// Arg          pos - character index to begin reversing characters.  (Default 0u)
-// Arg          char_count - number of characters to reverse.  If char_count is ALength_remainder,
-//              the number of characters is equal to the length of the string - pos.
-//              (Default ALength_remainder)
-// # Examples:  AString str("12345");
-//              str.reverse();         // = "54321"
-// # See:       as_reverse(), find_reverse()
-// # Author(s):  Conan Reis
-void AString::reverse(
-  uint32_t pos,     // = 0u
-  uint32_t char_count // = ALength_remainder
-  )
-  {
-  if (char_count == ALength_remainder)  // default
-    {
-    char_count = m_str_ref_p->m_length - pos;
-    }
+  dest_p = new_buffer_p;
+  cstr_p = cstr_start_p;
 
-  if (char_count > 1)  // If less than 2 characters are reversed, there is no point
+  do 
     {
-    #ifdef A_BOUNDS_CHECK
-      span_check(pos, char_count, "reverse");
-    #endif
-
-    // $Revisit - CReis This could be optimized - characters in specified range may be copied twice.
-    ensure_writable();
-
-    char   ch;
-    char * cstr_p     = m_str_ref_p->m_cstr_p + pos;
-    char * cstr_end_p = cstr_p + char_count - 1;
-
-    while (cstr_p < cstr_end_p)
+    //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+    // Find first non-space
+    while ((cstr_p <= cstr_end_p)
+      && ((*cstr_p == ' ') || (*cstr_p == '\t')))
       {
-      ch          = *cstr_p;
-      *cstr_p     = *cstr_end_p;
-      *cstr_end_p = ch;
       cstr_p++;
-      cstr_end_p--;
       }
-    }
-  }
 
-//---------------------------------------------------------------------------------------
-//  Sets the C-String character buffer.  See the description of the
-//              argument 'buffer_p' for the three possible uses of this constructor.
-// # Returns:   itself
-// Arg          buffer_p - pointer to array of characters (does not need to be null
-//              terminated unless 'length' is equal to ALength_calculate).  If 'buffer_p'
-//              is nullptr, 'length' and 'deallocate' are ignored.  There are in general 3
-//              different types of values that 'buffer_p' will be given:
-//                1. A temporary buffer which is allocated on the stack or is recovered
-//                   by some other means.
-//                2. A pre-allocated character array that this AString object should take
-//                   over responsibility for.
-//                3. nullptr.  This then creates an empty string with a space of 'size'
-//                   already allocated including the null terminating character.
-// Arg          size - This is the size in bytes of the memory pointed to by 'buffer_p'
-//              or if 'buffer_p' is nullptr, it is the initial memory size that should be 
-//              allocated by this string.  Also note that this size includes the null
-//              terminating character, so 'size' should never be less than 1.
-// Arg          length - number of characters to use in 'buffer_p' and the index position
-//              to place a terminating null character.  The given length must not be more
-//              than the size of 'buffer_p' and the C-String buffer pointed to by
-//              'buffer_p' should not have any null characters less then the given length.
-//              'length' may also be set to ALength_calculate in which case the character
-//              length is calculated by finding the first terminating null character
-//              already present in 'buffer_p'.  (Default ALength_calculate)
-// Arg          deallocate - Indicates whether this string (or more specifically the
-//              AStringRef) should take control of the memory pointed to by buffer_p and
-//              do deallocate it when it is no longer in use.
-// # Examples:  char buffer_p[100];
-//              str.set_buffer(buffer_p, 100u, 0u);
-// # See:       set_cstr(), operator=(cstr), append(), insert(), AString(cstr_p),
-//              AString(cstr_p, length, persistent), AString(buffer_p, size, length, deallocate)
-// # Notes:     To make a copy of a C-String call AString(cstr_p, length, persistent = false).
-//              To reference a C-String literal call AString(cstr_p) or
-//              AString(cstr_p, length, persistent = true)
-// # Author(s):  Conan Reis
-void AString::set_buffer(
-  const char * buffer_p,
-  uint32_t     size,
-  uint32_t     length,    // = ALength_calculate
-  bool         deallocate // = false
-  )
-  {
-  if (buffer_p)
-    {
-    if (length == ALength_calculate)
+
+    //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+    // Indent if some non-space chars before end of line
+    if ((cstr_p <= cstr_end_p) && (*cstr_p != '\r') && (*cstr_p != '\n'))
       {
-      length = uint32_t(::strlen(buffer_p));
+      // Copy characters so far
+      char_count = size_t(cstr_p - source_p);
+      memcpy(dest_p, source_p, char_count);
+      source_p = cstr_p;
+      dest_p  += char_count;
+
+      // Indent
+      memset(dest_p, ' ', space_count);
+      dest_p += space_count;
       }
 
-    m_str_ref_p = m_str_ref_p->reuse_or_new(buffer_p, length, size, deallocate);
-    m_str_ref_p->m_cstr_p[length] = '\0';  // Put in null-terminator
-    }
-  else  // nullptr, so create empty string with specified buffer size
-    {
-    ensure_size_empty(size);
-    }
-  }
 
-//---------------------------------------------------------------------------------------
-// Sets the C-String character buffer.  Refers to a persistent null-terminated
-//             C-String or makes its own copy of an existing character array.
-// Arg         cstr_p - pointer to array of characters (does not need to be null
-//             terminated unless length is set to ALength_calculate or 'persistent' is
-//             true).  'cstr_p' should never be nullptr.  'cstr_p' will usually be a string
-//             literal or if 'persistent' is false, 'cstr_p' may be any C-String that
-//             this string should make a copy of.
-// Arg         length - number of characters to use in 'cstr_p' and the index position to
-//             place a terminating null character.  The given length must not be more
-//             than the size of 'cstr_p' and the C-String buffer pointed to by 'cstr_p'
-//             should not have any null characters less then the given length.  A null
-//             terminator is placed only if 'persistent' is not true.
-//             'length' may also be set to ALength_calculate in which case the character
-//             length is calculated by finding the first terminating null character
-//             already present in 'cstr_p'.
-// Arg         persistent - Indicates whether the data pointed to by cstr_p will be
-//             available for the lifetime of this string.  If 'persistent' is true, the
-//             memory pointed to by 'cstr_p' will be used rather than having this object
-//             allocate its own memory - also the memory pointed to by 'cstr_p' will not
-//             be written to.  If 'persistent' is false, then this AString object will
-//             allocate its own memory and copy the contents of 'cstr_p' to it.
-// # Examples: str.set_cstr("Hello");
-// # See:      set_buffer(), operator=(cstr), append(), insert(), AString(cstr_p),
-//             AString(cstr_p, length, persistent), AString(buffer_p, size, length, deallocate)
-// # Author(s): Conan Reis
-void AString::set_cstr(
-  const char * cstr_p,
-  uint32_t     length,    // = ALength_calculate
-  bool         persistent // = true
-  )
-  {
-  A_ASSERT(cstr_p != nullptr, "Given nullptr instead of valid C-String", ErrId_null_cstr, AString);
+    //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+    // Skip past end of line (skip `\r` of `\r\n`) or to end of range
+    while (cstr_p <= cstr_end_p)
+      {
+      if (*cstr_p == '\n')
+        {
+        // Skip past newline
+        cstr_p++;
+        break;
+        }
 
-  if (length == ALength_calculate)
-    {
-    length = uint32_t(::strlen(cstr_p));
+      cstr_p++;
+      }
     }
+  while (cstr_p <= cstr_end_p);
 
-  if (persistent)
-    {
-    m_str_ref_p->dereference();
-    m_str_ref_p = AStringRef::pool_new(cstr_p, length, length + 1u, 1u, false, true);
-    }
-   else  // Not persistent - make a copy
-    {
-    ensure_size_buffer(length);
+  //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+  // Copy any remainder of the string
+  char_count = size_t(cstr_p - source_p);
+  memcpy(dest_p, source_p, char_count);
+  dest_p += char_count;
 
-    memcpy(m_str_ref_p->m_cstr_p, cstr_p, length);
-    m_str_ref_p->m_cstr_p[length] = '\0';  // Put in null-terminator
-    m_str_ref_p->m_length         = length;
-    }
+  length = uint32_t(dest_p - new_buffer_p);
+  new_buffer_p[length] = '\0';
+  m_str_ref_p = str_ref_p->reuse_or_new(new_buffer_p, length, new_size);
+
+  return line_count;
   }
 
 //---------------------------------------------------------------------------------------
-//  Removes all the characters of match_type from the beginning of the string
-//              until it encounters a character that is not match_type.
-// Arg          match_type - classification of characters to match.
-//              (Default ACharMatch_white_space)
-// # Examples:  AString str("  the quick brown fox  ");
+// Indents all rows/lines after the first row by specified `space_count` spaces from
+// `start_pos` to `end_pos`. Works on line breaks that are in Unix style `\n` or DOS
+// style `\r\n`.
+//
+// # Returns: number of line breaks over the range specified
+// # Params:
+//   space_count: number of space characters to indent
+//   start_pos:   starting index to begin indentation
+//   end_pos:     ending index to stop indentation
+//   
+// # Notes:
+//   - Spaces inserted just prior to first non-space (space or tab) character on each row.
+//   - Rows with no non-space characters are not indented.
+//   - If the range ends just after a line break, the following row is not indented - at
+//     least one character on a row must be included for it to be indented
+//   - Mimics behaviour of Visual Studio editor.
 // 
-//              str.trim();  // str is now "the quick brown fox  "
-// # See:       truncate(), crop(), remove_all(match_type), find(match_type), not_char_type()
-// # Author(s):  Conan Reis
-// Efficiency   See efficiency comment for remove_all().
-void AString::trim(
-  eACharMatch match_type // = ACharMatch_white_space
+// # See:       line_unindent(), line_*() functions, ARichEditOS::indent_selection()
+// # Author(s): Conan Reis
+uint AString::line_indent_next(
+  uint space_count, // = AString_indent_spaces_def
+  uint start_pos,   // = 0u
+  uint end_pos      // = ALength_remainder
   )
   {
-  uint32_t find_pos;
-
-  if (find(not_char_type(match_type), 1u, &find_pos))
-    {
-    // $Revisit - CReis this code could be transplanted here for extra speed.
-    crop_quick(find_pos, m_str_ref_p->m_length - find_pos);
-    }
-  else
+  if (find('\n', 1u, &start_pos, start_pos, end_pos))
     {
-    empty();
+    return line_indent(space_count, start_pos + 1u, end_pos);
     }
+
+  return 0u;
   }
 
 //---------------------------------------------------------------------------------------
-//  Removes all the characters of match_type from the end of the string
-//              until it encounters a character that is not match_type.
-// Arg          match_type - classification of characters to match.
-//              (Default ACharMatch_white_space)
-// # Examples:  AString str("  the quick brown fox  ");
+// Unindents rows/lines by specified `space_count` spaces from `start_pos` to `end_pos`.
+// Works on line breaks that are in Unix style `\n` or DOS style `\r\n`.
+//
+// # Returns: number of line breaks over the range specified
+// # Params:
+//   space_count: number of space characters to unindent
+//   tab_stops:   tab stop count in spaces
+//   start_pos:   starting index to begin
+//   end_pos:     ending index to stop
+//   
+// # Notes:
+//   - Spaces removed just prior to first non-space (space or tab) character on each row.
+//   - Rows with no non-space characters are left as is
+//   - If the range ends just after a line break, the following row is not unindented - at
+//     least one character on a row must be included for it to be unindented
 // 
-//              str.truncate();  // str is now "  the quick brown fox"
-// # See:       trim(), crop(), remove_all(match_type), find(match_type), not_char_type()
-// # Author(s):  Conan Reis
-void AString::truncate(
-  eACharMatch match_type // = ACharMatch_white_space
+// # See:       line_indent(), line_*() functions, ARichEditOS::unindent_selection()
+// # Author(s): Conan Reis
+uint AString::line_unindent(
+  uint space_count, // = AString_indent_spaces_def
+  uint tab_stops,   // = AString_tab_stop_def
+  uint start_pos,   // = 0u
+  uint end_pos      // = ALength_remainder
   )
   {
-  uint32_t find_pos;
-
-  if (find_reverse(not_char_type(match_type), 1u, &find_pos))
-    {
-    // $Revisit - CReis this code could be transplanted here for extra speed.
-    crop_quick(0u, find_pos + 1u);
-    }
-  else
-    {
-    empty();
-    }
-  }
-
-//---------------------------------------------------------------------------------------
-//  Add-assignment operator:  string += cstring
-// # Returns:   a reference to itself
-// Arg          cstr_p - Null-terminated C-sting to append.  'cstr_p' should never be 
-//              nullptr.
-// # See:       append(), insert(), set_cstr(), set_buffer(), add(), operator+=(),
-//              operator+(), operator=()
-// # Author(s):  Conan Reis
-AString & AString::operator+=(const char * cstr_p)
-  {
-  A_ASSERT(cstr_p != nullptr, "Given nullptr instead of valid C-String", ErrId_null_cstr, AString);
-
-  uint32_t length = uint32_t(::strlen(cstr_p));
-
-  if (length)
+  //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+  struct Nested
     {
-    uint32_t total_length = m_str_ref_p->m_length + length;  // Calculate total length of string
-
-    ensure_size(total_length);
-    
-    // concatenate new string
-    memcpy(m_str_ref_p->m_cstr_p + m_str_ref_p->m_length, cstr_p, size_t(length));
-    
-    m_str_ref_p->m_length               = total_length;
-    m_str_ref_p->m_cstr_p[total_length] = '\0';    // Place a terminating character
-    }
+    static char * set_column(
+      char * cstr_p, uint column, uint tab_stops)
+      {
+      uint idx = 0u;
+      uint tab_spaces = 0u;
 
-  return *this;
-  }
+      while (idx < column)
+        {
+        if (*cstr_p == ' ')
+          {
+          cstr_p++;
+          idx++;
+          }
+        else
+          {
+          // Must be a tab - determine its number of spaces
+          tab_spaces = tab_stops - (idx % tab_stops);
 
+          if ((idx + tab_spaces) >= column)
+            {
+            // Convert tab to spaces as needed and increment space difference
+            tab_spaces = column - idx;
+            memset(cstr_p, ' ', tab_spaces);
 
-//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
-// Non-Modifying Methods
-//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+            return cstr_p + tab_spaces;
+            }
 
-//---------------------------------------------------------------------------------------
-// Add - concatenate this string and another string to form a new string.
-// # Returns:  new string resulting from the concatenation of this string and 'str'
-// Arg         str - string to append
-// # Notes:    Note that the name add() is used as a convention rather than as_append()
-// # Author(s): Conan Reis
-AString AString::add(const AString & str) const
-  {
-  uint32_t length_this = m_str_ref_p->m_length;
-  uint32_t length_str  = str.m_str_ref_p->m_length;
-  uint32_t length_new  = length_this + length_str;
-  uint32_t size        = length_new + 1u;
-  char *   buffer_p    = AStringRef::alloc_buffer(size);
+          idx += tab_spaces;
+          }
+        }
 
-  ::memcpy(buffer_p, m_str_ref_p->m_cstr_p, size_t(length_this));  
-  ::memcpy(buffer_p + length_this, str.m_str_ref_p->m_cstr_p, size_t(length_str));
+      return cstr_p;
+      }
+    };
 
-  // Add null terminator by hand rather than copying it from str to ensure that it exists.
-  buffer_p[length_new] = '\0';
+  //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+  AStringRef * str_ref_p = m_str_ref_p;
+  uint32_t     length    = str_ref_p->m_length;
 
-  return AStringRef::pool_new(buffer_p, length_new, size, 0u, true, false);
-  }
+  if (length == 0u)
+    {
+    return 0u;
+    }
 
-//---------------------------------------------------------------------------------------
-// Add - concatenate this string and a C-string to form a new string.
-// # Returns:  new string resulting from the concatenation of this string and 'cstr_p'
-// Arg         cstr_p - pointer to array of characters (does not need to be null
-//             terminated unless length is equal to ALength_calculate).  'cstr_p' should
-//             never be nullptr.
-// Arg         length - number of characters to use in 'cstr_p' and used to determine a
-//             position to place a terminating null character.  The given length must not
-//             be more than the size of 'cstr_p' and 'cstr_p' should not have any null
-//             characters less then the given length.  'length' may also be set to
-//             ALength_calculate in which case the character length is calculated by
-//             finding the first terminating null character already present in 'cstr_p'.
-// # Notes:    Note that the name add() is used as a convention rather than as_append()
-// # Author(s): Conan Reis
-AString AString::add(
-  const char * cstr_p,
-  uint32_t     length // = ALength_calculate
-  ) const
-  {
-  if (length == ALength_calculate)
+  if (end_pos == ALength_remainder)
     {
-    length = uint32_t(::strlen(cstr_p));
+    end_pos = length - 1u;
     }
 
-  uint32_t length_this = m_str_ref_p->m_length;
-  uint32_t length_new  = length_this + length;
-  uint32_t size        = AStringRef::request_char_count(length_new);
-  char *   buffer_p    = AStringRef::alloc_buffer(size);
+  #ifdef A_BOUNDS_CHECK
+    bounds_check(start_pos, end_pos, "indent");
+  #endif
 
-  ::memcpy(buffer_p, m_str_ref_p->m_cstr_p, size_t(length_this));  
-  ::memcpy(buffer_p + length_this, cstr_p, size_t(length));
-  buffer_p[length_new] = '\0';  // Put in null-terminator
 
-  return AStringRef::pool_new(buffer_p, length_new, size, 0u, true, false);
-  }
+  //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+  // Determine number of lines.
+  uint   line_count   = 1u;
+  char * buffer_p     = str_ref_p->m_cstr_p;
+  char * cstr_start_p = buffer_p + start_pos;
+  char * cstr_end_p   = buffer_p + end_pos;
+  char * cstr_p       = cstr_start_p;
 
-//---------------------------------------------------------------------------------------
-//  Character concatenation:  string + ch
-// # Author(s):  Conan Reis
-AString AString::add(char ch) const
-  {
-  if (ch != '\0')
+  // Use < rather than <= to intentionally stop before last character
+  while (cstr_p < cstr_end_p)
     {
-    uint32_t length_this = m_str_ref_p->m_length;
-    uint32_t size        = AStringRef::request_char_count(length_this + 1u);
-    char *   buffer_p    = AStringRef::alloc_buffer(size);
-
-    ::memcpy(buffer_p, m_str_ref_p->m_cstr_p, size_t(length_this));  
-    buffer_p[length_this]      = ch;
-    buffer_p[length_this + 1u] = '\0';  // Put in null-terminator
+    if (*cstr_p == '\n')
+      {
+      line_count++;
+      }
 
-    return AStringRef::pool_new(buffer_p, length_this + 1u, size, 0u, true, false);
+    cstr_p++;
     }
 
-  return *this;
-  }
-
-//---------------------------------------------------------------------------------------
-//  Copies itself to reversed_p with char_count characters starting at pos in
-//              reversed order.
-// Arg          reversed_p - address to store a copy of this string with all or a portion
-//              of its characters reversed.
-// Arg          pos - character index to begin reversing characters.  (Default 0u)
-// Arg          char_count - number of characters to reverse.  If char_count is
-//              ALength_remainder, the number of characters is equal to the length of the
-//              string - pos.  (Default ALength_remainder)
-// # Examples:  AString str("12345");
-//              str.as_reverse(&str_rev);  // str_rev = "54321"
-// # See:       as_reverse(pos, char_count), reverse(), find_reverse()
-// # Author(s):  Conan Reis
-void AString::as_reverse(
-  AString * reversed_p,
-  uint32_t  pos,       // = 0u
-  uint32_t  char_count // = ALength_remainder
-  ) const
-  {
-  if (char_count == ALength_remainder)  // default
+  //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+  // Ensure enough memory for unindenting
+  // - Note that tabs are converted to spaces as they are reduced and they may add up to
+  //   more characters even after space_count characters have been removed.
+  size_t char_count;
+  char * line_p;
+  char * dest_p;
+  char * source_p     = buffer_p;
+  uint   extra_chars  = 0u;
+  uint   column       = 0u;
+  
+  if (tab_stops > space_count)
     {
-    char_count = m_str_ref_p->m_length - pos;
+    extra_chars = line_count * (tab_stops - space_count - 1);
     }
 
-  #ifdef A_BOUNDS_CHECK
-    span_check(pos, char_count, "as_reverse");
-  #endif
-
-  if (char_count > 1u)  // If less than 2 characters are reversed, there is no point
-    {
-    reversed_p->ensure_size_empty(m_str_ref_p->m_length);
-
-    char * rev_cstr_p = reversed_p->m_str_ref_p->m_cstr_p;  // Local caching
+  // $Revisit - CReis Could reuse existing buffer if it is large enough.
+  // Test to see if new buffer needed or if old one can be reused
+  //bool new_buffer_b = (str_ref_p->m_size < (length + extra_chars))
+  //  || ((str_ref_p->m_ref_count + str_ref_p->m_read_only) != 1u);
 
-    // Copy initial non-reversed portion - if any
-    if (pos)
-      {
-      ::memcpy(rev_cstr_p, m_str_ref_p->m_cstr_p, size_t(pos));
-      }
+  uint32_t new_size     = AStringRef::request_char_count(length + extra_chars);
+  char *   new_buffer_p = AStringRef::alloc_buffer(new_size);
 
+  dest_p = new_buffer_p;
+  cstr_p = cstr_start_p;
 
-    // Copy reversed portion
-    char * cstr_p         = m_str_ref_p->m_cstr_p + pos;
-    char * cstr_end_p     = cstr_p + char_count;
-    char * reversed_end_p = rev_cstr_p + pos + char_count - 1;
+  do 
+    {
+    //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+    // Find first non-space
+    column = 0u;
+    line_p = dest_p + size_t(cstr_p - source_p);
 
-    for (; cstr_p < cstr_end_p; cstr_p++, reversed_end_p--)
+    while ((cstr_p <= cstr_end_p)
+      && ((*cstr_p == ' ') || (*cstr_p == '\t')))
       {
-      *reversed_end_p = *cstr_p;
+      column += (*cstr_p == '\t') ? (tab_stops - (column % tab_stops)) : 1u;
+      cstr_p++;
       }
 
 
-    // Copy remaining non-reversed portion - if any
-    if ((pos + char_count) < m_str_ref_p->m_length)
+    //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+    // Unindent if some non-space chars before end of line
+    if ((cstr_p <= cstr_end_p) && (*cstr_p != '\r') && (*cstr_p != '\n'))
       {
-      // This copy includes the null terminator
-      ::memcpy(rev_cstr_p + pos + char_count, m_str_ref_p->m_cstr_p, size_t(m_str_ref_p->m_length - pos - char_count + 1u));
+      // Copy characters so far
+      char_count = size_t(cstr_p - source_p);
+      memcpy(dest_p, source_p, char_count);
+      source_p = cstr_p;
+
+      // Unindent
+      dest_p = Nested::set_column(
+        line_p, (column > space_count) ? column - space_count : 0u, tab_stops);
       }
-    else
+
+
+    //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+    // Skip past end of line (skip `\r` of `\r\n`) or to end of range
+    while (cstr_p <= cstr_end_p)
       {
-      rev_cstr_p[m_str_ref_p->m_length] = '\0';
-      }
+      if (*cstr_p == '\n')
+        {
+        // Skip past newline
+        cstr_p++;
+        break;
+        }
 
-    reversed_p->m_str_ref_p->m_length = m_str_ref_p->m_length;
-    }
-  else  // No reversing - just a standard copy
-    {
-    *reversed_p = *this;
+      cstr_p++;
+      }
     }
+  while (cstr_p <= cstr_end_p);
+
+  //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+  // Copy any remainder of the string
+  char_count = size_t(cstr_p - source_p);
+  memcpy(dest_p, source_p, char_count);
+  dest_p += char_count;
+
+  length = uint32_t(dest_p - new_buffer_p);
+  new_buffer_p[length] = '\0';
+  m_str_ref_p = str_ref_p->reuse_or_new(new_buffer_p, length, new_size);
+
+  return line_count;
   }
 
 //---------------------------------------------------------------------------------------
-// Determines the number of occurrences of the specified character.
-// 
-// # Returns:   number of occurrences of specified character
-// Arg          ch - character to count
-// Arg          start_pos - starting position of count search range (Default 0)
-// Arg          end_pos - ending position of count search range.  If end_pos is set to
-//              ALength_remainder, the entire length of the string (from the starting position)
-//              is searched.  (Default ALength_remainder)
-// Arg          last_counted_p - optional address to store index of last counted character.
-//              If nothing is counted then it is set to start_pos.
-// # Examples:  uint32_t underscores = str.count('_');
-// # See:       find(), get()
-// # Author(s):  Conan Reis
-uint32_t AString::count(
-  char       ch,
-  uint32_t   start_pos,     // = 0
-  uint32_t   end_pos,       // = ALength_remainder
-  uint32_t * last_counted_p // = nullptr
-  ) const
+// Substring character insertion.
+// # Returns:  a reference to itself
+// # Author(s): Conan Reis
+void AString::insert(
+  char ch,
+  uint32_t pos // = 0u
+  )
   {
-  // $Revisit - CReis [Efficiency] This should be faster than repeatedly calling memchr() - profile.
-  // It could be rewritten using inline assembly.
+  #ifdef A_BOUNDS_CHECK
+    bounds_check(pos, "insert");
+  #endif
 
-  // Ensure not empty
-  if (m_str_ref_p->m_length == 0u)
-    {
-    return 0u;
-    }
+  // $Revisit - CReis This could be optimized - the end may be copied twice
+  ensure_size(m_str_ref_p->m_length + 1u);
 
-  if (end_pos == ALength_remainder)
-    {
-    end_pos = m_str_ref_p->m_length - 1u;
-    }
+  memmove(m_str_ref_p->m_cstr_p + pos + 1u, m_str_ref_p->m_cstr_p + pos, size_t(m_str_ref_p->m_length - pos + 1u));
+  m_str_ref_p->m_cstr_p[pos] = ch;  // insert character
+  m_str_ref_p->m_length++;
+  }
 
+//---------------------------------------------------------------------------------------
+// Sub-string string insertion.
+// # Returns:  a reference to itself
+// # Author(s): Conan Reis
+void AString::insert(
+  const AString & str,
+  uint32_t        pos // = 0u
+  )
+  {
   #ifdef A_BOUNDS_CHECK
-    bounds_check(start_pos, end_pos, "count");
+    bounds_check(pos, "insert");
   #endif
 
-  uint32_t num_count    = 0u;
-  char *   cstr_start_p = m_str_ref_p->m_cstr_p;
-  char *   cstr_count_p = cstr_start_p + start_pos;
-  char *   cstr_p       = cstr_count_p;
-  char *   cstr_end_p   = cstr_start_p + end_pos;
+  // $Revisit - CReis This could be optimized - the end may be copied twice
+  ensure_size(m_str_ref_p->m_length + str.m_str_ref_p->m_length);
 
-  for (; cstr_p <= cstr_end_p; cstr_p++)
-    {
-    if (*cstr_p == ch)
-      {
-      cstr_count_p = cstr_p;
-      num_count++;
-      }
-    }
+  memmove(m_str_ref_p->m_cstr_p + pos + str.m_str_ref_p->m_length, m_str_ref_p->m_cstr_p + pos, size_t(m_str_ref_p->m_length - pos + 1u));
+  memcpy(m_str_ref_p->m_cstr_p + pos, str.m_str_ref_p->m_cstr_p, size_t(str.m_str_ref_p->m_length));
+  m_str_ref_p->m_length += str.m_str_ref_p->m_length;
+  }
 
-  if (last_counted_p)
-    {
-    *last_counted_p = uint32_t(reinterpret_cast<uintptr_t>(cstr_count_p) - reinterpret_cast<uintptr_t>(cstr_start_p));
-    }
+//---------------------------------------------------------------------------------------
+// Converts line breaks from to Unix style (\n) to DOS style (\r\n).
+//             This method will also work if the string is already in DOS style.
+// # Returns:  Returns the number of line breaks that were converted.
+// # See:      line_*() functions
+// # Author(s): Conan Reis
+uint AString::line_break_unix2dos(
+  uint start_pos,  // = 0u
+  uint end_pos     // = ALength_remainder
+  )
+  {
+  uint pre_remove = m_str_ref_p->m_length;
 
-  return num_count;
+  remove_all('\r', start_pos, end_pos);
+
+  end_pos = (end_pos == ALength_remainder)
+    ? m_str_ref_p->m_length - 1u
+    : end_pos - (pre_remove - m_str_ref_p->m_length);
+
+  return replace_all('\n', ms_dos_break, start_pos, end_pos);
   }
 
 //---------------------------------------------------------------------------------------
-//  Determines the number of occurrences of the specified character.
-// # Returns:   number of occurrences of specified character
-// Arg          match_type - classification of characters to match.
-// Arg          start_pos - starting position of count search range (Default 0)
-// Arg          end_pos - ending position of count search range.  If end_pos is set to
-//              ALength_remainder, the entire length of the string (from the starting position)
-//              is searched.  (Default ALength_remainder)
-// # Examples:  uint32_t digits = str.count(ACharMatch_digit);
-// # See:       find(match_type), get(match_type), not_char_type()
-// # Author(s):  Conan Reis
-uint32_t AString::count(
-  eACharMatch match_type,
-  uint32_t    start_pos, // = 0
-  uint32_t    end_pos    // = ALength_remainder
-  ) const
+// Substring search and removal. Finds Nth instance string str starting from start_pos
+// and stores the index position if found in find_pos. Returns true if found false if not.
+// # Author(s): Conan Reis
+bool AString::remove(
+  const AString & str,
+  uint32_t        instance,    // = 1u
+  uint32_t *      find_pos_p,  // = nullptr
+  uint32_t        start_pos,   // = 0u
+  uint32_t        end_pos,     // = ALength_remainder
+  eAStrCase       case_check   // = AStrCase_sensitive
+  )
   {
-  // $Revisit - CReis [Efficiency] This should be faster than repeatedly calling memchr() - profile.
-  // It could be rewritten using inline assembly.
-
-  uint32_t num_count= 0u;
+  uint32_t pos;
 
-  if (m_str_ref_p->m_length)  // if not empty
+  if (find(str, instance, &pos, start_pos, end_pos, case_check))
     {
-    if (end_pos == ALength_remainder)
+    // $Revisit - CReis This could be optimized - the end may be copied twice
+    ensure_writable();
+
+    m_str_ref_p->m_length -= str.m_str_ref_p->m_length;  // length of new string
+    memmove(m_str_ref_p->m_cstr_p + pos, m_str_ref_p->m_cstr_p + pos + str.m_str_ref_p->m_length, size_t(m_str_ref_p->m_length - pos + 1u));
+
+    if (find_pos_p)
       {
-      end_pos = m_str_ref_p->m_length - 1u;
+      *find_pos_p = pos;
       }
+      
+    return true;
+    }
+    
+  return false;
+  }
 
-    #ifdef A_BOUNDS_CHECK
-      bounds_check(start_pos, end_pos, "count");
-    #endif
+//---------------------------------------------------------------------------------------
+// Quick substring search and removal using the Boyer Moore algorithm.   
+//             Good for multiple searches for the same substring.  Finds Nth instance  
+//             of bm starting from start_pos and stores the index position if  
+//             found in find_pos. Returns true if found false if not.
+// # Author(s): Conan Reis
+bool AString::remove(
+  const AStringBM & bm,
+  uint32_t          instance,    // = 1u
+  uint32_t *        find_pos_p,  // = nullptr
+  uint32_t          start_pos,   // = 0u
+  uint32_t          end_pos      // = ALength_remainder
+  )
+  {
+  uint32_t pos;
 
-    uint8_t * cstr_p        = reinterpret_cast<uint8_t *>(m_str_ref_p->m_cstr_p + start_pos);
-    uint8_t * cstr_end_p    = reinterpret_cast<uint8_t *>(m_str_ref_p->m_cstr_p + end_pos);
-    bool *    match_table_p = ms_char_match_table[match_type];
+  if (find(bm, instance, &pos, start_pos, end_pos))
+    {
+    // $Revisit - CReis This could be optimized - the end may be copied twice
+    ensure_writable();
 
-    for (; cstr_p <= cstr_end_p; cstr_p++)
+    m_str_ref_p->m_length -= bm.get_length();           // length of new string
+    memmove(m_str_ref_p->m_cstr_p + pos, m_str_ref_p->m_cstr_p + pos + bm.get_length(), size_t(m_str_ref_p->m_length - pos + 1u));
+
+    if (find_pos_p)
       {
-      if (match_table_p[*cstr_p])
-        {
-        num_count++;
-        }
+      *find_pos_p = pos;
       }
+
+    return true;
     }
-  return num_count;
+
+  return false;
   }
 
 //---------------------------------------------------------------------------------------
-//  Returns number of substrings found
-// # Author(s):  Conan Reis
-uint32_t AString::count(
-  const AStringBM & bm,
-  uint32_t          start_pos,  // = 0u
-  uint32_t          end_pos     // = ALength_remainder
-  ) const
+// Substring deletion method
+// # Returns:  a reference to itself
+// # Author(s): Conan Reis
+void AString::remove_all(
+  uint32_t pos,
+  uint32_t char_count // = ALength_remainder
+  )
   {
-  uint32_t result = 0u;
-  uint32_t length = bm.m_str_ref_p->m_length;
-
-  while (find(bm, 1u, &start_pos, start_pos, end_pos) == true)
+  if (char_count == ALength_remainder)
     {
-    result++;
-    start_pos += length;  // non-overlapping
+    char_count = m_str_ref_p->m_length - pos;
     }
 
-  return result;
+  if (char_count)
+    {
+
+    #ifdef A_BOUNDS_CHECK
+      span_check(pos, char_count, "remove_all");
+    #endif
+
+    // $Revisit - CReis This could be optimized - the end may be copied twice
+    ensure_writable();
+
+    m_str_ref_p->m_length -= char_count;           // length of new string
+    memmove(m_str_ref_p->m_cstr_p + pos, m_str_ref_p->m_cstr_p + pos + char_count, size_t(m_str_ref_p->m_length - pos + 1u));
+    }
   }
 
 //---------------------------------------------------------------------------------------
-//  Finds instance of specified character starting from start_pos and ending
-//              at end_pos and if found stores the index position found.
-// # Returns:   true if instance character found, false if not
-// Arg          ch - character to find
-// Arg          instance - occurrence of character to find.  It may not be less than 1.
-//              (Default 1)
-// Arg          find_pos_p - address to store index of instance character if found.
-//              It is not modified if the character is not found or if it is set to nullptr.
-//              (Default nullptr)
-// Arg          start_pos - starting position of search range (Default 0)
-// Arg          end_pos - ending position of search range.  If end_pos is set to
-//              ALength_remainder, the entire length of the string (from the starting position)
-//              is searched (end_pos = length - start_pos).  (Default ALength_remainder)
-// # Examples:  if (str.find('_', 2))  // if 2nd underscore is found
-//                do_something();
-// # See:       count(), get()
-// # Notes:     This character find method is faster than the find method searching for a
-//              single character string.
-// # Author(s):  Conan Reis
-bool AString::find(
-  char   ch,
-  uint32_t   instance,   // = 1
-  uint32_t * find_pos_p, // = nullptr
-  uint32_t   start_pos,  // = 0
-  uint32_t   end_pos     // = ALength_remainder
-  ) const
+// Remove all characters of matching ch from start_pos to end_pos.
+// # Returns:  Returns the number of characters that were removed.
+// Arg         ch - character to match
+// Arg         start_pos - first position to start removing  (Default 0)
+// Arg         end_pos - last position to look for characters to remove.
+//             If end_pos is ALength_remainder, end_pos is set to the last index position of
+//             the string (length - 1).
+//             (Default ALength_remainder)
+// # Examples: AString str("  the quick brown fox  ");
+// 
+//             str.remove_all('o');  // str is now "  the quick brwn fx  "
+// # See:      trim(), truncate(), remove_all(match_type), remove_all(str),
+//             find(match_type)
+// # Author(s): Conan Reis
+uint AString::remove_all(
+  char ch,
+  uint32_t start_pos, // = 0u
+  uint32_t end_pos    // = ALength_remainder
+  )
   {
-  // $Revisit - CReis [Efficiency] This should be faster than repeatedly calling memchr() - profile.
-  // It could be rewritten using inline assembly.
+  uint remove_count = 0u;
 
-  if (m_str_ref_p->m_length)  // if not empty
+  if (m_str_ref_p->m_length)
     {
     if (end_pos == ALength_remainder)
       {
-      end_pos = m_str_ref_p->m_length - 1u;
+      end_pos = m_str_ref_p->m_length - 1;
       }
 
     #ifdef A_BOUNDS_CHECK
-      bounds_check(start_pos, end_pos, instance, "find");
+      bounds_check(start_pos, end_pos, "remove_all");
     #endif
 
-    char * cstr_p     = m_str_ref_p->m_cstr_p + start_pos;
-    char * cstr_end_p = m_str_ref_p->m_cstr_p + end_pos;
+    // $Revisit - CReis This could be optimized - some characters may be needlessly copied
+    ensure_writable();
 
-    while (cstr_p <= cstr_end_p)
+    uint8_t * cstr_p     = reinterpret_cast<uint8_t *>(m_str_ref_p->m_cstr_p + start_pos);
+    uint8_t * rewrite_p  = cstr_p;
+    uint8_t * cstr_end_p = reinterpret_cast<uint8_t *>(m_str_ref_p->m_cstr_p + end_pos);
+    uint32_t  length     = m_str_ref_p->m_length;
+
+    for (; cstr_p <= cstr_end_p; cstr_p++)
       {
-      if (*cstr_p == ch)     // Found one
+      if (*cstr_p != ch)
         {
-        if (instance == 1u)  // Found it!
-          {
-          if (find_pos_p)
-            {
-            *find_pos_p = uint32_t(cstr_p - m_str_ref_p->m_cstr_p);
-            }
-
-          return true;
-          }
-
-        instance--;
+        // $Revisit - CReis assuming that a check to see if rewrite_p == cstr_p would just slow things down
+        *rewrite_p = *cstr_p;
+        rewrite_p++;
+        }
+      else
+        {
+        length--;
         }
-
-      cstr_p++;
       }
+
+    *rewrite_p            = '\0';
+    remove_count          = m_str_ref_p->m_length - length;
+    m_str_ref_p->m_length = length;
     }
 
-  return false;
+  return remove_count;
   }
 
 //---------------------------------------------------------------------------------------
-//  Finds instance of specified type of character starting from start_pos and
-//              ending at end_pos and if found stores the index position found.
-// # Returns:   true if instance character type found, false if not
-// Arg          match_type - classification of characters to match.
-// Arg          instance - occurrence of character type to find.  It may not be less than 1.
-//              (Default 1)
-// Arg          find_pos_p - address to store index of instance character type if found.
-//              It is not modified if the character type is not found or if it is set to nullptr.
-//              (Default nullptr)
-// Arg          start_pos - starting position of search range (Default 0)
-// Arg          end_pos - ending position of search range.  If end_pos is set to
-//              ALength_remainder, the entire length of the string (from the starting position)
-//              is searched (end_pos = length - start_pos).  (Default ALength_remainder)
-// # Examples:  if (str.find(ACharMatch_lowercase, 2))  // if 2nd lowercase letter is found
-//                do_something();
-// # See:       count(), get(), not_char_type()
-// # Author(s):  Conan Reis
-bool AString::find(
+// Remove all characters of match_type from start_pos to end_pos.
+// # Returns:  Returns the number of characters that were removed.
+// Arg         match_type - classification of characters to match
+// Arg         start_pos - first position to start removing  (Default 0)
+// Arg         end_pos - last position to look for characters to remove.
+//             If end_pos is ALength_remainder, end_pos is set to the last index position of
+//             the string (length - 1).
+//             (Default ALength_remainder)
+// # Examples: AString str("  the quick brown fox  ");
+// 
+//             str.remove_all(ACharMatch_white_space);  // str is now "thequickbrownfox"
+// # See:      trim(), truncate(), remove_all(str), remove_all(ch), find(match_type),
+//             not_char_type()
+// # Author(s): Conan Reis
+uint AString::remove_all(
   eACharMatch match_type,
-  uint32_t    instance,   // = 1
-  uint32_t *  find_pos_p, // = nullptr
-  uint32_t    start_pos,  // = 0
-  uint32_t    end_pos     // = ALength_remainder
-  ) const
+  uint32_t    start_pos, // = 0u
+  uint32_t    end_pos    // = ALength_remainder
+  )
   {
-  uint32_t length = m_str_ref_p->m_length;
+  uint remove_count = 0u;
 
-  if (length && (start_pos < length))  // if not empty or skipped
+  if (m_str_ref_p->m_length)
     {
     if (end_pos == ALength_remainder)
       {
-      end_pos = length - 1u;
+      end_pos = m_str_ref_p->m_length - 1;
       }
 
     #ifdef A_BOUNDS_CHECK
-      bounds_check(start_pos, end_pos, instance, "find");
+      bounds_check(start_pos, end_pos, "remove_all");
     #endif
 
+    // $Revisit - CReis This could be optimized - some characters may be needlessly copied
+    ensure_writable();
+
     uint8_t * cstr_p        = reinterpret_cast<uint8_t *>(m_str_ref_p->m_cstr_p + start_pos);
+    uint8_t * rewrite_p     = cstr_p;
     uint8_t * cstr_end_p    = reinterpret_cast<uint8_t *>(m_str_ref_p->m_cstr_p + end_pos);
-    bool *    match_table_p = ms_char_match_table[match_type];
+    bool *    match_table_p = ms_char_match_table[not_char_type(match_type)];
+    uint32_t  length        = m_str_ref_p->m_length;
 
-    while (cstr_p <= cstr_end_p)
+    for (; cstr_p <= cstr_end_p; cstr_p++)
       {
-      if (match_table_p[*cstr_p])  // Found one
+      if (match_table_p[*cstr_p])
         {
-        if (instance == 1u)        // Found it!
-          {
-          if (find_pos_p)
-            {
-            *find_pos_p = uint32_t(cstr_p - reinterpret_cast<uint8_t *>(m_str_ref_p->m_cstr_p));
-            }
-
-          return true;
-          }
-
-        instance--;
+        *rewrite_p = *cstr_p;
+        rewrite_p++;
+        }
+      else
+        {
+        length--;
         }
-
-      cstr_p++;
       }
+
+    *rewrite_p            = '\0';
+    remove_count          = m_str_ref_p->m_length - length;
+    m_str_ref_p->m_length = length;
     }
 
-  return false;
+  return remove_count;
   }
 
 //---------------------------------------------------------------------------------------
-//  Finds instance of substring str starting from start_pos and ending
-//              at end_pos and if found stores the index position found.
-// # Returns:   true if instance of str found, false if not
-// Arg          str - substring to find
-// Arg          args_p - find info - see AFindStrArgs declaration.
-//              (Default &AFindStrArgs::ms_sensitive)
-// # Examples:  AString sub_str("hello");
-//              if (str.find(sub_str, &AFindStrArgs(2)))  // if 2nd "hello" substring is found
-//                do_something();
-// # See:       find(bm), count(), get()
-// # Notes:     [Efficiency] This method should be faster than calling strstr() - profile.
-//              The case insensitive routine could probably be made more efficient - via
-//              a lowercase table and/or only converting the characters once in temporary
-//              C-String buffers.
-// # Author(s):  Conan Reis
-/*
-bool AString::find2(
+// Remove all substrings matching str starting from start_pos to end_pos.
+// # Returns:  Returns the number of characters that were removed.
+// Arg         str - substring to match
+// Arg         start_pos - first position to start removing.
+// Arg         end_pos - last position to look for substring to remove.
+//             If end_pos is ALength_remainder, end_pos is set to the last index position
+//             of the string (length - 1).
+// Arg         case_check - indicates whether case should be AStrCase_sensitive or
+//             AStrCase_insensitive
+// # Author(s): Conan Reis
+uint32_t AString::remove_all(
   const AString & str,
-  AFindStrArgs *  args_p // = &AFindStrArgs::ms_sensitive
-  ) const
+  uint32_t        start_pos,  // = 0u
+  uint32_t        end_pos,    // = ALength_remainder
+  eAStrCase       case_check  // = AStrCase_sensitive
+  )
   {
-  if (m_str_ref_p->m_length && (m_str_ref_p->m_length >= str.m_str_ref_p->m_length))  // if not empty and str is no larger than this string
-    {
-    uint32_t end_pos  = args_p->m_end_pos;
-    uint32_t instance = args_p->m_instance;
+  // $Revisit - CReis This could be optimized - some characters may be needlessly copied
+  // [Efficiency] Instead of moving from (end of the remove position) - (end of string)
+  // to (beginning of the delete position) for each remove, the move could be from (end
+  // of the remove position) - (beginning of next remove or end of string, whichever is
+  // nearer) to (end of last move or start of string, whichever is later).
+
+  uint32_t   removed    = 0u;
+  uint32_t   str_length = str.m_str_ref_p->m_length;
+  uint32_t & length     = m_str_ref_p->m_length;  // Faster, but length must be up-to-date in find()
 
+  if (str_length && length)
+    {
+    ensure_writable();
+  
+    char * cstr_p = m_str_ref_p->m_cstr_p;
+  
     if (end_pos == ALength_remainder)
       {
-      end_pos = m_str_ref_p->m_length - 1;
+      end_pos = length - 1u;
       }
-
-    #ifdef A_BOUNDS_CHECK
-      bounds_check(args_p->m_start_pos, end_pos, instance, "find");
-    #endif
-
-    char * match_p;
-    char * find_p;
-    char * cstr_p       = m_str_ref_p->m_cstr_p + args_p->m_start_pos;
-    char * cstr_end_p   = m_str_ref_p->m_cstr_p + end_pos - str.m_str_ref_p->m_length - 1;  // won't match if less than str left
-    char * find_start_p = str.m_str_ref_p->m_cstr_p;
-    char * find_end_p   = find_start_p + str.m_str_ref_p->m_length;
-
-    if (args_p->m_case_check == AStrCase_sensitive)  // Case sensitive
+  
+    while (find(str, 1u, &start_pos, start_pos, end_pos, case_check))
       {
-      while (cstr_p <= cstr_end_p)
-        {
-        match_p = cstr_p;
-        find_p  = find_start_p;
+      end_pos -= str_length;
+      length  -= str_length;  // length of new string
+      memmove(cstr_p + start_pos, cstr_p + start_pos + str_length, size_t(length - start_pos + 1u));
+      removed++;
+      }
+    }
 
-        while ((find_p < find_end_p) && (*match_p == *find_p))
-          {
-          find_p++;
-          match_p++;
-          }
+  return removed;
+  }
 
-        if (find_p == find_end_p)  // Found one
-          {
-          if (instance == 1u)      // Found it!
-            {
-            args_p->m_find_start = uint32_t(cstr_p - m_str_ref_p->m_cstr_p);
-            args_p->m_find_end   = args_p->m_find_start + str.m_str_ref_p->m_length;
-            return true;
-            }
+//---------------------------------------------------------------------------------------
+// Remove all substrings matching fast finding Boyer-Moore str starting from
+//             start_pos to end_pos.
+// # Returns:  Returns the number of characters that were removed.
+// Arg         str - Boyer-Moore substring to match
+// Arg         start_pos - first position to start removing.
+// Arg         end_pos - last position to look for substring to remove.
+//             If end_pos is ALength_remainder, end_pos is set to the last index position
+//             of the string (length - 1).
+// Arg         case_check - indicates whether case should be AStrCase_sensitive or
+//             AStrCase_insensitive
+// # Author(s):  Conan Reis
+uint32_t AString::remove_all(
+  const AStringBM & bm,
+  uint32_t          start_pos,  // = 0u
+  uint32_t          end_pos     // = ALength_remainder
+  )
+  {
+  // $Revisit - CReis This could be optimized - some characters may be needlessly copied
+  // [Efficiency] Instead of moving from (end of the remove position) - (end of string)
+  // to (beginning of the delete position) for each remove, the move could be from (end
+  // of the remove position) - (beginning of next remove or end of string, whichever is
+  // nearer) to (end of last move or start of string, whichever is later).
 
-          instance--;
-          cstr_p = match_p;
-          }
-        else
-          {
-          cstr_p++;
-          }
-        }
+  uint32_t   removed    = 0u;
+  uint32_t   str_length = bm.m_str_ref_p->m_length;
+  uint32_t & length     = m_str_ref_p->m_length;  // Faster, but length must be up-to-date in find()
+  
+  if (str_length && length)
+    {
+    ensure_writable();
+    
+    char * cstr_p = m_str_ref_p->m_cstr_p;
+  
+    if (end_pos == ALength_remainder)
+      {
+      end_pos = length - 1u;
       }
-    else  // Ignore case
+  
+    while (find(bm, 1u, &start_pos, start_pos, end_pos))
       {
-      while (cstr_p <= cstr_end_p)
-        {
-        match_p = cstr_p;
-        find_p  = find_start_p;
+      end_pos -= str_length;
+      length  -= str_length;  // length of new string
+      memmove(cstr_p + start_pos, cstr_p + start_pos + str_length, size_t(length - start_pos + 1u));
+      removed++;
+      }
+    }
+    
+  return removed;
+  }
 
-        while ((find_p < find_end_p) && !compare_insensitive(*match_p, *find_p))
-          {
-          find_p++;
-          match_p++;
-          }
+//---------------------------------------------------------------------------------------
+//  Removes specified number of characters from the end of the string.
+// Arg          char_count - number of characters to remove from the end of the string.
+// # See:       set_length(), crop(), get_length(), remove(), trim(), truncate()
+// # Author(s):  Conan Reis
+void AString::remove_end(uint32_t char_count)
+  {
+  #ifdef A_BOUNDS_CHECK
+    A_VERIFY(char_count <= m_str_ref_p->m_length, a_cstr_format("- tried to remove %u characters out of %u", char_count, m_str_ref_p->m_length), AErrId_invalid_index_span, AString);
+  #endif
 
-        if (find_p == find_end_p)  // Found one
-          {
-          if (instance == 1u)      // Found it!
-            {
-            args_p->m_find_start = uint32_t(cstr_p - m_str_ref_p->m_cstr_p);
-            args_p->m_find_end   = args_p->m_find_start + str.m_str_ref_p->m_length;
-            return true;
-            }
+  set_length(m_str_ref_p->m_length - char_count);
+  }
 
-          instance--;
-          cstr_p = match_p;
-          }
-        else
-          {
-          cstr_p++;
-          }
-        }
-      }
+//---------------------------------------------------------------------------------------
+// Replaces chars in string starting at pos with new_char_count chars from
+//             new_str at new_pos.  If the pos + new_char_count is greater than the
+//             current length of the string, it will extend its length.
+// # Returns:  a reference to itself
+// Arg         new_str - string to replace with
+// Arg         pos - position in this string to begin replace
+// Arg         char_count - number of chars to replace in this string.  If it is set to
+//             ALength_remainder, it is set to length of this string - pos.  To do an
+//             "overwrite" use new_str.get_length().  If this value is 0, it is the same
+//             as an "insert".
+// Arg         new_pos - position to start copying from new_str
+// Arg         new_char_count - number of chars to copy from new_str into this string.
+//             If it is set to ALength_remainder, it is set to length of new - new_pos.
+// # Author(s): Conan Reis
+void AString::replace(
+  const AString & new_str,
+  uint32_t        pos,            // = 0
+  uint32_t        char_count,     // = ALength_remainder
+  uint32_t        new_pos,        // = 0
+  uint32_t        new_char_count // = ALength_remainder
+  )
+  {
+  if (new_char_count == ALength_remainder)
+    {
+    new_char_count = new_str.m_str_ref_p->m_length - new_pos;
     }
 
-  return false;
-  }      
-*/
+  #ifdef A_BOUNDS_CHECK
+    new_str.span_check(new_pos, new_char_count, "replace");
+  #endif
+
+  if (new_char_count)
+    {
+    uint32_t rem_length = m_str_ref_p->m_length - pos;
+
+    char_count = (char_count == ALength_remainder)
+      ? rem_length
+      : a_min(char_count, rem_length);  // Only remove the characters available
+
+    #ifdef A_BOUNDS_CHECK
+      span_check(pos, char_count, "replace");
+    #endif
+
+    uint32_t     new_length = m_str_ref_p->m_length - char_count + new_char_count;
+    AStringRef * str_ref_p  = m_str_ref_p;
+
+    // $Revisit - CReis This could be optimized - the end may be copied twice
+    ensure_size(new_length);
+
+    // Move remaining characters following old_str up or down
+    if (pos + new_char_count <= new_length)
+      {
+      memmove(m_str_ref_p->m_cstr_p + pos + new_char_count, str_ref_p->m_cstr_p + pos + char_count, str_ref_p->m_length - pos - char_count + 1u);
+      }
+
+    // Copy new_str to its replacement position in the current string
+    memcpy(m_str_ref_p->m_cstr_p + pos, new_str.m_str_ref_p->m_cstr_p + new_pos, new_char_count);
+    m_str_ref_p->m_length = new_length;
+    }
+  }
 
 //---------------------------------------------------------------------------------------
-//  Finds instance of substring str starting from start_pos and ending
-//              at end_pos and if found stores the index position found.
-// # Returns:   true if instance of str found, false if not
-// Arg          str - substring to find
-// Arg          instance - occurrence of substring to find.  It may not be less than 1.
-//              (Default 1)
-// Arg          find_pos_p - address to store index of instance substring if found.
-//              It is not modified if the substring is not found or if it is set to nullptr.
-//              (Default nullptr)
-// Arg          start_pos - starting character index of search range (Default 0)
-// Arg          end_pos - ending character index of search range.  If end_pos is set to
-//              ALength_remainder, the entire length of the string (from the starting position)
-//              is searched (end_pos = length - start_pos).  (Default ALength_remainder)
-// Arg          case_check - if set to AStrCase_sensitive, case is important (q != Q), if set
-//              to AStrCase_ignore, case is not important (q == Q).  (Default AStrCase_sensitive)
-// # Examples:  AString sub_str("hello");
-//              if (str.find(sub_str, 2))  // if 2nd "hello" substring is found
-//                do_something();
-// # See:       find(bm), count(), get()
-// # Notes:     [Efficiency] This method should be faster than calling strstr() - profile.
-//              The case insensitive routine could probably be made more efficient - via
-//              a lowercase table and/or only converting the characters once in temporary
-//              C-String buffers.
+//  Substring search and replacement
 // # Author(s):  Conan Reis
-bool AString::find(
-  const AString & str,
-  uint32_t        instance,    // = 1
+bool AString::replace(
+  const AString & old_str,
+  const AString & new_str,
+  uint32_t        instance,    // = 1u
   uint32_t *      find_pos_p,  // = nullptr
-  uint32_t        start_pos,   // = 0
+  uint32_t        start_pos,   // = 0u
   uint32_t        end_pos,     // = ALength_remainder
   eAStrCase       case_check   // = AStrCase_sensitive
-  ) const
+  )
   {
-  if (m_str_ref_p->m_length && (m_str_ref_p->m_length >= str.m_str_ref_p->m_length))  // if not empty and str is no larger than this string
+  uint32_t pos;
+
+  if (find(old_str, instance, &pos, start_pos, end_pos, case_check))
     {
-    if (end_pos == ALength_remainder)
+    uint32_t     old_length = old_str.m_str_ref_p->m_length;
+    uint32_t     new_length = new_str.m_str_ref_p->m_length;
+    uint32_t     length     = m_str_ref_p->m_length - old_length + new_length;
+    AStringRef * str_ref_p  = m_str_ref_p;
+
+    // $Revisit - CReis This could be optimized - the end may be copied twice
+    ensure_size(length);
+
+    // Move remaining characters following old_str up or down
+    if (pos + new_length < length)
       {
-      end_pos = m_str_ref_p->m_length - 1;
+      memmove(m_str_ref_p->m_cstr_p + pos + new_length, str_ref_p->m_cstr_p + pos + old_length, str_ref_p->m_length - pos - old_length + 1u);
       }
 
-    #ifdef A_BOUNDS_CHECK
-      bounds_check(start_pos, end_pos, instance, "find");
-    #endif
-
-    char * match_p;
-    char * find_p;
-    char * cstr_p       = m_str_ref_p->m_cstr_p + start_pos;
-    char * cstr_end_p   = m_str_ref_p->m_cstr_p + end_pos - str.m_str_ref_p->m_length + 1u;  // won't match if less than str left
-    char * find_start_p = str.m_str_ref_p->m_cstr_p;
-    char * find_end_p   = find_start_p + str.m_str_ref_p->m_length;
+    // Copy new_str to its replacement position in the current string
+    memcpy(m_str_ref_p->m_cstr_p + pos, new_str.m_str_ref_p->m_cstr_p, new_length);
+    m_str_ref_p->m_length = m_str_ref_p->m_length - old_length + new_length;
 
-    if (case_check == AStrCase_sensitive)  // Case sensitive
+    if (find_pos_p)
       {
-      while (cstr_p <= cstr_end_p)
-        {
-        match_p = cstr_p;
-        find_p  = find_start_p;
-
-        while ((*match_p == *find_p) && (find_p < find_end_p))    //  Note: Okay to check end condition (find_p < find_end_p) second because if >= it will point to null terminator i.e. still valid memory in first part of condition.
-          {
-          find_p++;
-          match_p++;
-          }
+      *find_pos_p = pos;
+      }
 
-        if (find_p == find_end_p)  // Found one
-          {
-          if (instance == 1u)      // Found it!
-            {
-            if (find_pos_p)
-              {
-              *find_pos_p = uint32_t(cstr_p - m_str_ref_p->m_cstr_p);
-              }
+    return true;
+    }
 
-            return true;
-            }
+  return false;
+  }
 
-          instance--;
-          cstr_p = match_p;
-          }
-        else
-          {
-          cstr_p++;
-          }
-        }
-      }
-    else  // Ignore case
-      {
-      while (cstr_p <= cstr_end_p)
-        {
-        match_p = cstr_p;
-        find_p  = find_start_p;
+//---------------------------------------------------------------------------------------
+//  Substring search and replacement
+// # Author(s):  Conan Reis
+bool AString::replace(
+  const AStringBM & bm,
+  const AString &   new_str,
+  uint32_t          instance,    // = 1u
+  uint32_t *        find_pos_p,  // = nullptr
+  uint32_t          start_pos,   // = 0u
+  uint32_t          end_pos      // = ALength_remainder
+  )
+  {
+  uint32_t pos;
 
-        while (!compare_insensitive(*match_p, *find_p) && (find_p < find_end_p))  //  Note: Okay to check end condition (find_p < find_end_p) second because if >= it will point to null terminator i.e. still valid memory in first part of condition.
-          {
-          find_p++;
-          match_p++;
-          }
+  if (find(bm, instance, &pos, start_pos, end_pos))
+    {
+    uint32_t old_length = bm.m_str_ref_p->m_length;
+    uint32_t new_length = new_str.m_str_ref_p->m_length;
+    uint32_t length     = m_str_ref_p->m_length - old_length + new_length;
 
-        if (find_p == find_end_p)  // Found one
-          {
-          if (instance == 1u)      // Found it!
-            {
-            if (find_pos_p)
-              {
-              *find_pos_p = uint32_t(cstr_p - m_str_ref_p->m_cstr_p);
-              }
+    // $Revisit - CReis This could be optimized - the end may be copied twice
+    ensure_size(length);
 
-            return true;
-            }
+    // Move remaining characters following bm up or down
+    memmove(m_str_ref_p->m_cstr_p + pos + new_length, m_str_ref_p->m_cstr_p + pos + old_length, m_str_ref_p->m_length - pos - old_length + 1u);
 
-          instance--;
-          cstr_p = match_p;
-          }
-        else
-          {
-          cstr_p++;
-          }
-        }
+    // Copy new_str to its replacement position in the current string
+    memcpy(m_str_ref_p->m_cstr_p + pos, new_str.m_str_ref_p->m_cstr_p, new_length);
+    m_str_ref_p->m_length = length;
+
+    if (find_pos_p)
+      {
+      *find_pos_p = pos;
       }
+
+    return true;
     }
 
   return false;
-  }      
+  }
 
 //---------------------------------------------------------------------------------------
-//  Quick substring search using the Boyer Moore algorithm.  Good for
-//              multiple searches for the same substring.  Finds instance of substring
-//              bm starting from start_pos and ending
-//              at end_pos and if found stores the index position found.
-// # Returns:   true if instance of bm found, false if not
-// Arg          bm - Boyer Moore substring to find
-// Arg          instance - occurrence of substring to find.  It may not be less than 1.
-//              (Default 1)
-// Arg          find_pos_p - address to store index of instance substring if found.
-//              It is not modified if the substring is not found or if it is set to nullptr.
-//              (Default nullptr)
-// Arg          start_pos - starting character index of search range (Default 0)
-// Arg          end_pos - ending character index of search range.  If end_pos is set to
-//              ALength_remainder, the entire length of the string (from the starting position)
-//              is searched (end_pos = length - start_pos).  (Default ALength_remainder)
-// Arg          case_check - if set to AStrCase_sensitive, case is important (q != Q), if set
-//              to AStrCase_ignore, case is not important (q == Q).  (Default AStrCase_sensitive)
-// # Examples:  AStringBM sub_str("hello");
-//              if (str.find(sub_str, 2))  // if 2nd "hello" substring is found
-//                do_something();
-// # See:       find(bm), count(), get()
-// # Notes:     [Efficiency]  The case insensitive routine could probably be made more
-//              efficient - via a lowercase table and/or only converting the characters
-//              once in temporary C-String buffers.
+//  Replace all old_ch with new_ch starting at start_pos and ending at end_pos.
+// # Returns:   Number of characters replaced.
 // # Author(s):  Conan Reis
-bool AString::find(
-  const AStringBM & bm,
-  uint32_t          instance,   // = 1
-  uint32_t *        find_pos_p, // = nullptr
-  uint32_t          start_pos,  // = 0
-  uint32_t          end_pos     // = ALength_remainder
-  ) const
+uint AString::replace_all(
+  char old_ch,
+  char new_ch,
+  uint start_pos,  // = 0u
+  uint end_pos     // = ALength_remainder
+  )
   {
-
-  // $Revisit - CReis Rewrite using pointers rather than indexes
-
-  if (m_str_ref_p->m_length)  // if not empty
+  uint  count  = 0u;
+  uint32_t length = m_str_ref_p->m_length;
+  
+  if (length)  // if not empty
     {
     if (end_pos == ALength_remainder)
       {
-      end_pos = m_str_ref_p->m_length - 1;
+      end_pos = length - 1;
       }
 
     #ifdef A_BOUNDS_CHECK
-      bounds_check(start_pos, end_pos, instance, "find");
+      bounds_check(start_pos, end_pos, "replace_all");
     #endif
 
-    char            insensitive_ch;
-    uint32_t        bm_pos;                                // bm_pos is an index into pattern
-    uint32_t        patlen     = bm.get_length();          // store pattern length locally (high use)
-    uint32_t        target_pos = start_pos + patlen - 1u;  // target_pos is the index into the target_p
-    const char *    cstr_p     = m_str_ref_p->m_cstr_p;    // store cstr locally (high use)
-    const char *    bm_cstr_p  = bm.m_str_ref_p->m_cstr_p; // store bm cstr locally (high use)
-    const uint8_t * delta_p    = bm.m_delta_p;             // store delta table locally (high use)
-  
-    if (bm.m_case == AStrCase_ignore)            // same, but to_lowercase used
+    ensure_writable();
+
+    char * cstr_p     = m_str_ref_p->m_cstr_p;
+    char * cstr_end_p = cstr_p + length;
+
+    while (cstr_p < cstr_end_p)
       {
-      while (target_pos <= end_pos)
+      if (*cstr_p == old_ch)
         {
-        bm_pos         = patlen - 1u;
-        insensitive_ch = to_lowercase(cstr_p[target_pos]);
+        *cstr_p = new_ch;
+        count++;
+        }
 
-        while (bm_cstr_p[bm_pos] == insensitive_ch)  // while corresponding chars match
-          {
-          if (bm_pos > 0u)                // Still characters to check                         
-            {                             // move left one character for next comparison
-            --bm_pos;                     
-            --target_pos;                 
-            }                             
-          else                            // pattern found!
-            {
-            if (instance == 1u)           // correct number of occurrences found!
-              {                           
-              if (find_pos_p)               
-                {
-                *find_pos_p = target_pos;   
-                }
+      cstr_p++;
+      }
+    }
 
-              return true;              
-              }                           
-            else                          // one less instance to find
-              {
-              instance--;
-              }
+  return count;
+  }
 
-            break;                        // Ugly, I know - could be [bm_pos = bm.get_length]
-            }
+//---------------------------------------------------------------------------------------
+//  Replace all old_ch with new_str starting at start_pos and ending at end_pos.
+// # Returns:   Number of characters replaced.
+// Efficiency   See remove_all() efficiency comment for replacements where new_str is
+//              shorter than old_str.  It may also be more efficient to apply the same
+//              method for the reverse - just determine offset or tally the results.
+// Stability    Assumes that new_str is > 1 character in length
+uint32_t AString::replace_all(
+  char            old_ch,
+  const AString & new_str,
+  uint32_t        start_pos,  // = 0u
+  uint32_t        end_pos     // = ALength_remainder
+  )
+  {
+  uint32_t pos;
+  uint32_t found = 0u;
+  
+  if (m_str_ref_p->m_length)  // if not empty
+    {
+    if (end_pos == ALength_remainder)
+      {
+      end_pos = m_str_ref_p->m_length - 1;
+      }
 
-          insensitive_ch = to_lowercase(cstr_p[target_pos]);
-          }
+    #ifdef A_BOUNDS_CHECK
+      bounds_check(start_pos, end_pos, "replace_all");
+    #endif
 
-        target_pos += a_max(static_cast<uint32_t>(delta_p[uint8_t(insensitive_ch)]), (patlen - bm_pos));  // move target_p index by delta value of mismatched character
-        }
-      }
-    else  // Case sensitive
-      {
-      while (target_pos <= end_pos)
-        {
-        bm_pos = patlen - 1u;
+    found = count(old_ch, start_pos, end_pos);
 
-        while (bm_cstr_p[bm_pos] == cstr_p[target_pos])  // while corresponding chars match
-          {
-          if (bm_pos > 0u)                // Still characters to check                         
-            {                             // move left one character for next comparison
-            --bm_pos;
-            --target_pos;
-            }
-          else                            // pattern found!
-            {
-            if (instance == 1u)           // correct number of occurrences found!
-              {
-              if (find_pos_p)
-                {
-                *find_pos_p = target_pos;
-                }
+    if (found)
+      {
+      uint32_t new_length      = new_str.m_str_ref_p->m_length;
+      uint32_t size_difference = new_length - 1u;
 
-              return true;
-              }
-            else                          // one less instance to find
-              {
-              instance--;
-              }
+      ensure_size(m_str_ref_p->m_length + (found * size_difference));
 
-            break;                        // Ugly, I know - could be [bm_pos = bm.get_length]
-            }
-          }
+      // These must be after the ensure_size() since the AStringRef and internal buffer could change
+      uint32_t & length     = m_str_ref_p->m_length;  // Faster, but length must be up-to-date in find()
+      char *     cstr_p     = m_str_ref_p->m_cstr_p;
+      char *     new_cstr_p = new_str.m_str_ref_p->m_cstr_p;
 
-        target_pos += a_max(static_cast<uint32_t>(delta_p[uint8_t(cstr_p[target_pos])]), (patlen - bm_pos));  // move target_p index by delta value of mismatched character
+      while ((start_pos <= end_pos) && find(old_ch, 1u, &pos, start_pos, end_pos))
+        {
+        memmove(cstr_p + pos + new_length, cstr_p + pos + 1u, size_t(length - pos));
+        length  += size_difference;
+        end_pos += size_difference;
+        memcpy(cstr_p + pos, new_cstr_p, size_t(new_length));
+        start_pos = pos + new_length;
         }
       }
     }
 
-  return false;
+  return found;
   }
 
-
 //---------------------------------------------------------------------------------------
-//  Finds instance of substring str starting from start_pos and ending at end_pos using a
-//              fuzzy search and if found stores the start and end position of the found text.
-// # Returns:   true if instance of str found, false if not
-// Arg          str - substring to find
-// Arg          instance - occurrence of substring to find.  It may not be less than 1.
-//              (Default 1)
-// Arg          find_start_p - address to store index of instance of the beginning of the substring if found.
-//              It is not modified if the substring is not found or if it is set to nullptr.
-//              (Default nullptr)
-// Arg          find_end_p - address to store index of instance of the end of the substring if found.
-//              It is not modified if the substring is not found or if it is set to nullptr.
-//              (Default nullptr)
-// Arg          start_pos - starting character index of search range (Default 0)
-// Arg          end_pos - ending character index of search range.  If end_pos is set to
-//              ALength_remainder, the entire length of the string (from the starting position)
-//              is searched (end_pos = length - start_pos).  (Default ALength_remainder)
-// Arg          case_check - if set to AStrCase_sensitive, case is important (q != Q), if set
-//              to AStrCase_ignore, case is not important (q == Q).  (Default AStrCase_sensitive)
-// # Examples:  AString source("abcde_abxxc");
-//              if (source.find_fuzzy("ac", 1))  // returns true, find_first_p returns 0, find_end_p return 2
-//                do_something();
-// # See:       find(bm), count(), get()
-// # Notes:     Matches do not cross line terminators.
-// # Author(s):  John Stenersen
-bool AString::find_fuzzy(
-  const AString & str,
-  uint32_t        instance,     //  = 1
-  uint32_t *      find_start_p, //  = nullptr
-  uint32_t *      find_end_p,   //  = nullptr
-  uint32_t        start_pos,    //  = 0
-  uint32_t        end_pos,      //  = ALength_remainder
-  eAStrCase       case_check    //  = AStrCase_sensitive
-  ) const
+//  Replace all bm with new_str starting at start_pos
+// # Author(s):  Conan Reis
+// Efficiency   See remove_all() efficiency comment for replacements where new_str is
+//              shorter than old_str.  It may also be more efficient to apply the same
+//              method for the reverse - just determine offset or tally the results.
+uint32_t AString::replace_all(
+  const AStringBM & bm,
+  const AString &   new_str,
+  uint32_t          start_pos,  // = 0u
+  uint32_t          end_pos     // = ALength_remainder
+  )
   {
-  if (!str.m_str_ref_p->m_length || (str.m_str_ref_p->m_length > m_str_ref_p->m_length))
-    {
-    //  The key string is empty or longer than the text being searched.
-    return false;
-    }
-
-  if (end_pos == ALength_remainder)
+  uint32_t pos;
+  uint32_t found = 0u;
+  
+  if (m_str_ref_p->m_length)  // if not empty
     {
-    end_pos = m_str_ref_p->m_length - 1;
-    }
+    if (end_pos == ALength_remainder)
+      {
+      end_pos = m_str_ref_p->m_length - 1;
+      }
 
-  #ifdef A_BOUNDS_CHECK
-    bounds_check(start_pos, end_pos, instance, "find_fuzzy");
-  #endif
+    #ifdef A_BOUNDS_CHECK
+      bounds_check(start_pos, end_pos, "replace_all");
+    #endif
 
-  const char * key_start_p  = str.m_str_ref_p->m_cstr_p;
-  const char * key_end_p    = key_start_p + str.m_str_ref_p->m_length - 1;
-  const char * text_start_p = & m_str_ref_p->m_cstr_p[start_pos];
-  const char * text_end_p   = & m_str_ref_p->m_cstr_p[end_pos - 1];
-  const char * first_p      = nullptr;
-  const char * next_p       = nullptr;
+    found = count(bm, start_pos, end_pos);
 
-  if (case_check == AStrCase_sensitive)  // Case sensitive
-    {
-    do  // Each instance
+    if (found)
       {
-      //  Fnd the first character match.
-      while (text_start_p <= text_end_p)
-        {
-        if (*text_start_p == *key_start_p)
-          {
-          first_p = text_start_p;
-          break;
-          }
-        text_start_p ++;
-        }
+      uint32_t new_length      = new_str.m_str_ref_p->m_length;
+      uint32_t old_length      = bm.get_length();
+      int      size_difference = int(new_length) - int(old_length);
 
-      if (!first_p)
-        {
-        //  Did not find the first character match.
-        return false;
-        }
+      ensure_size(m_str_ref_p->m_length + (found * size_difference));
 
-      //  For the remainder of the key, find a matching character in the text.
-      key_start_p ++;
-      text_start_p ++;
-      next_p = first_p;
+      // These must be after the ensure_size() since the internal buffer could change
+      uint32_t & length     = m_str_ref_p->m_length;  // Faster, but length must be up-to-date in find()
+      char *     cstr_p     = m_str_ref_p->m_cstr_p;
+      char *     new_cstr_p = new_str.m_str_ref_p->m_cstr_p;
 
-      while (key_start_p <= key_end_p)
+      while ((start_pos <= end_pos) && find(bm, 1u, &pos, start_pos, end_pos))
         {
-        //  Find the next character match.
-        next_p = nullptr;
-        while ((text_start_p <= text_end_p) && (*text_start_p != '\n') && (*text_start_p != '\r'))
-          {
-          if (*text_start_p == *key_start_p)
-            {
-            next_p = text_start_p;
-            break;
-            }
-          text_start_p ++;
-          }
-
-        if ((*text_start_p == '\n') || (*text_start_p == '\r'))
-          {
-          //  Start over on next line.
-          next_p        = text_start_p;
-          first_p       = nullptr;
-          key_start_p   = str.m_str_ref_p->m_cstr_p;
-          instance ++;
-          break;
-          }
-
-        if (!next_p)
+        if (size_difference != 0)
           {
-          return false; //  Match not found.
+          memmove(cstr_p + pos + new_length, cstr_p + pos + old_length, size_t(length - old_length + 1u - pos));
+          length  += uint32_t(size_difference);  // Silly cast to stop compiler warning
+          end_pos += uint32_t(size_difference);
           }
 
-        key_start_p ++;
-        text_start_p ++;
+        memcpy(cstr_p + pos, new_cstr_p, size_t(new_length));
+        start_pos = pos + new_length;
         }
-
-        //  Found a match.
-        instance --;
-        if (!instance)
-          {
-          //  The instance of the match.
-          if (find_start_p)
-            {
-            * find_start_p = (uint32_t) (first_p - m_str_ref_p->m_cstr_p);
-            }
-          if (find_end_p)
-            {
-            * find_end_p = (uint32_t) (next_p - m_str_ref_p->m_cstr_p + 1);
-            }
-          return true;
-          }
-
-        text_start_p  = next_p + 1;
-        first_p       = nullptr;
-        key_start_p   = str.m_str_ref_p->m_cstr_p;
-      } while (instance);
+      }
     }
-  else  // Ignore case
-    {
-    do  // Each instance
-      {
-      //  Fnd the first character match.
-      while (text_start_p <= text_end_p)
-        {
-        if (!compare_insensitive(*text_start_p, *key_start_p))
-          {
-          first_p = text_start_p;
-          break;
-          }
-        text_start_p ++;
-        }
 
-      if (!first_p)
-        {
-        //  Did not find the first character match.
-        return false;
-        }
+  return found;
+  }
 
-      //  For the remainder of the key, find a matching character in the text.
-      key_start_p ++;
-      text_start_p ++;
-      next_p = first_p;
+//---------------------------------------------------------------------------------------
+//  Reverse order of char_count characters starting at pos.
+// Arg          pos - character index to begin reversing characters.  (Default 0u)
+// Arg          char_count - number of characters to reverse.  If char_count is ALength_remainder,
+//              the number of characters is equal to the length of the string - pos.
+//              (Default ALength_remainder)
+// # Examples:  AString str("12345");
+//              str.reverse();         // = "54321"
+// # See:       as_reverse(), find_reverse()
+// # Author(s):  Conan Reis
+void AString::reverse(
+  uint32_t pos,     // = 0u
+  uint32_t char_count // = ALength_remainder
+  )
+  {
+  if (char_count == ALength_remainder)  // default
+    {
+    char_count = m_str_ref_p->m_length - pos;
+    }
 
-      while (key_start_p <= key_end_p)
-        {
-        //  Find the next character match.
-        next_p = nullptr;
-        while ((text_start_p <= text_end_p) && (*text_start_p != '\n') && (*text_start_p != '\r'))
-          {
-          if (!compare_insensitive(*text_start_p, *key_start_p))
-            {
-            next_p = text_start_p;
-            break;
-            }
-          text_start_p ++;
-          }
+  if (char_count > 1)  // If less than 2 characters are reversed, there is no point
+    {
+    #ifdef A_BOUNDS_CHECK
+      span_check(pos, char_count, "reverse");
+    #endif
 
-        if ((*text_start_p == '\n') || (*text_start_p == '\r'))
-          {
-          //  Start over on next line.
-          next_p        = text_start_p;
-          first_p       = nullptr;
-          key_start_p   = str.m_str_ref_p->m_cstr_p;
-          instance ++;
-          break;
-          }
+    // $Revisit - CReis This could be optimized - characters in specified range may be copied twice.
+    ensure_writable();
 
-        if (!next_p)
-          {
-          return false; //  Match not found.
-          }
+    char   ch;
+    char * cstr_p     = m_str_ref_p->m_cstr_p + pos;
+    char * cstr_end_p = cstr_p + char_count - 1;
 
-        key_start_p ++;
-        text_start_p ++;
-        }
+    while (cstr_p < cstr_end_p)
+      {
+      ch          = *cstr_p;
+      *cstr_p     = *cstr_end_p;
+      *cstr_end_p = ch;
+      cstr_p++;
+      cstr_end_p--;
+      }
+    }
+  }
+
+//---------------------------------------------------------------------------------------
+//  Sets the C-String character buffer.  See the description of the
+//              argument 'buffer_p' for the three possible uses of this constructor.
+// # Returns:   itself
+// Arg          buffer_p - pointer to array of characters (does not need to be null
+//              terminated unless 'length' is equal to ALength_calculate).  If 'buffer_p'
+//              is nullptr, 'length' and 'deallocate' are ignored.  There are in general 3
+//              different types of values that 'buffer_p' will be given:
+//                1. A temporary buffer which is allocated on the stack or is recovered
+//                   by some other means.
+//                2. A pre-allocated character array that this AString object should take
+//                   over responsibility for.
+//                3. nullptr.  This then creates an empty string with a space of 'size'
+//                   already allocated including the null terminating character.
+// Arg          size - This is the size in bytes of the memory pointed to by 'buffer_p'
+//              or if 'buffer_p' is nullptr, it is the initial memory size that should be 
+//              allocated by this string.  Also note that this size includes the null
+//              terminating character, so 'size' should never be less than 1.
+// Arg          length - number of characters to use in 'buffer_p' and the index position
+//              to place a terminating null character.  The given length must not be more
+//              than the size of 'buffer_p' and the C-String buffer pointed to by
+//              'buffer_p' should not have any null characters less then the given length.
+//              'length' may also be set to ALength_calculate in which case the character
+//              length is calculated by finding the first terminating null character
+//              already present in 'buffer_p'.  (Default ALength_calculate)
+// Arg          deallocate - Indicates whether this string (or more specifically the
+//              AStringRef) should take control of the memory pointed to by buffer_p and
+//              do deallocate it when it is no longer in use.
+// # Examples:  char buffer_p[100];
+//              str.set_buffer(buffer_p, 100u, 0u);
+// # See:       set_cstr(), operator=(cstr), append(), insert(), AString(cstr_p),
+//              AString(cstr_p, length, persistent), AString(buffer_p, size, length, deallocate)
+// # Notes:     To make a copy of a C-String call AString(cstr_p, length, persistent = false).
+//              To reference a C-String literal call AString(cstr_p) or
+//              AString(cstr_p, length, persistent = true)
+// # Author(s):  Conan Reis
+void AString::set_buffer(
+  const char * buffer_p,
+  uint32_t     size,
+  uint32_t     length,    // = ALength_calculate
+  bool         deallocate // = false
+  )
+  {
+  if (buffer_p)
+    {
+    if (length == ALength_calculate)
+      {
+      length = uint32_t(::strlen(buffer_p));
+      }
+
+    m_str_ref_p = m_str_ref_p->reuse_or_new(buffer_p, length, size, deallocate);
+    m_str_ref_p->m_cstr_p[length] = '\0';  // Put in null-terminator
+    }
+  else  // nullptr, so create empty string with specified buffer size
+    {
+    ensure_size_empty(size);
+    }
+  }
+
+//---------------------------------------------------------------------------------------
+// Sets the C-String character buffer.  Refers to a persistent null-terminated
+//             C-String or makes its own copy of an existing character array.
+// Arg         cstr_p - pointer to array of characters (does not need to be null
+//             terminated unless length is set to ALength_calculate or 'persistent' is
+//             true).  'cstr_p' should never be nullptr.  'cstr_p' will usually be a string
+//             literal or if 'persistent' is false, 'cstr_p' may be any C-String that
+//             this string should make a copy of.
+// Arg         length - number of characters to use in 'cstr_p' and the index position to
+//             place a terminating null character.  The given length must not be more
+//             than the size of 'cstr_p' and the C-String buffer pointed to by 'cstr_p'
+//             should not have any null characters less then the given length.  A null
+//             terminator is placed only if 'persistent' is not true.
+//             'length' may also be set to ALength_calculate in which case the character
+//             length is calculated by finding the first terminating null character
+//             already present in 'cstr_p'.
+// Arg         persistent - Indicates whether the data pointed to by cstr_p will be
+//             available for the lifetime of this string.  If 'persistent' is true, the
+//             memory pointed to by 'cstr_p' will be used rather than having this object
+//             allocate its own memory - also the memory pointed to by 'cstr_p' will not
+//             be written to.  If 'persistent' is false, then this AString object will
+//             allocate its own memory and copy the contents of 'cstr_p' to it.
+// # Examples: str.set_cstr("Hello");
+// # See:      set_buffer(), operator=(cstr), append(), insert(), AString(cstr_p),
+//             AString(cstr_p, length, persistent), AString(buffer_p, size, length, deallocate)
+// # Author(s): Conan Reis
+void AString::set_cstr(
+  const char * cstr_p,
+  uint32_t     length,    // = ALength_calculate
+  bool         persistent // = true
+  )
+  {
+  A_ASSERT(cstr_p != nullptr, "Given nullptr instead of valid C-String", ErrId_null_cstr, AString);
+
+  if (length == ALength_calculate)
+    {
+    length = uint32_t(::strlen(cstr_p));
+    }
+
+  if (persistent)
+    {
+    m_str_ref_p->dereference();
+    m_str_ref_p = AStringRef::pool_new(cstr_p, length, length + 1u, 1u, false, true);
+    }
+   else  // Not persistent - make a copy
+    {
+    ensure_size_buffer(length);
+
+    memcpy(m_str_ref_p->m_cstr_p, cstr_p, length);
+    m_str_ref_p->m_cstr_p[length] = '\0';  // Put in null-terminator
+    m_str_ref_p->m_length         = length;
+    }
+  }
+
+//---------------------------------------------------------------------------------------
+//  Removes all the characters of match_type from the beginning of the string
+//              until it encounters a character that is not match_type.
+// Arg          match_type - classification of characters to match.
+//              (Default ACharMatch_white_space)
+// # Examples:  AString str("  the quick brown fox  ");
+// 
+//              str.trim();  // str is now "the quick brown fox  "
+// # See:       truncate(), crop(), remove_all(match_type), find(match_type), not_char_type()
+// # Author(s):  Conan Reis
+// Efficiency   See efficiency comment for remove_all().
+void AString::trim(
+  eACharMatch match_type // = ACharMatch_white_space
+  )
+  {
+  uint32_t find_pos;
+
+  if (find(not_char_type(match_type), 1u, &find_pos))
+    {
+    // $Revisit - CReis this code could be transplanted here for extra speed.
+    crop_quick(find_pos, m_str_ref_p->m_length - find_pos);
+    }
+  else
+    {
+    empty();
+    }
+  }
+
+//---------------------------------------------------------------------------------------
+//  Removes all the characters of match_type from the end of the string
+//              until it encounters a character that is not match_type.
+// Arg          match_type - classification of characters to match.
+//              (Default ACharMatch_white_space)
+// # Examples:  AString str("  the quick brown fox  ");
+// 
+//              str.truncate();  // str is now "  the quick brown fox"
+// # See:       trim(), crop(), remove_all(match_type), find(match_type), not_char_type()
+// # Author(s):  Conan Reis
+void AString::truncate(
+  eACharMatch match_type // = ACharMatch_white_space
+  )
+  {
+  uint32_t find_pos;
+
+  if (find_reverse(not_char_type(match_type), 1u, &find_pos))
+    {
+    // $Revisit - CReis this code could be transplanted here for extra speed.
+    crop_quick(0u, find_pos + 1u);
+    }
+  else
+    {
+    empty();
+    }
+  }
+
+//---------------------------------------------------------------------------------------
+//  Add-assignment operator:  string += cstring
+// # Returns:   a reference to itself
+// Arg          cstr_p - Null-terminated C-sting to append.  'cstr_p' should never be 
+//              nullptr.
+// # See:       append(), insert(), set_cstr(), set_buffer(), add(), operator+=(),
+//              operator+(), operator=()
+// # Author(s):  Conan Reis
+AString & AString::operator+=(const char * cstr_p)
+  {
+  A_ASSERT(cstr_p != nullptr, "Given nullptr instead of valid C-String", ErrId_null_cstr, AString);
+
+  uint32_t length = uint32_t(::strlen(cstr_p));
+
+  if (length)
+    {
+    uint32_t total_length = m_str_ref_p->m_length + length;  // Calculate total length of string
+
+    ensure_size(total_length);
+    
+    // concatenate new string
+    memcpy(m_str_ref_p->m_cstr_p + m_str_ref_p->m_length, cstr_p, size_t(length));
+    
+    m_str_ref_p->m_length               = total_length;
+    m_str_ref_p->m_cstr_p[total_length] = '\0';    // Place a terminating character
+    }
+
+  return *this;
+  }
+
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// Non-Modifying Methods
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+//---------------------------------------------------------------------------------------
+// Add - concatenate this string and another string to form a new string.
+// # Returns:  new string resulting from the concatenation of this string and 'str'
+// Arg         str - string to append
+// # Notes:    Note that the name add() is used as a convention rather than as_append()
+// # Author(s): Conan Reis
+AString AString::add(const AString & str) const
+  {
+  uint32_t     length_this = m_str_ref_p->m_length;
+  uint32_t     length_str  = str.m_str_ref_p->m_length;
+  uint32_t     length_new  = length_this + length_str;
+  AStringRef * str_ref_p   = AStringRef::pool_new_buffer(length_new, length_new, 0u);
+  char *       buffer_p    = str_ref_p->m_cstr_p;
+
+  ::memcpy(buffer_p, m_str_ref_p->m_cstr_p, size_t(length_this));  
+  ::memcpy(buffer_p + length_this, str.m_str_ref_p->m_cstr_p, size_t(length_str));
+
+  // Add null terminator by hand rather than copying it from str to ensure that it exists.
+  buffer_p[length_new] = '\0';
+
+  return str_ref_p;
+  }
+
+//---------------------------------------------------------------------------------------
+// Add - concatenate this string and a C-string to form a new string.
+// # Returns:  new string resulting from the concatenation of this string and 'cstr_p'
+// Arg         cstr_p - pointer to array of characters (does not need to be null
+//             terminated unless length is equal to ALength_calculate).  'cstr_p' should
+//             never be nullptr.
+// Arg         length - number of characters to use in 'cstr_p' and used to determine a
+//             position to place a terminating null character.  The given length must not
+//             be more than the size of 'cstr_p' and 'cstr_p' should not have any null
+//             characters less then the given length.  'length' may also be set to
+//             ALength_calculate in which case the character length is calculated by
+//             finding the first terminating null character already present in 'cstr_p'.
+// # Notes:    Note that the name add() is used as a convention rather than as_append()
+// # Author(s): Conan Reis
+AString AString::add(
+  const char * cstr_p,
+  uint32_t     length // = ALength_calculate
+  ) const
+  {
+  if (length == ALength_calculate)
+    {
+    length = uint32_t(::strlen(cstr_p));
+    }
+
+  uint32_t     length_this = m_str_ref_p->m_length;
+  uint32_t     length_new  = length_this + length;
+  AStringRef * str_ref_p   = AStringRef::pool_new_buffer(length_new, length_new, 0u);
+  char *       buffer_p    = str_ref_p->m_cstr_p;
+
+  ::memcpy(buffer_p, m_str_ref_p->m_cstr_p, size_t(length_this));  
+  ::memcpy(buffer_p + length_this, cstr_p, size_t(length));
+  buffer_p[length_new] = '\0';  // Put in null-terminator
+
+  return str_ref_p;
+  }
+
+//---------------------------------------------------------------------------------------
+//  Character concatenation:  string + ch
+// # Author(s):  Conan Reis
+AString AString::add(char ch) const
+  {
+  if (ch != '\0')
+    {
+    uint32_t     length_this = m_str_ref_p->m_length;
+    AStringRef * str_ref_p   = AStringRef::pool_new_buffer(length_this + 1u, length_this + 1u, 0u);
+    char *       buffer_p    = str_ref_p->m_cstr_p;
+
+    ::memcpy(buffer_p, m_str_ref_p->m_cstr_p, size_t(length_this));  
+    buffer_p[length_this]      = ch;
+    buffer_p[length_this + 1u] = '\0';  // Put in null-terminator
+
+    return str_ref_p;
+    }
+
+  return *this;
+  }
+
+//---------------------------------------------------------------------------------------
+//  Copies itself to reversed_p with char_count characters starting at pos in
+//              reversed order.
+// Arg          reversed_p - address to store a copy of this string with all or a portion
+//              of its characters reversed.
+// Arg          pos - character index to begin reversing characters.  (Default 0u)
+// Arg          char_count - number of characters to reverse.  If char_count is
+//              ALength_remainder, the number of characters is equal to the length of the
+//              string - pos.  (Default ALength_remainder)
+// # Examples:  AString str("12345");
+//              str.as_reverse(&str_rev);  // str_rev = "54321"
+// # See:       as_reverse(pos, char_count), reverse(), find_reverse()
+// # Author(s):  Conan Reis
+void AString::as_reverse(
+  AString * reversed_p,
+  uint32_t  pos,       // = 0u
+  uint32_t  char_count // = ALength_remainder
+  ) const
+  {
+  if (char_count == ALength_remainder)  // default
+    {
+    char_count = m_str_ref_p->m_length - pos;
+    }
+
+  #ifdef A_BOUNDS_CHECK
+    span_check(pos, char_count, "as_reverse");
+  #endif
+
+  if (char_count > 1u)  // If less than 2 characters are reversed, there is no point
+    {
+    reversed_p->ensure_size_empty(m_str_ref_p->m_length);
+
+    char * rev_cstr_p = reversed_p->m_str_ref_p->m_cstr_p;  // Local caching
+
+    // Copy initial non-reversed portion - if any
+    if (pos)
+      {
+      ::memcpy(rev_cstr_p, m_str_ref_p->m_cstr_p, size_t(pos));
+      }
+
+
+    // Copy reversed portion
+    char * cstr_p         = m_str_ref_p->m_cstr_p + pos;
+    char * cstr_end_p     = cstr_p + char_count;
+    char * reversed_end_p = rev_cstr_p + pos + char_count - 1;
+
+    for (; cstr_p < cstr_end_p; cstr_p++, reversed_end_p--)
+      {
+      *reversed_end_p = *cstr_p;
+      }
+
+
+    // Copy remaining non-reversed portion - if any
+    if ((pos + char_count) < m_str_ref_p->m_length)
+      {
+      // This copy includes the null terminator
+      ::memcpy(rev_cstr_p + pos + char_count, m_str_ref_p->m_cstr_p, size_t(m_str_ref_p->m_length - pos - char_count + 1u));
+      }
+    else
+      {
+      rev_cstr_p[m_str_ref_p->m_length] = '\0';
+      }
+
+    reversed_p->m_str_ref_p->m_length = m_str_ref_p->m_length;
+    }
+  else  // No reversing - just a standard copy
+    {
+    *reversed_p = *this;
+    }
+  }
+
+//---------------------------------------------------------------------------------------
+// Determines the number of occurrences of the specified character.
+// 
+// # Returns:   number of occurrences of specified character
+// Arg          ch - character to count
+// Arg          start_pos - starting position of count search range (Default 0)
+// Arg          end_pos - ending position of count search range.  If end_pos is set to
+//              ALength_remainder, the entire length of the string (from the starting position)
+//              is searched.  (Default ALength_remainder)
+// Arg          last_counted_p - optional address to store index of last counted character.
+//              If nothing is counted then it is set to start_pos.
+// # Examples:  uint32_t underscores = str.count('_');
+// # See:       find(), get()
+// # Author(s):  Conan Reis
+uint32_t AString::count(
+  char       ch,
+  uint32_t   start_pos,     // = 0
+  uint32_t   end_pos,       // = ALength_remainder
+  uint32_t * last_counted_p // = nullptr
+  ) const
+  {
+  // Ensure not empty
+  if (m_str_ref_p->m_length == 0u)
+    {
+    return 0u;
+    }
+
+  if (end_pos == ALength_remainder)
+    {
+    end_pos = m_str_ref_p->m_length - 1u;
+    }
+
+  #ifdef A_BOUNDS_CHECK
+    bounds_check(start_pos, end_pos, "count");
+  #endif
+
+  const char * cstr_start_p = m_str_ref_p->m_cstr_p;
+  const char * cstr_count_p = cstr_start_p + start_pos;
+  const char * cstr_end_p   = cstr_start_p + end_pos;
+  uint32_t     num_count    = a_count_char(cstr_count_p, cstr_end_p, ch);
+
+  if (last_counted_p)
+    {
+    if (num_count)
+      {
+      cstr_count_p = a_find_char_reverse(cstr_count_p, cstr_end_p, ch);
+      }
+
+    *last_counted_p = uint32_t(cstr_count_p - cstr_start_p);
+    }
+
+  return num_count;
+  }
+
+//---------------------------------------------------------------------------------------
+//  Determines the number of occurrences of the specified character.
+// # Returns:   number of occurrences of specified character
+// Arg          match_type - classification of characters to match.
+// Arg          start_pos - starting position of count search range (Default 0)
+// Arg          end_pos - ending position of count search range.  If end_pos is set to
+//              ALength_remainder, the entire length of the string (from the starting position)
+//              is searched.  (Default ALength_remainder)
+// # Examples:  uint32_t digits = str.count(ACharMatch_digit);
+// # See:       find(match_type), get(match_type), not_char_type()
+// # Author(s):  Conan Reis
+uint32_t AString::count(
+  eACharMatch match_type,
+  uint32_t    start_pos, // = 0
+  uint32_t    end_pos    // = ALength_remainder
+  ) const
+  {
+  uint32_t num_count= 0u;
+
+  if (m_str_ref_p->m_length)  // if not empty
+    {
+    if (end_pos == ALength_remainder)
+      {
+      end_pos = m_str_ref_p->m_length - 1u;
+      }
+
+    #ifdef A_BOUNDS_CHECK
+      bounds_check(start_pos, end_pos, "count");
+    #endif
+
+    num_count = a_count_match(
+      reinterpret_cast<uint8_t *>(m_str_ref_p->m_cstr_p + start_pos),
+      reinterpret_cast<uint8_t *>(m_str_ref_p->m_cstr_p + end_pos),
+      ms_char_match_table[match_type]);
+    }
+  return num_count;
+  }
+
+//---------------------------------------------------------------------------------------
+//  Returns number of substrings found
+// # Author(s):  Conan Reis
+uint32_t AString::count(
+  const AStringBM & bm,
+  uint32_t          start_pos,  // = 0u
+  uint32_t          end_pos     // = ALength_remainder
+  ) const
+  {
+  uint32_t result = 0u;
+  uint32_t length = bm.m_str_ref_p->m_length;
+
+  while (find(bm, 1u, &start_pos, start_pos, end_pos) == true)
+    {
+    result++;
+    start_pos += length;  // non-overlapping
+    }
+
+  return result;
+  }
+
+//---------------------------------------------------------------------------------------
+//  Finds instance of specified character starting from start_pos and ending
+//              at end_pos and if found stores the index position found.
+// # Returns:   true if instance character found, false if not
+// Arg          ch - character to find
+// Arg          instance - occurrence of character to find.  It may not be less than 1.
+//              (Default 1)
+// Arg          find_pos_p - address to store index of instance character if found.
+//              It is not modified if the character is not found or if it is set to nullptr.
+//              (Default nullptr)
+// Arg          start_pos - starting position of search range (Default 0)
+// Arg          end_pos - ending position of search range.  If end_pos is set to
+//              ALength_remainder, the entire length of the string (from the starting position)
+//              is searched (end_pos = length - start_pos).  (Default ALength_remainder)
+// # Examples:  if (str.find('_', 2))  // if 2nd underscore is found
+//                do_something();
+// # See:       count(), get()
+// # Notes:     This character find method is faster than the find method searching for a
+//              single character string.
+// # Author(s):  Conan Reis
+bool AString::find(
+  char   ch,
+  uint32_t   instance,   // = 1
+  uint32_t * find_pos_p, // = nullptr
+  uint32_t   start_pos,  // = 0
+  uint32_t   end_pos     // = ALength_remainder
+  ) const
+  {
+  if (m_str_ref_p->m_length)  // if not empty
+    {
+    if (end_pos == ALength_remainder)
+      {
+      end_pos = m_str_ref_p->m_length - 1u;
+      }
+
+    #ifdef A_BOUNDS_CHECK
+      bounds_check(start_pos, end_pos, instance, "find");
+    #endif
+
+    const char * cstr_p     = m_str_ref_p->m_cstr_p + start_pos;
+    const char * cstr_end_p = m_str_ref_p->m_cstr_p + end_pos;
+
+    while ((cstr_p = a_find_char(cstr_p, cstr_end_p, ch)) != nullptr)  // Found one
+      {
+      if (instance == 1u)  // Found it!
+        {
+        if (find_pos_p)
+          {
+          *find_pos_p = uint32_t(cstr_p - m_str_ref_p->m_cstr_p);
+          }
+
+        return true;
+        }
+
+      instance--;
+      cstr_p++;
+      }
+    }
+
+  return false;
+  }
+
+//---------------------------------------------------------------------------------------
+//  Finds instance of specified type of character starting from start_pos and
+//              ending at end_pos and if found stores the index position found.
+// # Returns:   true if instance character type found, false if not
+// Arg          match_type - classification of characters to match.
+// Arg          instance - occurrence of character type to find.  It may not be less than 1.
+//              (Default 1)
+// Arg          find_pos_p - address to store index of instance character type if found.
+//              It is not modified if the character type is not found or if it is set to nullptr.
+//              (Default nullptr)
+// Arg          start_pos - starting position of search range (Default 0)
+// Arg          end_pos - ending position of search range.  If end_pos is set to
+//              ALength_remainder, the entire length of the string (from the starting position)
+//              is searched (end_pos = length - start_pos).  (Default ALength_remainder)
+// # Examples:  if (str.find(ACharMatch_lowercase, 2))  // if 2nd lowercase letter is found
+//                do_something();
+// # See:       count(), get(), not_char_type()
+// # Author(s):  Conan Reis
+bool AString::find(
+  eACharMatch match_type,
+  uint32_t    instance,   // = 1
+  uint32_t *  find_pos_p, // = nullptr
+  uint32_t    start_pos,  // = 0
+  uint32_t    end_pos     // = ALength_remainder
+  ) const
+  {
+  uint32_t length = m_str_ref_p->m_length;
+
+  if (length && (start_pos < length))  // if not empty or skipped
+    {
+    if (end_pos == ALength_remainder)
+      {
+      end_pos = length - 1u;
+      }
+
+    #ifdef A_BOUNDS_CHECK
+      bounds_check(start_pos, end_pos, instance, "find");
+    #endif
+
+    const uint8_t * cstr_p        = reinterpret_cast<uint8_t *>(m_str_ref_p->m_cstr_p + start_pos);
+    const uint8_t * cstr_end_p    = reinterpret_cast<uint8_t *>(m_str_ref_p->m_cstr_p + end_pos);
+    const bool *    match_table_p = ms_char_match_table[match_type];
+
+    while ((cstr_p = a_find_match(cstr_p, cstr_end_p, match_table_p)) != nullptr)  // Found one
+      {
+      if (instance == 1u)  // Found it!
+        {
+        if (find_pos_p)
+          {
+          *find_pos_p = uint32_t(cstr_p - reinterpret_cast<uint8_t *>(m_str_ref_p->m_cstr_p));
+          }
+
+        return true;
+        }
+
+      instance--;
+      cstr_p++;
+      }
+    }
+
+  return false;
+  }
+
+//---------------------------------------------------------------------------------------
+//  Finds instance of substring str starting from start_pos and ending
+//              at end_pos and if found stores the index position found.
+// # Returns:   true if instance of str found, false if not
+// Arg          str - substring to find
+// Arg          args_p - find info - see AFindStrArgs declaration.
+//              (Default &AFindStrArgs::ms_sensitive)
+// # Examples:  AString sub_str("hello");
+//              if (str.find(sub_str, &AFindStrArgs(2)))  // if 2nd "hello" substring is found
+//                do_something();
+// # See:       find(bm), count(), get()
+// # Notes:     [Efficiency] This method should be faster than calling strstr() - profile.
+//              The case insensitive routine could probably be made more efficient - via
+//              a lowercase table and/or only converting the characters once in temporary
+//              C-String buffers.
+// # Author(s):  Conan Reis
+/*
+bool AString::find2(
+  const AString & str,
+  AFindStrArgs *  args_p // = &AFindStrArgs::ms_sensitive
+  ) const
+  {
+  if (m_str_ref_p->m_length && (m_str_ref_p->m_length >= str.m_str_ref_p->m_length))  // if not empty and str is no larger than this string
+    {
+    uint32_t end_pos  = args_p->m_end_pos;
+    uint32_t instance = args_p->m_instance;
+
+    if (end_pos == ALength_remainder)
+      {
+      end_pos = m_str_ref_p->m_length - 1;
+      }
+
+    #ifdef A_BOUNDS_CHECK
+      bounds_check(args_p->m_start_pos, end_pos, instance, "find");
+    #endif
+
+    char * match_p;
+    char * find_p;
+    char * cstr_p       = m_str_ref_p->m_cstr_p + args_p->m_start_pos;
+    char * cstr_end_p   = m_str_ref_p->m_cstr_p + end_pos - str.m_str_ref_p->m_length - 1;  // won't match if less than str left
+    char * find_start_p = str.m_str_ref_p->m_cstr_p;
+    char * find_end_p   = find_start_p + str.m_str_ref_p->m_length;
+
+    if (args_p->m_case_check == AStrCase_sensitive)  // Case sensitive
+      {
+      while (cstr_p <= cstr_end_p)
+        {
+        match_p = cstr_p;
+        find_p  = find_start_p;
+
+        while ((find_p < find_end_p) && (*match_p == *find_p))
+          {
+          find_p++;
+          match_p++;
+          }
+
+        if (find_p == find_end_p)  // Found one
+          {
+          if (instance == 1u)      // Found it!
+            {
+            args_p->m_find_start = uint32_t(cstr_p - m_str_ref_p->m_cstr_p);
+            args_p->m_find_end   = args_p->m_find_start + str.m_str_ref_p->m_length;
+            return true;
+            }
+
+          instance--;
+          cstr_p = match_p;
+          }
+        else
+          {
+          cstr_p++;
+          }
+        }
+      }
+    else  // Ignore case
+      {
+      while (cstr_p <= cstr_end_p)
+        {
+        match_p = cstr_p;
+        find_p  = find_start_p;
+
+        while ((find_p < find_end_p) && !compare_insensitive(*match_p, *find_p))
+          {
+          find_p++;
+          match_p++;
+          }
+
+        if (find_p == find_end_p)  // Found one
+          {
+          if (instance == 1u)      // Found it!
+            {
+            args_p->m_find_start = uint32_t(cstr_p - m_str_ref_p->m_cstr_p);
+            args_p->m_find_end   = args_p->m_find_start + str.m_str_ref_p->m_length;
+            return true;
+            }
+
+          instance--;
+          cstr_p = match_p;
+          }
+        else
+          {
+          cstr_p++;
+          }
+        }
+      }
+    }
+
+  return false;
+  }      
+*/
+
+//---------------------------------------------------------------------------------------
+//  Finds instance of substring str starting from start_pos and ending
+//              at end_pos and if found stores the index position found.
+// # Returns:   true if instance of str found, false if not
+// Arg          str - substring to find
+// Arg          instance - occurrence of substring to find.  It may not be less than 1.
+//              (Default 1)
+// Arg          find_pos_p - address to store index of instance substring if found.
+//              It is not modified if the substring is not found or if it is set to nullptr.
+//              (Default nullptr)
+// Arg          start_pos - starting character index of search range (Default 0)
+// Arg          end_pos - ending character index of search range.  If end_pos is set to
+//              ALength_remainder, the entire length of the string (from the starting position)
+//              is searched (end_pos = length - start_pos).  (Default ALength_remainder)
+// Arg          case_check - if set to AStrCase_sensitive, case is important (q != Q), if set
+//              to AStrCase_ignore, case is not important (q == Q).  (Default AStrCase_sensitive)
+// # Examples:  AString sub_str("hello");
+//              if (str.find(sub_str, 2))  // if 2nd "hello" substring is found
+//                do_something();
+// # See:       find(bm), count(), get()
+// # Notes:     Candidate positions are filtered by the first and last characters of str
+//              (16 positions at a time when SSE2 is available) before the whole substring
+//              is compared.
+// # Author(s):  Conan Reis
+bool AString::find(
+  const AString & str,
+  uint32_t        instance,    // = 1
+  uint32_t *      find_pos_p,  // = nullptr
+  uint32_t        start_pos,   // = 0
+  uint32_t        end_pos,     // = ALength_remainder
+  eAStrCase       case_check   // = AStrCase_sensitive
+  ) const
+  {
+  if (m_str_ref_p->m_length && (m_str_ref_p->m_length >= str.m_str_ref_p->m_length))  // if not empty and str is no larger than this string
+    {
+    if (end_pos == ALength_remainder)
+      {
+      end_pos = m_str_ref_p->m_length - 1;
+      }
+
+    #ifdef A_BOUNDS_CHECK
+      bounds_check(start_pos, end_pos, instance, "find");
+    #endif
+
+    const char * match_p;
+    const char * cstr_p      = m_str_ref_p->m_cstr_p + start_pos;
+    const char * cstr_last_p = m_str_ref_p->m_cstr_p + end_pos - str.m_str_ref_p->m_length + 1u;  // won't match if less than str left
+    const char * find_p      = str.m_str_ref_p->m_cstr_p;
+    uint32_t     find_length = str.m_str_ref_p->m_length;
+
+    while (cstr_p <= cstr_last_p)
+      {
+      // An empty substring matches immediately
+      match_p = find_length
+        ? a_find_substr(cstr_p, cstr_last_p, find_p, find_length, case_check)
+        : cstr_p;
+
+      if (match_p == nullptr)
+        {
+        break;
+        }
+
+      // Found one
+      if (instance == 1u)  // Found it!
+        {
+        if (find_pos_p)
+          {
+          *find_pos_p = uint32_t(match_p - m_str_ref_p->m_cstr_p);
+          }
+
+        return true;
+        }
+
+      instance--;
+      cstr_p = match_p + find_length;
+      }
+    }
+
+  return false;
+  }      
+
+//---------------------------------------------------------------------------------------
+//  Quick substring search using the Boyer Moore algorithm.  Good for
+//              multiple searches for the same substring.  Finds instance of substring
+//              bm starting from start_pos and ending
+//              at end_pos and if found stores the index position found.
+// # Returns:   true if instance of bm found, false if not
+// Arg          bm - Boyer Moore substring to find
+// Arg          instance - occurrence of substring to find.  It may not be less than 1.
+//              (Default 1)
+// Arg          find_pos_p - address to store index of instance substring if found.
+//              It is not modified if the substring is not found or if it is set to nullptr.
+//              (Default nullptr)
+// Arg          start_pos - starting character index of search range (Default 0)
+// Arg          end_pos - ending character index of search range.  If end_pos is set to
+//              ALength_remainder, the entire length of the string (from the starting position)
+//              is searched (end_pos = length - start_pos).  (Default ALength_remainder)
+// Arg          case_check - if set to AStrCase_sensitive, case is important (q != Q), if set
+//              to AStrCase_ignore, case is not important (q == Q).  (Default AStrCase_sensitive)
+// # Examples:  AStringBM sub_str("hello");
+//              if (str.find(sub_str, 2))  // if 2nd "hello" substring is found
+//                do_something();
+// # See:       find(bm), count(), get()
+// # Notes:     [Efficiency]  The case insensitive routine could probably be made more
+//              efficient - via a lowercase table and/or only converting the characters
+//              once in temporary C-String buffers.
+// # Author(s):  Conan Reis
+bool AString::find(
+  const AStringBM & bm,
+  uint32_t          instance,   // = 1
+  uint32_t *        find_pos_p, // = nullptr
+  uint32_t          start_pos,  // = 0
+  uint32_t          end_pos     // = ALength_remainder
+  ) const
+  {
+
+  // $Revisit - CReis Rewrite using pointers rather than indexes
+
+  if (m_str_ref_p->m_length)  // if not empty
+    {
+    if (end_pos == ALength_remainder)
+      {
+      end_pos = m_str_ref_p->m_length - 1;
+      }
+
+    #ifdef A_BOUNDS_CHECK
+      bounds_check(start_pos, end_pos, instance, "find");
+    #endif
+
+    #ifdef A_STR_SSE2
+      // With SSE2 the first/last character filtered search rejects 16 positions at a time
+      // which is generally faster than the Boyer-Moore skips below.
+      uint32_t bm_length = bm.get_length();
+
+      if (bm_length)
+        {
+        const char * match_p;
+        const char * find_cstr_p = m_str_ref_p->m_cstr_p + start_pos;
+        const char * cstr_last_p = m_str_ref_p->m_cstr_p + end_pos - bm_length + 1u;  // won't match if less than bm left
+
+        while ((find_cstr_p <= cstr_last_p)
+          && ((match_p = a_find_substr(find_cstr_p, cstr_last_p, bm.m_str_ref_p->m_cstr_p, bm_length, bm.m_case)) != nullptr))
+          {
+          if (instance == 1u)  // Found it!
+            {
+            if (find_pos_p)
+              {
+              *find_pos_p = uint32_t(match_p - m_str_ref_p->m_cstr_p);
+              }
+
+            return true;
+            }
+
+          instance--;
+          find_cstr_p = match_p + bm_length;  // non-overlapping like Boyer-Moore
+          }
+
+        return false;
+        }
+    #endif
+
+    char            insensitive_ch;
+    uint32_t        bm_pos;                                // bm_pos is an index into pattern
+    uint32_t        patlen     = bm.get_length();          // store pattern length locally (high use)
+    uint32_t        target_pos = start_pos + patlen - 1u;  // target_pos is the index into the target_p
+    const char *    cstr_p     = m_str_ref_p->m_cstr_p;    // store cstr locally (high use)
+    const char *    bm_cstr_p  = bm.m_str_ref_p->m_cstr_p; // store bm cstr locally (high use)
+    const uint8_t * delta_p    = bm.m_delta_p;             // store delta table locally (high use)
+  
+    if (bm.m_case == AStrCase_ignore)            // same, but to_lowercase used
+      {
+      while (target_pos <= end_pos)
+        {
+        bm_pos         = patlen - 1u;
+        insensitive_ch = to_lowercase(cstr_p[target_pos]);
+
+        while (bm_cstr_p[bm_pos] == insensitive_ch)  // while corresponding chars match
+          {
+          if (bm_pos > 0u)                // Still characters to check                         
+            {                             // move left one character for next comparison
+            --bm_pos;                     
+            --target_pos;                 
+            }                             
+          else                            // pattern found!
+            {
+            if (instance == 1u)           // correct number of occurrences found!
+              {                           
+              if (find_pos_p)               
+                {
+                *find_pos_p = target_pos;   
+                }
+
+              return true;              
+              }                           
+            else                          // one less instance to find
+              {
+              instance--;
+              }
+
+            break;                        // Ugly, I know - could be [bm_pos = bm.get_length]
+            }
+
+          insensitive_ch = to_lowercase(cstr_p[target_pos]);
+          }
+
+        target_pos += a_max(static_cast<uint32_t>(delta_p[uint8_t(insensitive_ch)]), (patlen - bm_pos));  // move target_p index by delta value of mismatched character
+        }
+      }
+    else  // Case sensitive
+      {
+      while (target_pos <= end_pos)
+        {
+        bm_pos = patlen - 1u;
+
+        while (bm_cstr_p[bm_pos] == cstr_p[target_pos])  // while corresponding chars match
+          {
+          if (bm_pos > 0u)                // Still characters to check                         
+            {                             // move left one character for next comparison
+            --bm_pos;
+            --target_pos;
+            }
+          else                            // pattern found!
+            {
+            if (instance == 1u)           // correct number of occurrences found!
+              {
+              if (find_pos_p)
+                {
+                *find_pos_p = target_pos;
+                }
+
+              return true;
+              }
+            else                          // one less instance to find
+              {
+              instance--;
+              }
+
+            break;                        // Ugly, I know - could be [bm_pos = bm.get_length]
+            }
+          }
+
+        target_pos += a_max(static_cast<uint32_t>(delta_p[uint8_t(cstr_p[target_pos])]), (patlen - bm_pos));  // move target_p index by delta value of mismatched character
+        }
+      }
+    }
+
+  return false;
+  }
+
+
+//---------------------------------------------------------------------------------------
+//  Finds instance of substring str starting from start_pos and ending at end_pos using a
+//              fuzzy search and if found stores the start and end position of the found text.
+// # Returns:   true if instance of str found, false if not
+// Arg          str - substring to find
+// Arg          instance - occurrence of substring to find.  It may not be less than 1.
+//              (Default 1)
+// Arg          find_start_p - address to store index of instance of the beginning of the substring if found.
+//              It is not modified if the substring is not found or if it is set to nullptr.
+//              (Default nullptr)
+// Arg          find_end_p - address to store index of instance of the end of the substring if found.
+//              It is not modified if the substring is not found or if it is set to nullptr.
+//              (Default nullptr)
+// Arg          start_pos - starting character index of search range (Default 0)
+// Arg          end_pos - ending character index of search range.  If end_pos is set to
+//              ALength_remainder, the entire length of the string (from the starting position)
+//              is searched (end_pos = length - start_pos).  (Default ALength_remainder)
+// Arg          case_check - if set to AStrCase_sensitive, case is important (q != Q), if set
+//              to AStrCase_ignore, case is not important (q == Q).  (Default AStrCase_sensitive)
+// # Examples:  AString source("abcde_abxxc");
+//              if (source.find_fuzzy("ac", 1))  // returns true, find_first_p returns 0, find_end_p return 2
+//                do_something();
+// # See:       find(bm), count(), get()
+// # Notes:     Matches do not cross line terminators.
+// # Author(s):  John Stenersen
+bool AString::find_fuzzy(
+  const AString & str,
+  uint32_t        instance,     //  = 1
+  uint32_t *      find_start_p, //  = nullptr
+  uint32_t *      find_end_p,   //  = nullptr
+  uint32_t        start_pos,    //  = 0
+  uint32_t        end_pos,      //  = ALength_remainder
+  eAStrCase       case_check    //  = AStrCase_sensitive
+  ) const
+  {
+  if (!str.m_str_ref_p->m_length || (str.m_str_ref_p->m_length > m_str_ref_p->m_length))
+    {
+    //  The key string is empty or longer than the text being searched.
+    return false;
+    }
+
+  if (end_pos == ALength_remainder)
+    {
+    end_pos = m_str_ref_p->m_length - 1;
+    }
+
+  #ifdef A_BOUNDS_CHECK
+    bounds_check(start_pos, end_pos, instance, "find_fuzzy");
+  #endif
+
+  const char * key_start_p  = str.m_str_ref_p->m_cstr_p;
+  const char * key_end_p    = key_start_p + str.m_str_ref_p->m_length - 1;
+  const char * text_start_p = & m_str_ref_p->m_cstr_p[start_pos];
+  const char * text_end_p   = & m_str_ref_p->m_cstr_p[end_pos - 1];
+  const char * first_p      = nullptr;
+  const char * next_p       = nullptr;
+
+  if (case_check == AStrCase_sensitive)  // Case sensitive
+    {
+    do  // Each instance
+      {
+      //  Fnd the first character match.
+      while (text_start_p <= text_end_p)
+        {
+        if (*text_start_p == *key_start_p)
+          {
+          first_p = text_start_p;
+          break;
+          }
+        text_start_p ++;
+        }
+
+      if (!first_p)
+        {
+        //  Did not find the first character match.
+        return false;
+        }
+
+      //  For the remainder of the key, find a matching character in the text.
+      key_start_p ++;
+      text_start_p ++;
+      next_p = first_p;
+
+      while (key_start_p <= key_end_p)
+        {
+        //  Find the next character match.
+        next_p = nullptr;
+        while ((text_start_p <= text_end_p) && (*text_start_p != '\n') && (*text_start_p != '\r'))
+          {
+          if (*text_start_p == *key_start_p)
+            {
+            next_p = text_start_p;
+            break;
+            }
+          text_start_p ++;
+          }
+
+        if ((*text_start_p == '\n') || (*text_start_p == '\r'))
+          {
+          //  Start over on next line.
+          next_p        = text_start_p;
+          first_p       = nullptr;
+          key_start_p   = str.m_str_ref_p->m_cstr_p;
+          instance ++;
+          break;
+          }
+
+        if (!next_p)
+          {
+          return false; //  Match not found.
+          }
+
+        key_start_p ++;
+        text_start_p ++;
+        }
+
+        //  Found a match.
+        instance --;
+        if (!instance)
+          {
+          //  The instance of the match.
+          if (find_start_p)
+            {
+            * find_start_p = (uint32_t) (first_p - m_str_ref_p->m_cstr_p);
+            }
+          if (find_end_p)
+            {
+            * find_end_p = (uint32_t) (next_p - m_str_ref_p->m_cstr_p + 1);
+            }
+          return true;
+          }
+
+        text_start_p  = next_p + 1;
+        first_p       = nullptr;
+        key_start_p   = str.m_str_ref_p->m_cstr_p;
+      } while (instance);
+    }
+  else  // Ignore case
+    {
+    do  // Each instance
+      {
+      //  Fnd the first character match.
+      while (text_start_p <= text_end_p)
+        {
+        if (!compare_insensitive(*text_start_p, *key_start_p))
+          {
+          first_p = text_start_p;
+          break;
+          }
+        text_start_p ++;
+        }
+
+      if (!first_p)
+        {
+        //  Did not find the first character match.
+        return false;
+        }
+
+      //  For the remainder of the key, find a matching character in the text.
+      key_start_p ++;
+      text_start_p ++;
+      next_p = first_p;
+
+      while (key_start_p <= key_end_p)
+        {
+        //  Find the next character match.
+        next_p = nullptr;
+        while ((text_start_p <= text_end_p) && (*text_start_p != '\n') && (*text_start_p != '\r'))
+          {
+          if (!compare_insensitive(*text_start_p, *key_start_p))
+            {
+            next_p = text_start_p;
+            break;
+            }
+          text_start_p ++;
+          }
+
+        if ((*text_start_p == '\n') || (*text_start_p == '\r'))
+          {
+          //  Start over on next line.
+          next_p        = text_start_p;
+          first_p       = nullptr;
+          key_start_p   = str.m_str_ref_p->m_cstr_p;
+          instance ++;
+          break;
+          }
+
+        if (!next_p)
+          {
+          return false; //  Match not found.
+          }
+
+        key_start_p ++;
+        text_start_p ++;
+        }
+
+        //  Found a match.
+        instance --;
+        if (!instance)
+          {
+          //  The instance of the match.
+          if (find_start_p)
+            {
+            * find_start_p = (uint32_t) (first_p - m_str_ref_p->m_cstr_p);
+            }
+          if (find_end_p)
+            {
+            * find_end_p = (uint32_t) (next_p - m_str_ref_p->m_cstr_p + 1);
+            }
+          return true;
+          }
+
+        text_start_p  = next_p + 1;
+        first_p       = nullptr;
+        key_start_p   = str.m_str_ref_p->m_cstr_p;
+      } while (instance);
+    }
+
+  return false;   //  Not found.
+  } //  AString::find_fuzzy()
+
+
+//---------------------------------------------------------------------------------------
+//  Finds in reverse direction the instance of substring str starting from start_pos and ending at end_pos using a
+//              fuzzy search and if found stores the start and end position of the found text.
+// # Returns:   true if instance of str found, false if not
+// Arg          str - substring to find
+// Arg          instance - occurrence of substring to find.  It may not be less than 1.
+//              (Default 1)
+// Arg          find_start_p - address to store index of instance of the beginning of the substring if found.
+//              It is not modified if the substring is not found or if it is set to nullptr.
+//              (Default nullptr)
+// Arg          find_end_p - address to store index of instance of the end of the substring if found.
+//              It is not modified if the substring is not found or if it is set to nullptr.
+//              (Default nullptr)
+// Arg          start_pos - starting character index of search range (Default 0)
+// Arg          end_pos - ending character index of search range.  If end_pos is set to
+//              ALength_remainder, the entire length of the string (from the starting position)
+//              is searched (end_pos = length - start_pos).  (Default ALength_remainder)
+// Arg          case_check - if set to AStrCase_sensitive, case is important (q != Q), if set
+//              to AStrCase_ignore, case is not important (q == Q).  (Default AStrCase_sensitive)
+// # Examples:  AString source("abcde_abxxc");
+//              if (source.find_fuzzy_reverse("ac", 1))  // returns true, find_first_p returns 6, find_end_p return 10
+//                do_something();
+// # See:       find(bm), count(), get()
+// # Notes:     Matches do not cross line terminators.
+// # Author(s):  John Stenersen
+bool AString::find_fuzzy_reverse(
+  const AString & str,
+  uint32_t        instance,     //  = 1
+  uint32_t *      find_start_p, //  = nullptr
+  uint32_t *      find_end_p,   //  = nullptr
+  uint32_t        start_pos,    //  = 0
+  uint32_t        end_pos,      //  = ALength_remainder
+  eAStrCase       case_check    //  = AStrCase_sensitive
+  ) const
+  {
+  if (!str.m_str_ref_p->m_length || (str.m_str_ref_p->m_length > m_str_ref_p->m_length))
+    {
+    //  The key string is empty or longer than the text being searched.
+    return false;
+    }
+
+  if (end_pos == ALength_remainder)
+    {
+    end_pos = m_str_ref_p->m_length - 1;
+    }
+
+  #ifdef A_BOUNDS_CHECK
+    bounds_check(start_pos, end_pos, instance, "find_fuzzy");
+  #endif
+
+  const char * key_start_p  = str.m_str_ref_p->m_cstr_p;
+  const char * key_end_p    = key_start_p + str.m_str_ref_p->m_length - 1;
+  const char * text_start_p = & m_str_ref_p->m_cstr_p[start_pos];
+  const char * text_end_p   = & m_str_ref_p->m_cstr_p[end_pos - 1];
+  const char * last_p       = nullptr;
+  const char * prev_p       = nullptr;
+
+  if (case_check == AStrCase_sensitive)  // Case sensitive
+    {
+    do  // Each instance
+      {
+      //  Fnd the last character match.
+      while (text_start_p <= text_end_p)
+        {
+        if (*text_end_p == *key_end_p)
+          {
+          last_p = text_end_p;
+          break;
+          }
+        text_end_p --;
+        }
+
+      if (!last_p)
+        {
+        //  Did not find the last character match.
+        return false;
+        }
+
+      //  For the remainder of the key, find a matching character in the text.
+      key_end_p --;
+      text_end_p --;
+      prev_p = last_p;
+
+      while (key_start_p <= key_end_p)
+        {
+        //  Find the prev character match.
+        prev_p = nullptr;
+        while ((text_start_p <= text_end_p) && (*text_end_p != '\n') && (*text_end_p != '\r'))
+          {
+          if (*text_end_p == *key_end_p)
+            {
+            prev_p = text_end_p;
+            break;
+            }
+          text_end_p --;
+          }
+
+        if ((*text_end_p == '\n') || (*text_end_p == '\r'))
+          {
+          //  Start over on next line.
+          prev_p    = text_end_p;
+          last_p    = nullptr;
+          key_end_p = key_start_p + str.m_str_ref_p->m_length - 1;
+          instance ++;
+          break;
+          }
+
+        if (!prev_p)
+          {
+          return false; //  Match not found.
+          }
+
+        key_end_p --;
+        text_end_p --;
+        }
+
+        //  Found a match.
+        instance --;
+        if (!instance)
+          {
+          //  The instance of the match.
+          if (find_start_p)
+            {
+            * find_start_p = (uint32_t) (prev_p - m_str_ref_p->m_cstr_p);
+            }
+          if (find_end_p)
+            {
+            * find_end_p = (uint32_t) (last_p - m_str_ref_p->m_cstr_p + 1);
+            }
+          return true;
+          }
+
+        text_end_p  = prev_p - 1;
+        last_p      = nullptr;
+        key_end_p   = key_start_p + str.m_str_ref_p->m_length - 1;
+      } while (instance);
+    }
+  else  // Ignore case
+    {
+    do  // Each instance
+      {
+      //  Fnd the last character match.
+      while (text_start_p <= text_end_p)
+        {
+        if (!compare_insensitive(*text_end_p, *key_end_p))
+          {
+          last_p = text_end_p;
+          break;
+          }
+        text_end_p --;
+        }
+
+      if (!last_p)
+        {
+        //  Did not find the last character match.
+        return false;
+        }
+
+      //  For the remainder of the key, find a matching character in the text.
+      key_end_p --;
+      text_end_p --;
+      prev_p = last_p;
+
+      while (key_start_p <= key_end_p)
+        {
+        //  Find the prev character match.
+        prev_p = nullptr;
+        while ((text_start_p <= text_end_p) && (*text_end_p != '\n') && (*text_end_p != '\r'))
+          {
+          if (!compare_insensitive(*text_end_p, *key_end_p))
+            {
+            prev_p = text_end_p;
+            break;
+            }
+          text_end_p --;
+          }
+
+        if ((*text_end_p == '\n') || (*text_end_p == '\r'))
+          {
+          //  Start over on next line.
+          prev_p    = text_end_p;
+          last_p    = nullptr;
+          key_end_p = key_start_p + str.m_str_ref_p->m_length - 1;
+          instance ++;
+          break;
+          }
+
+        if (!prev_p)
+          {
+          return false; //  Match not found.
+          }
+
+        key_end_p --;
+        text_end_p --;
+        }
+
+        //  Found a match.
+        instance --;
+        if (!instance)
+          {
+          //  The instance of the match.
+          if (find_start_p)
+            {
+            * find_start_p = (uint32_t) (prev_p - m_str_ref_p->m_cstr_p);
+            }
+          if (find_end_p)
+            {
+            * find_end_p = (uint32_t) (last_p - m_str_ref_p->m_cstr_p + 1);
+            }
+          return true;
+          }
+
+        text_end_p  = prev_p - 1;
+        last_p      = nullptr;
+        key_end_p   = key_start_p + str.m_str_ref_p->m_length - 1;
+      } while (instance);
+    }
+
+  return false;   //  Not found.
+  } //  AString::find_fuzzy_reverse()
+
+
+//---------------------------------------------------------------------------------------
+// Determine column that starts indent - i.e. first character from `start_pos` that is
+// non-space (not ` ` or `\t`). Takes into account tab stops and adjusts column if any
+// tab `\t` characters encountered.
+// 
+// # Returns: 0-based row/line number
+// # Params:
+//   tab_stops:    tab stop count in spaces
+//   indent_idx_p: address to store 0-based index position. Ignored if nullptr.
+//   start_pos:    starting index to begin
+//   end_pos:      ending index to stop
+//
+// # See:
+//   index_to_row(), row_to_index(), line_indent(), line_unindent(), advance_to_indent()
+//   
+// # Author(s): Conan Reis
+uint AString::find_indent_column(
+  uint   tab_stops,    // = AString_tab_stop_def
+  uint * indent_idx_p, // = nullptr
+  uint   start_pos,    // = 0u
+  uint   end_pos       // = ALength_remainder
+  ) const
+  {
+  //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+  // Setup
+  AStringRef * str_ref_p = m_str_ref_p;
+  uint         length    = str_ref_p->m_length;
+
+  if (length == 0u)
+    {
+    if (indent_idx_p)
+      {
+      *indent_idx_p = 0u;
+      }
+
+    return 0u;
+    }
+
+  if (end_pos == ALength_remainder)
+    {
+    end_pos = length - 1u;
+    }
+
+  #ifdef A_BOUNDS_CHECK
+    bounds_check(start_pos, end_pos, "indent");
+  #endif
+
+  //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+  uint         column   = 0u;
+  char *       buffer_p = str_ref_p->m_cstr_p;
+  const char * indent_p =
+    advance_to_indent(buffer_p + start_pos, buffer_p + end_pos, tab_stops, &column);
+
+  if (indent_idx_p)
+    {
+    *indent_idx_p = uint(indent_p - buffer_p);
+    }
+
+  return column;
+  }
+
+//---------------------------------------------------------------------------------------
+//  Finds instance of specified character in reverse starting from end_pos
+//              and ending at start_pos and if found stores the index position found.
+// # Returns:   true if instance character found, false if not
+// Arg          ch - character to find
+// Arg          instance - occurrence of character to find.  It may not be less than 1.
+//              (Default 1)
+// Arg          find_pos_p - address to store index of instance character if found.
+//              It is not modified if the character is not found or if it is set to nullptr.
+//              (Default nullptr)
+// Arg          start_pos - ending position of search range (Default 0)
+// Arg          end_pos - starting position of search range.  If end_pos is set to
+//              ALength_remainder, the entire length of the string (from the starting position)
+//              is searched (end_pos = length - start_pos).  (Default ALength_remainder)
+// # Examples:  if (str.find_reverse('_', 2))  // if 2nd to last underscore is found
+//                do_something();
+// # See:       count(), get()
+// # Notes:     This character find method is faster than the find_reverse() method
+//              searching for a single character string.
+// # Author(s):  Conan Reis
+bool AString::find_reverse(
+  char       ch,
+  uint32_t   instance,   // = 1
+  uint32_t * find_pos_p, // = nullptr
+  uint32_t   start_pos,  // = 0
+  uint32_t   end_pos     // = ALength_remainder
+  ) const
+  {
+  if (m_str_ref_p->m_length)  // if not empty
+    {
+    if (end_pos == ALength_remainder)
+      {
+      end_pos = m_str_ref_p->m_length - 1;
+      }
+
+    #ifdef A_BOUNDS_CHECK
+      bounds_check(start_pos, end_pos, instance, "find_reverse");
+    #endif
+
+    const char * cstr_p     = m_str_ref_p->m_cstr_p + start_pos;
+    const char * cstr_end_p = m_str_ref_p->m_cstr_p + end_pos;
+
+    while ((cstr_end_p = a_find_char_reverse(cstr_p, cstr_end_p, ch)) != nullptr)  // Found one
+      {
+      if (instance == 1u)  // Found it!
+        {
+        if (find_pos_p)
+          {
+          *find_pos_p = uint32_t(cstr_end_p - m_str_ref_p->m_cstr_p);
+          }
+
+        return true;
+        }
+
+      instance--;
+      cstr_end_p--;
+      }
+    }
+
+  return false;
+  }
+
+//---------------------------------------------------------------------------------------
+//  Finds instance of specified type of character in reverse starting from
+//              end_pos and ending at start_pos and if found stores the index position found.
+// # Returns:   true if instance character type found, false if not
+// Arg          match_type - classification of characters to match.
+// Arg          instance - occurrence of character type to find.  It may not be less than 1.
+//              (Default 1)
+// Arg          find_pos_p - address to store index of instance character type if found.
+//              It is not modified if the character type is not found or if it is set to nullptr.
+//              (Default nullptr)
+// Arg          start_pos - ending position of search range (Default 0)
+// Arg          end_pos - starting position of search range.  If end_pos is set to
+//              ALength_remainder, the entire length of the string (from the starting position)
+//              is searched (end_pos = length - start_pos).  (Default ALength_remainder)
+// # Examples:  if (str.find_reverse(ACharMatch_lowercase, 2))  // if 2nd to last lowercase letter is found
+//                do_something();
+// # See:       count(), get()
+// # Author(s):  Conan Reis
+bool AString::find_reverse(
+  eACharMatch match_type,
+  uint32_t    instance,   // = 1
+  uint32_t *  find_pos_p, // = nullptr
+  uint32_t    start_pos,  // = 0
+  uint32_t    end_pos     // = ALength_remainder
+  ) const
+  {
+  if (m_str_ref_p->m_length)  // if not empty
+    {
+    if (end_pos == ALength_remainder)
+      {
+      end_pos = m_str_ref_p->m_length - 1;
+      }
+
+    #ifdef A_BOUNDS_CHECK
+      bounds_check(start_pos, end_pos, instance, "find_reverse");
+    #endif
+
+    uint8_t * cstr_p        = reinterpret_cast<uint8_t *>(m_str_ref_p->m_cstr_p + start_pos);
+    uint8_t * cstr_end_p    = reinterpret_cast<uint8_t *>(m_str_ref_p->m_cstr_p + end_pos);
+    bool *    match_table_p = ms_char_match_table[match_type];
+
+    while (cstr_p <= cstr_end_p)
+      {
+      if (match_table_p[*cstr_end_p ])  // Found one
+        {
+        if (instance == 1u)             // Found it!
+          {
+          if (find_pos_p)
+            {
+            *find_pos_p = uint32_t(cstr_end_p - reinterpret_cast<uint8_t *>(m_str_ref_p->m_cstr_p));
+            }
+
+          return true;
+          }
+
+        instance--;
+        }
+
+      cstr_end_p--;
+      }
+    }
+
+  return false;
+  }
+
+//---------------------------------------------------------------------------------------
+// Substring reverse search.
+// 
+// Returns: `true` if instance of str found, `false` if not
+// 
+// Params:
+//   str: substring to find
+//   instance: occurrence of substring to find.  It may not be less than 1.
+//   find_pos_p:
+//     Address to store index of instance substring if found.
+//     It is not modified if the substring is not found or if it is set to nullptr.
+//   start_pos: starting character index of search range.
+//   end_pos:
+//     Ending character index of search range.  If `end_pos` is set to `ALength_remainder`,
+//     the entire length of the string (from the starting position) is searched (`end_pos
+//     = length - 1u`).
+//   case_check:
+//     If set to `AStrCase_sensitive`, case is important (q != Q), if set to
+//     `AStrCase_ignore`, case is not important (q == Q).
+//     
+// See:
+//   find_reverse(ch), find_reverse(match_type),
+//   find(str), find(bm), find(ch), find(match_type)
+bool AString::find_reverse(
+  const AString & str,
+  uint32_t        instance,    // = 1
+  uint32_t *      find_pos_p,  // = nullptr
+  uint32_t        start_pos,   // = 0
+  uint32_t        end_pos,     // = ALength_remainder
+  eAStrCase       case_check   // = AStrCase_sensitive
+  ) const
+  {
+  uint32_t length     = m_str_ref_p->m_length;
+  uint32_t str_length = str.m_str_ref_p->m_length;
+
+  if ((length == 0u) || (str_length == 0u) || (length < str_length))
+    {
+    return false;
+    }
+
+  if (end_pos == ALength_remainder)
+    {
+    end_pos = length;
+    }
+
+  #ifdef A_BOUNDS_CHECK
+    bounds_check(start_pos, end_pos, instance, "find_reverse");
+  #endif
+
+  char * match_p;
+  char * find_p;
+  char * cstr_p       = m_str_ref_p->m_cstr_p + start_pos;
+  char * cstr_end_p   = m_str_ref_p->m_cstr_p + end_pos - str_length + 1u;  // won't match if less than str left
+  char * find_start_p = str.m_str_ref_p->m_cstr_p;
+  char * find_end_p   = find_start_p + str_length;
+
+  if (case_check == AStrCase_sensitive)  // Case sensitive
+    {
+    do
+      {
+      cstr_end_p--;
+      match_p = cstr_end_p;
+      find_p  = find_start_p;
+
+      while ((find_p < find_end_p) && (*match_p == *find_p))
+        {
+        find_p++;
+        match_p++;
+        }
+
+      if (find_p == find_end_p)  // Found one
+        {
+        if (instance == 1u)      // Found it!
+          {
+          if (find_pos_p)
+            {
+            *find_pos_p = uint32_t(cstr_end_p - m_str_ref_p->m_cstr_p);
+            }
+
+          return true;
+          }
+
+        instance--;
+        }
+      }
+    while (cstr_p < cstr_end_p);
+    }
+  else  // Ignore case
+    {
+    do
+      {
+      cstr_end_p--;
+      match_p = cstr_end_p;
+      find_p  = find_start_p;
+
+      while (!compare_insensitive(*match_p, *find_p) && (find_p < find_end_p))  //  Note: Okay to check end condition (find_p < find_end_p) second because if >= it will point to null terminator i.e. still valid memory in first part of condition.
+        {
+        find_p++;
+        match_p++;
+        }
+
+      if (find_p == find_end_p)  // Found one
+        {
+        if (instance == 1u)      // Found it!
+          {
+          if (find_pos_p)
+            {
+            *find_pos_p = uint32_t(cstr_end_p - m_str_ref_p->m_cstr_p);
+            }
 
-        //  Found a match.
-        instance --;
-        if (!instance)
-          {
-          //  The instance of the match.
-          if (find_start_p)
-            {
-            * find_start_p = (uint32_t) (first_p - m_str_ref_p->m_cstr_p);
-            }
-          if (find_end_p)
-            {
-            * find_end_p = (uint32_t) (next_p - m_str_ref_p->m_cstr_p + 1);
-            }
           return true;
           }
 
-        text_start_p  = next_p + 1;
-        first_p       = nullptr;
-        key_start_p   = str.m_str_ref_p->m_cstr_p;
-      } while (instance);
+        instance--;
+        }
+      }
+    while (cstr_p < cstr_end_p);
+    }
+
+  return false;
+  }
+
+
+//---------------------------------------------------------------------------------------
+//  substring retrieval method
+// # Author(s):  Conan Reis
+void AString::get(
+  AString * str_p,
+  uint32_t  pos,       // = 0u
+  uint32_t  char_count // = ALength_remainder
+  ) const
+  {
+  if (char_count == ALength_remainder)
+    {
+    char_count = m_str_ref_p->m_length - pos;
+    }
+
+  str_p->ensure_size_empty(char_count);
+
+  if (char_count)
+    {
+    #ifdef A_BOUNDS_CHECK
+      span_check(pos, char_count, "get");
+    #endif
+
+    memcpy(str_p->m_str_ref_p->m_cstr_p, m_str_ref_p->m_cstr_p + pos, size_t(char_count));
+    str_p->m_str_ref_p->m_cstr_p[char_count] = '\0';
+    str_p->m_str_ref_p->m_length             = char_count;
     }
+  }
 
-  return false;   //  Not found.
-  } //  AString::find_fuzzy()
+//---------------------------------------------------------------------------------------
+//  substring retrieval method
+// # Author(s):  Conan Reis
+AString AString::get(
+  uint32_t pos,       // = 0u
+  uint32_t char_count // = ALength_remainder
+  ) const
+  {
+  if (char_count == ALength_remainder)
+    {
+    char_count = m_str_ref_p->m_length - pos;
+    }
+
+  AString result(nullptr, uint32_t(char_count + 1u), uint32_t(0u));
+
+  if (char_count)
+    {
+    #ifdef A_BOUNDS_CHECK
+      span_check(pos, char_count, "get");
+    #endif
+
+    memcpy(result.m_str_ref_p->m_cstr_p, m_str_ref_p->m_cstr_p + pos, size_t(char_count));
+    result.m_str_ref_p->m_cstr_p[char_count] = '\0';
+    result.m_str_ref_p->m_length             = char_count;
+    }
 
+  return result;
+  }
 
 //---------------------------------------------------------------------------------------
-//  Finds in reverse direction the instance of substring str starting from start_pos and ending at end_pos using a
-//              fuzzy search and if found stores the start and end position of the found text.
-// # Returns:   true if instance of str found, false if not
-// Arg          str - substring to find
-// Arg          instance - occurrence of substring to find.  It may not be less than 1.
-//              (Default 1)
-// Arg          find_start_p - address to store index of instance of the beginning of the substring if found.
-//              It is not modified if the substring is not found or if it is set to nullptr.
-//              (Default nullptr)
-// Arg          find_end_p - address to store index of instance of the end of the substring if found.
-//              It is not modified if the substring is not found or if it is set to nullptr.
-//              (Default nullptr)
-// Arg          start_pos - starting character index of search range (Default 0)
-// Arg          end_pos - ending character index of search range.  If end_pos is set to
-//              ALength_remainder, the entire length of the string (from the starting position)
-//              is searched (end_pos = length - start_pos).  (Default ALength_remainder)
-// Arg          case_check - if set to AStrCase_sensitive, case is important (q != Q), if set
-//              to AStrCase_ignore, case is not important (q == Q).  (Default AStrCase_sensitive)
-// # Examples:  AString source("abcde_abxxc");
-//              if (source.find_fuzzy_reverse("ac", 1))  // returns true, find_first_p returns 6, find_end_p return 10
-//                do_something();
-// # See:       find(bm), count(), get()
-// # Notes:     Matches do not cross line terminators.
-// # Author(s):  John Stenersen
-bool AString::find_fuzzy_reverse(
-  const AString & str,
-  uint32_t        instance,     //  = 1
-  uint32_t *      find_start_p, //  = nullptr
-  uint32_t *      find_end_p,   //  = nullptr
-  uint32_t        start_pos,    //  = 0
-  uint32_t        end_pos,      //  = ALength_remainder
-  eAStrCase       case_check    //  = AStrCase_sensitive
+//  Dynamic substring retrieval
+// # Author(s):  Conan Reis
+AString * AString::get_new(
+  uint32_t pos,       // = 0u
+  uint32_t char_count // = ALength_remainder
   ) const
   {
-  if (!str.m_str_ref_p->m_length || (str.m_str_ref_p->m_length > m_str_ref_p->m_length))
+  AString * str_p;
+  
+  if (char_count == ALength_remainder)
     {
-    //  The key string is empty or longer than the text being searched.
-    return false;
+    char_count = m_str_ref_p->m_length - pos;
+    }
+
+  #ifdef A_BOUNDS_CHECK
+    if (char_count)
+      {
+      span_check(pos, char_count, "get_new");
+      }
+  #endif
+
+  str_p = new AString(m_str_ref_p->m_cstr_p + pos, char_count);
+
+  A_VERIFY_MEMORY(str_p != nullptr, AString);
+
+  return str_p;
+  }
+
+//---------------------------------------------------------------------------------------
+//  Substring at index position in between tokens in current string
+//              looking from start_pos to end_pos.
+//              Separators that are adjacent to one another count as an empty string.
+// # Returns:   Substring at index position in between tokens
+// Arg          index - index position of substring to return (zero indexed)
+// Arg          token - substring to separate on
+// Arg          find_pos_p - pointer to store index position in current string
+//              where returned substring is found.  Not set if nullptr
+// Arg          start_pos - index position in current string to begin looking
+// Arg          end_pos - index position in current string to stop looking
+//              (ALength_remainder = current length of string)
+// Arg          case_check - whether or not the token should be case sensitive or not
+// # Notes:     If the index given is out of range or if the specified index is
+//              between two separators, an empty string is returned.
+//              If the index is out of range, the value find_pos_p points to is
+//              not changed.
+// # Examples:  AString str("one, two, three, four");
+//              AString third(str.get_token(2, ", "));  // = "three"
+// # Author(s):  Conan Reis
+AString AString::get_token(
+  uint32_t          index,
+  const AStringBM & token,
+  uint32_t *        find_pos_p, // = nullptr
+  uint32_t          start_pos,  // = 0
+  uint32_t          end_pos     // = ALength_remainder
+  ) const
+  {
+  if (m_str_ref_p->m_length)  // if not empty
+    {
+    if (end_pos == ALength_remainder)
+      {
+      end_pos = m_str_ref_p->m_length - 1;
+      }
+
+    // Get starting position
+    if (index)
+      {
+      #ifdef A_BOUNDS_CHECK
+        bool found = find(token, index, &start_pos, start_pos, end_pos);
+
+        A_VERIFY(found, "::get_token() - index out of range", AErrId_invalid_index, AString);
+      #endif
+
+      start_pos += token.m_str_ref_p->m_length;
+      }
+
+    // Get ending position
+    if (!find(token, 1u, &end_pos, start_pos, end_pos))
+      {
+      end_pos++;
+      }
+    }
+  else
+    {
+    #ifdef A_BOUNDS_CHECK
+      A_VERIFY(index == 0u, "::get_token() - index out of range", AErrId_invalid_index, AString);
+    #endif
+
+    end_pos = 0u;
+    }
+
+  if (find_pos_p)
+    {
+    *find_pos_p = start_pos;
+    }
+
+  return AString(m_str_ref_p->m_cstr_p + start_pos, end_pos - start_pos);
+  }
+
+//---------------------------------------------------------------------------------------
+//  Splits current string from start_pos to end_pos into new dynamic
+//              substrings with separator as the substring to split on.
+// Arg          collect_p - array to accumulate (i.e. append) the dynamically allocated
+//              substrings to.  Any previous AString objects will remain in collected_p,
+//              they are just added to.
+//              *** Remember to free the substrings after they are finished being used.
+// Arg          separator - 
+// Arg          start_pos - character index position to begin tokenization (Default 0)
+// Arg          end_pos - character index position to end tokenization.  If end_pos is
+//              ALength_remainder, then end_pos is set to the last character positon.
+//              (Default ALength_remainder)
+// Arg          case_check - Indicates whether the search for the separator substring
+//              should be case sensitive (AStrCase_sensitive) or case insensitive (AStrCase_ignore).
+//              (Default AStrCase_sensitive)
+// # See:       get_token(), AString(APArrayLogical<AString>, separator)
+// # Notes:     Seperators that are adjacent to one another count as an empty string.
+// # Author(s):  Conan Reis
+void AString::tokenize(
+  APArrayLogical<AString> * collect_p,
+  const AString &           separator, // = AString(',')
+  uint32_t                  start_pos, // = 0
+  uint32_t                  end_pos,   // = ALength_remainder
+  eAStrCase                 case_check // = AStrCase_sensitive
+  ) const
+  {
+  uint32_t pos;
+
+  if (m_str_ref_p->m_length)  // if not empty
+    {
+    if (end_pos == ALength_remainder)
+      {
+      end_pos = m_str_ref_p->m_length - 1;
+      }
+
+    #ifdef A_BOUNDS_CHECK
+      bounds_check(start_pos, end_pos, "tokenize");
+    #endif
+
+    uint32_t length = separator.m_str_ref_p->m_length;
+
+    while ((start_pos <= end_pos) && (find(separator, 1u, &pos, start_pos, end_pos, case_check)))
+      {
+      collect_p->append(*get_new(start_pos, pos - start_pos));
+      start_pos = pos + length;
+      }
+
+    collect_p->append(*get_new(start_pos, end_pos - start_pos + 1));
     }
+  }
+
+//---------------------------------------------------------------------------------------
+//  Splits current string from start_pos to end_pos into new dynamic
+//              substrings with separator as the substring to split on.
+// Arg          collect_p - array to accumulate (i.e. append) the dynamically allocated
+//              substrings to.  Any previous AString objects will remain in collected_p,
+//              they are just added to.
+//              *** Remember to free the substrings after they are finished being used.
+// Arg          separator - 
+// Arg          start_pos - character index position to begin tokenization (Default 0)
+// Arg          end_pos - character index position to end tokenization.  If end_pos is
+//              ALength_remainder, then end_pos is set to the last character positon.
+//              (Default ALength_remainder)
+// Arg          case_check - Indicates whether the search for the separator substring
+//              should be case sensitive (AStrCase_sensitive) or case insensitive (AStrCase_ignore).
+//              (Default AStrCase_sensitive)
+// # See:       get_token(), AString(APArrayLogical<AString>, separator)
+// # Notes:     Separators that are adjacent to one another count as an empty string.
+// # Author(s):  Conan Reis
+void AString::tokenize(
+  APArrayLogical<AString> * collect_p, 
+  const AStringBM &         separator,
+  uint32_t                  start_pos, // = 0
+  uint32_t                  end_pos    // = ALength_remainder
+  ) const
+  {
+  uint32_t pos;
 
-  if (end_pos == ALength_remainder)
+  if (m_str_ref_p->m_length)  // if not empty
     {
-    end_pos = m_str_ref_p->m_length - 1;
-    }
+    if (end_pos == ALength_remainder)
+      {
+      end_pos = m_str_ref_p->m_length - 1;
+      }
 
-  #ifdef A_BOUNDS_CHECK
-    bounds_check(start_pos, end_pos, instance, "find_fuzzy");
-  #endif
+    #ifdef A_BOUNDS_CHECK
+      bounds_check(start_pos, end_pos, "tokenize");
+    #endif
 
-  const char * key_start_p  = str.m_str_ref_p->m_cstr_p;
-  const char * key_end_p    = key_start_p + str.m_str_ref_p->m_length - 1;
-  const char * text_start_p = & m_str_ref_p->m_cstr_p[start_pos];
-  const char * text_end_p   = & m_str_ref_p->m_cstr_p[end_pos - 1];
-  const char * last_p       = nullptr;
-  const char * prev_p       = nullptr;
+    uint32_t length = separator.get_length();
 
-  if (case_check == AStrCase_sensitive)  // Case sensitive
-    {
-    do  // Each instance
+    while ((start_pos <= end_pos) && (find(separator, 1u, &pos, start_pos, end_pos)))
       {
-      //  Fnd the last character match.
-      while (text_start_p <= text_end_p)
-        {
-        if (*text_end_p == *key_end_p)
-          {
-          last_p = text_end_p;
-          break;
-          }
-        text_end_p --;
-        }
-
-      if (!last_p)
-        {
-        //  Did not find the last character match.
-        return false;
-        }
+      collect_p->append(*get_new(start_pos, pos - start_pos));
+      start_pos = pos + length;
+      }
 
-      //  For the remainder of the key, find a matching character in the text.
-      key_end_p --;
-      text_end_p --;
-      prev_p = last_p;
+    collect_p->append(*get_new(start_pos, end_pos - start_pos + 1));
+    }
+  }
 
-      while (key_start_p <= key_end_p)
-        {
-        //  Find the prev character match.
-        prev_p = nullptr;
-        while ((text_start_p <= text_end_p) && (*text_end_p != '\n') && (*text_end_p != '\r'))
-          {
-          if (*text_end_p == *key_end_p)
-            {
-            prev_p = text_end_p;
-            break;
-            }
-          text_end_p --;
-          }
 
-        if ((*text_end_p == '\n') || (*text_end_p == '\r'))
-          {
-          //  Start over on next line.
-          prev_p    = text_end_p;
-          last_p    = nullptr;
-          key_end_p = key_start_p + str.m_str_ref_p->m_length - 1;
-          instance ++;
-          break;
-          }
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// Internal Methods
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
 
-        if (!prev_p)
-          {
-          return false; //  Match not found.
-          }
+//---------------------------------------------------------------------------------------
+//  Makes the string writable and have a unique reference.
+// # Examples:  called by ensure_writable()
+// # Notes:     Maintains data integrity.
+// # Author(s):  Conan Reis
+void AString::make_writable()
+  {
+  AStringRef * str_ref_p = m_str_ref_p;
+  uint32_t     length    = str_ref_p->m_length;
 
-        key_end_p --;
-        text_end_p --;
-        }
+  // Null terminator added by hand rather than copied to ensure that it exists.
+  m_str_ref_p = str_ref_p->reuse_or_new_buffer(length, str_ref_p->m_cstr_p, length);
+  }
 
-        //  Found a match.
-        instance --;
-        if (!instance)
-          {
-          //  The instance of the match.
-          if (find_start_p)
-            {
-            * find_start_p = (uint32_t) (prev_p - m_str_ref_p->m_cstr_p);
-            }
-          if (find_end_p)
-            {
-            * find_end_p = (uint32_t) (last_p - m_str_ref_p->m_cstr_p + 1);
-            }
-          return true;
-          }
+//---------------------------------------------------------------------------------------
+//  Makes C-String buffer large enough, writable, and unique (not shared)
+//              - copying the data already present in the string.
+// Arg          needed_chars - amount of characters that need to be stored not including
+//              the null terminating character
+// # Examples:  Called by ensure_size()
+// # See:       set_size_buffer(), ensure_size(), ensure_size_empty(),
+//              ensure_size_buffer(), set_length()
+// # Author(s):  Conan Reis
+void AString::set_size(uint32_t needed_chars)  
+  {
+  AStringRef * str_ref_p = m_str_ref_p;
 
-        text_end_p  = prev_p - 1;
-        last_p      = nullptr;
-        key_end_p   = key_start_p + str.m_str_ref_p->m_length - 1;
-      } while (instance);
-    }
-  else  // Ignore case
-    {
-    do  // Each instance
-      {
-      //  Fnd the last character match.
-      while (text_start_p <= text_end_p)
-        {
-        if (!compare_insensitive(*text_end_p, *key_end_p))
-          {
-          last_p = text_end_p;
-          break;
-          }
-        text_end_p --;
-        }
+  // Copy previous contents - truncated to new capacity if needed
+  m_str_ref_p = str_ref_p->reuse_or_new_buffer(needed_chars, str_ref_p->m_cstr_p, str_ref_p->m_length);
+  }
 
-      if (!last_p)
-        {
-        //  Did not find the last character match.
-        return false;
-        }
 
-      //  For the remainder of the key, find a matching character in the text.
-      key_end_p --;
-      text_end_p --;
-      prev_p = last_p;
+#ifdef A_BOUNDS_CHECK
 
-      while (key_start_p <= key_end_p)
-        {
-        //  Find the prev character match.
-        prev_p = nullptr;
-        while ((text_start_p <= text_end_p) && (*text_end_p != '\n') && (*text_end_p != '\r'))
-          {
-          if (!compare_insensitive(*text_end_p, *key_end_p))
-            {
-            prev_p = text_end_p;
-            break;
-            }
-          text_end_p --;
-          }
+// $Revisit - CReis These methods should be changed to macros so that they are faster in debug mode and so that they use the __FUNCSIG__ macro
 
-        if ((*text_end_p == '\n') || (*text_end_p == '\r'))
-          {
-          //  Start over on next line.
-          prev_p    = text_end_p;
-          last_p    = nullptr;
-          key_end_p = key_start_p + str.m_str_ref_p->m_length - 1;
-          instance ++;
-          break;
-          }
+//---------------------------------------------------------------------------------------
+// # Author(s):  Conan Reis
+void AString::bounds_check(
+  uint32_t     pos,
+  const char * func_name_p
+  ) const
+  {
+  A_VERIFY(
+    pos <= m_str_ref_p->m_length,
+    a_cstr_format("AString::%s() - invalid index\nGiven %u but length only %u, AString:\n%s",
+      func_name_p, pos, m_str_ref_p->m_length, m_str_ref_p->m_cstr_p),
+    AErrId_invalid_index,
+    AString);
+  }
 
-        if (!prev_p)
-          {
-          return false; //  Match not found.
-          }
+//---------------------------------------------------------------------------------------
+// # Author(s):  Conan Reis
+void AString::bounds_check(
+  uint32_t     start_pos,
+  uint32_t     end_pos,
+  const char * func_name_p
+  ) const
+  {
+  A_VERIFY(
+    ((start_pos < m_str_ref_p->m_length) && (end_pos < m_str_ref_p->m_length) && (start_pos <= end_pos)),
+    a_cstr_format("AString::%s(start_pos %u, end_pos %u) - invalid index(es)\nLength is %u, AString:\n%s",
+      func_name_p, start_pos, end_pos, m_str_ref_p->m_length, m_str_ref_p->m_cstr_p),
+    AErrId_invalid_index_range,
+    AString);
+  }
 
-        key_end_p --;
-        text_end_p --;
-        }
+//---------------------------------------------------------------------------------------
+// # Author(s):  Conan Reis
+void AString::bounds_check(
+  uint32_t     start_pos,
+  uint32_t     end_pos,
+  uint32_t     instance,
+  const char * func_name_p
+  ) const
+  {
+  A_VERIFY(
+    ((start_pos < m_str_ref_p->m_length) && (end_pos <= m_str_ref_p->m_length) && (start_pos <= end_pos) && (instance != 0u)),
+    a_cstr_format("AString::%s(start_pos %u, end_pos %u, instance %u) - invalid index(es)\nLength is %u, AString:\n%s",
+      func_name_p, start_pos, end_pos, instance, m_str_ref_p->m_length, m_str_ref_p->m_cstr_p),
+    AErrId_invalid_index_range,
+    AString);
+  }
 
-        //  Found a match.
-        instance --;
-        if (!instance)
-          {
-          //  The instance of the match.
-          if (find_start_p)
-            {
-            * find_start_p = (uint32_t) (prev_p - m_str_ref_p->m_cstr_p);
-            }
-          if (find_end_p)
-            {
-            * find_end_p = (uint32_t) (last_p - m_str_ref_p->m_cstr_p + 1);
-            }
-          return true;
-          }
+//---------------------------------------------------------------------------------------
+// # Author(s):  Conan Reis
+void AString::span_check(
+  uint32_t     pos,
+  uint32_t     char_count,
+  const char * func_name_p
+  ) const
+  {
+  A_VERIFY(
+    (pos + char_count) <= m_str_ref_p->m_length,
+    a_cstr_format("AString::%s(pos %u, char_count %u) - invalid index(es)\nLength is %u, AString:\n%s",
+      func_name_p, pos, char_count, m_str_ref_p->m_length, m_str_ref_p->m_cstr_p),
+    AErrId_invalid_index_span,
+    AString);
+  }
 
-        text_end_p  = prev_p - 1;
-        last_p      = nullptr;
-        key_end_p   = key_start_p + str.m_str_ref_p->m_length - 1;
-      } while (instance);
-    }
+#endif  // A_BOUNDS_CHECK
 
-  return false;   //  Not found.
-  } //  AString::find_fuzzy_reverse()
 
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// Class Internal Methods
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
 
 //---------------------------------------------------------------------------------------
-// Determine column that starts indent - i.e. first character from `start_pos` that is
-// non-space (not ` ` or `\t`). Takes into account tab stops and adjusts column if any
-// tab `\t` characters encountered.
+// Initializes the character matching / classification table.
 // 
-// # Returns: 0-based row/line number
-// # Params:
-//   tab_stops:    tab stop count in spaces
-//   indent_idx_p: address to store 0-based index position. Ignored if nullptr.
-//   start_pos:    starting index to begin
-//   end_pos:      ending index to stop
+// Only uses ASCII so as not to be dependent on ANSI Code Pages, etc.
+// Probably should be replaced with more comprehensive Unicode UTF-8 mechanism - though
+// should work with ASCII subset of UTF-8
+// 
+// # Notes
+//   Use the 2 dimensional table ms_char_match_table instead of the standard character
+//   classification functions like isalpha(), isspace(), etc.
 //
-// # See:
-//   index_to_row(), row_to_index(), line_indent(), line_unindent(), advance_to_indent()
-//   
+//   ms_char_match_table[ACharMatch_white_space][ch] is the same as isspace(ch)
+//
+//   Always convert characters to unsigned if they are greater than 127. For example, use
+//   ms_char_match_table[ACharMatch_alphabetic][uint8_t(ch)] rather than
+//   ms_char_match_table[ACharMatch_alphabetic][ch].
+//
+//   If the same character classification test is to be used repeatedly, a temporary
+//   variable can be made to remove one level of indirection and use it as a one
+//   dimensional array.  For example:
+//   ```
+//   bool * is_digit_p = ms_char_match_table[ACharMatch_digit];
+//   for (...)
+//     {
+//     ...
+//     if (is_digit_p[ch])
+//     ...
+//     }
+//   ```  
+//                
+// # Examples:  Called at system start-up.
+// # See:       not_char_type()
 // # Author(s): Conan Reis
-uint AString::find_indent_column(
-  uint   tab_stops,    // = AString_tab_stop_def
-  uint * indent_idx_p, // = nullptr
-  uint   start_pos,    // = 0u
-  uint   end_pos       // = ALength_remainder
-  ) const
+void AString::init_match_table()
   {
-  //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
-  // Setup
-  AStringRef * str_ref_p = m_str_ref_p;
-  uint         length    = str_ref_p->m_length;
+  const size_t bool_bytes = sizeof(bool);
 
-  if (length == 0u)
-    {
-    if (indent_idx_p)
-      {
-      *indent_idx_p = 0u;
-      }
+  // #################### Affirmative Classifications ####################
 
-    return 0u;
-    }
+  // Most of the classification tests return false
+  memset(ms_char_match_table, false, bool_bytes * ACharMatch__not_start * AString_ansi_charset_length);
 
-  if (end_pos == ALength_remainder)
-    {
-    end_pos = length - 1u;
-    }
+  // Set alphabetic ACharMatch_alphabetic
+  memset(&ms_char_match_table[ACharMatch_alphabetic]['A'], true, bool_bytes * ('Z' - 'A' + 1));
+  memset(&ms_char_match_table[ACharMatch_alphabetic]['a'], true, bool_bytes * ('z' - 'a' + 1));
 
-  #ifdef A_BOUNDS_CHECK
-    bounds_check(start_pos, end_pos, "indent");
-  #endif
+  // Set alphanumeric ACharMatch_alphanumeric
+  memcpy(ms_char_match_table[ACharMatch_alphanumeric], ms_char_match_table[ACharMatch_alphabetic], bool_bytes * AString_ansi_charset_length);  // Alphabetic
+  memset(&ms_char_match_table[ACharMatch_alphanumeric]['0'], true, bool_bytes * ('9'- '0' + 1));
 
-  //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
-  uint         column   = 0u;
-  char *       buffer_p = str_ref_p->m_cstr_p;
-  const char * indent_p =
-    advance_to_indent(buffer_p + start_pos, buffer_p + end_pos, tab_stops, &column);
+  // Set alphanumeric ACharMatch_alphascore
+  memcpy(ms_char_match_table[ACharMatch_alphascore], ms_char_match_table[ACharMatch_alphabetic], bool_bytes * AString_ansi_charset_length);  // Alphabetic
+  ms_char_match_table[ACharMatch_alphascore]['_'] = true;
 
-  if (indent_idx_p)
-    {
-    *indent_idx_p = uint(indent_p - buffer_p);
-    }
+  // Set digit ACharMatch_DIGIT
+  memset(&ms_char_match_table[ACharMatch_digit]['0'], true, bool_bytes * ('9'- '0' + 1));
 
-  return column;
-  }
+  // Set alphanumeric ACharMatch_identifier
+  memcpy(ms_char_match_table[ACharMatch_identifier], ms_char_match_table[ACharMatch_alphanumeric], bool_bytes * AString_ansi_charset_length);  // Alphanumeric
+  ms_char_match_table[ACharMatch_identifier]['_'] = true;
 
-//---------------------------------------------------------------------------------------
-//  Finds instance of specified character in reverse starting from end_pos
-//              and ending at start_pos and if found stores the index position found.
-// # Returns:   true if instance character found, false if not
-// Arg          ch - character to find
-// Arg          instance - occurrence of character to find.  It may not be less than 1.
-//              (Default 1)
-// Arg          find_pos_p - address to store index of instance character if found.
-//              It is not modified if the character is not found or if it is set to nullptr.
-//              (Default nullptr)
-// Arg          start_pos - ending position of search range (Default 0)
-// Arg          end_pos - starting position of search range.  If end_pos is set to
-//              ALength_remainder, the entire length of the string (from the starting position)
-//              is searched (end_pos = length - start_pos).  (Default ALength_remainder)
-// # Examples:  if (str.find_reverse('_', 2))  // if 2nd to last underscore is found
-//                do_something();
-// # See:       count(), get()
-// # Notes:     This character find method is faster than the find_reverse() method
-//              searching for a single character string.
-// # Author(s):  Conan Reis
-bool AString::find_reverse(
-  char       ch,
-  uint32_t   instance,   // = 1
-  uint32_t * find_pos_p, // = nullptr
-  uint32_t   start_pos,  // = 0
-  uint32_t   end_pos     // = ALength_remainder
-  ) const
-  {
-  // $Revisit - CReis [Efficiency] This should be faster than repeatedly calling memchr() - profile.
-  // It could be rewritten using inline assembly.
+  // Set lowercase ACharMatch_lowercase
+  memset(&ms_char_match_table[ACharMatch_lowercase]['a'], true, bool_bytes * ('z' - 'a' + 1));
 
-  if (m_str_ref_p->m_length)  // if not empty
-    {
-    if (end_pos == ALength_remainder)
-      {
-      end_pos = m_str_ref_p->m_length - 1;
-      }
+  // Set Punctuation ACharMatch_punctuation
+  ms_char_match_table[ACharMatch_punctuation]['!'] = true;
+  ms_char_match_table[ACharMatch_punctuation]['"'] = true;
+  ms_char_match_table[ACharMatch_punctuation]['\''] = true;
+  ms_char_match_table[ACharMatch_punctuation]['('] = true;
+  ms_char_match_table[ACharMatch_punctuation][')'] = true;
+  ms_char_match_table[ACharMatch_punctuation][','] = true;
+  ms_char_match_table[ACharMatch_punctuation]['-'] = true;  // Note this could be a hyphen as well as a minus sign
+  ms_char_match_table[ACharMatch_punctuation]['.'] = true;
+  ms_char_match_table[ACharMatch_punctuation][':'] = true;
+  ms_char_match_table[ACharMatch_punctuation][';'] = true;
+  ms_char_match_table[ACharMatch_punctuation]['?'] = true;
+  ms_char_match_table[ACharMatch_punctuation]['['] = true;
+  ms_char_match_table[ACharMatch_punctuation][']'] = true;
+  ms_char_match_table[ACharMatch_punctuation]['{'] = true;
+  ms_char_match_table[ACharMatch_punctuation]['}'] = true;
 
-    #ifdef A_BOUNDS_CHECK
-      bounds_check(start_pos, end_pos, instance, "find_reverse");
-    #endif
+  // Set symbol ACharMatch_symbol
+  memset(&ms_char_match_table[ACharMatch_symbol]['#'], true, bool_bytes * ('&' - '#' + 1));
+  ms_char_match_table[ACharMatch_symbol]['*'] = true;
+  ms_char_match_table[ACharMatch_symbol]['+'] = true;
+  ms_char_match_table[ACharMatch_symbol]['-'] = true;  // Note this could be a hyphen as well as a minus sign
+  ms_char_match_table[ACharMatch_symbol]['/'] = true;
+  ms_char_match_table[ACharMatch_symbol]['<'] = true;
+  ms_char_match_table[ACharMatch_symbol]['='] = true;
+  ms_char_match_table[ACharMatch_symbol]['>'] = true;
+  ms_char_match_table[ACharMatch_symbol]['@'] = true;
+  ms_char_match_table[ACharMatch_symbol]['\\'] = true;
+  ms_char_match_table[ACharMatch_symbol]['^'] = true;
+  ms_char_match_table[ACharMatch_symbol]['`'] = true;
+  ms_char_match_table[ACharMatch_symbol]['|'] = true;
+  ms_char_match_table[ACharMatch_symbol]['~'] = true;
 
-    char * cstr_p     = m_str_ref_p->m_cstr_p + start_pos;
-    char * cstr_end_p = m_str_ref_p->m_cstr_p + end_pos;
+  // Set Punctuation and symbols ACharMatch_token
+  memset(&ms_char_match_table[ACharMatch_token]['!'], true, bool_bytes * ('/' - '!' + 1));
+  memset(&ms_char_match_table[ACharMatch_token][':'], true, bool_bytes * ('@' - ':' + 1));
+  memset(&ms_char_match_table[ACharMatch_token]['['], true, bool_bytes * ('`' - '[' + 1));
+  memset(&ms_char_match_table[ACharMatch_token]['{'], true, bool_bytes * ('~' - '{' + 1));
 
-    while (cstr_p <= cstr_end_p)
-      {
-      if (*cstr_end_p == ch)     // Found one
-        {
-        if (instance == 1u)  // Found it!
-          {
-          if (find_pos_p)
-            {
-            *find_pos_p = uint32_t(cstr_end_p - m_str_ref_p->m_cstr_p);
-            }
+  // Set alphabetic ACharMatch_uppercase
+  memset(&ms_char_match_table[ACharMatch_uppercase]['A'], true, bool_bytes * ('Z' - 'A' + 1));
 
-          return true;
-          }
+  // Set white space ACharMatch_white_space
+  // Horizontal Tab, Line Feed, Vertical Tab, Form Feed, Carriage Return
+  memset(&ms_char_match_table[ACharMatch_white_space][9], true, bool_bytes * 5);
+  // Space
+  ms_char_match_table[ACharMatch_white_space][' '] = true;
+  
+  
+  // #################### Negative Classifications #######################
 
-        instance--;
-        }
+  // Most of the negative classification tests return true
+  memset(ms_char_match_table[ACharMatch__not_start], true, bool_bytes * ACharMatch__not_start * AString_ansi_charset_length);
 
-      cstr_end_p--;
-      }
-    }
+  // Set alphabetic ACharMatch_not_alphabetic
+  memset(&ms_char_match_table[ACharMatch_not_alphabetic]['A'], false, bool_bytes * ('Z' - 'A' + 1));
+  memset(&ms_char_match_table[ACharMatch_not_alphabetic]['a'], false, bool_bytes * ('z' - 'a' + 1));
 
-  return false;
-  }
+  // Set alphanumeric ACharMatch_not_alphanumeric
+  memcpy(ms_char_match_table[ACharMatch_not_alphanumeric], ms_char_match_table[ACharMatch_not_alphabetic], bool_bytes * AString_ansi_charset_length);  // Alphabetic
+  memset(&ms_char_match_table[ACharMatch_not_alphanumeric]['0'], false, bool_bytes * ('9'- '0' + 1));
 
-//---------------------------------------------------------------------------------------
-//  Finds instance of specified type of character in reverse starting from
-//              end_pos and ending at start_pos and if found stores the index position found.
-// # Returns:   true if instance character type found, false if not
-// Arg          match_type - classification of characters to match.
-// Arg          instance - occurrence of character type to find.  It may not be less than 1.
-//              (Default 1)
-// Arg          find_pos_p - address to store index of instance character type if found.
-//              It is not modified if the character type is not found or if it is set to nullptr.
-//              (Default nullptr)
-// Arg          start_pos - ending position of search range (Default 0)
-// Arg          end_pos - starting position of search range.  If end_pos is set to
-//              ALength_remainder, the entire length of the string (from the starting position)
-//              is searched (end_pos = length - start_pos).  (Default ALength_remainder)
-// # Examples:  if (str.find_reverse(ACharMatch_lowercase, 2))  // if 2nd to last lowercase letter is found
-//                do_something();
-// # See:       count(), get()
-// # Author(s):  Conan Reis
-bool AString::find_reverse(
-  eACharMatch match_type,
-  uint32_t    instance,   // = 1
-  uint32_t *  find_pos_p, // = nullptr
-  uint32_t    start_pos,  // = 0
-  uint32_t    end_pos     // = ALength_remainder
-  ) const
-  {
-  if (m_str_ref_p->m_length)  // if not empty
-    {
-    if (end_pos == ALength_remainder)
-      {
-      end_pos = m_str_ref_p->m_length - 1;
-      }
+  // Set alphanumeric ACharMatch_not_alphascore
+  memcpy(ms_char_match_table[ACharMatch_not_alphascore], ms_char_match_table[ACharMatch_not_alphabetic], bool_bytes * AString_ansi_charset_length);  // Alphabetic
+  ms_char_match_table[ACharMatch_not_alphascore]['_'] = false;
+
+  // Set digit ACharMatch_not_digit
+  memset(&ms_char_match_table[ACharMatch_not_digit]['0'], false, bool_bytes * ('9'- '0' + 1));
 
-    #ifdef A_BOUNDS_CHECK
-      bounds_check(start_pos, end_pos, instance, "find_reverse");
-    #endif
+  // Set alphanumeric ACharMatch_not_identifier
+  memcpy(ms_char_match_table[ACharMatch_not_identifier], ms_char_match_table[ACharMatch_not_alphanumeric], bool_bytes * AString_ansi_charset_length);  // Alphanumeric
+  ms_char_match_table[ACharMatch_not_identifier]['_'] = false;
 
-    uint8_t * cstr_p        = reinterpret_cast<uint8_t *>(m_str_ref_p->m_cstr_p + start_pos);
-    uint8_t * cstr_end_p    = reinterpret_cast<uint8_t *>(m_str_ref_p->m_cstr_p + end_pos);
-    bool *    match_table_p = ms_char_match_table[match_type];
+  // Set lowercase ACharMatch_not_lowercase
+  memset(&ms_char_match_table[ACharMatch_not_lowercase]['a'], false, bool_bytes * ('z' - 'a' + 1));
 
-    while (cstr_p <= cstr_end_p)
-      {
-      if (match_table_p[*cstr_end_p ])  // Found one
-        {
-        if (instance == 1u)             // Found it!
-          {
-          if (find_pos_p)
-            {
-            *find_pos_p = uint32_t(cstr_end_p - reinterpret_cast<uint8_t *>(m_str_ref_p->m_cstr_p));
-            }
+  // Set Punctuation ACharMatch_not_punctuation
+  ms_char_match_table[ACharMatch_not_punctuation]['!'] = false;
+  ms_char_match_table[ACharMatch_not_punctuation]['"'] = false;
+  ms_char_match_table[ACharMatch_not_punctuation]['\''] = false;
+  ms_char_match_table[ACharMatch_not_punctuation]['('] = false;
+  ms_char_match_table[ACharMatch_not_punctuation][')'] = false;
+  ms_char_match_table[ACharMatch_not_punctuation][','] = false;
+  ms_char_match_table[ACharMatch_not_punctuation]['-'] = false;  // Note this could be a hyphen as well as a minus sign
+  ms_char_match_table[ACharMatch_not_punctuation]['.'] = false;
+  ms_char_match_table[ACharMatch_not_punctuation][':'] = false;
+  ms_char_match_table[ACharMatch_not_punctuation][';'] = false;
+  ms_char_match_table[ACharMatch_not_punctuation]['?'] = false;
+  ms_char_match_table[ACharMatch_not_punctuation]['['] = false;
+  ms_char_match_table[ACharMatch_not_punctuation][']'] = false;
+  ms_char_match_table[ACharMatch_not_punctuation]['{'] = false;
+  ms_char_match_table[ACharMatch_not_punctuation]['}'] = false;
 
-          return true;
-          }
+  // Set symbol ACharMatch_not_symbol
+  memset(&ms_char_match_table[ACharMatch_not_symbol]['#'], false, bool_bytes * ('&' - '#' + 1));
+  ms_char_match_table[ACharMatch_not_symbol]['*'] = false;
+  ms_char_match_table[ACharMatch_not_symbol]['+'] = false;
+  ms_char_match_table[ACharMatch_not_symbol]['-'] = false;  // Note this could be a hyphen as well as a minus sign
+  ms_char_match_table[ACharMatch_not_symbol]['/'] = false;
+  ms_char_match_table[ACharMatch_not_symbol]['<'] = false;
+  ms_char_match_table[ACharMatch_not_symbol]['='] = false;
+  ms_char_match_table[ACharMatch_not_symbol]['>'] = false;
+  ms_char_match_table[ACharMatch_not_symbol]['@'] = false;
+  ms_char_match_table[ACharMatch_not_symbol]['\\'] = false;
+  ms_char_match_table[ACharMatch_not_symbol]['^'] = false;
+  ms_char_match_table[ACharMatch_not_symbol]['`'] = false;
+  ms_char_match_table[ACharMatch_not_symbol]['|'] = false;
+  ms_char_match_table[ACharMatch_not_symbol]['~'] = false;
 
-        instance--;
-        }
+  // Set Punctuation and symbols ACharMatch_not_token
+  memset(&ms_char_match_table[ACharMatch_not_token]['!'], false, bool_bytes * ('/' - '!' + 1));
+  memset(&ms_char_match_table[ACharMatch_not_token][':'], false, bool_bytes * ('@' - ':' + 1));
+  memset(&ms_char_match_table[ACharMatch_not_token]['['], false, bool_bytes * ('`' - '[' + 1));
+  memset(&ms_char_match_table[ACharMatch_not_token]['{'], false, bool_bytes * ('~' - '{' + 1));
 
-      cstr_end_p--;
-      }
-    }
+  // Set alphabetic ACharMatch_not_uppercase
+  memset(&ms_char_match_table[ACharMatch_not_uppercase]['A'], false, bool_bytes * ('Z' - 'A' + 1));
 
-  return false;
+  // Set white space ACharMatch_not_white_space
+  // Horizontal Tab, Line Feed, Vertical Tab, Form Feed, Carriage Return
+  memset(&ms_char_match_table[ACharMatch_not_white_space][9], false, bool_bytes * 5);
+  // Space
+  ms_char_match_table[ACharMatch_not_white_space][' '] = false;
   }
 
+
+//#######################################################################################
+// AStringBM Class
+//#######################################################################################
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// Common Methods
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
 //---------------------------------------------------------------------------------------
-// Substring reverse search.
-// 
-// Returns: `true` if instance of str found, `false` if not
-// 
-// Params:
-//   str: substring to find
-//   instance: occurrence of substring to find.  It may not be less than 1.
-//   find_pos_p:
-//     Address to store index of instance substring if found.
-//     It is not modified if the substring is not found or if it is set to nullptr.
-//   start_pos: starting character index of search range.
-//   end_pos:
-//     Ending character index of search range.  If `end_pos` is set to `ALength_remainder`,
-//     the entire length of the string (from the starting position) is searched (`end_pos
-//     = length - 1u`).
-//   case_check:
-//     If set to `AStrCase_sensitive`, case is important (q != Q), if set to
-//     `AStrCase_ignore`, case is not important (q == Q).
-//     
-// See:
-//   find_reverse(ch), find_reverse(match_type),
-//   find(str), find(bm), find(ch), find(match_type)
-bool AString::find_reverse(
-  const AString & str,
-  uint32_t        instance,    // = 1
-  uint32_t *      find_pos_p,  // = nullptr
-  uint32_t        start_pos,   // = 0
-  uint32_t        end_pos,     // = ALength_remainder
-  eAStrCase       case_check   // = AStrCase_sensitive
-  ) const
+// Normal constructor from string.
+// # Author(s): Conan Reis
+AStringBM::AStringBM(
+  const AString & str,       // = ms_empty
+  eAStrCase       case_check // = AStrCase_sensitive
+  ) :
+  AString(str),
+  m_case(case_check)
   {
-  uint32_t length     = m_str_ref_p->m_length;
-  uint32_t str_length = str.m_str_ref_p->m_length;
-
-  if ((length == 0u) || (str_length == 0u) || (length < str_length))
-    {
-    return false;
-    }
+  uint32_t pos    = 0u;
+  uint32_t length = m_str_ref_p->m_length;  // get length of pattern
+  uint32_t offset = length - 1u;
 
-  if (end_pos == ALength_remainder)
+  if (case_check == AStrCase_ignore)
     {
-    end_pos = length;
+    lowercase();
     }
 
-  #ifdef A_BOUNDS_CHECK
-    bounds_check(start_pos, end_pos, instance, "find_reverse");
-  #endif
+  char *    cstr_p  = m_str_ref_p->m_cstr_p;  // for quicker access
+  uint8_t * delta_p = m_delta_p;              // for quicker access
 
-  char * match_p;
-  char * find_p;
-  char * cstr_p       = m_str_ref_p->m_cstr_p + start_pos;
-  char * cstr_end_p   = m_str_ref_p->m_cstr_p + end_pos - str_length + 1u;  // won't match if less than str left
-  char * find_start_p = str.m_str_ref_p->m_cstr_p;
-  char * find_end_p   = find_start_p + str_length;
+  memset(m_delta_p, int(length), static_cast<size_t>(AString_ansi_charset_length));
 
-  if (case_check == AStrCase_sensitive)  // Case sensitive
+  for (; pos < length; pos++)  // set table values
     {
-    do
-      {
-      cstr_end_p--;
-      match_p = cstr_end_p;
-      find_p  = find_start_p;
+    delta_p[static_cast<uint32_t>(cstr_p[pos])] = uint8_t(offset - pos);
+    }
+  }
 
-      while ((find_p < find_end_p) && (*match_p == *find_p))
-        {
-        find_p++;
-        match_p++;
-        }
+//---------------------------------------------------------------------------------------
+// Copy constructor.
+// # Author(s): Conan Reis
+AStringBM::AStringBM(const AStringBM & bm) :
+  AString(bm),
+  m_case(bm.m_case)
+  {
+  memcpy(m_delta_p, bm.m_delta_p, static_cast<size_t>(AString_ansi_charset_length));  // copy contents of source
+  }
 
-      if (find_p == find_end_p)  // Found one
-        {
-        if (instance == 1u)      // Found it!
-          {
-          if (find_pos_p)
-            {
-            *find_pos_p = uint32_t(cstr_end_p - m_str_ref_p->m_cstr_p);
-            }
+//---------------------------------------------------------------------------------------
+// Assignment operator.
+// # Author(s): Conan Reis
+const AStringBM & AStringBM::operator=(const AStringBM & bm)
+  {
+  AString::operator=(bm);
+  m_case = bm.m_case;
+  memcpy(m_delta_p, bm.m_delta_p, static_cast<size_t>(AString_ansi_charset_length));  // copy contents of source
 
-          return true;
-          }
+  return *this;
+  }
 
-        instance--;
-        }
-      }
-    while (cstr_p < cstr_end_p);
-    }
-  else  // Ignore case
-    {
-    do
-      {
-      cstr_end_p--;
-      match_p = cstr_end_p;
-      find_p  = find_start_p;
 
-      while (!compare_insensitive(*match_p, *find_p) && (find_p < find_end_p))  //  Note: Okay to check end condition (find_p < find_end_p) second because if >= it will point to null terminator i.e. still valid memory in first part of condition.
-        {
-        find_p++;
-        match_p++;
-        }
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// Modifying Methods
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
 
-      if (find_p == find_end_p)  // Found one
-        {
-        if (instance == 1u)      // Found it!
-          {
-          if (find_pos_p)
-            {
-            *find_pos_p = uint32_t(cstr_end_p - m_str_ref_p->m_cstr_p);
-            }
+//---------------------------------------------------------------------------------------
+// Converter from AString to existing AStringBM.
+// # Author(s): Conan Reis
+void AStringBM::convert(
+  const AString & str,
+  eAStrCase       case_check // = AStrCase_sensitive
+  )
+  {
+  uint32_t pos    = 0u;
+  uint32_t length = str.m_str_ref_p->m_length;  // get length of pattern
+  uint32_t offset = length - 1u;
 
-          return true;
-          }
+  AString::operator=(str);
+  m_case = case_check;
 
-        instance--;
-        }
-      }
-    while (cstr_p < cstr_end_p);
+  if (case_check == AStrCase_ignore)
+    {
+    lowercase();
     }
 
-  return false;
-  }
-
-
-//---------------------------------------------------------------------------------------
-//  substring retrieval method
-// # Author(s):  Conan Reis
-void AString::get(
-  AString * str_p,
-  uint32_t  pos,       // = 0u
-  uint32_t  char_count // = ALength_remainder
-  ) const
-  {
-  if (char_count == ALength_remainder)
+  char *    cstr_p  = str.m_str_ref_p->m_cstr_p;  // for quicker access
+  uint8_t * delta_p = m_delta_p;              // for quicker access
+
+  memset(m_delta_p, int(length), static_cast<size_t>(AString_ansi_charset_length));
+
+  for (; pos < length; pos++)  // set table values
     {
-    char_count = m_str_ref_p->m_length - pos;
+    delta_p[static_cast<uint32_t>(cstr_p[pos])] = uint8_t(offset - pos);
     }
+  }
 
-  str_p->ensure_size_empty(char_count);
 
-  if (char_count)
-    {
-    #ifdef A_BOUNDS_CHECK
-      span_check(pos, char_count, "get");
-    #endif
+//#######################################################################################
+// AStringView Class
+//#######################################################################################
 
-    memcpy(str_p->m_str_ref_p->m_cstr_p, m_str_ref_p->m_cstr_p + pos, size_t(char_count));
-    str_p->m_str_ref_p->m_cstr_p[char_count] = '\0';
-    str_p->m_str_ref_p->m_length             = char_count;
-    }
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// Converter Methods
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+//---------------------------------------------------------------------------------------
+// Makes a new string with a copy of the viewed characters.
+// # Returns:  new string
+// # Notes:    This is the only AStringView method that allocates a string - use it when
+//             the characters need to outlive the string being viewed.
+AString AStringView::as_string() const
+  {
+  return AString(m_cstr_p, m_length, false);
   }
 
 //---------------------------------------------------------------------------------------
-//  substring retrieval method
-// # Author(s):  Conan Reis
-AString AString::get(
-  uint32_t pos,       // = 0u
-  uint32_t char_count // = ALength_remainder
+// Converter to f64 - same as AString::as_float64() though parsing stops at the end of
+// the view.
+// # Returns:  a f64 interpretation of the specified section
+// Arg         start_pos - index position to start parsing
+// Arg         stop_pos_p - Address to store the index position where conversion stops.
+//             If it is set to nullptr, it is ignored.  (Default nullptr)
+// # See:      AString::as_float64() for the acceptable string form
+f64 AStringView::as_float64(
+  uint32_t   start_pos,  // = 0u
+  uint32_t * stop_pos_p  // = nullptr
   ) const
   {
-  if (char_count == ALength_remainder)
-    {
-    char_count = m_str_ref_p->m_length - pos;
-    }
+  #ifdef A_BOUNDS_CHECK
+    A_VERIFY(start_pos <= m_length, a_cstr_format("AStringView::as_float64(start_pos %u) - invalid index\nLength is %u", start_pos, m_length), AErrId_invalid_index, AString);
+  #endif
 
-  AString result(nullptr, uint32_t(char_count + 1u), uint32_t(0u));
+  AViewCStr num(m_cstr_p + start_pos, m_length - start_pos);
+  char *    stop_char_p;
+  f64       value = ::strtod(num.m_cstr_p, &stop_char_p);
 
-  if (char_count)
+  if (stop_pos_p)
     {
-    #ifdef A_BOUNDS_CHECK
-      span_check(pos, char_count, "get");
-    #endif
-
-    memcpy(result.m_str_ref_p->m_cstr_p, m_str_ref_p->m_cstr_p + pos, size_t(char_count));
-    result.m_str_ref_p->m_cstr_p[char_count] = '\0';
-    result.m_str_ref_p->m_length             = char_count;
+    *stop_pos_p = start_pos + num.get_stop_pos(stop_char_p);
     }
 
-  return result;
+  return value;
   }
 
 //---------------------------------------------------------------------------------------
-//  Dynamic substring retrieval
-// # Author(s):  Conan Reis
-AString * AString::get_new(
-  uint32_t pos,       // = 0u
-  uint32_t char_count // = ALength_remainder
+// Converter to f32 - same as AString::as_float32() though parsing stops at the end of
+// the view.
+// # Returns:  a f32 interpretation of the specified section
+// Arg         start_pos - index position to start parsing
+// Arg         stop_pos_p - Address to store the index position where conversion stops.
+//             If it is set to nullptr, it is ignored.  (Default nullptr)
+// # See:      AString::as_float64() for the acceptable string form
+f32 AStringView::as_float32(
+  uint32_t   start_pos,  // = 0u
+  uint32_t * stop_pos_p  // = nullptr
   ) const
   {
-  AString * str_p;
-  
-  if (char_count == ALength_remainder)
-    {
-    char_count = m_str_ref_p->m_length - pos;
-    }
+  return f32(as_float64(start_pos, stop_pos_p));
+  }
 
+//---------------------------------------------------------------------------------------
+// Converter to int32_t - same as AString::as_int() though parsing stops at the end of
+// the view.
+// # Returns:  a int32_t interpretation of the specified section
+// Arg         start_pos - index position to start parsing
+// Arg         stop_pos_p - Address to store the index position where conversion stops.
+//             If it is set to nullptr, it is ignored.  (Default nullptr)
+// Arg         base - numerical base / radix 2-36 or AString_determine_base
+// # See:      AString::as_int() for the acceptable string form
+int AStringView::as_int(
+  uint32_t   start_pos,  // = 0u
+  uint32_t * stop_pos_p, // = nullptr
+  uint32_t   base        // = AString_determine_base
+  ) const
+  {
   #ifdef A_BOUNDS_CHECK
-    if (char_count)
-      {
-      span_check(pos, char_count, "get_new");
-      }
+    A_VERIFY(start_pos <= m_length, a_cstr_format("AStringView::as_int(start_pos %u) - invalid index\nLength is %u", start_pos, m_length), AErrId_invalid_index, AString);
+    A_VERIFY(a_is_ordered(AString_determine_base, base, AString_max_base), a_cstr_format("invalid numerical base/radix \nExpected 1-37, but given %u", base), AString::ErrId_invalid_base, AString);
   #endif
 
-  str_p = new AString(m_str_ref_p->m_cstr_p + pos, char_count);
+  AViewCStr num(m_cstr_p + start_pos, m_length - start_pos);
+  char *    stop_char_p;
+  int32_t   value = int32_t(::strtol(num.m_cstr_p, &stop_char_p, int(base)));
 
-  A_VERIFY_MEMORY(str_p != nullptr, AString);
+  if (stop_pos_p)
+    {
+    *stop_pos_p = start_pos + num.get_stop_pos(stop_char_p);
+    }
 
-  return str_p;
+  return value;
   }
 
 //---------------------------------------------------------------------------------------
-//  Substring at index position in between tokens in current string
-//              looking from start_pos to end_pos.
-//              Separators that are adjacent to one another count as an empty string.
-// # Returns:   Substring at index position in between tokens
-// Arg          index - index position of substring to return (zero indexed)
-// Arg          token - substring to separate on
-// Arg          find_pos_p - pointer to store index position in current string
-//              where returned substring is found.  Not set if nullptr
-// Arg          start_pos - index position in current string to begin looking
-// Arg          end_pos - index position in current string to stop looking
-//              (ALength_remainder = current length of string)
-// Arg          case_check - whether or not the token should be case sensitive or not
-// # Notes:     If the index given is out of range or if the specified index is
-//              between two separators, an empty string is returned.
-//              If the index is out of range, the value find_pos_p points to is
-//              not changed.
-// # Examples:  AString str("one, two, three, four");
-//              AString third(str.get_token(2, ", "));  // = "three"
-// # Author(s):  Conan Reis
-AString AString::get_token(
-  uint32_t          index,
-  const AStringBM & token,
-  uint32_t *        find_pos_p, // = nullptr
-  uint32_t          start_pos,  // = 0
-  uint32_t          end_pos     // = ALength_remainder
+// Converter to uint32_t - same as AString::as_uint() though parsing stops at the end of
+// the view.
+// # Returns:  a uint32_t interpretation of the specified section
+// Arg         start_pos - index position to start parsing
+// Arg         stop_pos_p - Address to store the index position where conversion stops.
+//             If it is set to nullptr, it is ignored.  (Default nullptr)
+// Arg         base - numerical base / radix 2-36 or AString_determine_base
+// # See:      AString::as_uint() for the acceptable string form
+uint AStringView::as_uint(
+  uint32_t   start_pos,  // = 0u
+  uint32_t * stop_pos_p, // = nullptr
+  uint32_t   base        // = AString_determine_base
   ) const
   {
-  if (m_str_ref_p->m_length)  // if not empty
+  #ifdef A_BOUNDS_CHECK
+    A_VERIFY(start_pos <= m_length, a_cstr_format("AStringView::as_uint(start_pos %u) - invalid index\nLength is %u", start_pos, m_length), AErrId_invalid_index, AString);
+    A_VERIFY(a_is_ordered(AString_determine_base, base, AString_max_base), a_cstr_format("invalid numerical base/radix \nExpected 1-37, but given %u", base), AString::ErrId_invalid_base, AString);
+  #endif
+
+  AViewCStr num(m_cstr_p + start_pos, m_length - start_pos);
+  char *    stop_char_p;
+  uint32_t  value = uint32_t(::strtoul(num.m_cstr_p, &stop_char_p, int(base)));
+
+  if (stop_pos_p)
     {
-    if (end_pos == ALength_remainder)
-      {
-      end_pos = m_str_ref_p->m_length - 1;
-      }
+    *stop_pos_p = start_pos + num.get_stop_pos(stop_char_p);
+    }
 
-    // Get starting position
-    if (index)
-      {
-      #ifdef A_BOUNDS_CHECK
-        bool found = find(token, index, &start_pos, start_pos, end_pos);
+  return value;
+  }
 
-        A_VERIFY(found, "::get_token() - index out of range", AErrId_invalid_index, AString);
-      #endif
 
-      start_pos += token.m_str_ref_p->m_length;
-      }
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// Comparison Methods
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
 
-    // Get ending position
-    if (!find(token, 1u, &end_pos, start_pos, end_pos))
-      {
-      end_pos++;
-      }
+//---------------------------------------------------------------------------------------
+// Compares the viewed characters to the ones given to determine if they are equal to,
+// less than, or greater than them.  A shorter view that matches the start of a longer
+// one is less than it.
+// # Returns:  AEquate_equal, AEquate_less, or AEquate_greater
+// Arg         view - characters to compare
+// Arg         case_check - AStrCase_sensitive or AStrCase_ignore
+// # See:      is_equal(), is_match()
+eAEquate AStringView::compare(
+  const AStringView & view,
+  eAStrCase           case_check // = AStrCase_sensitive
+  ) const
+  {
+  uint32_t length = a_min(m_length, view.m_length);
+  int      result = 0;
+
+  if (case_check == AStrCase_sensitive)
+    {
+    result = ::memcmp(m_cstr_p, view.m_cstr_p, length);
     }
   else
     {
-    #ifdef A_BOUNDS_CHECK
-      A_VERIFY(index == 0u, "::get_token() - index out of range", AErrId_invalid_index, AString);
-    #endif
+    const char * cstr_p     = m_cstr_p;
+    const char * cstr_end_p = m_cstr_p + length;
+    const char * view_p     = view.m_cstr_p;
 
-    end_pos = 0u;
+    for (; (result == 0) && (cstr_p < cstr_end_p); cstr_p++, view_p++)
+      {
+      result = AString::compare_insensitive(*cstr_p, *view_p);
+      }
     }
 
-  if (find_pos_p)
+  if (result == 0)
     {
-    *find_pos_p = start_pos;
+    return (m_length == view.m_length)
+      ? AEquate_equal
+      : ((m_length < view.m_length) ? AEquate_less : AEquate_greater);
     }
 
-  return AString(m_str_ref_p->m_cstr_p + start_pos, end_pos - start_pos);
+  return (result < 0) ? AEquate_less : AEquate_greater;
   }
 
 //---------------------------------------------------------------------------------------
-//  Splits current string from start_pos to end_pos into new dynamic
-//              substrings with separator as the substring to split on.
-// Arg          collect_p - array to accumulate (i.e. append) the dynamically allocated
-//              substrings to.  Any previous AString objects will remain in collected_p,
-//              they are just added to.
-//              *** Remember to free the substrings after they are finished being used.
-// Arg          separator - 
-// Arg          start_pos - character index position to begin tokenization (Default 0)
-// Arg          end_pos - character index position to end tokenization.  If end_pos is
-//              ALength_remainder, then end_pos is set to the last character positon.
-//              (Default ALength_remainder)
-// Arg          case_check - Indicates whether the search for the separator substring
-//              should be case sensitive (AStrCase_sensitive) or case insensitive (AStrCase_ignore).
-//              (Default AStrCase_sensitive)
-// # See:       get_token(), AString(APArrayLogical<AString>, separator)
-// # Notes:     Seperators that are adjacent to one another count as an empty string.
-// # Author(s):  Conan Reis
-void AString::tokenize(
-  APArrayLogical<AString> * collect_p,
-  const AString &           separator, // = AString(',')
-  uint32_t                  start_pos, // = 0
-  uint32_t                  end_pos,   // = ALength_remainder
-  eAStrCase                 case_check // = AStrCase_sensitive
+// Determines if the given characters are found in this view as specified by match_type.
+// # Returns:  true if matched, false if not
+// Arg         view - characters to match
+// Arg         match_type - AStrMatch_subpart, AStrMatch_prefix, AStrMatch_suffix or
+//             AStrMatch_exact
+// Arg         case_check - AStrCase_sensitive or AStrCase_ignore
+// # Examples: if (line.is_match("//", AStrMatch_prefix)) ...  // skip comment
+// # See:      is_equal(), find()
+bool AStringView::is_match(
+  const AStringView & view,
+  eAStrMatch          match_type,
+  eAStrCase           case_check // = AStrCase_sensitive
   ) const
   {
-  uint32_t pos;
-
-  if (m_str_ref_p->m_length)  // if not empty
+  if (view.m_length > m_length)
     {
-    if (end_pos == ALength_remainder)
-      {
-      end_pos = m_str_ref_p->m_length - 1;
-      }
+    return false;
+    }
 
-    #ifdef A_BOUNDS_CHECK
-      bounds_check(start_pos, end_pos, "tokenize");
-    #endif
+  switch (match_type)
+    {
+    case AStrMatch_prefix:
+      return a_is_substr(m_cstr_p, view.m_cstr_p, view.m_length, case_check);
 
-    uint32_t length = separator.m_str_ref_p->m_length;
+    case AStrMatch_suffix:
+      return a_is_substr(m_cstr_p + m_length - view.m_length, view.m_cstr_p, view.m_length, case_check);
 
-    while ((start_pos <= end_pos) && (find(separator, 1u, &pos, start_pos, end_pos, case_check)))
-      {
-      collect_p->append(*get_new(start_pos, pos - start_pos));
-      start_pos = pos + length;
-      }
+    case AStrMatch_exact:
+      return is_equal(view, case_check);
 
-    collect_p->append(*get_new(start_pos, end_pos - start_pos + 1));
+    default:  // AStrMatch_subpart
+      return a_find_substr_range(m_cstr_p, m_cstr_p + m_length, view.m_cstr_p, view.m_length, case_check) != nullptr;
     }
   }
 
-//---------------------------------------------------------------------------------------
-//  Splits current string from start_pos to end_pos into new dynamic
-//              substrings with separator as the substring to split on.
-// Arg          collect_p - array to accumulate (i.e. append) the dynamically allocated
-//              substrings to.  Any previous AString objects will remain in collected_p,
-//              they are just added to.
-//              *** Remember to free the substrings after they are finished being used.
-// Arg          separator - 
-// Arg          start_pos - character index position to begin tokenization (Default 0)
-// Arg          end_pos - character index position to end tokenization.  If end_pos is
-//              ALength_remainder, then end_pos is set to the last character positon.
-//              (Default ALength_remainder)
-// Arg          case_check - Indicates whether the search for the separator substring
-//              should be case sensitive (AStrCase_sensitive) or case insensitive (AStrCase_ignore).
-//              (Default AStrCase_sensitive)
-// # See:       get_token(), AString(APArrayLogical<AString>, separator)
-// # Notes:     Separators that are adjacent to one another count as an empty string.
-// # Author(s):  Conan Reis
-void AString::tokenize(
-  APArrayLogical<AString> * collect_p, 
-  const AStringBM &         separator,
-  uint32_t                  start_pos, // = 0
-  uint32_t                  end_pos    // = ALength_remainder
-  ) const
-  {
-  uint32_t pos;
 
-  if (m_str_ref_p->m_length)  // if not empty
-    {
-    if (end_pos == ALength_remainder)
-      {
-      end_pos = m_str_ref_p->m_length - 1;
-      }
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// Modifying Methods
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
 
-    #ifdef A_BOUNDS_CHECK
-      bounds_check(start_pos, end_pos, "tokenize");
-    #endif
+//---------------------------------------------------------------------------------------
+// Narrows the view to the specified subrange - no characters are modified.
+// Arg         pos - index of first character to keep viewing
+// Arg         char_count - number of characters to keep viewing.  If it is
+//             ALength_remainder, all the characters from pos to the end are kept.
+// # See:      get(), crop(match_type)
+void AStringView::crop(
+  uint32_t pos,
+  uint32_t char_count // = ALength_remainder
+  )
+  {
+  *this = get(pos, char_count);
+  }
 
-    uint32_t length = separator.get_length();
+//---------------------------------------------------------------------------------------
+// Narrows the view to exclude all the characters of match_type at its beginning and end.
+// # Returns:  itself
+// Arg         match_type - classification of characters to exclude.
+//             (Default ACharMatch_white_space)
+// # Examples: AStringView view("  the quick brown fox  ");
+//
+//             view.crop();  // view is now "the quick brown fox"
+// # See:      AString::crop(match_type)
+AStringView & AStringView::crop(
+  eACharMatch match_type // = ACharMatch_white_space
+  )
+  {
+  const bool *    match_table_p = AString::ms_char_match_table[match_type];
+  const uint8_t * cstr_p        = reinterpret_cast<const uint8_t *>(m_cstr_p);
+  const uint8_t * cstr_end_p    = cstr_p + m_length;
 
-    while ((start_pos <= end_pos) && (find(separator, 1u, &pos, start_pos, end_pos)))
-      {
-      collect_p->append(*get_new(start_pos, pos - start_pos));
-      start_pos = pos + length;
-      }
+  while ((cstr_p < cstr_end_p) && match_table_p[*cstr_p])
+    {
+    cstr_p++;
+    }
 
-    collect_p->append(*get_new(start_pos, end_pos - start_pos + 1));
+  while ((cstr_p < cstr_end_p) && match_table_p[cstr_end_p[-1]])
+    {
+    cstr_end_p--;
     }
-  }
 
+  m_cstr_p = reinterpret_cast<const char *>(cstr_p);
+  m_length = uint32_t(cstr_end_p - cstr_p);
 
-//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
-// Internal Methods
-//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+  return *this;
+  }
 
 //---------------------------------------------------------------------------------------
-//  Makes the string writable and have a unique reference.
-// # Examples:  called by ensure_writable()
-// # Notes:     Maintains data integrity.
-// # Author(s):  Conan Reis
-void AString::make_writable()
+// Removes the characters up to the next separator from the front of this view and
+// stores them in token_p.  The separator itself is skipped.  If no separator is found
+// the whole view becomes the token and this view is left empty.
+// # Returns:  true if a token was stored or false if this view was already empty
+// Arg         token_p - address to store view of token
+// Arg         separator - characters that separate tokens
+// Arg         case_check - whether or not the separator search is case sensitive
+// # Examples: AStringView line;
+//
+//             while (text.pop_token(&line, "\n"))
+//               {
+//               parse_line(line);
+//               }
+// # Notes:    Separators that are adjacent to one another result in an empty token, but
+//             a separator at the very end does not result in a final empty token.
+// # See:      get_token(), tokenize()
+bool AStringView::pop_token(
+  AStringView *       token_p,
+  const AStringView & separator, // = ms_comma
+  eAStrCase           case_check // = AStrCase_sensitive
+  )
   {
-  AStringRef * str_ref_p = m_str_ref_p;
-  uint32_t     length    = str_ref_p->m_length;
-  uint32_t     size      = AStringRef::request_char_count(str_ref_p->m_length);
-  char *       buffer_p  = AStringRef::alloc_buffer(size);
-  
-  memcpy(buffer_p, str_ref_p->m_cstr_p, size_t(length));
+  if (m_length == 0u)
+    {
+    return false;
+    }
+
+  const char * cstr_end_p = m_cstr_p + m_length;
+  const char * match_p    = separator.m_length
+    ? a_find_substr_range(m_cstr_p, cstr_end_p, separator.m_cstr_p, separator.m_length, case_check)
+    : nullptr;
+
+  if (match_p == nullptr)
+    {
+    *token_p = *this;
+    m_cstr_p = cstr_end_p;
+    m_length = 0u;
 
-  // Add null terminator by hand rather than copying it to ensure that it exists.
-  buffer_p[length] = '\0';
+    return true;
+    }
 
-  m_str_ref_p = str_ref_p->reuse_or_new(buffer_p, length, size, true);
+  *token_p = AStringView(m_cstr_p, uint32_t(match_p - m_cstr_p));
+  m_cstr_p = match_p + separator.m_length;
+  m_length = uint32_t(cstr_end_p - m_cstr_p);
+
+  return true;
   }
 
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// Non-modifying Methods
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
 //---------------------------------------------------------------------------------------
-//  Makes C-String buffer large enough, writable, and unique (not shared)
-//              - copying the data already present in the string.
-// Arg          needed_chars - amount of characters that need to be stored not including
-//              the null terminating character
-// # Examples:  Called by ensure_size()
-// # See:       set_size_buffer(), ensure_size(), ensure_size_empty(),
-//              ensure_size_buffer(), set_length()
-// # Author(s):  Conan Reis
-void AString::set_size(uint32_t needed_chars)  
+// Finds instance of specified character starting from start_pos and ending at end_pos
+// and if found stores the index position found.
+// # Returns:  true if instance character found, false if not
+// Arg         ch - character to find
+// Arg         instance - occurrence of character to find.  It may not be less than 1.
+// Arg         find_pos_p - address to store index of instance character if found.
+//             It is not modified if the character is not found or if it is nullptr.
+// Arg         start_pos - starting position of search range
+// Arg         end_pos - ending position of search range.  If end_pos is set to
+//             ALength_remainder, the rest of the view is searched.
+// # See:      AString::find(ch)
+bool AStringView::find(
+  char       ch,
+  uint32_t   instance,   // = 1u
+  uint32_t * find_pos_p, // = nullptr
+  uint32_t   start_pos,  // = 0u
+  uint32_t   end_pos     // = ALength_remainder
+  ) const
   {
-  AStringRef * str_ref_p = m_str_ref_p;
-  uint32_t     size      = AStringRef::request_char_count(needed_chars);
-  uint32_t     length    = a_min(str_ref_p->m_length, size - 1u);
-  char *       buffer_p  = AStringRef::alloc_buffer(size);
+  if (end_pos == ALength_remainder)
+    {
+    end_pos = m_length - 1u;
+    }
 
-  // Copy previous contents
-  memcpy(buffer_p, str_ref_p->m_cstr_p, size_t(length));
+  if ((m_length == 0u) || (start_pos > end_pos))
+    {
+    return false;
+    }
 
-  // Add null terminator by hand rather than copying it to ensure that it exists.
-  buffer_p[length] = '\0';
+  #ifdef A_BOUNDS_CHECK
+    A_VERIFY((end_pos < m_length) && (instance >= 1u), a_cstr_format("AStringView::find(instance %u, start_pos %u, end_pos %u) - invalid argument\nLength is %u", instance, start_pos, end_pos, m_length), AErrId_invalid_index_range, AString);
+  #endif
 
-  m_str_ref_p = str_ref_p->reuse_or_new(buffer_p, length, size);
-  }
+  const char * cstr_p     = m_cstr_p + start_pos;
+  const char * cstr_end_p = m_cstr_p + end_pos;
 
+  while ((cstr_p = a_find_char(cstr_p, cstr_end_p, ch)) != nullptr)  // Found one
+    {
+    if (instance == 1u)  // Found it!
+      {
+      if (find_pos_p)
+        {
+        *find_pos_p = uint32_t(cstr_p - m_cstr_p);
+        }
 
-#ifdef A_BOUNDS_CHECK
+      return true;
+      }
 
-// $Revisit - CReis These methods should be changed to macros so that they are faster in debug mode and so that they use the __FUNCSIG__ macro
+    instance--;
+    cstr_p++;
+    }
 
-//---------------------------------------------------------------------------------------
-// # Author(s):  Conan Reis
-void AString::bounds_check(
-  uint32_t     pos,
-  const char * func_name_p
-  ) const
-  {
-  A_VERIFY(
-    pos <= m_str_ref_p->m_length,
-    a_cstr_format("AString::%s() - invalid index\nGiven %u but length only %u, AString:\n%s",
-      func_name_p, pos, m_str_ref_p->m_length, m_str_ref_p->m_cstr_p),
-    AErrId_invalid_index,
-    AString);
+  return false;
   }
 
 //---------------------------------------------------------------------------------------
-// # Author(s):  Conan Reis
-void AString::bounds_check(
-  uint32_t     start_pos,
-  uint32_t     end_pos,
-  const char * func_name_p
+// Finds instance of specified type of character starting from start_pos and ending at
+// end_pos and if found stores the index position found.
+// # Returns:  true if instance character type found, false if not
+// Arg         match_type - classification of characters to match.
+// Arg         instance - occurrence of character type to find.  It may not be less than 1.
+// Arg         find_pos_p - address to store index of instance character type if found.
+//             It is not modified if the character type is not found or if it is nullptr.
+// Arg         start_pos - starting position of search range
+// Arg         end_pos - ending position of search range.  If end_pos is set to
+//             ALength_remainder, the rest of the view is searched.
+// # See:      AString::find(match_type)
+bool AStringView::find(
+  eACharMatch match_type,
+  uint32_t    instance,   // = 1u
+  uint32_t *  find_pos_p, // = nullptr
+  uint32_t    start_pos,  // = 0u
+  uint32_t    end_pos     // = ALength_remainder
   ) const
   {
-  A_VERIFY(
-    ((start_pos < m_str_ref_p->m_length) && (end_pos < m_str_ref_p->m_length) && (start_pos <= end_pos)),
-    a_cstr_format("AString::%s(start_pos %u, end_pos %u) - invalid index(es)\nLength is %u, AString:\n%s",
-      func_name_p, start_pos, end_pos, m_str_ref_p->m_length, m_str_ref_p->m_cstr_p),
-    AErrId_invalid_index_range,
-    AString);
-  }
+  if (end_pos == ALength_remainder)
+    {
+    end_pos = m_length - 1u;
+    }
 
-//---------------------------------------------------------------------------------------
-// # Author(s):  Conan Reis
-void AString::bounds_check(
-  uint32_t     start_pos,
-  uint32_t     end_pos,
-  uint32_t     instance,
-  const char * func_name_p
-  ) const
-  {
-  A_VERIFY(
-    ((start_pos < m_str_ref_p->m_length) && (end_pos <= m_str_ref_p->m_length) && (start_pos <= end_pos) && (instance != 0u)),
-    a_cstr_format("AString::%s(start_pos %u, end_pos %u, instance %u) - invalid index(es)\nLength is %u, AString:\n%s",
-      func_name_p, start_pos, end_pos, instance, m_str_ref_p->m_length, m_str_ref_p->m_cstr_p),
-    AErrId_invalid_index_range,
-    AString);
-  }
+  if ((m_length == 0u) || (start_pos > end_pos))
+    {
+    return false;
+    }
 
-//---------------------------------------------------------------------------------------
-// # Author(s):  Conan Reis
-void AString::span_check(
-  uint32_t     pos,
-  uint32_t     char_count,
-  const char * func_name_p
-  ) const
-  {
-  A_VERIFY(
-    (pos + char_count) <= m_str_ref_p->m_length,
-    a_cstr_format("AString::%s(pos %u, char_count %u) - invalid index(es)\nLength is %u, AString:\n%s",
-      func_name_p, pos, char_count, m_str_ref_p->m_length, m_str_ref_p->m_cstr_p),
-    AErrId_invalid_index_span,
-    AString);
-  }
+  #ifdef A_BOUNDS_CHECK
+    A_VERIFY((end_pos < m_length) && (instance >= 1u), a_cstr_format("AStringView::find(instance %u, start_pos %u, end_pos %u) - invalid argument\nLength is %u", instance, start_pos, end_pos, m_length), AErrId_invalid_index_range, AString);
+  #endif
 
-#endif  // A_BOUNDS_CHECK
+  const bool *    match_table_p = AString::ms_char_match_table[match_type];
+  const uint8_t * cstr_p        = reinterpret_cast<const uint8_t *>(m_cstr_p) + start_pos;
+  const uint8_t * cstr_end_p    = reinterpret_cast<const uint8_t *>(m_cstr_p) + end_pos;
+
+  while ((cstr_p = a_find_match(cstr_p, cstr_end_p, match_table_p)) != nullptr)  // Found one
+    {
+    if (instance == 1u)  // Found it!
+      {
+      if (find_pos_p)
+        {
+        *find_pos_p = uint32_t(cstr_p - reinterpret_cast<const uint8_t *>(m_cstr_p));
+        }
 
+      return true;
+      }
 
-//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
-// Class Internal Methods
-//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+    instance--;
+    cstr_p++;
+    }
+
+  return false;
+  }
 
 //---------------------------------------------------------------------------------------
-// Initializes the character matching / classification table.
-// 
-// Only uses ASCII so as not to be dependent on ANSI Code Pages, etc.
-// Probably should be replaced with more comprehensive Unicode UTF-8 mechanism - though
-// should work with ASCII subset of UTF-8
-// 
-// # Notes
-//   Use the 2 dimensional table ms_char_match_table instead of the standard character
-//   classification functions like isalpha(), isspace(), etc.
-//
-//   ms_char_match_table[ACharMatch_white_space][ch] is the same as isspace(ch)
-//
-//   Always convert characters to unsigned if they are greater than 127. For example, use
-//   ms_char_match_table[ACharMatch_alphabetic][uint8_t(ch)] rather than
-//   ms_char_match_table[ACharMatch_alphabetic][ch].
-//
-//   If the same character classification test is to be used repeatedly, a temporary
-//   variable can be made to remove one level of indirection and use it as a one
-//   dimensional array.  For example:
-//   ```
-//   bool * is_digit_p = ms_char_match_table[ACharMatch_digit];
-//   for (...)
-//     {
-//     ...
-//     if (is_digit_p[ch])
-//     ...
-//     }
-//   ```  
-//                
-// # Examples:  Called at system start-up.
-// # See:       not_char_type()
-// # Author(s): Conan Reis
-void AString::init_match_table()
+// Finds instance of substring str starting from start_pos and ending at end_pos and if
+// found stores the index position found.
+// # Returns:  true if instance of str found, false if not
+// Arg         str - substring to find
+// Arg         instance - occurrence of substring to find.  It may not be less than 1.
+// Arg         find_pos_p - address to store index of instance substring if found.
+//             It is not modified if the substring is not found or if it is nullptr.
+// Arg         start_pos - starting character index of search range
+// Arg         end_pos - ending character index of search range.  If end_pos is set to
+//             ALength_remainder, the rest of the view is searched.
+// Arg         case_check - AStrCase_sensitive or AStrCase_ignore
+// # See:      AString::find(str)
+bool AStringView::find(
+  const AStringView & str,
+  uint32_t            instance,   // = 1u
+  uint32_t *          find_pos_p, // = nullptr
+  uint32_t            start_pos,  // = 0u
+  uint32_t            end_pos,    // = ALength_remainder
+  eAStrCase           case_check  // = AStrCase_sensitive
+  ) const
   {
-  const size_t bool_bytes = sizeof(bool);
+  if (end_pos == ALength_remainder)
+    {
+    end_pos = m_length - 1u;
+    }
 
-  // #################### Affirmative Classifications ####################
+  if ((m_length == 0u) || (start_pos > end_pos))
+    {
+    return false;
+    }
 
-  // Most of the classification tests return false
-  memset(ms_char_match_table, false, bool_bytes * ACharMatch__not_start * AString_ansi_charset_length);
+  #ifdef A_BOUNDS_CHECK
+    A_VERIFY((end_pos < m_length) && (instance >= 1u), a_cstr_format("AStringView::find(instance %u, start_pos %u, end_pos %u) - invalid argument\nLength is %u", instance, start_pos, end_pos, m_length), AErrId_invalid_index_range, AString);
+  #endif
 
-  // Set alphabetic ACharMatch_alphabetic
-  memset(&ms_char_match_table[ACharMatch_alphabetic]['A'], true, bool_bytes * ('Z' - 'A' + 1));
-  memset(&ms_char_match_table[ACharMatch_alphabetic]['a'], true, bool_bytes * ('z' - 'a' + 1));
+  const char * match_p;
+  const char * cstr_p     = m_cstr_p + start_pos;
+  const char * cstr_end_p = m_cstr_p + end_pos + 1u;
 
-  // Set alphanumeric ACharMatch_alphanumeric
-  memcpy(ms_char_match_table[ACharMatch_alphanumeric], ms_char_match_table[ACharMatch_alphabetic], bool_bytes * AString_ansi_charset_length);  // Alphabetic
-  memset(&ms_char_match_table[ACharMatch_alphanumeric]['0'], true, bool_bytes * ('9'- '0' + 1));
+  while ((match_p = a_find_substr_range(cstr_p, cstr_end_p, str.m_cstr_p, str.m_length, case_check)) != nullptr)  // Found one
+    {
+    if (instance == 1u)  // Found it!
+      {
+      if (find_pos_p)
+        {
+        *find_pos_p = uint32_t(match_p - m_cstr_p);
+        }
 
-  // Set alphanumeric ACharMatch_alphascore
-  memcpy(ms_char_match_table[ACharMatch_alphascore], ms_char_match_table[ACharMatch_alphabetic], bool_bytes * AString_ansi_charset_length);  // Alphabetic
-  ms_char_match_table[ACharMatch_alphascore]['_'] = true;
+      return true;
+      }
 
-  // Set digit ACharMatch_DIGIT
-  memset(&ms_char_match_table[ACharMatch_digit]['0'], true, bool_bytes * ('9'- '0' + 1));
+    instance--;
+    cstr_p = match_p + a_max(str.m_length, 1u);  // non-overlapping
+    }
 
-  // Set alphanumeric ACharMatch_identifier
-  memcpy(ms_char_match_table[ACharMatch_identifier], ms_char_match_table[ACharMatch_alphanumeric], bool_bytes * AString_ansi_charset_length);  // Alphanumeric
-  ms_char_match_table[ACharMatch_identifier]['_'] = true;
+  return false;
+  }
 
-  // Set lowercase ACharMatch_lowercase
-  memset(&ms_char_match_table[ACharMatch_lowercase]['a'], true, bool_bytes * ('z' - 'a' + 1));
+//---------------------------------------------------------------------------------------
+// Finds instance of specified character in reverse starting from end_pos and ending at
+// start_pos and if found stores the index position found.
+// # Returns:  true if instance character found, false if not
+// Arg         ch - character to find
+// Arg         instance - occurrence of character to find counting from the end.  It may
+//             not be less than 1.
+// Arg         find_pos_p - address to store index of instance character if found.
+//             It is not modified if the character is not found or if it is nullptr.
+// Arg         start_pos - starting position of search range
+// Arg         end_pos - ending position of search range.  If end_pos is set to
+//             ALength_remainder, the rest of the view is searched.
+// # See:      AString::find_reverse(ch)
+bool AStringView::find_reverse(
+  char       ch,
+  uint32_t   instance,   // = 1u
+  uint32_t * find_pos_p, // = nullptr
+  uint32_t   start_pos,  // = 0u
+  uint32_t   end_pos     // = ALength_remainder
+  ) const
+  {
+  if (end_pos == ALength_remainder)
+    {
+    end_pos = m_length - 1u;
+    }
 
-  // Set Punctuation ACharMatch_punctuation
-  ms_char_match_table[ACharMatch_punctuation]['!'] = true;
-  ms_char_match_table[ACharMatch_punctuation]['"'] = true;
-  ms_char_match_table[ACharMatch_punctuation]['\''] = true;
-  ms_char_match_table[ACharMatch_punctuation]['('] = true;
-  ms_char_match_table[ACharMatch_punctuation][')'] = true;
-  ms_char_match_table[ACharMatch_punctuation][','] = true;
-  ms_char_match_table[ACharMatch_punctuation]['-'] = true;  // Note this could be a hyphen as well as a minus sign
-  ms_char_match_table[ACharMatch_punctuation]['.'] = true;
-  ms_char_match_table[ACharMatch_punctuation][':'] = true;
-  ms_char_match_table[ACharMatch_punctuation][';'] = true;
-  ms_char_match_table[ACharMatch_punctuation]['?'] = true;
-  ms_char_match_table[ACharMatch_punctuation]['['] = true;
-  ms_char_match_table[ACharMatch_punctuation][']'] = true;
-  ms_char_match_table[ACharMatch_punctuation]['{'] = true;
-  ms_char_match_table[ACharMatch_punctuation]['}'] = true;
+  if ((m_length == 0u) || (start_pos > end_pos))
+    {
+    return false;
+    }
+
+  #ifdef A_BOUNDS_CHECK
+    A_VERIFY((end_pos < m_length) && (instance >= 1u), a_cstr_format("AStringView::find_reverse(instance %u, start_pos %u, end_pos %u) - invalid argument\nLength is %u", instance, start_pos, end_pos, m_length), AErrId_invalid_index_range, AString);
+  #endif
 
-  // Set symbol ACharMatch_symbol
-  memset(&ms_char_match_table[ACharMatch_symbol]['#'], true, bool_bytes * ('&' - '#' + 1));
-  ms_char_match_table[ACharMatch_symbol]['*'] = true;
-  ms_char_match_table[ACharMatch_symbol]['+'] = true;
-  ms_char_match_table[ACharMatch_symbol]['-'] = true;  // Note this could be a hyphen as well as a minus sign
-  ms_char_match_table[ACharMatch_symbol]['/'] = true;
-  ms_char_match_table[ACharMatch_symbol]['<'] = true;
-  ms_char_match_table[ACharMatch_symbol]['='] = true;
-  ms_char_match_table[ACharMatch_symbol]['>'] = true;
-  ms_char_match_table[ACharMatch_symbol]['@'] = true;
-  ms_char_match_table[ACharMatch_symbol]['\\'] = true;
-  ms_char_match_table[ACharMatch_symbol]['^'] = true;
-  ms_char_match_table[ACharMatch_symbol]['`'] = true;
-  ms_char_match_table[ACharMatch_symbol]['|'] = true;
-  ms_char_match_table[ACharMatch_symbol]['~'] = true;
+  const char * cstr_p     = m_cstr_p + start_pos;
+  const char * cstr_end_p = m_cstr_p + end_pos;
+  const char * found_p;
 
-  // Set Punctuation and symbols ACharMatch_token
-  memset(&ms_char_match_table[ACharMatch_token]['!'], true, bool_bytes * ('/' - '!' + 1));
-  memset(&ms_char_match_table[ACharMatch_token][':'], true, bool_bytes * ('@' - ':' + 1));
-  memset(&ms_char_match_table[ACharMatch_token]['['], true, bool_bytes * ('`' - '[' + 1));
-  memset(&ms_char_match_table[ACharMatch_token]['{'], true, bool_bytes * ('~' - '{' + 1));
+  while ((cstr_p <= cstr_end_p) && ((found_p = a_find_char_reverse(cstr_p, cstr_end_p, ch)) != nullptr))  // Found one
+    {
+    if (instance == 1u)  // Found it!
+      {
+      if (find_pos_p)
+        {
+        *find_pos_p = uint32_t(found_p - m_cstr_p);
+        }
 
-  // Set alphabetic ACharMatch_uppercase
-  memset(&ms_char_match_table[ACharMatch_uppercase]['A'], true, bool_bytes * ('Z' - 'A' + 1));
+      return true;
+      }
 
-  // Set white space ACharMatch_white_space
-  // Horizontal Tab, Line Feed, Vertical Tab, Form Feed, Carriage Return
-  memset(&ms_char_match_table[ACharMatch_white_space][9], true, bool_bytes * 5);
-  // Space
-  ms_char_match_table[ACharMatch_white_space][' '] = true;
-  
-  
-  // #################### Negative Classifications #######################
+    instance--;
+    cstr_end_p = found_p - 1;
+    }
 
-  // Most of the negative classification tests return true
-  memset(ms_char_match_table[ACharMatch__not_start], true, bool_bytes * ACharMatch__not_start * AString_ansi_charset_length);
+  return false;
+  }
 
-  // Set alphabetic ACharMatch_not_alphabetic
-  memset(&ms_char_match_table[ACharMatch_not_alphabetic]['A'], false, bool_bytes * ('Z' - 'A' + 1));
-  memset(&ms_char_match_table[ACharMatch_not_alphabetic]['a'], false, bool_bytes * ('z' - 'a' + 1));
+//---------------------------------------------------------------------------------------
+// Gets view of substring at index position in between separators from start_pos to
+// end_pos.  Separators that are adjacent to one another count as an empty token.
+// # Returns:  view of substring at index position in between separators or an empty view
+//             if there are fewer than index separators in the range.
+// Arg         index - index position of token to return (zero indexed)
+// Arg         separator - substring to separate on
+// Arg         find_pos_p - address to store index position where the returned token
+//             starts.  It is not modified if index is out of range or if it is nullptr.
+// Arg         start_pos - index position to begin looking
+// Arg         end_pos - index position to stop looking (ALength_remainder = rest of view)
+// Arg         case_check - whether or not the separator search is case sensitive
+// # Examples: AStringView view("one, two, three, four");
+//             AStringView third(view.get_token(2u, ", "));  // = "three"
+// # See:      tokenize(), pop_token(), AString::get_token()
+AStringView AStringView::get_token(
+  uint32_t            index,      // = 0u
+  const AStringView & separator,  // = ms_comma
+  uint32_t *          find_pos_p, // = nullptr
+  uint32_t            start_pos,  // = 0u
+  uint32_t            end_pos,    // = ALength_remainder
+  eAStrCase           case_check  // = AStrCase_sensitive
+  ) const
+  {
+  if (m_length == 0u)
+    {
+    if (find_pos_p && (index == 0u))
+      {
+      *find_pos_p = 0u;
+      }
 
-  // Set alphanumeric ACharMatch_not_alphanumeric
-  memcpy(ms_char_match_table[ACharMatch_not_alphanumeric], ms_char_match_table[ACharMatch_not_alphabetic], bool_bytes * AString_ansi_charset_length);  // Alphabetic
-  memset(&ms_char_match_table[ACharMatch_not_alphanumeric]['0'], false, bool_bytes * ('9'- '0' + 1));
+    return AStringView();
+    }
 
-  // Set alphanumeric ACharMatch_not_alphascore
-  memcpy(ms_char_match_table[ACharMatch_not_alphascore], ms_char_match_table[ACharMatch_not_alphabetic], bool_bytes * AString_ansi_charset_length);  // Alphabetic
-  ms_char_match_table[ACharMatch_not_alphascore]['_'] = false;
+  if (end_pos == ALength_remainder)
+    {
+    end_pos = m_length - 1u;
+    }
 
-  // Set digit ACharMatch_not_digit
-  memset(&ms_char_match_table[ACharMatch_not_digit]['0'], false, bool_bytes * ('9'- '0' + 1));
+  // Get starting position
+  if (index)
+    {
+    if (!find(separator, index, &start_pos, start_pos, end_pos, case_check))
+      {
+      return AStringView();
+      }
 
-  // Set alphanumeric ACharMatch_not_identifier
-  memcpy(ms_char_match_table[ACharMatch_not_identifier], ms_char_match_table[ACharMatch_not_alphanumeric], bool_bytes * AString_ansi_charset_length);  // Alphanumeric
-  ms_char_match_table[ACharMatch_not_identifier]['_'] = false;
+    start_pos += separator.m_length;
+    }
 
-  // Set lowercase ACharMatch_not_lowercase
-  memset(&ms_char_match_table[ACharMatch_not_lowercase]['a'], false, bool_bytes * ('z' - 'a' + 1));
+  // Get ending position
+  if (!find(separator, 1u, &end_pos, start_pos, end_pos, case_check))
+    {
+    end_pos++;
+    }
 
-  // Set Punctuation ACharMatch_not_punctuation
-  ms_char_match_table[ACharMatch_not_punctuation]['!'] = false;
-  ms_char_match_table[ACharMatch_not_punctuation]['"'] = false;
-  ms_char_match_table[ACharMatch_not_punctuation]['\''] = false;
-  ms_char_match_table[ACharMatch_not_punctuation]['('] = false;
-  ms_char_match_table[ACharMatch_not_punctuation][')'] = false;
-  ms_char_match_table[ACharMatch_not_punctuation][','] = false;
-  ms_char_match_table[ACharMatch_not_punctuation]['-'] = false;  // Note this could be a hyphen as well as a minus sign
-  ms_char_match_table[ACharMatch_not_punctuation]['.'] = false;
-  ms_char_match_table[ACharMatch_not_punctuation][':'] = false;
-  ms_char_match_table[ACharMatch_not_punctuation][';'] = false;
-  ms_char_match_table[ACharMatch_not_punctuation]['?'] = false;
-  ms_char_match_table[ACharMatch_not_punctuation]['['] = false;
-  ms_char_match_table[ACharMatch_not_punctuation][']'] = false;
-  ms_char_match_table[ACharMatch_not_punctuation]['{'] = false;
-  ms_char_match_table[ACharMatch_not_punctuation]['}'] = false;
+  if (find_pos_p)
+    {
+    *find_pos_p = start_pos;
+    }
 
-  // Set symbol ACharMatch_not_symbol
-  memset(&ms_char_match_table[ACharMatch_not_symbol]['#'], false, bool_bytes * ('&' - '#' + 1));
-  ms_char_match_table[ACharMatch_not_symbol]['*'] = false;
-  ms_char_match_table[ACharMatch_not_symbol]['+'] = false;
-  ms_char_match_table[ACharMatch_not_symbol]['-'] = false;  // Note this could be a hyphen as well as a minus sign
-  ms_char_match_table[ACharMatch_not_symbol]['/'] = false;
-  ms_char_match_table[ACharMatch_not_symbol]['<'] = false;
-  ms_char_match_table[ACharMatch_not_symbol]['='] = false;
-  ms_char_match_table[ACharMatch_not_symbol]['>'] = false;
-  ms_char_match_table[ACharMatch_not_symbol]['@'] = false;
-  ms_char_match_table[ACharMatch_not_symbol]['\\'] = false;
-  ms_char_match_table[ACharMatch_not_symbol]['^'] = false;
-  ms_char_match_table[ACharMatch_not_symbol]['`'] = false;
-  ms_char_match_table[ACharMatch_not_symbol]['|'] = false;
-  ms_char_match_table[ACharMatch_not_symbol]['~'] = false;
+  return AStringView(m_cstr_p + start_pos, end_pos - start_pos);
+  }
 
-  // Set Punctuation and symbols ACharMatch_not_token
-  memset(&ms_char_match_table[ACharMatch_not_token]['!'], false, bool_bytes * ('/' - '!' + 1));
-  memset(&ms_char_match_table[ACharMatch_not_token][':'], false, bool_bytes * ('@' - ':' + 1));
-  memset(&ms_char_match_table[ACharMatch_not_token]['['], false, bool_bytes * ('`' - '[' + 1));
-  memset(&ms_char_match_table[ACharMatch_not_token]['{'], false, bool_bytes * ('~' - '{' + 1));
+//---------------------------------------------------------------------------------------
+// Splits this view from start_pos to end_pos into views of the substrings between
+// separators - no characters are copied and nothing is allocated.
+// # Returns:  number of tokens in the range.  If it is more than token_max only the first
+//             token_max tokens were stored.
+// Arg         tokens_p - array to store up to token_max token views in
+// Arg         token_max - number of elements in tokens_p
+// Arg         separator - substring to split on
+// Arg         start_pos - character index position to begin tokenization
+// Arg         end_pos - character index position to end tokenization.  If end_pos is
+//             ALength_remainder, then end_pos is set to the last character position.
+// Arg         case_check - whether or not the separator search is case sensitive
+// # Examples: AStringView fields[4];
+//
+//             AStringView("a,b,,c").tokenize(fields, 4u);  // "a", "b", "", "c"
+// # Notes:    Separators that are adjacent to one another count as an empty token.
+//             An empty view results in no tokens.
+// # See:      get_token(), pop_token(), AString::tokenize()
+uint32_t AStringView::tokenize(
+  AStringView *       tokens_p,
+  uint32_t            token_max,
+  const AStringView & separator,  // = ms_comma
+  uint32_t            start_pos,  // = 0u
+  uint32_t            end_pos,    // = ALength_remainder
+  eAStrCase           case_check  // = AStrCase_sensitive
+  ) const
+  {
+  if (m_length == 0u)
+    {
+    return 0u;
+    }
 
-  // Set alphabetic ACharMatch_not_uppercase
-  memset(&ms_char_match_table[ACharMatch_not_uppercase]['A'], false, bool_bytes * ('Z' - 'A' + 1));
+  if (end_pos == ALength_remainder)
+    {
+    end_pos = m_length - 1u;
+    }
 
-  // Set white space ACharMatch_not_white_space
-  // Horizontal Tab, Line Feed, Vertical Tab, Form Feed, Carriage Return
-  memset(&ms_char_match_table[ACharMatch_not_white_space][9], false, bool_bytes * 5);
-  // Space
-  ms_char_match_table[ACharMatch_not_white_space][' '] = false;
+  #ifdef A_BOUNDS_CHECK
+    A_VERIFY((start_pos <= end_pos + 1u) && (end_pos < m_length), a_cstr_format("AStringView::tokenize(start_pos %u, end_pos %u) - invalid index(es)\nLength is %u", start_pos, end_pos, m_length), AErrId_invalid_index_range, AString);
+  #endif
+
+  const char * match_p;
+  const char * sep_p      = separator.m_cstr_p;
+  uint32_t     sep_length = separator.m_length;
+  const char * cstr_p     = m_cstr_p + start_pos;
+  const char * cstr_end_p = m_cstr_p + end_pos + 1u;
+  uint32_t     count      = 0u;
+
+  while (sep_length
+    && ((match_p = a_find_substr_range(cstr_p, cstr_end_p, sep_p, sep_length, case_check)) != nullptr))
+    {
+    if (count < token_max)
+      {
+      tokens_p[count] = AStringView(cstr_p, uint32_t(match_p - cstr_p));
+      }
+
+    count++;
+    cstr_p = match_p + sep_length;
+    }
+
+  if (count < token_max)
+    {
+    tokens_p[count] = AStringView(cstr_p, uint32_t(cstr_end_p - cstr_p));
+    }
+
+  return count + 1u;
   }
 
 
 //#######################################################################################
-// AStringBM Class
+// AStringBuilder Class
 //#######################################################################################
 
 //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
@@ -4780,55 +6509,68 @@ void AString::init_match_table()
 //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
 
 //---------------------------------------------------------------------------------------
-// Normal constructor from string.
-// # Author(s): Conan Reis
-AStringBM::AStringBM(
-  const AString & str,       // = ms_empty
-  eAStrCase       case_check // = AStrCase_sensitive
+// Constructor
+// Arg         reserve_chars - number of characters to initially reserve space for.  If
+//             it is 0 then no buffer is allocated until the first append.
+AStringBuilder::AStringBuilder(
+  uint32_t reserve_chars // = AString_builder_reserve_def
   ) :
-  AString(str),
-  m_case(case_check)
+  m_cstr_p(const_cast<char *>("")),
+  m_length(0u),
+  m_size(0u)
   {
-  uint32_t pos    = 0u;
-  uint32_t length = m_str_ref_p->m_length;  // get length of pattern
-  uint32_t offset = length - 1u;
-
-  if (case_check == AStrCase_ignore)
+  if (reserve_chars)
     {
-    lowercase();
+    grow(reserve_chars);
     }
+  }
 
-  char *    cstr_p  = m_str_ref_p->m_cstr_p;  // for quicker access
-  uint8_t * delta_p = m_delta_p;              // for quicker access
-
-  memset(m_delta_p, int(length), static_cast<size_t>(AString_ansi_charset_length));
-
-  for (; pos < length; pos++)  // set table values
+//---------------------------------------------------------------------------------------
+// Destructor
+AStringBuilder::~AStringBuilder()
+  {
+  if (m_size)
     {
-    delta_p[static_cast<uint32_t>(cstr_p[pos])] = uint8_t(offset - pos);
+    AStringRef::free_buffer(m_cstr_p);
     }
   }
 
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// Converter Methods
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
 //---------------------------------------------------------------------------------------
-// Copy constructor.
-// # Author(s): Conan Reis
-AStringBM::AStringBM(const AStringBM & bm) :
-  AString(bm),
-  m_case(bm.m_case)
+// Makes a new string with a copy of the characters built so far - the builder is left
+// as is.
+// # Returns:  new string
+// # See:      pop_string() which does not copy
+AString AStringBuilder::as_string() const
   {
-  memcpy(m_delta_p, bm.m_delta_p, static_cast<size_t>(AString_ansi_charset_length));  // copy contents of source
+  return AString(m_cstr_p, m_length, false);
   }
 
 //---------------------------------------------------------------------------------------
-// Assignment operator.
-// # Author(s): Conan Reis
-const AStringBM & AStringBM::operator=(const AStringBM & bm)
+// Hands the built characters over to a new AString without copying them and leaves the
+// builder empty and without a buffer.
+// # Returns:  string that owns the builder's former buffer
+// # Notes:    The string keeps any unused space at the end of the buffer - call
+//             AString::compact() on it if it is going to be kept around for a while.
+// # See:      as_string() which copies
+AString AStringBuilder::pop_string()
   {
-  AString::operator=(bm);
-  m_case = bm.m_case;
-  memcpy(m_delta_p, bm.m_delta_p, static_cast<size_t>(AString_ansi_charset_length));  // copy contents of source
+  if (m_size == 0u)
+    {
+    return AString::ms_empty;
+    }
 
-  return *this;
+  AString str(m_cstr_p, m_size, m_length, true);
+
+  m_cstr_p = const_cast<char *>("");
+  m_length = 0u;
+  m_size   = 0u;
+
+  return str;
   }
 
 
@@ -4837,34 +6579,151 @@ const AStringBM & AStringBM::operator=(const AStringBM & bm)
 //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
 
 //---------------------------------------------------------------------------------------
-// Converter from AString to existing AStringBM.
-// # Author(s): Conan Reis
-void AStringBM::convert(
-  const AString & str,
-  eAStrCase       case_check // = AStrCase_sensitive
+// Appends a character repeated char_count times.
+// Arg         ch - character to append
+// Arg         char_count - number of times to append ch
+// # Examples: builder.append(' ', indent);
+void AStringBuilder::append(
+  char     ch,
+  uint32_t char_count
   )
   {
-  uint32_t pos    = 0u;
-  uint32_t length = str.m_str_ref_p->m_length;  // get length of pattern
-  uint32_t offset = length - 1u;
+  uint32_t new_length = m_length + char_count;
 
-  AString::operator=(str);
-  m_case = case_check;
+  ensure_size(new_length);
+  ::memset(m_cstr_p + m_length, ch, char_count);
+  m_cstr_p[new_length] = '\0';
+  m_length             = new_length;
+  }
 
-  if (case_check == AStrCase_ignore)
+//---------------------------------------------------------------------------------------
+// Appends the formatted string - see AString::append_format() for a description of the
+// format string.
+// Arg         format_str_p - standard printf() style format string
+// Arg         ... - variable length arguments expected by the format string
+// # Notes:    Unlike AString::append_format() the result is never truncated - if it does
+//             not fit in the current buffer then the buffer is grown and the string is
+//             formatted again.
+// # See:      append_int(), append_float(), etc. which are faster for single numbers
+void AStringBuilder::append_format(const char * format_str_p, ...)
+  {
+  va_list args;
+  int     fmt_length;
+  int     free_size;
+
+  // Ensure at least a little room so that most formats succeed on the first try
+  ensure_size(m_length + AString_int32_max_chars);
+
+  while (true)
     {
-    lowercase();
+    free_size = int(m_size - m_length) - 1;  // excluding null terminator
+
+    va_start(args, format_str_p);
+
+    #ifdef A_PLAT_PS3
+      fmt_length = vsnprintf(m_cstr_p + m_length, size_t(free_size + 1), format_str_p, args);
+    #else
+      fmt_length = _vsnprintf(m_cstr_p + m_length, size_t(free_size), format_str_p, args);
+    #endif
+
+    va_end(args);
+
+    // Some implementations return -1 when the buffer is too small and others the length
+    // that would have been needed - either way try again with a larger buffer.
+    if ((fmt_length >= 0) && (fmt_length < free_size))
+      {
+      break;
+      }
+
+    grow((fmt_length > free_size) ? m_length + uint32_t(fmt_length) : m_size);
     }
 
-  char *    cstr_p  = str.m_str_ref_p->m_cstr_p;  // for quicker access
-  uint8_t * delta_p = m_delta_p;              // for quicker access
+  m_length += uint32_t(fmt_length);
+  m_cstr_p[m_length] = '\0';
+  }
 
-  memset(m_delta_p, int(length), static_cast<size_t>(AString_ansi_charset_length));
+//---------------------------------------------------------------------------------------
+// Appends a signed integer - see AString::ctor_int()
+// Arg         integer - signed integer to append
+// Arg         base - base (or radix) to use for conversion
+void AStringBuilder::append_int(
+  int  integer,
+  uint base // = AString_def_base (10)
+  )
+  {
+  ensure_size(m_length + AString_int32_max_chars);
+  m_length += a_int_to_cstr(integer, base, m_cstr_p + m_length);
+  m_cstr_p[m_length] = '\0';
+  }
 
-  for (; pos < length; pos++)  // set table values
+//---------------------------------------------------------------------------------------
+// Appends an unsigned integer - see AString::ctor_uint()
+// Arg         natural - unsigned integer to append
+// Arg         base - base (or radix) to use for conversion
+void AStringBuilder::append_uint(
+  uint natural,
+  uint base // = AString_def_base (10)
+  )
+  {
+  ensure_size(m_length + AString_int32_max_chars);
+  m_length += a_uint_to_cstr(natural, base, m_cstr_p + m_length);
+  m_cstr_p[m_length] = '\0';
+  }
+
+//---------------------------------------------------------------------------------------
+// Appends a f32 - see AString::ctor_float()
+// Arg         real - f32 to append
+// Arg         significant - number of significant digits
+void AStringBuilder::append_float(
+  f32  real,
+  uint significant // = AString_float_sig_digits_def
+  )
+  {
+  ensure_size(m_length + significant + AString_real_extra_chars);
+  m_length += a_real_to_cstr(f64(real), true, significant, true, m_cstr_p + m_length);
+  m_cstr_p[m_length] = '\0';
+  }
+
+//---------------------------------------------------------------------------------------
+// Appends a f64 - see AString::ctor_float64()
+// Arg         real - f64 to append
+// Arg         significant - number of significant digits
+void AStringBuilder::append_float64(
+  f64  real,
+  uint significant // = AString_double_sig_digits_def
+  )
+  {
+  ensure_size(m_length + significant + AString_real_extra_chars);
+  m_length += a_real_to_cstr(real, false, significant, true, m_cstr_p + m_length);
+  m_cstr_p[m_length] = '\0';
+  }
+
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// Internal Methods
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+//---------------------------------------------------------------------------------------
+// Reallocates the buffer so that it can store at least needed_chars characters plus a
+// null terminator.  The buffer at least doubles in size each time and any slack the
+// memory system would add to the allocation anyway is used.
+// Arg         needed_chars - total number of characters (not including the null
+//             terminator) that need to fit
+// # See:      ensure_size()
+void AStringBuilder::grow(uint32_t needed_chars)
+  {
+  uint32_t size     = AStringRef::request_char_count(a_max(needed_chars, m_size << 1u));
+  char *   buffer_p = AStringRef::alloc_buffer(size);
+
+  ::memcpy(buffer_p, m_cstr_p, m_length + 1u);
+
+  if (m_size)
     {
-    delta_p[static_cast<uint32_t>(cstr_p[pos])] = uint8_t(offset - pos);
+    AStringRef::free_buffer(m_cstr_p);
     }
+
+  m_cstr_p = buffer_p;
+  m_size   = size;
   }
 
 
@@ -70,6 +70,72 @@ AStringRef * AStringRef::reuse_or_new(
   return AStringRef::pool_new(cstr_p, length, size, 1u, deallocate, false);
   }
 
+//---------------------------------------------------------------------------------------
+// Reuses this string reference if it can - otherwise retrieves a string reference object
+// from the dynamic pool - and gives it a unique writable buffer large enough for
+// `needed_chars` characters plus a null terminator.  The embedded small buffer is used
+// if it is large enough, otherwise a buffer is allocated.
+// 
+// # Params:
+//   needed_chars: minimum number of characters to store not counting null terminator
+//   cstr_p:       characters to copy into the new buffer - may point into the current
+//                 buffer of this string reference
+//   length:       number of characters to copy from `cstr_p` - clamped to the capacity
+//                 of the new buffer
+//   
+// # Returns:   unique writable AStringRef with `m_length` set and null terminated
+// # See:       reuse_or_new(), pool_new_buffer()
+AStringRef * AStringRef::reuse_or_new_buffer(
+  uint32_t     needed_chars,
+  const char * cstr_p,
+  uint32_t     length
+  )
+  {
+  if (needed_chars >= AStringRef_small_size)
+    {
+    uint32_t size     = request_char_count(needed_chars);
+    char *   buffer_p = alloc_buffer(size);
+
+    length = a_min(length, size - 1u);
+    memcpy(buffer_p, cstr_p, length);
+    buffer_p[length] = '\0';
+
+    return reuse_or_new(buffer_p, length, size);
+    }
+
+  length = a_min(length, uint32_t(AStringRef_small_size - 1u));
+
+  // If unique
+  if (m_ref_count == 1u)
+    {
+    // May overlap if already using embedded buffer
+    memmove(m_small_a, cstr_p, length);
+    m_small_a[length] = '\0';
+
+    if (m_deallocate)
+      {
+      AStringRef::free_buffer(m_cstr_p);
+      }
+
+    m_cstr_p     = m_small_a;
+    m_size       = AStringRef_small_size;
+    m_length     = length;
+    m_deallocate = false;
+    m_read_only  = false;
+
+    return this;
+    }
+
+  // Shared - copy prior to dereference
+  AStringRef * str_ref_p = pool_new_buffer(needed_chars, length, 1u);
+
+  memcpy(str_ref_p->m_cstr_p, cstr_p, length);
+  str_ref_p->m_cstr_p[length] = '\0';
+  dereference();
+
+  return str_ref_p;
+  }
+
 //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
 // Class Methods
 //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
@@ -126,19 +192,62 @@ AStringRef * AStringRef::pool_new_copy(
   bool         read_only  // = false
   )
   {
-  AStringRef * str_ref_p   = get_pool().pop();
-  uint32_t     size        = request_char_count(length);
-  char *       copy_cstr_p = alloc_buffer(size);
+  AStringRef * str_ref_p   = pool_new_buffer(length, length, ref_count);
+  char *       copy_cstr_p = str_ref_p->m_cstr_p;
 
   memcpy(copy_cstr_p, cstr_p, length);
   copy_cstr_p[length] = '\0';  // Put in null-terminator
 
-  str_ref_p->m_cstr_p     = copy_cstr_p;
-  str_ref_p->m_length     = length;
-  str_ref_p->m_size       = size;
-  str_ref_p->m_ref_count  = ref_count;
-  str_ref_p->m_deallocate = true;
-  str_ref_p->m_read_only  = read_only;
+  str_ref_p->m_read_only = read_only;
+
+  return str_ref_p;
+  }
+
+//---------------------------------------------------------------------------------------
+// Retrieves a string reference object from the dynamic pool and initializes it with a
+// writable buffer large enough for `needed_chars` characters plus a null terminator.
+// Short strings use the buffer embedded in the AStringRef so they only cost a pool pop,
+// longer strings get an allocated buffer.
+// 
+// # Notes:
+//   The buffer contents are left uninitialized - the caller is expected to fill in the
+//   characters and null terminator via `m_cstr_p`.  `m_size` is set to the actual
+//   capacity which may be larger than requested.
+//   
+// # Returns:   a dynamic AStringRef
+// # Params:
+//   needed_chars: minimum number of characters to store not counting null terminator
+//   length:       initial value for `m_length`
+//   ref_count:    initial reference count
+//   
+// # See:       pool_new(), pool_new_copy(), reuse_or_new_buffer()
+// # Modifiers: static
+AStringRef * AStringRef::pool_new_buffer(
+  uint32_t needed_chars,
+  uint32_t length,
+  uint16_t ref_count
+  )
+  {
+  AStringRef * str_ref_p = get_pool().pop();
+
+  if (needed_chars < AStringRef_small_size)
+    {
+    str_ref_p->m_cstr_p     = str_ref_p->m_small_a;
+    str_ref_p->m_size       = AStringRef_small_size;
+    str_ref_p->m_deallocate = false;
+    }
+  else
+    {
+    uint32_t size = request_char_count(needed_chars);
+
+    str_ref_p->m_cstr_p     = alloc_buffer(size);
+    str_ref_p->m_size       = size;
+    str_ref_p->m_deallocate = true;
+    }
+
+  str_ref_p->m_length    = length;
+  str_ref_p->m_ref_count = ref_count;
+  str_ref_p->m_read_only = false;
 
   return str_ref_p;
   }
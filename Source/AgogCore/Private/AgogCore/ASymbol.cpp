@@ -265,6 +265,49 @@ ASymbol ASymbol::create(
   #endif
   }
 
+//---------------------------------------------------------------------------------------
+// Creates a new symbol based on the supplied string using an id that was already
+//             computed - usually at compile time via ASYMBOL_LITERAL_TO_ID().  This skips
+//             hashing the string and if there is no string database the string is ignored.
+// # Returns:  new symbol
+// Arg         sym_id - id of the string - must be the same as ASYMBOL_CSTR_TO_ID() of
+//             'cstr_p' and 'length'.
+// Arg         cstr_p - pointer to array of characters (does not need to be null
+//             terminated).  It will usually be a string literal or if 'term' is
+//             ATerm_short, 'cstr_p' may be any C-String that this string could make a copy of.
+// Arg         length - number of characters to use in 'cstr_p' - must not be 0.
+// Arg         term - lifespan of cstr_p: ATerm_long if can just reference cstr_p or
+//             ATerm_short if a copy should be made.
+// # See:      ASYMBOL_DEFINE_STR()
+// # Modifiers: static
+ASymbol ASymbol::create_with_id(
+  uint32_t     sym_id,
+  const char * cstr_p,
+  uint32_t     length,
+  eATerm       term    // = ATerm_long
+  )
+  {
+  A_ASSERTX(
+    sym_id == ASYMBOL_CSTR_TO_ID(cstr_p, length),
+    AErrMsg(
+      a_str_format(
+        "Tried to create symbol '%.*s' with id 0x%X but its id should be 0x%X!",
+        length,
+        cstr_p,
+        sym_id,
+        ASYMBOL_CSTR_TO_ID(cstr_p, length)),
+      AErrLevel_notify));
+
+  #if defined(A_SYMBOL_REF_LINK)
+    return ASymbolTable::ms_main_p->symbol_reference(sym_id, cstr_p, length, term);
+  #elif defined(A_SYMBOL_STR_DB)
+    ASYMBOL_CSTR_STORE(sym_id, cstr_p, length, term);
+    return sym_id;
+  #else
+    return sym_id;
+  #endif
+  }
+
 //---------------------------------------------------------------------------------------
 // Gets the symbol based on the given binary.
 //             Uses the *main* symbol table.
@@ -499,6 +542,19 @@ void ASymbol::table_from_binary(const void ** binary_pp)
     }
 }
 
+//---------------------------------------------------------------------------------------
+// Merges a symbol table binary made by ASymbolTable::as_binary_resident() into the main
+// symbol table without copying it.
+// Arg         binary_pp - Pointer to address to read from and increment.  The binary
+//             must stay resident (for example memory mapped) for as long as the main
+//             symbol table uses it - see ASymbolTable::merge_binary_resident().
+// # See:      table_from_binary()
+// # Modifiers: static
+void ASymbol::table_from_binary_resident(const void ** binary_pp)
+  {
+  ASymbolTable::ms_main_p->merge_binary_resident(binary_pp);
+  }
+
 //---------------------------------------------------------------------------------------
 // Sets the optional serialization tracking table.  It keeps track of any
 //             symbol that is serialized - i.e. whenever as_binary(sym, binary_pp) is
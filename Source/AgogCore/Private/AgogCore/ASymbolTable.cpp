@@ -29,11 +29,100 @@
 // ASymbolTable::ms_main_p  - defined in AgogCore.cpp
 
 
+#if defined(A_SYMBOLTABLE_CLASSES)
+
 //=======================================================================================
-// Method Definitions
+// Local Global Structures
 //=======================================================================================
 
-#if defined(A_SYMBOLTABLE_CLASSES)
+namespace
+{
+
+  // Length of a symbol id in the form |#12345678#| - see ASymbol::id_as_str()
+  const uint32_t ASymbol_id_str_length = 12u;
+
+  //---------------------------------------------------------------------------------------
+  // Finds the next symbol id in the form |#12345678#| - only the delimiters are checked.
+  // Returns:  start of id or nullptr if there are no more
+  // Arg       cstr_p - start of characters to search
+  // Arg       cstr_end_p - end of characters to search (exclusive)
+  const char * a_find_id_marker(
+    const char * cstr_p,
+    const char * cstr_end_p
+    )
+    {
+    while ((cstr_end_p - cstr_p) >= ptrdiff_t(ASymbol_id_str_length))
+      {
+      cstr_p = static_cast<const char *>(
+        ::memchr(cstr_p, '|', size_t(cstr_end_p - cstr_p) - ASymbol_id_str_length + 1u));
+
+      if (cstr_p == nullptr)
+        {
+        return nullptr;
+        }
+
+      if ((cstr_p[1u] == '#')
+        && (cstr_p[ASymbol_id_str_length - 2u] == '#')
+        && (cstr_p[ASymbol_id_str_length - 1u] == '|'))
+        {
+        return cstr_p;
+        }
+
+      cstr_p++;
+      }
+
+    return nullptr;
+    }
+
+  //---------------------------------------------------------------------------------------
+  // Parses the 8 hexadecimal digits of a symbol id found with a_find_id_marker().
+  // Returns:  true if valid and false if not
+  // Arg       marker_p - start of symbol id in the form |#12345678#|
+  // Arg       sym_id_p - address to store parsed id
+  bool a_parse_id_marker(
+    const char * marker_p,
+    uint32_t *   sym_id_p
+    )
+    {
+    uint32_t     sym_id       = 0u;
+    const char * digit_p      = marker_p + 2u;
+    const char * digits_end_p = digit_p + 8u;
+    uint32_t     ch;
+
+    for (; digit_p < digits_end_p; digit_p++)
+      {
+      ch = uint8_t(*digit_p);
+
+      if ((ch - '0') <= 9u)
+        {
+        ch -= '0';
+        }
+      else
+        {
+        ch = (ch | 0x20u) - 'a';  // Lowercase
+
+        if (ch > 5u)
+          {
+          return false;
+          }
+
+        ch += 10u;
+        }
+
+      sym_id = (sym_id << 4u) | ch;
+      }
+
+    *sym_id_p = sym_id;
+
+    return true;
+    }
+
+} // End unnamed namespace
+
+
+//=======================================================================================
+// Method Definitions
+//=======================================================================================
 
 //---------------------------------------------------------------------------------------
 // Default constructor
@@ -262,6 +351,8 @@ void ASymbolTable::assign_binary(const void ** binary_pp)
       sym_id);
     (*(uint8_t **)binary_pp) += str_len;
     }
+
+  m_sym_refs.set_length_unsafe(length);
   }
 
 //---------------------------------------------------------------------------------------
@@ -319,6 +410,126 @@ void ASymbolTable::merge_binary(const void ** binary_pp)
     }
   }
 
+//---------------------------------------------------------------------------------------
+// Fills memory pointed to by binary_pp with this symbol table in a form whose strings
+// can be referenced in place by merge_binary_resident() - for example after memory
+// mapping it - and increments the memory address to just past the last byte written.
+// Arg         binary_pp - Pointer to address to fill and increment.  Its size *must* be
+//             large enough to fit all the binary data - see as_binary_resident_length().
+//             It should be 4-byte aligned.
+// # See:      as_binary_resident_length(), merge_binary_resident(), as_binary()
+// # Notes:    Binary composition:
+//               4 bytes       - ASymbolTable_resident_tag
+//               4 bytes       - number of symbols (n)
+//               n * 4 bytes   - symbol ids in ascending order
+//               n+1 * 4 bytes - byte offset of each string in the string block with the
+//                               last offset being the size of the string block
+//               string block  - null-terminated strings in symbol id order
+//
+//             Unlike as_binary() all the numbers are 4-byte aligned and the strings are
+//             null-terminated so that they can be referenced where they are.
+void ASymbolTable::as_binary_resident(void ** binary_pp) const
+  {
+  uint32_t value  = ASymbolTable_resident_tag;
+  uint32_t length = m_sym_refs.get_length();
+
+  // 4 bytes - ASymbolTable_resident_tag
+  A_BYTE_STREAM_OUT32(binary_pp, &value);
+
+  // 4 bytes - number of symbols
+  A_BYTE_STREAM_OUT32(binary_pp, &length);
+
+  ASymbolRef ** syms_pp     = m_sym_refs.get_array();
+  ASymbolRef ** syms_end_pp = syms_pp + length;
+  ASymbolRef ** sym_pp;
+
+  // n * 4 bytes - symbol ids
+  for (sym_pp = syms_pp; sym_pp < syms_end_pp; sym_pp++)
+    {
+    A_BYTE_STREAM_OUT32(binary_pp, &(*sym_pp)->m_uid);
+    }
+
+  // n+1 * 4 bytes - string offsets
+  value = 0u;
+  A_BYTE_STREAM_OUT32(binary_pp, &value);
+
+  for (sym_pp = syms_pp; sym_pp < syms_end_pp; sym_pp++)
+    {
+    value += (*sym_pp)->m_str_ref_p->m_length + 1u;
+    A_BYTE_STREAM_OUT32(binary_pp, &value);
+    }
+
+  // string block
+  AStringRef * str_ref_p;
+
+  for (sym_pp = syms_pp; sym_pp < syms_end_pp; sym_pp++)
+    {
+    str_ref_p = (*sym_pp)->m_str_ref_p;
+    ::memcpy(*binary_pp, str_ref_p->m_cstr_p, str_ref_p->m_length + 1u);
+    (*(uint8_t **)binary_pp) += str_ref_p->m_length + 1u;
+    }
+  }
+
+//---------------------------------------------------------------------------------------
+// Get byte size needed for binary memory stream made by as_binary_resident().
+// # See:      as_binary_resident()
+uint32_t ASymbolTable::as_binary_resident_length() const
+  {
+  // Same as as_binary() except for tag(4) + last offset(4) + symbol_length * (offset(4)
+  // + null(1)) instead of symbol_length * string_length(1)
+  return as_binary_length() + 4u + (4u * m_sym_refs.get_length());
+  }
+
+//---------------------------------------------------------------------------------------
+// Merges symbols from a binary made by as_binary_resident() into this table without
+// copying their strings.
+//
+// The strings of the new symbols are read-only references into the binary so it *must*
+// stay resident (for example memory mapped or held in a SSBinaryHandle) until empty() is
+// called or this table is destructed.
+//
+// Arg         binary_pp - Pointer to address to read from and increment.
+// # See:      as_binary_resident(), merge_binary()
+// # Notes:    Symbols already in this table keep precedence over the same symbols in the
+//             binary so existing ASymbol objects are unaffected.
+//
+//             The ids in the binary are in ascending order so when merging into an empty
+//             table each symbol is appended to the end of the sorted symbols.
+void ASymbolTable::merge_binary_resident(const void ** binary_pp)
+  {
+  // 4 bytes - ASymbolTable_resident_tag
+  uint32_t tag = A_BYTE_STREAM_UI32_INC(binary_pp);
+
+  A_VERIFYX(
+    tag == ASymbolTable_resident_tag,
+    "Binary was not made by ASymbolTable::as_binary_resident()!");
+
+  // 4 bytes - number of symbols
+  uint32_t length = A_BYTE_STREAM_UI32_INC(binary_pp);
+
+  const uint32_t * ids_p     = static_cast<const uint32_t *>(*binary_pp);
+  const uint32_t * offsets_p = ids_p + length;
+  const char *     strs_p    = reinterpret_cast<const char *>(offsets_p + length + 1u);
+  uint32_t         idx;
+  uint32_t         offset;
+  uint32_t         next_offset;
+
+  *binary_pp = strs_p + A_BYTE_STREAM_UI32(offsets_p + length);
+
+  // Assume that there will be no overlap
+  m_sym_refs.ensure_size(m_sym_refs.get_length() + length);
+
+  offset = 0u;
+
+  for (idx = 0u; idx < length; idx++)
+    {
+    next_offset = A_BYTE_STREAM_UI32(offsets_p + idx + 1u);
+
+    // ATerm_long references the characters in place rather than copying them
+    symbol_reference(A_BYTE_STREAM_UI32(ids_p + idx), strs_p + offset, next_offset - offset - 1u, ATerm_long);
+    offset = next_offset;
+    }
+  }
 
 #if defined(A_SYMBOL_REF_COUNT)
 
@@ -493,83 +704,100 @@ bool ASymbolTable::translate_known_id(
 // # Params:
 //   str_p: pointer to string to convert
 //   
+// # See:  translate_ids(str, out_p) which this uses
 // # Author(s): Conan Reis
 bool ASymbolTable::translate_ids(AString * str_p) const
   {
   uint32_t length = str_p->get_length();
 
-  const uint32_t ASymbol_id_str_length = 12u;
-
-  if (length < ASymbol_id_str_length)
+  // Nothing to do unless there is at least one id - the usual case
+  if ((length < ASymbol_id_str_length)
+    || (a_find_id_marker(str_p->as_cstr(), str_p->as_cstr() + length) == nullptr))
     {
     return true;
     }
 
-  bool     sym_replaced;
-  bool     translated = true;
-  uint32_t sym_id;
-  uint32_t str_length;
-  uint32_t find_idx;
-  uint32_t end_idx;
-  uint32_t start_idx = 0u;
-  uint32_t max_idx   = length - ASymbol_id_str_length;
-
-  AString sym_str;
-
-  const char * cstr_p = str_p->as_cstr();
-
-  // If found special |#12345678#| pattern
-  while ((start_idx <= max_idx)
-    && str_p->find('|', 1u, &find_idx, start_idx)
-    && (find_idx <= max_idx)
-    && (cstr_p[find_idx + 1u] == '#')
-    && (cstr_p[find_idx + ASymbol_id_str_length - 2u] == '#')
-    && (cstr_p[find_idx + ASymbol_id_str_length - 1u] == '|'))
-    {
-    sym_replaced = false;
+  // Translated string is built up in one go rather than replacing ids in place which would
+  // shift the rest of the string once per id.
+  AStringBuilder builder(length + (length >> 2u));
+  bool           translated = translate_ids(AStringView(*str_p), &builder);
 
-    // $Revisit - CReis Ensure that ids with leading zeros 00123 are converted properly
-    sym_id = str_p->as_uint(find_idx + 1u, &end_idx, 16u);
+  *str_p = builder.pop_string();
 
-    if (end_idx == find_idx + ASymbol_id_str_length - 1u)
+  return translated;
+  }
+
+//---------------------------------------------------------------------------------------
+// Appends a string to a builder with any occurrences of symbol ids in the form
+// |#12345678#| converted to their string equivalents - in a single pass.
+// 
+// # Returns:
+//   `true` if completely converted and `false` if there were some ids that the string
+//   equivalent could not be found for - those ids are appended unchanged.
+//   
+// # Params:
+//   str:   string to convert
+//   out_p: builder to append the converted string to
+//   
+// # Notes:
+//   This is useful for converting large amounts of text such as callstacks and logs
+//   since only the runs of characters between ids are copied.  Ids for the null symbol ""
+//   are removed.
+//   
+// # See:  translate_ids(str_p), translate_known_id()
+bool ASymbolTable::translate_ids(
+  const AStringView & str,
+  AStringBuilder *    out_p
+  ) const
+  {
+  bool         translated = true;
+  uint32_t     sym_id;
+  ASymbolRef * sym_ref_p;
+  AStringRef * str_ref_p;
+  const char * cstr_p     = str.get_cstr();
+  const char * cstr_end_p = cstr_p + str.get_length();
+  const char * run_p      = cstr_p;  // Start of characters not yet appended
+  const char * find_p     = a_find_id_marker(cstr_p, cstr_end_p);
+
+  while (find_p)
+    {
+    if (a_parse_id_marker(find_p, &sym_id))
       {
-      if (sym_id != ASymbol_id_null)
+      sym_ref_p = (sym_id != ASymbol_id_null) ? get_symbol(sym_id) : nullptr;
+
+      if (sym_ref_p || (sym_id == ASymbol_id_null))
         {
-        if (translate_known_id(sym_id, &sym_str))
-          {
-          // Replace symbol id with corresponding string
-          str_p->replace(sym_str, find_idx, ASymbol_id_str_length);
-          str_length   = sym_str.get_length();
-          max_idx      = max_idx + str_length - ASymbol_id_str_length;
-          start_idx    = find_idx + str_length;
-          sym_replaced = true;
-          }
-        else
+        // Replace symbol id with corresponding string - or remove it if it is the empty
+        // symbol ""
+        out_p->append(run_p, uint32_t(find_p - run_p));
+
+        if (sym_ref_p)
           {
-          // Unable to translate all of supplied string
-          translated = false;
+          str_ref_p = sym_ref_p->m_str_ref_p;
+          out_p->append(str_ref_p->m_cstr_p, str_ref_p->m_length);
           }
+
+        run_p = find_p + ASymbol_id_str_length;
         }
       else
         {
-        // It is the empty symbol "" - remove symbol id
-        str_p->remove_all(find_idx, ASymbol_id_str_length);
-        max_idx -= ASymbol_id_str_length;
-        start_idx = find_idx;
-        sym_replaced = true;
+        // Unable to translate all of supplied string
+        translated = false;
         }
+
+      find_p += ASymbol_id_str_length;
       }
     else
       {
       translated = false;
       A_DPRINT("Bad symbol id!\n");
+      find_p++;
       }
 
-    if (!sym_replaced)
-      {
-      start_idx = find_idx + ASymbol_id_str_length;
-      }
-    }  // while
+    find_p = a_find_id_marker(find_p, cstr_end_p);
+    }
+
+  out_p->append(run_p, uint32_t(cstr_end_p - run_p));
 
   return translated;
   }
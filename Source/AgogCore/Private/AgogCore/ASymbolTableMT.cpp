@@ -0,0 +1,405 @@
+//=======================================================================================
+// Agog Labs C++ library.
+// Copyright (c) 2000 Agog Labs Inc.,
+// All rights reserved.
+//
+// ASymbolTableMT class definition module
+// # Notes:
+//=======================================================================================
+
+
+//=======================================================================================
+// Includes
+//=======================================================================================
+
+#include "AgogCore/ASymbolTableMT.hpp"
+#include "AgogCore/AStringRef.hpp"
+#include "AgogCore/AString.hpp"
+
+
+//=======================================================================================
+// Method Definitions
+//=======================================================================================
+
+#if defined(A_SYMBOLTABLE_CLASSES)
+
+//---------------------------------------------------------------------------------------
+// Default constructor
+// # Returns:  itself
+ASymbolTableMT::ASymbolTableMT() :
+  m_block_used(ASymbolTableMT_block_size)
+  {
+  }
+
+//---------------------------------------------------------------------------------------
+// Destructor
+// # Notes:    Frees all the symbols created by this table - so with A_SYMBOL_REF_LINK
+//             ensure that none of them are still in use.
+ASymbolTableMT::~ASymbolTableMT()
+  {
+  // ASymbolRef and AStringRef have nothing that needs to be destructed
+  Block ** blocks_pp     = m_blocks.get_array();
+  Block ** blocks_end_pp = blocks_pp + m_blocks.get_length();
+
+  for (; blocks_pp < blocks_end_pp; blocks_pp++)
+    {
+    AMemory::free(*blocks_pp);
+    }
+  }
+
+//---------------------------------------------------------------------------------------
+// Gets the number of symbols in this table.
+// # Returns:  number of symbols
+// # Notes:    Thread-safe though other threads may add symbols as soon as it returns.
+uint32_t ASymbolTableMT::get_length() const
+  {
+  uint32_t      length       = 0u;
+  const Shard * shard_p      = m_shards;
+  const Shard * shards_end_p = shard_p + ASymbolTableMT_shard_count;
+
+  for (; shard_p < shards_end_p; shard_p++)
+    {
+    std::lock_guard<std::mutex> lock(shard_p->m_mutex);
+
+    length += shard_p->m_sym_refs.get_length();
+    }
+
+  return length;
+  }
+
+//---------------------------------------------------------------------------------------
+// Creates a symbol in this table - or gets it if it was already created.
+// # Returns:  symbol
+// Arg         cstr_p - pointer to array of characters (does not need to be null
+//             terminated).  The characters are copied.
+// Arg         length - number of characters to use in 'cstr_p'.  If it is
+//             ALength_calculate, 'cstr_p' must be null-terminated.
+// # See:      merge_into(), ASymbol::create()
+// # Notes:    Thread-safe.
+ASymbol ASymbolTableMT::create(
+  const char * cstr_p,
+  uint32_t     length // = ALength_calculate
+  )
+  {
+  if ((length == 0u) || (cstr_p == nullptr) || (*cstr_p == '\0'))
+    {
+    return ASymbol::ms_null;
+    }
+
+  if (length == ALength_calculate)
+    {
+    length = uint32_t(::strlen(cstr_p));
+    }
+
+  uint32_t sym_id = ASYMBOL_CSTR_TO_ID(cstr_p, length);
+
+  // ASymbol_id_null marks unused hash slots so it cannot be stored
+  if (sym_id == ASymbol_id_null)
+    {
+    return ASymbol::ms_null;
+    }
+
+  ASymbolRef * sym_ref_p = symbol_reference(sym_id, cstr_p, length);
+
+  #if defined(A_SYMBOL_REF_LINK)
+    return sym_ref_p;
+  #else
+    return sym_id;
+  #endif
+  }
+
+//---------------------------------------------------------------------------------------
+// Determines if the specified symbol id is currently registered in this table.
+//             The null symbol "" is always considered to be registered.
+// # Returns:  true if registered and false if not
+// Arg         sym_id - symbol id to look for
+// # Notes:    Thread-safe.
+bool ASymbolTableMT::is_registered(uint32_t sym_id) const
+  {
+  if (sym_id == ASymbol_id_null)
+    {
+    return true;
+    }
+
+  const Shard &               shard = get_shard(sym_id);
+  std::lock_guard<std::mutex> lock(shard.m_mutex);
+
+  return shard.find_ref(sym_id) != nullptr;
+  }
+
+//---------------------------------------------------------------------------------------
+// Adds copies of all the symbols in this table that are not already in another table -
+// for example so that the main table can translate their ids.
+// Arg         table_p - table to add symbols to
+// # Notes:    Must be called by the thread that uses table_p - usually the main thread -
+//             when no other threads are using this table.
+//
+//             With A_SYMBOL_REF_LINK existing ASymbol objects still reference the symbols
+//             in this table - they compare equal to the same symbols from table_p since
+//             symbols are compared by id.
+void ASymbolTableMT::merge_into(ASymbolTable * table_p) const
+  {
+  AStringRef *  str_ref_p;
+  ASymbolRef ** syms_pp;
+  ASymbolRef ** syms_end_pp;
+  const Shard * shard_p      = m_shards;
+  const Shard * shards_end_p = shard_p + ASymbolTableMT_shard_count;
+
+  table_p->m_sym_refs.ensure_size(table_p->m_sym_refs.get_length() + get_length());
+
+  for (; shard_p < shards_end_p; shard_p++)
+    {
+    syms_pp     = shard_p->m_sym_refs.get_array();
+    syms_end_pp = syms_pp + shard_p->m_sym_refs.get_length();
+
+    for (; syms_pp < syms_end_pp; syms_pp++)
+      {
+      // Copied into pooled symbols since table_p deletes its symbols and may outlive this
+      // table.
+      str_ref_p = (*syms_pp)->m_str_ref_p;
+      table_p->symbol_reference((*syms_pp)->m_uid, str_ref_p->m_cstr_p, str_ref_p->m_length, ATerm_short);
+      }
+    }
+  }
+
+//---------------------------------------------------------------------------------------
+// Returns a symbol reference from this table that matches the supplied symbol id and
+// string.  If it is not already in the table it is added.
+// # Returns:  symbol reference
+// Arg         sym_id - id of symbol - must not be ASymbol_id_null
+// Arg         cstr_p - characters of symbol - they are copied if the symbol is added
+// Arg         length - number of characters in cstr_p
+// # See:      ASymbolTable::symbol_reference()
+ASymbolRef * ASymbolTableMT::symbol_reference(
+  uint32_t     sym_id,
+  const char * cstr_p,
+  uint32_t     length
+  )
+  {
+  // Ensure symbol string no larger than 255 characters since only 1-byte is used to store
+  // length in binary.
+  A_ASSERTX(
+    length <= UINT8_MAX,
+    AErrMsg(
+      a_str_format(
+        "Tried to create symbol '%.*s' (0x%X) but it too long!\n"
+        "Its length is %u and the max length is 255 characters.\n"
+        "[Try to use a different shorter string if possible.]",
+        int(length),
+        cstr_p,
+        sym_id,
+        length),
+      AErrLevel_notify));
+
+  Shard &                     shard = get_shard(sym_id);
+  std::lock_guard<std::mutex> lock(shard.m_mutex);
+  ASymbolRef *                sym_ref_p = shard.find_ref(sym_id);
+
+  if (sym_ref_p)
+    {
+    // Check for name collision
+    A_ASSERTX(
+      sym_ref_p->m_str_ref_p->is_equal(cstr_p, length),
+      AErrMsg(
+        a_str_format(
+          "Symbol id collision!  The new string '%.*s' and the string '%s' are different,\n"
+          "but they both have the same id 0x%X.\n"
+          "[Try to use a different string if possible and hope that it has a unique id.]",
+          int(length),
+          cstr_p,
+          sym_ref_p->m_str_ref_p->m_cstr_p,
+          sym_id),
+        AErrLevel_notify));
+
+    return sym_ref_p;
+    }
+
+  sym_ref_p = block_new(sym_id, cstr_p, length);
+  shard.append_ref(sym_ref_p);
+
+  return sym_ref_p;
+  }
+
+//---------------------------------------------------------------------------------------
+// Creates a symbol reference (along with its string reference and a copy of its
+// characters) in the blocks owned by this table rather than using the object pools which
+// are not thread-safe.
+// # Returns:  new symbol reference - it is not added to a shard
+// Arg         sym_id - id of symbol
+// Arg         cstr_p - characters of symbol - they are copied
+// Arg         length - number of characters in cstr_p
+// # Notes:    The string reference is read-only and it is never returned to the string
+//             reference pool since the symbol reference keeps a reference to it until this
+//             table is destructed.
+ASymbolRef * ASymbolTableMT::block_new(
+  uint32_t     sym_id,
+  const char * cstr_p,
+  uint32_t     length
+  )
+  {
+  // Keep each symbol aligned to pointer size
+  uint32_t bytes = uint32_t(sizeof(ASymbolRef) + sizeof(AStringRef) + length + 1u + sizeof(void *) - 1u)
+    & ~uint32_t(sizeof(void *) - 1u);
+  uint8_t * mem_p;
+
+  m_block_mutex.lock();
+
+  if ((m_block_used + bytes) > ASymbolTableMT_block_size)
+    {
+    m_blocks.append(*static_cast<Block *>(AMemory::malloc(sizeof(Block), "ASymbolTableMT::m_blocks")));
+    m_block_used = 0u;
+    }
+
+  mem_p         = m_blocks.get_last()->m_bytes_a + m_block_used;
+  m_block_used += bytes;
+
+  m_block_mutex.unlock();
+
+  char * chars_p = reinterpret_cast<char *>(mem_p + sizeof(ASymbolRef) + sizeof(AStringRef));
+
+  ::memcpy(chars_p, cstr_p, length);
+  chars_p[length] = '\0';
+
+  AStringRef * str_ref_p = new (mem_p + sizeof(ASymbolRef)) AStringRef(chars_p, length, length + 1u, 0u, false, true);
+
+  // Adds the reference to the string reference that is never removed
+  return new (mem_p) ASymbolRef(str_ref_p, sym_id);
+  }
+
+//---------------------------------------------------------------------------------------
+// Constructor
+ASymbolTableMT::Shard::Shard() :
+  m_hash_p(nullptr),
+  m_hash_mask(0u),
+  m_hash_shift(0u)
+  {
+  hash_rebuild(0u);
+  }
+
+//---------------------------------------------------------------------------------------
+// Destructor
+ASymbolTableMT::Shard::~Shard()
+  {
+  delete [] m_hash_p;
+  }
+
+//---------------------------------------------------------------------------------------
+// Looks up symbol reference in the hash index by symbol id.
+// # Returns:  ASymbolRef with matching id or nullptr if not in m_sym_refs
+// Arg         sym_id - symbol id to lookup - must not be ASymbol_id_null
+// # Notes:    The shard must be locked by the caller.
+ASymbolRef * ASymbolTableMT::Shard::find_ref(uint32_t sym_id) const
+  {
+  const HashSlot * slots_p = m_hash_p;
+  uint32_t         mask    = m_hash_mask;
+  uint32_t         pos     = (sym_id * 2654435769u) >> m_hash_shift;  // Fibonacci hash
+  uint32_t         slot_id = slots_p[pos].m_id;
+
+  while (slot_id != sym_id)
+    {
+    if (slot_id == ASymbol_id_null)
+      {
+      return nullptr;
+      }
+
+    pos     = (pos + 1u) & mask;
+    slot_id = slots_p[pos].m_id;
+    }
+
+  return m_sym_refs.get_array()[slots_p[pos].m_idx];
+  }
+
+//---------------------------------------------------------------------------------------
+// Appends a symbol reference that is not already in this shard and indexes it.
+// Arg         sym_ref_p - symbol reference to add
+// # See:      hash_insert()
+void ASymbolTableMT::Shard::append_ref(ASymbolRef * sym_ref_p)
+  {
+  uint32_t idx = m_sym_refs.get_length();
+
+  // Grow geometrically - APArray::append() only grows a few elements at a time which
+  // makes creating many symbols quadratic.
+  if (idx == m_sym_refs.get_size())
+    {
+    m_sym_refs.ensure_size(a_max(idx << 1u, uint32_t(ASymbolTableMT_hash_size_min)));
+    }
+
+  m_sym_refs.append(*sym_ref_p);
+
+  // Keep hash index at most half full
+  if (((idx + 1u) << 1u) > (m_hash_mask + 1u))
+    {
+    // Reindexes all symbols including the new one
+    hash_rebuild(idx + 1u);
+
+    return;
+    }
+
+  hash_insert(sym_ref_p->m_uid, idx);
+  }
+
+//---------------------------------------------------------------------------------------
+// Adds symbol id to hash index - it must not already be present and there must be at
+// least one unused slot.
+// Arg         sym_id - id of symbol to add
+// Arg         idx - index of symbol in m_sym_refs
+// # See:      find_ref(), hash_rebuild()
+void ASymbolTableMT::Shard::hash_insert(
+  uint32_t sym_id,
+  uint32_t idx
+  )
+  {
+  HashSlot * slots_p = m_hash_p;
+  uint32_t   mask    = m_hash_mask;
+  uint32_t   pos     = (sym_id * 2654435769u) >> m_hash_shift;  // Fibonacci hash - same as find_ref()
+
+  while (slots_p[pos].m_id != ASymbol_id_null)
+    {
+    pos = (pos + 1u) & mask;
+    }
+
+  slots_p[pos].m_id  = sym_id;
+  slots_p[pos].m_idx = idx;
+  }
+
+//---------------------------------------------------------------------------------------
+// Resizes hash index so that it can hold at least the specified number of symbols while
+// staying at most half full and then reindexes all the symbols in m_sym_refs.
+// Arg         needed - number of symbols to make room for
+// # See:      hash_insert(), find_ref()
+void ASymbolTableMT::Shard::hash_rebuild(uint32_t needed)
+  {
+  uint32_t size  = ASymbolTableMT_hash_size_min;
+  uint32_t shift = 28u;  // 32 - log2(ASymbolTableMT_hash_size_min)
+
+  needed = a_max(needed, m_sym_refs.get_length()) << 1u;
+
+  while (size < needed)
+    {
+    size <<= 1u;
+    shift--;
+    }
+
+  if (size != (m_hash_mask + 1u))
+    {
+    delete [] m_hash_p;
+    m_hash_p     = new ("ASymbolTableMT::m_hash_p") HashSlot[size];
+    m_hash_mask  = size - 1u;
+    m_hash_shift = shift;
+    }
+
+  // Sets all slot ids to ASymbol_id_null (0xFFFFFFFF)
+  ::memset(m_hash_p, 0xFF, size * sizeof(HashSlot));
+
+  uint32_t      idx     = 0u;
+  uint32_t      length  = m_sym_refs.get_length();
+  ASymbolRef ** syms_pp = m_sym_refs.get_array();
+
+  for (; idx < length; idx++)
+    {
+    hash_insert(syms_pp[idx]->m_uid, idx);
+    }
+  }
+
+
+#endif // A_SYMBOLTABLE_CLASSES
@@ -107,6 +107,7 @@ const AString      AString::ms_empty(AStringRef::get_empty());
 //A_DSCOPE_LOG(AString_ms_empty, A_SOURCE_STR "AString::ms_empty - ctor\n", A_SOURCE_STR "AString::ms_empty - dtor\n");
 const AString      AString::ms_comma(",", 1u);
 const AString      AString::ms_dos_break("\r\n", 2u);
+const AStringView  AStringView::ms_comma(",", 1u);
 AConstructDestruct AString::ms_construct_destruct(init_match_table);  // ctor/dtor must be last data member
 
 // Convert ASCII character to uppercase.
@@ -37,10 +37,20 @@
 //    uint32_t hash_modelb = AChecksum::generate_crc32_cstr("_B", base_hash);    Same as "ModelName_B"
 //    uint32_t hash_modelc = AChecksum::generate_crc32_cstr("_C", base_hash);    Same as "ModelName_C"
 //
+//  Checksums are computed 8 bytes at a time with sliced lookup tables and, on x86/x64 CPUs
+//  that support PCLMULQDQ (detected at runtime), runs of 64+ bytes are folded with
+//  carry-less multiplication.  All paths give results identical to the classic byte at a
+//  time CRC so stored checksums and symbol ids are unaffected.
+//
+//  generate_crc32_const() gives the same checksum as generate_crc32_cstr() though it can be
+//  evaluated at compile time - symbol ids of string literals use it so that they do not
+//  need to be hashed at startup.  See ASYMBOL_LITERAL_TO_ID().
+//
 //  References:
 //
 //    http://en.wikipedia.org/wiki/Cyclic_redundancy_check
 //    32-Bit - gnu textutils-2.1  src\cksum.c
+//    Intel - Fast CRC Computation for Generic Polynomials Using PCLMULQDQ Instruction
 //
 //=======================================================================================
 
@@ -74,6 +84,44 @@ class AChecksum
     static uint32_t generate_crc32_upper(const AString & str, uint32_t prev_crc = 0);
     static uint32_t generate_crc32_cstr_upper(const char * cstr_p, uint32_t length = ALength_calculate, uint32_t prev_crc = 0);
 
+    #if !defined(A_NO_CONSTEXPR)
+
+    // Compile-time Class Methods - same results as generate_crc32_cstr() though only
+    // intended for short strings such as symbol names since they are evaluated
+    // recursively (one level per character).
+
+      static constexpr uint32_t generate_crc32_const(const char * cstr_p, uint32_t length, uint32_t prev_crc = 0u)
+        { return ~crc32_const_update(~prev_crc, cstr_p, length); }
+
+      template<size_t _Size>
+      static constexpr uint32_t generate_crc32_literal(const char (& cstr_a)[_Size], uint32_t prev_crc = 0u)
+        { return generate_crc32_const(cstr_a, uint32_t(_Size - 1u), prev_crc); }
+
+  protected:
+
+  // Internal Class Methods
+
+      static constexpr uint32_t crc32_const_bit(uint32_t crc)
+        { return (crc >> 1) ^ (0xedb88320u & (0u - (crc & 1u))); }
+
+      static constexpr uint32_t crc32_const_byte(uint32_t crc)
+        { return crc32_const_bit(crc32_const_bit(crc32_const_bit(crc32_const_bit(crc32_const_bit(crc32_const_bit(crc32_const_bit(crc32_const_bit(crc)))))))); }
+
+      static constexpr uint32_t crc32_const_update(uint32_t crc, const char * cstr_p, uint32_t length)
+        { return length ? crc32_const_update(crc32_const_byte(crc ^ uint8_t(*cstr_p)), cstr_p + 1, length - 1u) : crc; }
+
+    #else
+
+    // Run-time version of the compile-time method for compilers without constexpr.  It
+    // only accepts character arrays so that a pointer - whose size is not the string
+    // length - cannot be given by mistake.
+
+      template<size_t _Size>
+      static uint32_t generate_crc32_literal(const char (& cstr_a)[_Size], uint32_t prev_crc = 0u)
+        { return generate_crc32_cstr(cstr_a, uint32_t(_Size - 1u), prev_crc); }
+
+    #endif  // A_NO_CONSTEXPR
+
   };
 
 
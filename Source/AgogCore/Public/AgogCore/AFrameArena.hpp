@@ -0,0 +1,228 @@
+//=======================================================================================
+// Agog Labs C++ library.
+// Copyright (c) 2015 Agog Labs Inc.,
+// All rights reserved.
+//
+// Bump allocator for memory that only lives until the end of the current update/frame
+// # Notes:
+//=======================================================================================
+
+
+#ifndef __AFRAMEARENA_HPP
+#define __AFRAMEARENA_HPP
+
+
+//=======================================================================================
+// Includes
+//=======================================================================================
+
+#include "AgogCore/AMemory.hpp"
+#include <type_traits>
+#include <utility>       // Uses: std::forward
+
+
+//=======================================================================================
+// Global Macros / Defines
+//=======================================================================================
+
+enum
+  {
+  // Default byte size of the chunks an arena gets from AMemory
+  AFrameArena_chunk_size_def = 64u * 1024u,
+
+  // Default alignment of arena allocations
+  AFrameArena_align_def      = 16u
+  };
+
+// Allocates a transient object from the current frame arena - it is destructed and its
+// memory reclaimed when AFrameArena::get_frame().reset() is called.
+// Only use for objects that cannot escape the current update.
+// # Examples:  MyTemp * temp_p = A_FRAME_NEW(MyTemp)(arg1, arg2);
+#define A_FRAME_NEW(_CLASS_NAME)  new (AFrameArena::get_frame().allocate_object<_CLASS_NAME>()) _CLASS_NAME
+
+
+//=======================================================================================
+// Global Structures
+//=======================================================================================
+
+class AString;
+
+//---------------------------------------------------------------------------------------
+// Arena (bump pointer) allocator for transient memory.
+//
+// Allocation just bumps a pointer through a chunk of memory and nothing is freed
+// individually - everything allocated is released at once with reset(), which is
+// expected to be called at the end of each update.  This replaces per-frame pairs of
+// malloc()/free() for temporaries that are known not to outlive the update.
+//
+// Objects that need their destructors called have a small finalizer record allocated
+// alongside them which reset() calls in reverse order of allocation.
+//
+// If a frame needs more than one chunk, reset() replaces all the chunks with a single
+// chunk large enough for that frame so later frames with similar usage stay in one
+// chunk.
+//
+// # Examples:
+//   // Raw memory
+//   f32 * weights_a = static_cast<f32 *>(AFrameArena::get_frame().allocate(count * sizeof(f32)));
+//
+//   // Objects - destructed at reset()
+//   MyTemp * temp_p = AFrameArena::get_frame().new_object<MyTemp>(arg1, arg2);
+//
+//   // Formatted string without a separately allocated buffer
+//   SSDebug::print(AFrameArena::get_frame().str_format("%u items\n", count));
+//
+// # Notes:
+//   $Note - Nothing allocated from an arena may be referenced after reset() - this
+//   includes copies of AString objects from str_format() since copies share the buffer.
+//   Like AObjReusePool, an arena is *not* thread-safe.
+class AFrameArena
+  {
+  public:
+
+  // Common Methods
+
+    AFrameArena(uint32_t chunk_size = AFrameArena_chunk_size_def);
+    ~AFrameArena();
+
+  // Accessor Methods
+
+    size_t get_bytes_used() const       { return m_bytes_retired + (m_chunk_p ? size_t(m_cur_p - m_chunk_p->get_data()) : 0u); }
+    size_t get_bytes_peak() const       { return m_bytes_peak; }
+    size_t get_bytes_reserved() const;
+    bool   is_owned(const void * mem_p) const;
+
+  // Modifying Methods
+
+    void * allocate(size_t size, size_t alignment = AFrameArena_align_def);
+
+    template<class _ObjectType>
+      void * allocate_object();
+
+    template<class _ObjectType, typename... _tArgs>
+      _ObjectType * new_object(_tArgs &&... args);
+
+    char *  cstr_copy(const char * cstr_p, uint32_t length);
+    char *  cstr_format(const char * format_str_p, ...);
+    AString str_format(const char * format_str_p, ...);
+
+    void reset();
+
+  // Class Methods
+
+    static AFrameArena & get_frame();
+
+  protected:
+
+  // Nested Structures
+
+    // Header of each chunk of memory - followed by the chunk data
+    struct Chunk
+      {
+      Chunk *   m_next_p;
+      size_t    m_size;
+
+      uint8_t * get_data()                { return reinterpret_cast<uint8_t *>(this + 1); }
+      };
+
+    // Record of an object to destruct at reset()
+    struct Finalizer
+      {
+      Finalizer * m_next_p;
+      void *      m_obj_p;
+      void     (* m_destruct_f)(void * obj_p);
+      };
+
+  // Internal Methods
+
+    void * allocate_chunk(size_t size, size_t alignment);
+    void   add_finalizer(void * obj_p, void (* destruct_f)(void * obj_p));
+    void   free_chunks();
+
+    template<class _ObjectType>
+      static void destruct_object(void * obj_p)  { static_cast<_ObjectType *>(obj_p)->~_ObjectType(); }
+
+  // Data Members
+
+    // Next free byte and end of current chunk
+    uint8_t * m_cur_p;
+    uint8_t * m_end_p;
+
+    // Current chunk followed by any chunks already filled this frame
+    Chunk * m_chunk_p;
+
+    // Objects to destruct - most recent first
+    Finalizer * m_finalizers_p;
+
+    // Bytes used in chunks already filled this frame
+    size_t m_bytes_retired;
+
+    // Most bytes used in a single frame
+    size_t m_bytes_peak;
+
+    // Minimum size of chunk data
+    uint32_t m_chunk_size;
+
+  };  // AFrameArena
+
+
+//=======================================================================================
+// Inline Methods
+//=======================================================================================
+
+//---------------------------------------------------------------------------------------
+// Allocates memory that stays valid until the next reset().
+// # Returns:  aligned memory at least size bytes large
+// Arg         size - number of bytes needed
+// Arg         alignment - byte alignment of memory - must be a power of 2
+inline void * AFrameArena::allocate(
+  size_t size,
+  size_t alignment // = AFrameArena_align_def
+  )
+  {
+  uint8_t * mem_p = reinterpret_cast<uint8_t *>(
+    (reinterpret_cast<uintptr_t>(m_cur_p) + (alignment - 1u)) & ~uintptr_t(alignment - 1u));
+
+  // Also checks for no chunk yet since a 0 byte allocation would otherwise fit
+  if (((mem_p + size) > m_end_p) || (m_chunk_p == nullptr))
+    {
+    return allocate_chunk(size, alignment);
+    }
+
+  m_cur_p = mem_p + size;
+
+  return mem_p;
+  }
+
+//---------------------------------------------------------------------------------------
+// Allocates memory for an object and - unless the object type does not need it -
+// arranges for its destructor to be called at reset().  Usually used via A_FRAME_NEW().
+// # Returns:  memory to construct object in with placement new
+// # Notes:    The object must be constructed before reset() is called.
+template<class _ObjectType>
+inline void * AFrameArena::allocate_object()
+  {
+  const size_t alignment = std::alignment_of<_ObjectType>::value;
+
+  void * obj_p = allocate(sizeof(_ObjectType), (alignment > AFrameArena_align_def) ? alignment : size_t(AFrameArena_align_def));
+
+  if (!std::is_trivially_destructible<_ObjectType>::value)
+    {
+    add_finalizer(obj_p, destruct_object<_ObjectType>);
+    }
+
+  return obj_p;
+  }
+
+//---------------------------------------------------------------------------------------
+// Constructs an object in the arena that is destructed at reset()
+// # Returns:  new object
+// Arg         args - arguments passed on to the object constructor
+template<class _ObjectType, typename... _tArgs>
+inline _ObjectType * AFrameArena::new_object(_tArgs &&... args)
+  {
+  return new (allocate_object<_ObjectType>()) _ObjectType(std::forward<_tArgs>(args)...);
+  }
+
+
+#endif  // __AFRAMEARENA_HPP
@@ -0,0 +1,983 @@
+//=======================================================================================
+// Agog Labs C++ library.
+// Copyright (c) 2015 Agog Labs Inc.,
+// All rights reserved.
+//
+//  AHashMap and AHashSet class templates - open addressing hash tables
+// # Notes:
+//=======================================================================================
+
+
+#ifndef __AHASHMAP_HPP
+#define __AHASHMAP_HPP
+
+
+//=======================================================================================
+// Includes
+//=======================================================================================
+
+#include "AgogCore/AString.hpp"
+#include "AgogCore/ASymbol.hpp"
+#include <string.h>      // Uses: memcpy(), memset()
+#include <utility>       // Uses: std::move()
+
+
+//=======================================================================================
+// Global Macros / Defines
+//=======================================================================================
+
+enum
+  {
+  // Minimum number of slots in a non-empty hash table - always a power of 2
+  AHashTable_size_min = 8u,
+
+  // Largest probe distance (+1) that fits in a slot's distance byte - larger distances
+  // are stored as this value and worked out from the home slot of the entry's key.
+  AHashTable_dist_max = 255u,
+
+  // An insert that would exceed AHashTable_dist_max only grows the table if it has fewer
+  // than this many slots per entry - so keys with identical hashes cannot grow it forever.
+  AHashTable_grow_ratio_max = 8u
+  };
+
+
+//=======================================================================================
+// Global Structures
+//=======================================================================================
+
+//---------------------------------------------------------------------------------------
+// Hashes and compares keys for AHashMap<> and AHashSet<>.  The hash does not need to be
+// well distributed in its low bits since the tables use the high bits of a Fibonacci
+// (multiplicative) hash of it to pick a slot.
+//
+// There is no general definition - specialize it for any other key type by providing
+// static hash() and equals() functions like the ones below.
+template<class _KeyType>
+struct AHashKey;
+
+//---------------------------------------------------------------------------------------
+// Ids (ASymbol ids, object ids, etc.) are used as is.
+template<>
+struct AHashKey<uint32_t>
+  {
+  static uint32_t hash(uint32_t key)                     { return key; }
+  static bool     equals(uint32_t lhs, uint32_t rhs)     { return lhs == rhs; }
+  };
+
+//---------------------------------------------------------------------------------------
+template<>
+struct AHashKey<int32_t>
+  {
+  static uint32_t hash(int32_t key)                      { return uint32_t(key); }
+  static bool     equals(int32_t lhs, int32_t rhs)       { return lhs == rhs; }
+  };
+
+//---------------------------------------------------------------------------------------
+template<>
+struct AHashKey<uint64_t>
+  {
+  static uint32_t hash(uint64_t key)                     { key ^= key >> 33; key *= 0xff51afd7ed558ccdull; key ^= key >> 33; key *= 0xc4ceb9fe1a85ec53ull; return uint32_t(key ^ (key >> 33)); }  // MurmurHash3 64-bit finalizer
+  static bool     equals(uint64_t lhs, uint64_t rhs)     { return lhs == rhs; }
+  };
+
+//---------------------------------------------------------------------------------------
+// Addresses - mixed as 64-bit values since their low bits are mostly zero due to
+// alignment and their high bits mostly the same.
+template<class _Type>
+struct AHashKey<_Type *>
+  {
+  static uint32_t hash(const _Type * key_p)                     { return AHashKey<uint64_t>::hash(uint64_t(uintptr_t(key_p))); }
+  static bool     equals(const _Type * lhs_p, const _Type * rhs_p)  { return lhs_p == rhs_p; }
+  };
+
+//---------------------------------------------------------------------------------------
+// Symbol ids are already CRC32 values.
+template<>
+struct AHashKey<ASymbol>
+  {
+  static uint32_t hash(const ASymbol & key)                       { return key.get_id(); }
+  static bool     equals(const ASymbol & lhs, const ASymbol & rhs)  { return lhs == rhs; }
+  };
+
+//---------------------------------------------------------------------------------------
+// Case sensitive string keys
+template<>
+struct AHashKey<AString>
+  {
+  static uint32_t hash(const AString & key)                       { return key.as_crc32(); }
+  static bool     equals(const AString & lhs, const AString & rhs)  { return lhs == rhs; }
+  };
+
+
+//---------------------------------------------------------------------------------------
+// Notes    Common base for AHashMap<> and AHashSet<> - an open addressing hash table
+//          that uses robin hood linear probing.
+//
+//          Each slot has a byte storing its probe distance + 1 (0 for an empty slot) in
+//          an array separate from the entries so lookups only touch an entry when its
+//          distance matches the distance being probed.  Robin hood ordering keeps the
+//          entries of a cluster sorted by home slot - so a lookup stops as soon as it
+//          reaches a slot with a shorter distance than its own and removals shift the
+//          rest of a cluster back rather than leaving tombstones.  Distances that do not
+//          fit in a byte (only likely with many keys that have the same hash) are stored
+//          as AHashTable_dist_max and worked out from the key when needed.
+//
+//          The table grows (doubling its slots) when it would be more than 7/8 full.
+//          Entries are moved around with memcpy() the same as the AVCompactArray<>
+//          family so _EntryType must not store pointers to itself.  Any addresses of
+//          entries become invalid after any modification to the table.
+// Arg      _EntryType - entry structure with a m_key data member
+// Arg      _KeyType - key type used to look up entries
+// Arg      _HashClass - provides static hash() and equals() functions for _KeyType
+// See Also AHashMap<>, AHashSet<>
+template<
+  class _EntryType,
+  class _KeyType,
+  class _HashClass
+  >
+class AHashTableBase
+  {
+  public:
+  // Common types
+
+    // Local shorthand
+    typedef AHashTableBase<_EntryType, _KeyType, _HashClass> tAHashTableBase;
+
+  // Modifying Behaviour methods
+
+    void empty();
+    void ensure_size(uint32_t count);
+    bool remove(const _KeyType & key);
+
+  // Non-modifying Methods
+
+    bool     find(const _KeyType & key) const          { return find_entry(key) != nullptr; }
+    uint32_t get_length() const                        { return m_count; }
+    uint32_t get_size() const                          { return m_mask ? m_mask + 1u : 0u; }
+    bool     is_empty() const                          { return m_count == 0u; }
+    bool     is_filled() const                         { return m_count != 0u; }
+
+  protected:
+  // Internal Methods
+
+    AHashTableBase()                                   : m_entries_p(nullptr), m_dists_p(nullptr), m_count(0u), m_mask(0u), m_shift(32u) {}
+    AHashTableBase(const AHashTableBase & table);
+    AHashTableBase(AHashTableBase && table);
+    ~AHashTableBase();
+
+    void         assign(const AHashTableBase & table);
+    void         take(AHashTableBase * table_p);
+    _EntryType * find_entry(const _KeyType & key) const;
+    _EntryType * insert_entry(const _KeyType & key, bool * appended_p);
+    void         remove_entry(_EntryType * entry_p);
+    void         rebuild(uint32_t slot_count);
+
+    static void     place(_EntryType * entries_p, uint8_t * dists_p, uint32_t mask, uint32_t shift, uint32_t pos);
+    static uint32_t get_home(const _KeyType & key, uint32_t shift)  { return (_HashClass::hash(key) * 2654435769u) >> shift; }  // Fibonacci hash
+    static uint32_t get_dist(const _EntryType * entries_p, const uint8_t * dists_p, uint32_t mask, uint32_t shift, uint32_t pos);
+    static uint8_t  get_dist_byte(uint32_t dist)                    { return uint8_t((dist < AHashTable_dist_max) ? dist : AHashTable_dist_max); }
+
+  // Data Members
+
+    // Slots - each is only constructed if its m_dists_p byte is non-zero
+    _EntryType * m_entries_p;
+
+    // Probe distance + 1 of each slot - 0 if the slot is empty.  Allocated in the same
+    // block as m_entries_p.
+    uint8_t * m_dists_p;
+
+    // Number of entries
+    uint32_t m_count;
+
+    // Number of slots - 1 (number of slots is a power of 2) or 0 if no slots allocated
+    uint32_t m_mask;
+
+    // Shift used to get home slot from multiplicative hash of key
+    uint32_t m_shift;
+
+  };  // AHashTableBase
+
+
+//---------------------------------------------------------------------------------------
+// Key/value pair stored by AHashMap<>
+template<class _KeyType, class _ValueType>
+struct AHashMapEntry
+  {
+  _KeyType   m_key;
+  _ValueType m_value;
+
+  AHashMapEntry(const _KeyType & key, const _ValueType & value) : m_key(key), m_value(value) {}
+  AHashMapEntry(const _KeyType & key, _ValueType && value)      : m_key(key), m_value(std::move(value)) {}
+  };
+
+//---------------------------------------------------------------------------------------
+// Notes    The AHashMap class template maps unique keys to values stored by value in an
+//          open addressing hash table (see AHashTableBase<>) - O(1) appends, removals
+//          and lookups on average rather than the O(log n) lookups and O(n) appends and
+//          removals of APSorted<>.  Entries are in no particular order.
+//
+//          ASymbol and uint32_t id keys are supported directly - see AHashKey<> for other
+//          key types.
+// Examples
+//   AHashMap<ASymbol, SSClass *> classes;
+//
+//   classes.append(class_name, class_p);
+//
+//   SSClass ** class_pp = classes.get(class_name);
+// Arg      _KeyType - key type
+// Arg      _ValueType - value type
+// Arg      _HashClass - provides static hash() and equals() functions for _KeyType
+//          (Default AHashKey<_KeyType>)
+// See Also AHashSet<>, APSorted<>
+template<
+  class _KeyType,
+  class _ValueType,
+  class _HashClass = AHashKey<_KeyType>
+  >
+class AHashMap : public AHashTableBase<AHashMapEntry<_KeyType, _ValueType>, _KeyType, _HashClass>
+  {
+  public:
+  // Common types
+
+    // Local shorthand
+    typedef AHashMapEntry<_KeyType, _ValueType>                     tEntry;
+    typedef AHashTableBase<tEntry, _KeyType, _HashClass>            tAHashTableBase;
+    typedef AHashMap<_KeyType, _ValueType, _HashClass>              tAHashMap;
+
+  // Common methods
+
+    AHashMap()                                         {}
+    explicit AHashMap(uint32_t count)                  { this->ensure_size(count); }
+    AHashMap(const AHashMap & map) : tAHashTableBase(map) {}
+    AHashMap(AHashMap && map) : tAHashTableBase(static_cast<tAHashTableBase &&>(map)) {}
+    AHashMap & operator=(const AHashMap & map)         { this->assign(map); return *this; }
+    AHashMap & operator=(AHashMap && map)              { this->take(&map); return *this; }
+
+  // Modifying Behaviour methods
+
+    bool         append(const _KeyType & key, const _ValueType & value);
+    bool         append(const _KeyType & key, _ValueType && value);
+    bool         append_replace(const _KeyType & key, const _ValueType & value);
+    bool         append_replace(const _KeyType & key, _ValueType && value);
+    bool         pop(const _KeyType & key, _ValueType * value_p);
+    _ValueType & operator[](const _KeyType & key);
+
+  // Non-modifying Methods
+
+    _ValueType * get(const _KeyType & key) const;
+
+    template<class _InvokeType>
+      void apply(_InvokeType & invoke_obj) const;
+
+  };  // AHashMap
+
+
+//---------------------------------------------------------------------------------------
+// Key stored by AHashSet<>
+template<class _KeyType>
+struct AHashSetEntry
+  {
+  _KeyType m_key;
+
+  AHashSetEntry(const _KeyType & key) : m_key(key) {}
+  AHashSetEntry(_KeyType && key)      : m_key(std::move(key)) {}
+  };
+
+//---------------------------------------------------------------------------------------
+// Notes    The AHashSet class template stores unique keys by value in an open addressing
+//          hash table (see AHashTableBase<>).  Keys are in no particular order.
+// Arg      _KeyType - key type
+// Arg      _HashClass - provides static hash() and equals() functions for _KeyType
+//          (Default AHashKey<_KeyType>)
+// See Also AHashMap<>
+template<
+  class _KeyType,
+  class _HashClass = AHashKey<_KeyType>
+  >
+class AHashSet : public AHashTableBase<AHashSetEntry<_KeyType>, _KeyType, _HashClass>
+  {
+  public:
+  // Common types
+
+    // Local shorthand
+    typedef AHashSetEntry<_KeyType>                       tEntry;
+    typedef AHashTableBase<tEntry, _KeyType, _HashClass>  tAHashTableBase;
+    typedef AHashSet<_KeyType, _HashClass>                tAHashSet;
+
+  // Common methods
+
+    AHashSet()                                         {}
+    explicit AHashSet(uint32_t count)                  { this->ensure_size(count); }
+    AHashSet(const AHashSet & set) : tAHashTableBase(set) {}
+    AHashSet(AHashSet && set) : tAHashTableBase(static_cast<tAHashTableBase &&>(set)) {}
+    AHashSet & operator=(const AHashSet & set)         { this->assign(set); return *this; }
+    AHashSet & operator=(AHashSet && set)              { this->take(&set); return *this; }
+
+  // Modifying Behaviour methods
+
+    bool append(const _KeyType & key);
+    bool append(_KeyType && key);
+
+  // Non-modifying Methods
+
+    template<class _InvokeType>
+      void apply(_InvokeType & invoke_obj) const;
+
+  };  // AHashSet
+
+
+//=======================================================================================
+// AHashTableBase Methods
+//=======================================================================================
+
+//---------------------------------------------------------------------------------------
+// Copy constructor
+template<class _EntryType, class _KeyType, class _HashClass>
+AHashTableBase<_EntryType, _KeyType, _HashClass>::AHashTableBase(const AHashTableBase & table) :
+  m_entries_p(nullptr),
+  m_dists_p(nullptr),
+  m_count(0u),
+  m_mask(0u),
+  m_shift(32u)
+  {
+  assign(table);
+  }
+
+//---------------------------------------------------------------------------------------
+// Move constructor - takes the slots of a temporary table and leaves it empty.
+template<class _EntryType, class _KeyType, class _HashClass>
+AHashTableBase<_EntryType, _KeyType, _HashClass>::AHashTableBase(AHashTableBase && table) :
+  m_entries_p(table.m_entries_p),
+  m_dists_p(table.m_dists_p),
+  m_count(table.m_count),
+  m_mask(table.m_mask),
+  m_shift(table.m_shift)
+  {
+  table.m_entries_p = nullptr;
+  table.m_dists_p   = nullptr;
+  table.m_count     = 0u;
+  table.m_mask      = 0u;
+  table.m_shift     = 32u;
+  }
+
+//---------------------------------------------------------------------------------------
+// Destructor
+template<class _EntryType, class _KeyType, class _HashClass>
+AHashTableBase<_EntryType, _KeyType, _HashClass>::~AHashTableBase()
+  {
+  empty();
+  AMemory::free(m_entries_p);
+  }
+
+//---------------------------------------------------------------------------------------
+// Removes all entries - the slots are kept for reuse.
+// # See: remove()
+template<class _EntryType, class _KeyType, class _HashClass>
+void AHashTableBase<_EntryType, _KeyType, _HashClass>::empty()
+  {
+  if (m_count)
+    {
+    uint32_t slot_count = m_mask + 1u;
+
+    for (uint32_t idx = 0u; idx < slot_count; idx++)
+      {
+      if (m_dists_p[idx])
+        {
+        m_entries_p[idx].~_EntryType();
+        }
+      }
+
+    ::memset(m_dists_p, 0, slot_count);
+    m_count = 0u;
+    }
+  }
+
+//---------------------------------------------------------------------------------------
+// Ensures that at least count entries can be stored without the table needing to grow.
+// # See: get_size()
+template<class _EntryType, class _KeyType, class _HashClass>
+void AHashTableBase<_EntryType, _KeyType, _HashClass>::ensure_size(uint32_t count)
+  {
+  uint32_t slot_count = m_mask ? m_mask + 1u : 0u;
+
+  // Max load is 7/8 of the slots
+  if (count > (slot_count - (slot_count >> 3)))
+    {
+    slot_count = AHashTable_size_min;
+
+    while (count > (slot_count - (slot_count >> 3)))
+      {
+      slot_count <<= 1;
+      }
+
+    rebuild(slot_count);
+    }
+  }
+
+//---------------------------------------------------------------------------------------
+// Removes the entry with the specified key.
+// # Returns:  true if found and removed, false if not found
+// Arg         key - key of entry to remove
+// # See:      empty()
+template<class _EntryType, class _KeyType, class _HashClass>
+bool AHashTableBase<_EntryType, _KeyType, _HashClass>::remove(const _KeyType & key)
+  {
+  _EntryType * entry_p = find_entry(key);
+
+  if (entry_p == nullptr)
+    {
+    return false;
+    }
+
+  entry_p->~_EntryType();
+  remove_entry(entry_p);
+
+  return true;
+  }
+
+//---------------------------------------------------------------------------------------
+// Destroys any current entries and copies the entries of another table.  The slot layout
+// is copied as is so no rehashing is needed.
+// # Modifiers: protected
+template<class _EntryType, class _KeyType, class _HashClass>
+void AHashTableBase<_EntryType, _KeyType, _HashClass>::assign(const AHashTableBase & table)
+  {
+  if (this == &table)
+    {
+    return;
+    }
+
+  empty();
+
+  if (table.m_count == 0u)
+    {
+    return;
+    }
+
+  uint32_t slot_count = table.m_mask + 1u;
+
+  if (m_mask != table.m_mask)
+    {
+    AMemory::free(m_entries_p);
+    m_entries_p = (_EntryType *)AMemory::malloc((sizeof(_EntryType) + 1u) * slot_count, "AHashTable.slots");
+    A_VERIFY_MEMORY(m_entries_p != nullptr, tAHashTableBase);
+    m_dists_p   = (uint8_t *)(m_entries_p + slot_count);
+    m_mask      = table.m_mask;
+    m_shift     = table.m_shift;
+    }
+
+  ::memcpy(m_dists_p, table.m_dists_p, slot_count);
+
+  for (uint32_t idx = 0u; idx < slot_count; idx++)
+    {
+    if (m_dists_p[idx])
+      {
+      new (m_entries_p + idx) _EntryType(table.m_entries_p[idx]);
+      }
+    }
+
+  m_count = table.m_count;
+  }
+
+//---------------------------------------------------------------------------------------
+// Destroys any current entries and frees the slots then takes the slots of another table
+// and leaves it empty.
+// # Modifiers: protected
+template<class _EntryType, class _KeyType, class _HashClass>
+void AHashTableBase<_EntryType, _KeyType, _HashClass>::take(AHashTableBase * table_p)
+  {
+  if (this == table_p)
+    {
+    return;
+    }
+
+  empty();
+  AMemory::free(m_entries_p);
+
+  m_entries_p = table_p->m_entries_p;
+  m_dists_p   = table_p->m_dists_p;
+  m_count     = table_p->m_count;
+  m_mask      = table_p->m_mask;
+  m_shift     = table_p->m_shift;
+
+  table_p->m_entries_p = nullptr;
+  table_p->m_dists_p   = nullptr;
+  table_p->m_count     = 0u;
+  table_p->m_mask      = 0u;
+  table_p->m_shift     = 32u;
+  }
+
+//---------------------------------------------------------------------------------------
+// Finds the entry with the specified key.
+// # Returns:  entry or nullptr if not found
+// Arg         key - key of entry to find
+// # Modifiers: protected
+template<class _EntryType, class _KeyType, class _HashClass>
+inline _EntryType * AHashTableBase<_EntryType, _KeyType, _HashClass>::find_entry(
+  const _KeyType & key
+  ) const
+  {
+  if (m_count == 0u)
+    {
+    return nullptr;
+    }
+
+  const uint8_t * dists_p   = m_dists_p;
+  uint32_t        mask      = m_mask;
+  uint32_t        shift     = m_shift;
+  uint32_t        pos       = get_home(key, shift);
+  uint32_t        dist      = 1u;
+  uint32_t        slot_dist = dists_p[pos];
+
+  // Stop at an empty slot or at an entry closer to its home than the key would be
+  while (slot_dist >= dist)
+    {
+    if ((slot_dist == dist) && _HashClass::equals(m_entries_p[pos].m_key, key))
+      {
+      return m_entries_p + pos;
+      }
+
+    pos       = (pos + 1u) & mask;
+    slot_dist = get_dist(m_entries_p, dists_p, mask, shift, pos);
+    dist++;
+    }
+
+  return nullptr;
+  }
+
+//---------------------------------------------------------------------------------------
+// Finds the entry with the specified key or makes an unconstructed slot for it.
+// # Returns:  existing entry or address of slot that the caller must construct an entry
+//             with the specified key in (using placement new) if appended_p is set to
+//             true.
+// Arg         key - key of entry to find or make room for
+// Arg         appended_p - address to store whether a slot was made for a new entry
+// # Modifiers: protected
+template<class _EntryType, class _KeyType, class _HashClass>
+_EntryType * AHashTableBase<_EntryType, _KeyType, _HashClass>::insert_entry(
+  const _KeyType & key,
+  bool *           appended_p
+  )
+  {
+  ensure_size(m_count + 1u);
+
+  A_LOOP_INFINITE
+    {
+    uint8_t * dists_p   = m_dists_p;
+    uint32_t  mask      = m_mask;
+    uint32_t  shift     = m_shift;
+    uint32_t  pos       = get_home(key, shift);
+    uint32_t  dist      = 1u;
+    uint32_t  slot_dist = dists_p[pos];
+
+    while (slot_dist >= dist)
+      {
+      if ((slot_dist == dist) && _HashClass::equals(m_entries_p[pos].m_key, key))
+        {
+        *appended_p = false;
+
+        return m_entries_p + pos;
+        }
+
+      pos       = (pos + 1u) & mask;
+      slot_dist = get_dist(m_entries_p, dists_p, mask, shift, pos);
+      dist++;
+      }
+
+    // If the probe distance would not fit in a byte, grow and try again - unless the
+    // table is already sparse in which case the keys just share the same hash and the
+    // long distance is stored instead.
+    if ((dist <= AHashTable_dist_max)
+      || (((mask + 1u) / AHashTable_grow_ratio_max) >= m_count))
+      {
+      place(m_entries_p, dists_p, mask, shift, pos);
+      dists_p[pos] = get_dist_byte(dist);
+      m_count++;
+      *appended_p = true;
+
+      return m_entries_p + pos;
+      }
+
+    rebuild((mask + 1u) << 1);
+    }
+  }
+
+//---------------------------------------------------------------------------------------
+// Removes the entry at entry_p - which must already be destructed - and shifts back any
+// following entries of its cluster.
+// # Modifiers: protected
+template<class _EntryType, class _KeyType, class _HashClass>
+void AHashTableBase<_EntryType, _KeyType, _HashClass>::remove_entry(_EntryType * entry_p)
+  {
+  uint8_t * dists_p = m_dists_p;
+  uint32_t  mask    = m_mask;
+  uint32_t  shift   = m_shift;
+  uint32_t  pos     = uint32_t(entry_p - m_entries_p);
+  uint32_t  next    = (pos + 1u) & mask;
+
+  // Entries not in their home slot move back one
+  while (dists_p[next] > 1u)
+    {
+    dists_p[pos] = get_dist_byte(get_dist(m_entries_p, dists_p, mask, shift, next) - 1u);
+    ::memcpy(m_entries_p + pos, m_entries_p + next, sizeof(_EntryType));
+    pos  = next;
+    next = (next + 1u) & mask;
+    }
+
+  dists_p[pos] = 0u;
+  m_count--;
+  }
+
+//---------------------------------------------------------------------------------------
+// Makes the slot at pos available by shifting it and the rest of its cluster forward by
+// one slot.  The distance byte of pos is left for the caller to set.
+// # Modifiers: protected, static
+template<class _EntryType, class _KeyType, class _HashClass>
+void AHashTableBase<_EntryType, _KeyType, _HashClass>::place(
+  _EntryType * entries_p,
+  uint8_t *    dists_p,
+  uint32_t     mask,
+  uint32_t     shift,
+  uint32_t     pos
+  )
+  {
+  uint32_t idx = pos;
+
+  while (dists_p[idx])
+    {
+    idx = (idx + 1u) & mask;
+    }
+
+  uint32_t prev;
+
+  while (idx != pos)
+    {
+    prev = (idx - 1u) & mask;
+    dists_p[idx] = get_dist_byte(get_dist(entries_p, dists_p, mask, shift, prev) + 1u);
+    ::memcpy(entries_p + idx, entries_p + prev, sizeof(_EntryType));
+    idx  = prev;
+    }
+  }
+
+//---------------------------------------------------------------------------------------
+// # Returns:  probe distance + 1 of the entry in the slot at pos or 0 if the slot is empty
+// # Notes:    Distances stored as AHashTable_dist_max are worked out from the home slot of
+//             the entry's key since they may be larger.
+// # Modifiers: protected, static
+template<class _EntryType, class _KeyType, class _HashClass>
+inline uint32_t AHashTableBase<_EntryType, _KeyType, _HashClass>::get_dist(
+  const _EntryType * entries_p,
+  const uint8_t *    dists_p,
+  uint32_t           mask,
+  uint32_t           shift,
+  uint32_t           pos
+  )
+  {
+  uint32_t dist = dists_p[pos];
+
+  return (dist < AHashTable_dist_max)
+    ? dist
+    : ((pos - get_home(entries_p[pos].m_key, shift)) & mask) + 1u;
+  }
+
+//---------------------------------------------------------------------------------------
+// Moves all the entries to a new set of slots.
+// Arg         slot_count - number of slots to use - must be a power of 2 and large enough
+//             for the current entries.
+// # Modifiers: protected
+template<class _EntryType, class _KeyType, class _HashClass>
+void AHashTableBase<_EntryType, _KeyType, _HashClass>::rebuild(uint32_t slot_count)
+  {
+  uint32_t     old_count = m_mask ? m_mask + 1u : 0u;
+  _EntryType * entries_p = (_EntryType *)AMemory::malloc((sizeof(_EntryType) + 1u) * slot_count, "AHashTable.slots");
+  A_VERIFY_MEMORY(entries_p != nullptr, tAHashTableBase);
+
+  uint8_t * dists_p = (uint8_t *)(entries_p + slot_count);
+  uint32_t  mask    = slot_count - 1u;
+  uint32_t  shift   = 32u;
+
+  for (uint32_t size = slot_count; size > 1u; size >>= 1)
+    {
+    shift--;
+    }
+
+  ::memset(dists_p, 0, slot_count);
+
+  // Entries are moved bitwise
+  for (uint32_t idx = 0u; idx < old_count; idx++)
+    {
+    if (m_dists_p[idx])
+      {
+      uint32_t pos  = get_home(m_entries_p[idx].m_key, shift);
+      uint32_t dist = 1u;
+
+      while (get_dist(entries_p, dists_p, mask, shift, pos) >= dist)
+        {
+        pos = (pos + 1u) & mask;
+        dist++;
+        }
+
+      place(entries_p, dists_p, mask, shift, pos);
+      ::memcpy(entries_p + pos, m_entries_p + idx, sizeof(_EntryType));
+      dists_p[pos] = get_dist_byte(dist);
+      }
+    }
+
+  AMemory::free(m_entries_p);
+  m_entries_p = entries_p;
+  m_dists_p   = dists_p;
+  m_mask      = mask;
+  m_shift     = shift;
+  }
+
+
+//=======================================================================================
+// AHashMap Methods
+//=======================================================================================
+
+//---------------------------------------------------------------------------------------
+// Appends a key/value pair if the key is not already present.
+// # Returns:  true if appended, false if the key was already present (its value is left
+//             unchanged)
+// Arg         key - key to append
+// Arg         value - value to associate with key
+// # See:      append_replace(), operator[]()
+template<class _KeyType, class _ValueType, class _HashClass>
+bool AHashMap<_KeyType, _ValueType, _HashClass>::append(
+  const _KeyType &   key,
+  const _ValueType & value
+  )
+  {
+  bool     appended;
+  tEntry * entry_p = this->insert_entry(key, &appended);
+
+  if (appended)
+    {
+    new (entry_p) tEntry(key, value);
+    }
+
+  return appended;
+  }
+
+//---------------------------------------------------------------------------------------
+// Same as append(key, const _ValueType &) though value is a temporary so it is moved
+// into the map rather than copied.  It is left untouched if the key was already present.
+// # Returns:  true if appended, false if the key was already present
+// Arg         key - key to append
+// Arg         value - temporary value to associate with key
+template<class _KeyType, class _ValueType, class _HashClass>
+bool AHashMap<_KeyType, _ValueType, _HashClass>::append(
+  const _KeyType & key,
+  _ValueType &&    value
+  )
+  {
+  bool     appended;
+  tEntry * entry_p = this->insert_entry(key, &appended);
+
+  if (appended)
+    {
+    new (entry_p) tEntry(key, std::move(value));
+    }
+
+  return appended;
+  }
+
+//---------------------------------------------------------------------------------------
+// Appends a key/value pair or replaces the value of an existing key.
+// # Returns:  true if appended, false if an existing value was replaced
+// Arg         key - key to append
+// Arg         value - value to associate with key
+// # See:      append(), operator[]()
+template<class _KeyType, class _ValueType, class _HashClass>
+bool AHashMap<_KeyType, _ValueType, _HashClass>::append_replace(
+  const _KeyType &   key,
+  const _ValueType & value
+  )
+  {
+  bool     appended;
+  tEntry * entry_p = this->insert_entry(key, &appended);
+
+  if (appended)
+    {
+    new (entry_p) tEntry(key, value);
+    }
+  else
+    {
+    entry_p->m_value = value;
+    }
+
+  return appended;
+  }
+
+//---------------------------------------------------------------------------------------
+// Same as append_replace(key, const _ValueType &) though value is a temporary so it is
+// moved into the map rather than copied.
+// # Returns:  true if appended, false if an existing value was replaced
+// Arg         key - key to append
+// Arg         value - temporary value to associate with key
+template<class _KeyType, class _ValueType, class _HashClass>
+bool AHashMap<_KeyType, _ValueType, _HashClass>::append_replace(
+  const _KeyType & key,
+  _ValueType &&    value
+  )
+  {
+  bool     appended;
+  tEntry * entry_p = this->insert_entry(key, &appended);
+
+  if (appended)
+    {
+    new (entry_p) tEntry(key, std::move(value));
+    }
+  else
+    {
+    entry_p->m_value = std::move(value);
+    }
+
+  return appended;
+  }
+
+//---------------------------------------------------------------------------------------
+// Removes the entry with the specified key and returns its value.
+// # Returns:  true if found and removed, false if not found
+// Arg         key - key of entry to remove
+// Arg         value_p - address to store value of removed entry
+// # See:      remove()
+template<class _KeyType, class _ValueType, class _HashClass>
+bool AHashMap<_KeyType, _ValueType, _HashClass>::pop(
+  const _KeyType & key,
+  _ValueType *     value_p
+  )
+  {
+  tEntry * entry_p = this->find_entry(key);
+
+  if (entry_p == nullptr)
+    {
+    return false;
+    }
+
+  *value_p = std::move(entry_p->m_value);
+  entry_p->~tEntry();
+  this->remove_entry(entry_p);
+
+  return true;
+  }
+
+//---------------------------------------------------------------------------------------
+// Gets the value of the specified key - appending a default constructed value if the key
+// is not already present.
+// # Returns:  value - only valid until this map is next modified
+// Arg         key - key of value
+// # Examples: counts[sym]++;
+// # See:      get(), append()
+template<class _KeyType, class _ValueType, class _HashClass>
+_ValueType & AHashMap<_KeyType, _ValueType, _HashClass>::operator[](const _KeyType & key)
+  {
+  bool     appended;
+  tEntry * entry_p = this->insert_entry(key, &appended);
+
+  if (appended)
+    {
+    new (entry_p) tEntry(key, _ValueType());
+    }
+
+  return entry_p->m_value;
+  }
+
+//---------------------------------------------------------------------------------------
+// Gets the value of the specified key.
+// # Returns:  address of value or nullptr if not found - only valid until this map is
+//             next modified
+// Arg         key - key of value to find
+// # See:      find(), operator[]()
+template<class _KeyType, class _ValueType, class _HashClass>
+inline _ValueType * AHashMap<_KeyType, _ValueType, _HashClass>::get(const _KeyType & key) const
+  {
+  tEntry * entry_p = this->find_entry(key);
+
+  return entry_p ? &entry_p->m_value : nullptr;
+  }
+
+//---------------------------------------------------------------------------------------
+// Applies the supplied invoke_obj to each key/value pair in no particular order.
+// Arg         invoke_obj - function or function object called with each pair in the form:
+//               void invoke(const _KeyType & key, _ValueType & value)
+//             The map must not be modified during the call.
+template<class _KeyType, class _ValueType, class _HashClass>
+template<class _InvokeType>
+void AHashMap<_KeyType, _ValueType, _HashClass>::apply(_InvokeType & invoke_obj) const
+  {
+  uint32_t slot_count = this->get_size();
+
+  for (uint32_t idx = 0u; idx < slot_count; idx++)
+    {
+    if (this->m_dists_p[idx])
+      {
+      invoke_obj(this->m_entries_p[idx].m_key, this->m_entries_p[idx].m_value);
+      }
+    }
+  }
+
+
+//=======================================================================================
+// AHashSet Methods
+//=======================================================================================
+
+//---------------------------------------------------------------------------------------
+// Appends a key if it is not already present.
+// # Returns:  true if appended, false if already present
+// Arg         key - key to append
+template<class _KeyType, class _HashClass>
+bool AHashSet<_KeyType, _HashClass>::append(const _KeyType & key)
+  {
+  bool     appended;
+  tEntry * entry_p = this->insert_entry(key, &appended);
+
+  if (appended)
+    {
+    new (entry_p) tEntry(key);
+    }
+
+  return appended;
+  }
+
+//---------------------------------------------------------------------------------------
+// Same as append(const _KeyType &) though key is a temporary so it is moved into the set
+// rather than copied.
+// # Returns:  true if appended, false if already present
+// Arg         key - temporary key to append
+template<class _KeyType, class _HashClass>
+bool AHashSet<_KeyType, _HashClass>::append(_KeyType && key)
+  {
+  bool     appended;
+  tEntry * entry_p = this->insert_entry(key, &appended);
+
+  if (appended)
+    {
+    new (entry_p) tEntry(std::move(key));
+    }
+
+  return appended;
+  }
+
+//---------------------------------------------------------------------------------------
+// Applies the supplied invoke_obj to each key in no particular order.
+// Arg         invoke_obj - function or function object called with each key in the form:
+//               void invoke(const _KeyType & key)
+//             The set must not be modified during the call.
+template<class _KeyType, class _HashClass>
+template<class _InvokeType>
+void AHashSet<_KeyType, _HashClass>::apply(_InvokeType & invoke_obj) const
+  {
+  uint32_t slot_count = this->get_size();
+
+  for (uint32_t idx = 0u; idx < slot_count; idx++)
+    {
+    if (this->m_dists_p[idx])
+      {
+      invoke_obj(this->m_entries_p[idx].m_key);
+      }
+    }
+  }
+
+
+#endif  // __AHASHMAP_HPP
@@ -0,0 +1,322 @@
+//=======================================================================================
+// Agog Labs C++ library.
+// Copyright (c) 2015 Agog Labs Inc.,
+// All rights reserved.
+//
+// Job system - fixed pool of worker threads with work-stealing job queues
+// # Notes:
+//=======================================================================================
+
+
+#ifndef __AJOBSYSTEM_HPP
+#define __AJOBSYSTEM_HPP
+
+
+//=======================================================================================
+// Includes
+//=======================================================================================
+
+#include "AgogCore/AgogCore.hpp"
+#include <atomic>              // Uses: std::atomic
+#include <condition_variable>  // Uses: std::condition_variable
+#include <mutex>               // Uses: std::mutex
+#include <thread>              // Uses: std::thread
+
+
+//=======================================================================================
+// Global Macros / Defines
+//=======================================================================================
+
+enum
+  {
+  // Default number of jobs each worker queue can hold - jobs are run immediately by the
+  // submitting thread if its queue is full.  Must be a power of 2.
+  AJobSystem_queue_size_def = 4096u,
+
+  // Number of times an idle worker looks for a job before going to sleep
+  AJobSystem_idle_spins     = 64u,
+
+  // Number of parallel_for() jobs created per worker when no grain size is given
+  AJobSystem_for_splits     = 4u,
+
+  // Bytes used to keep data written by different threads on separate cache lines
+  AJobSystem_cache_line     = 64u
+  };
+
+
+//=======================================================================================
+// Global Structures
+//=======================================================================================
+
+class AJobCounter;
+
+// Function called to run a job
+typedef void (* tAJobFunc)(void * data_p);
+
+// Function called to process part of a parallel_for() range - begin inclusive, end exclusive
+typedef void (* tAJobRangeFunc)(void * data_p, uint32_t begin, uint32_t end);
+
+
+//---------------------------------------------------------------------------------------
+// A unit of work - a function and the data to pass to it.
+//
+// Jobs are owned by the caller and are not copied by AJobSystem - a job (and its data)
+// must stay valid until the counter it was run with has been waited on.
+struct AJob
+  {
+  // Common Methods
+
+    AJob(tAJobFunc func_p = nullptr, void * data_p = nullptr) : m_func_p(func_p), m_data_p(data_p), m_counter_p(nullptr), m_next_p(nullptr) {}
+
+  // Data Members
+
+    // Function to call and the data to pass to it
+    tAJobFunc m_func_p;
+    void *    m_data_p;
+
+    // Set by AJobSystem - counter decremented once the job is done
+    AJobCounter * m_counter_p;
+
+    // Set by AJobSystem - next job in a dependency or submission list
+    AJob * m_next_p;
+
+  };
+
+
+//---------------------------------------------------------------------------------------
+// Count of outstanding jobs that can be waited on with AJobSystem::wait() and that other
+// jobs can depend on with AJobSystem::run_after().
+//
+// # Notes:
+//   A counter may be reused once it has been waited on.  Only destroy a counter after
+//   AJobSystem::wait() has returned for it - polling is_done() is not enough since the
+//   thread finishing the last job may still be using the counter.
+class AJobCounter
+  {
+  public:
+
+  // Common Methods
+
+    AJobCounter() : m_count(0u), m_pending_p(nullptr) {}
+    ~AJobCounter()                      { A_ASSERTX(m_pending_p == nullptr, "AJobCounter destroyed with jobs still waiting on it!"); }
+
+  // Accessor Methods
+
+    uint32_t get_count() const          { return m_count.load(std::memory_order_acquire); }
+    bool     is_done() const            { return get_count() == 0u; }
+
+  protected:
+
+    friend class AJobSystem;
+
+  // Data Members
+
+    // Number of jobs not yet done
+    std::atomic<uint32_t> m_count;
+
+    // Protects m_pending_p and the last decrement of m_count
+    std::mutex m_mutex;
+
+    // Jobs to run once m_count reaches 0 - see AJobSystem::run_after()
+    AJob * m_pending_p;
+
+  private:
+
+    // Disallow copying
+    AJobCounter(const AJobCounter &);
+    AJobCounter & operator=(const AJobCounter &);
+
+  };
+
+
+//---------------------------------------------------------------------------------------
+// Fixed pool of worker threads that run jobs.
+//
+// Each worker - including the thread that created the job system, which is worker 0 -
+// has its own queue.  A worker adds and removes jobs at one end of its own queue with no
+// locking and idle workers steal the oldest jobs from the other end of other workers'
+// queues.  Threads that are not workers (such as loader threads) add their jobs to a
+// shared locked list instead.
+//
+// wait() runs other jobs while the counter it waits on is not done, so waiting inside
+// a job does not tie up a worker and the thread that created the job system helps out.
+//
+// Workers spin briefly when they run out of jobs and then sleep until more jobs are
+// run.
+//
+// # Examples:
+//   AJobSystem jobs;
+//
+//   // Individual jobs
+//   AJob        load_jobs[2] = { AJob(load_class_group, &group1), AJob(load_class_group, &group2) };
+//   AJob        link_job(link_classes, &classes);
+//   AJobCounter loaded;
+//   AJobCounter linked;
+//
+//   jobs.run(load_jobs, 2u, &loaded);
+//   jobs.run_after(&loaded, &link_job, 1u, &linked);  // Runs once both loads are done
+//   jobs.wait(&linked);
+//
+//   // Index ranges
+//   jobs.parallel_for(count, 0u, [&](uint32_t begin, uint32_t end)
+//     {
+//     for (uint32_t idx = begin; idx < end; idx++) { results_a[idx] = process(idx); }
+//     });
+//
+// # Notes:
+//   The job system must be destroyed by the thread that created it and only after all
+//   the jobs it has been given are done.
+//   Only one job system should be used per thread.
+//   All memory is allocated through AMemory.
+class AJobSystem
+  {
+  public:
+
+  // Common Methods
+
+    AJobSystem(uint32_t worker_count = 0u, uint32_t queue_size = AJobSystem_queue_size_def);
+    ~AJobSystem();
+
+  // Accessor Methods
+
+    uint32_t get_worker_count() const   { return m_worker_count; }
+    int32_t  get_worker_idx() const;
+
+  // Methods
+
+    void run(AJob * jobs_p, uint32_t job_count, AJobCounter * counter_p);
+    void run_after(AJobCounter * depend_p, AJob * jobs_p, uint32_t job_count, AJobCounter * counter_p);
+    void wait(AJobCounter * counter_p);
+    void parallel_for(uint32_t count, uint32_t grain, tAJobRangeFunc func_p, void * data_p);
+
+    template<class _FuncType>
+      void parallel_for(uint32_t count, uint32_t grain, const _FuncType & func);
+
+  // Class Methods
+
+    static uint32_t get_hardware_thread_count();
+
+  protected:
+
+  // Nested Structures
+
+    // Worker thread and its job queue.
+    //
+    // The queue is a fixed size ring of job pointers.  The owning worker pushes and pops
+    // at m_bottom and other threads steal from m_top - see Chase & Lev "Dynamic Circular
+    // Work-Stealing Deque" and Le et al. "Correct and Efficient Work-Stealing for Weak
+    // Memory Models".
+    struct Worker
+      {
+      // Index of oldest job - changed by stealing threads
+      std::atomic<int64_t> m_top;
+
+      uint8_t m_pad_top[AJobSystem_cache_line];
+
+      // Index one past newest job - only changed by owning worker
+      std::atomic<int64_t> m_bottom;
+
+      // Ring of jobs - m_mask + 1 long
+      std::atomic<AJob *> * m_jobs_a;
+      uint32_t              m_mask;
+
+      // Index of this worker and random state for picking workers to steal from
+      uint32_t m_idx;
+      uint32_t m_random;
+
+      AJobSystem * m_system_p;
+      std::thread  m_thread;
+
+      uint8_t m_pad_bottom[AJobSystem_cache_line];
+      };
+
+    // Part of a parallel_for() range
+    struct Range
+      {
+      tAJobRangeFunc m_func_p;
+      void *         m_data_p;
+      uint32_t       m_begin;
+      uint32_t       m_end;
+      };
+
+  // Internal Methods
+
+    void   worker_loop(Worker * worker_p);
+    void   submit(Worker * worker_p, AJob * job_p);
+    void   execute(AJob * job_p);
+    void   complete(AJobCounter * counter_p);
+    void   wake(uint32_t job_count);
+    AJob * find_job(Worker * worker_p);
+    AJob * inject_pop();
+    Worker * get_worker() const;
+
+    static bool   queue_push(Worker * worker_p, AJob * job_p);
+    static AJob * queue_pop(Worker * worker_p);
+    static AJob * queue_steal(Worker * worker_p);
+    static void   invoke_range(void * range_p);
+
+    template<class _FuncType>
+      static void invoke_func(void * func_p, uint32_t begin, uint32_t end)  { (*static_cast<const _FuncType *>(func_p))(begin, end); }
+
+  // Data Members
+
+    // Workers - worker 0 is the thread that created the job system
+    Worker * m_workers_a;
+    uint32_t m_worker_count;
+
+    // Jobs run by threads that are not workers - protected by m_inject_mutex
+    AJob *               m_inject_head_p;
+    AJob *               m_inject_tail_p;
+    std::atomic<int32_t> m_inject_count;
+    std::mutex           m_inject_mutex;
+
+    // Number of jobs in queues that have not been taken yet - used to decide whether
+    // workers should sleep.
+    std::atomic<int32_t> m_queued;
+
+    // Sleeping workers wait on m_wake_cond - protected by m_sleep_mutex
+    std::atomic<uint32_t>   m_sleeping;
+    std::mutex              m_sleep_mutex;
+    std::condition_variable m_wake_cond;
+
+    // Set when the job system is being destroyed
+    std::atomic<bool> m_quit;
+
+  // Class Data
+
+    // Worker for the calling thread - nullptr if it is not a worker
+    static A_THREAD_LOCAL Worker * ms_worker_p;
+
+  private:
+
+    // Disallow copying
+    AJobSystem(const AJobSystem &);
+    AJobSystem & operator=(const AJobSystem &);
+
+  };  // AJobSystem
+
+
+//=======================================================================================
+// Inline Methods
+//=======================================================================================
+
+//---------------------------------------------------------------------------------------
+// Calls func(begin, end) in parallel for sub-ranges that together cover 0 to count - 1
+// and returns once all of them are done.
+// Arg         count - number of indexes to process
+// Arg         grain - number of indexes in each sub-range.  If 0 the range is split
+//             into AJobSystem_for_splits sub-ranges per worker.
+// Arg         func - function or lambda that takes a begin (inclusive) and end
+//             (exclusive) index - it is called from several threads at once.
+template<class _FuncType>
+inline void AJobSystem::parallel_for(
+  uint32_t          count,
+  uint32_t          grain,
+  const _FuncType & func
+  )
+  {
+  parallel_for(count, grain, invoke_func<_FuncType>, const_cast<_FuncType *>(&func));
+  }
+
+
+#endif  // __AJOBSYSTEM_HPP
@@ -134,7 +134,9 @@ class AList
 
     AList();
     AList(AList * list_p);
+    AList(AList && list);
     ~AList();
+    AList & operator=(AList && list);
 
   // Accessor methods
 
@@ -254,6 +256,8 @@ class AListFree : public AList<_ElementType, _NodeIdType>
     AListFree()                                              {}
     ~AListFree()                                             { AList::free_all(); }
     AListFree(AList<_ElementType, _NodeIdType> * list_p)     : AList<_ElementType, _NodeIdType>(list_p) {}
+    AListFree(AListFree && list)                             : AList<_ElementType, _NodeIdType>(&list) {}
+    AListFree & operator=(AListFree && list)                 { if (this != &list) { this->free_all(); this->append_take(&list); } return *this; }
 
   protected:
   // Internal Methods
@@ -304,6 +308,15 @@ inline AList<_ElementType, _NodeIdType>::AList(AList * list_p)
   append_take(list_p);
   }
 
+//---------------------------------------------------------------------------------------
+// Move constructor - transfers elements from a temporary list to this list.
+// # See: AList(AList *)
+template<class _ElementType, class _NodeIdType>
+inline AList<_ElementType, _NodeIdType>::AList(AList && list)
+  {
+  append_take(&list);
+  }
+
 //---------------------------------------------------------------------------------------
 // Copy constructor - does nothing for intrinsic lists
 // # Author(s): Conan Reis
@@ -334,6 +347,21 @@ inline AList<_ElementType, _NodeIdType> & AList<_ElementType, _NodeIdType>::oper
   return *this;
   }
 
+//---------------------------------------------------------------------------------------
+// Move assignment operator - removes any existing elements and then transfers elements
+// from a temporary list to this list.
+// # See: take()
+template<class _ElementType, class _NodeIdType>
+inline AList<_ElementType, _NodeIdType> & AList<_ElementType, _NodeIdType>::operator=(AList && list)
+  {
+  if (this != &list)
+    {
+    take(&list);
+    }
+
+  return *this;
+  }
+
 //---------------------------------------------------------------------------------------
 // Insert element at the tail/end of the list.
 // # Author(s): Conan Reis
@@ -372,6 +400,12 @@ void AList<_ElementType, _NodeIdType>::append_take(AList * list_p)
     A_VERIFYX(is_valid() && list_p->is_valid(), "List failed validity check!");
   #endif
 
+  // Nothing to transfer - linking in an empty list would link to its sentinel
+  if (list_p->is_empty())
+    {
+    return;
+    }
+
   tAListNode * sentinel_p      = &m_sentinel;
   tAListNode * last_p          = sentinel_p->m_prev_p;
   tAListNode * list_sentinel_p = &list_p->m_sentinel;
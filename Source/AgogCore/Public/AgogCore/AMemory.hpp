@@ -111,6 +111,9 @@ class AMemory
     static void           delete_array(_ObjectType * array_p, size_t num_objects);
 
     static void           override_functions(tAMallocFunc malloc_func, tAFreeFunc free_func, tAReqByteSizeFunc req_byte_size_func);
+    static tAMallocFunc      get_malloc_func()                            { return ms_malloc_func; }
+    static tAFreeFunc        get_free_func()                              { return ms_free_func; }
+    static tAReqByteSizeFunc get_req_byte_size_func()                     { return ms_req_byte_size_func; }
 
   protected:
 
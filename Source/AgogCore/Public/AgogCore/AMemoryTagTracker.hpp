@@ -0,0 +1,133 @@
+//=======================================================================================
+// Agog Labs C++ library.
+// Copyright (c) 2015 Agog Labs Inc.,
+// All rights reserved.
+//
+// Live allocation tracking per AMemory name tag
+// # Notes:
+//=======================================================================================
+
+
+#ifndef __AMEMORYTAGTRACKER_HPP
+#define __AMEMORYTAGTRACKER_HPP
+
+
+//=======================================================================================
+// Includes
+//=======================================================================================
+
+#include "AgogCore/AMemory.hpp"
+
+
+//=======================================================================================
+// Global Macros / Defines
+//=======================================================================================
+
+enum
+  {
+  // Maximum number of distinct tags - any more are lumped into the last tag
+  AMemTag_tag_max          = 1024u,
+
+  // Maximum number of characters kept from a tag name
+  AMemTag_name_length_max  = 47u,
+
+  // Initial number of slots in the live allocation table - must be a power of 2
+  AMemTag_table_initial    = 4096u,
+
+  // Number of slots in the tag name pointer cache - must be a power of 2
+  AMemTag_name_cache_size  = 2048u
+  };
+
+
+//=======================================================================================
+// Global Structures
+//=======================================================================================
+
+//---------------------------------------------------------------------------------------
+// Statistics for all live allocations made with the same AMemory name tag
+struct AMemoryTagInfo
+  {
+  // Tag name - copied from the name_p given to AMemory::malloc()
+  char m_name[AMemTag_name_length_max + 1u];
+
+  // Bytes currently allocated (as requested - not including allocator overhead)
+  size_t m_bytes_live;
+
+  // Peak of m_bytes_live
+  size_t m_bytes_peak;
+
+  // Number of allocations currently outstanding
+  uint32_t m_count_live;
+
+  // Total number of allocations made
+  uint32_t m_alloc_count;
+
+  // Number of allocations made since last AMemoryTagTracker::reset_interval()
+  uint32_t m_alloc_count_interval;
+  };
+
+
+//---------------------------------------------------------------------------------------
+// Opt-in tracking allocator that records live bytes, live count, peak and allocation
+// rate for each name tag passed to AMemory::malloc() - "AStringRef.buffer", class names
+// from A_NEW_OPERATORS, etc.
+//
+// It wraps the AMemory functions that are installed when install() is called and
+// remembers the size and tag of each live allocation in an open addressing hash table
+// keyed on address.  Memory allocated before install() is not in the table and is just
+// passed through when freed.  Each malloc()/free() costs a hash table insert/remove on
+// top of the wrapped allocator - tag names are only compared the first time a given
+// name pointer is seen.
+//
+// # Examples:
+//   // After any custom allocator is installed
+//   AMemoryTagTracker::install();
+//   ...
+//   AMemoryTagTracker::print_stats();
+//
+// # Notes:
+//   malloc() and free() may be called from any thread - the tables are protected by a
+//   single lock which is not held while the wrapped allocator is called.  Statistics
+//   returned by reference may change while they are read if other threads are
+//   allocating.  install() and deinitialize() must be called while no other thread is
+//   allocating.
+//   Tags are matched by name pointer first, so a tag string buffer that is reused for a
+//   different name keeps being counted under the name it had when first seen.
+class AMemoryTagTracker
+  {
+  public:
+
+  // Class Methods
+
+    static void     install();
+    static void     deinitialize();
+    static bool     is_installed()                                  { return ms_backing_malloc_func != nullptr; }
+
+    // AMemory functions - see AMemory::override_functions()
+
+    static void *   malloc(size_t size, const char * name_p);
+    static void     free(void * mem_p);
+
+    // Statistics
+
+    static uint32_t               get_tag_count();
+    static const AMemoryTagInfo & get_tag(uint32_t tag_idx);
+    static const AMemoryTagInfo * find_tag(const char * name_p);
+    static size_t                 get_bytes_live();
+    static uint32_t               get_count_live();
+    static void                   reset_interval();
+    static void                   print_stats();
+
+  protected:
+
+  // Class Data
+
+    // Wrapped allocator functions
+    static tAMallocFunc      ms_backing_malloc_func;
+    static tAFreeFunc        ms_backing_free_func;
+    static tAReqByteSizeFunc ms_backing_req_byte_size_func;
+
+  };  // AMemoryTagTracker
+
+
+#endif  // __AMEMORYTAGTRACKER_HPP
@@ -0,0 +1,210 @@
+//=======================================================================================
+// Agog Labs C++ library.
+// Copyright (c) 2015 Agog Labs Inc.,
+// All rights reserved.
+//
+// Recorded object pool high-water marks used to pre-size pools
+// # Notes:
+//=======================================================================================
+
+
+#ifndef __AOBJPOOLPROFILE_HPP
+#define __AOBJPOOLPROFILE_HPP
+
+
+//=======================================================================================
+// Includes
+//=======================================================================================
+
+#include "AgogCore/AObjReusePool.hpp"
+
+
+//=======================================================================================
+// Global Macros / Defines
+//=======================================================================================
+
+enum
+  {
+  // Maximum number of named pools in a profile
+  AObjPoolProfile_entry_max = 64u,
+
+  // Maximum number of characters in a pool name
+  AObjPoolProfile_name_length_max = 47u
+  };
+
+
+//=======================================================================================
+// Global Structures
+//=======================================================================================
+
+class AString;
+
+//---------------------------------------------------------------------------------------
+// Profile of the peak number of objects used by each of a set of named object pools.
+//
+// A profile recorded during a play session is saved as a small text file and loaded by a
+// later session before it starts running so that each pool can reserve its recorded
+// high-water mark up front and never has to call append_block() mid-frame.
+//
+// The profile format is one pool per line - its name followed by its object count.
+// Lines starting with // are comments:
+//   // Object pool high-water marks
+//   AStringRef 4096
+//   SSInvokedExpression 1200
+//
+// # Examples:
+//   // At startup - after loading profile text from file
+//   AObjPoolProfile::parse(profile_cstr_p, length);
+//   AObjPoolProfile::register_pool("AStringRef", AStringRef::get_pool());  // reserves
+//
+//   // At shutdown
+//   AString profile_str;
+//   AObjPoolProfile::update_counts();
+//   AObjPoolProfile::as_string(&profile_str);
+//   // ...then save profile_str to file
+//
+// # Notes:
+//   High-water marks are only exact if AORPOOL_USAGE_COUNT is defined - otherwise the
+//   capacity of each pool is used as an approximation.
+//   If AORPOOL_USAGE_COUNT is defined any growth of a registered pool beyond its
+//   reserved amount is reported with A_DPRINT().  Any grow callback the pool already
+//   had is still called and it is put back by empty().
+class AObjPoolProfile
+  {
+  public:
+
+  // Class Methods
+
+    template<class _PoolType>
+      static void register_pool(const char * name_p, _PoolType & pool);
+
+    static uint32_t get_count(const char * name_p);
+    static void     set_count(const char * name_p, uint32_t count);
+    static void     update_counts();
+    static void     empty();
+
+    // Serialization
+
+    static void     as_string(AString * str_p);
+    static uint32_t parse(const char * cstr_p, uint32_t length);
+
+  protected:
+
+  // Nested Structures
+
+    // Grow callback of any pool type - cast back to the pool's tGrowFunc to call it
+    typedef void (* tGrowFuncGeneric)();
+
+    struct Entry
+      {
+      // Name of pool - from profile or register_pool()
+      char m_name[AObjPoolProfile_name_length_max + 1u];
+
+      // Recorded high-water mark
+      uint32_t m_count;
+
+      // Registered pool or nullptr if only known from a loaded profile
+      const void * m_pool_p;
+
+      // Gets the high-water mark of the registered pool
+      uint32_t (* m_count_max_f)(const void * pool_p);
+
+      // Grow callback the pool had before it was registered - called by on_pool_grow()
+      tGrowFuncGeneric m_prev_grow_f;
+
+      // Puts m_prev_grow_f back in the registered pool - see empty()
+      void (* m_restore_grow_f)(const Entry & entry);
+      };
+
+  // Internal Class Methods
+
+    static Entry *          get_entry(const char * name_p, uint32_t length, bool create_b);
+    static tGrowFuncGeneric on_grow(const void * pool_p, uint32_t capacity);
+
+    template<class _PoolType>
+      static uint32_t get_pool_count_max(const void * pool_p)
+        {
+        return static_cast<const _PoolType *>(pool_p)->get_count_max();
+        }
+
+    #ifdef AORPOOL_USAGE_COUNT
+
+      template<class _PoolType>
+        static void on_pool_grow(const _PoolType & pool)
+          {
+          typename _PoolType::tGrowFunc prev_grow_f =
+            reinterpret_cast<typename _PoolType::tGrowFunc>(on_grow(&pool, pool.get_count_capacity()));
+
+          if (prev_grow_f)
+            {
+            (prev_grow_f)(pool);
+            }
+          }
+
+      template<class _PoolType>
+        static void restore_pool_grow(const Entry & entry)
+          {
+          _PoolType * pool_p = static_cast<_PoolType *>(const_cast<void *>(entry.m_pool_p));
+
+          if (pool_p->m_grow_f == on_pool_grow<_PoolType>)
+            {
+            pool_p->m_grow_f = reinterpret_cast<typename _PoolType::tGrowFunc>(entry.m_prev_grow_f);
+            }
+          }
+
+    #endif
+
+  // Class Data
+
+    static Entry    ms_entries[AObjPoolProfile_entry_max];
+    static uint32_t ms_entry_count;
+
+  };  // AObjPoolProfile
+
+
+//=======================================================================================
+// Methods
+//=======================================================================================
+
+//---------------------------------------------------------------------------------------
+// Registers a pool so that its high-water mark is included by update_counts() and
+// reserves the count recorded for it in any previously loaded profile.
+// Arg         name_p - unique name of pool such as its object type
+// Arg         pool - pool to register - AObjReusePool<> or AObjReusePoolMT<>.  It must
+//             remain valid until empty() is called.
+// # See:      parse(), update_counts()
+// # Notes:    Call after parse() so that the loaded count can be reserved.
+template<class _PoolType>
+void AObjPoolProfile::register_pool(
+  const char * name_p,
+  _PoolType &  pool
+  )
+  {
+  Entry * entry_p = get_entry(name_p, ALength_calculate, true);
+
+  if (entry_p == nullptr)
+    {
+    return;
+    }
+
+  entry_p->m_pool_p      = &pool;
+  entry_p->m_count_max_f = get_pool_count_max<_PoolType>;
+
+  if (entry_p->m_count)
+    {
+    pool.reserve(entry_p->m_count);
+    }
+
+  #ifdef AORPOOL_USAGE_COUNT
+    // Chain any existing callback - unless the pool is being registered again
+    if (pool.m_grow_f != on_pool_grow<_PoolType>)
+      {
+      entry_p->m_prev_grow_f    = reinterpret_cast<tGrowFuncGeneric>(pool.m_grow_f);
+      entry_p->m_restore_grow_f = restore_pool_grow<_PoolType>;
+      pool.m_grow_f             = on_pool_grow<_PoolType>;
+      }
+  #endif
+  }
+
+
+#endif  // __AOBJPOOLPROFILE_HPP
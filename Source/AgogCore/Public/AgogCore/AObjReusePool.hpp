@@ -29,6 +29,12 @@
   #define AORPOOL_USAGE_COUNT
 #endif
 
+enum
+  {
+  // Number of expansion blocks that trim() tallies free objects for in one pass
+  AObjReusePool_trim_tally_max = 64u
+  };
+
 
 //=======================================================================================
 // Global Structures
@@ -85,6 +91,11 @@ class AObjBlock
 //          pop() is used effectively as a new.
 //          append() is used effectively as a delete.
 //
+//          This class is not thread-safe - see AObjReusePoolMT<> for a thread-safe
+//          version with the same interface.
+//          AObjReusePoolIntrusive<> has the same interface but keeps its free lists
+//          in the free objects themselves rather than in pointer arrays.
+//
 //          Any modifications to this template should be compile-tested by adding an
 //          explicit instantiation declaration such as:
 //            template class AObjReusePool<AStringRef>;
@@ -98,6 +109,15 @@ class AObjReusePool
   {
   public:
 
+  // Common types
+
+    // Local shorthand for templates
+    typedef AObjReusePool<_ObjectType> tObjReusePool;
+    typedef AObjBlock<_ObjectType>     tObjBlock;
+
+    // Callback called just prior to the pool growing
+    typedef void (* tGrowFunc)(const tObjReusePool & pool);
+
   // Public Data Members
 
     #ifdef AORPOOL_USAGE_COUNT
@@ -109,16 +129,10 @@ class AObjReusePool
       uint32_t m_count_max;
 
       // Optional callback that is called just prior to adding
-      void (* m_grow_f)(const AObjReusePool & pool);
+      tGrowFunc m_grow_f;
 
     #endif
 
-  // Common types
-
-    // Local shorthand for templates
-    typedef AObjReusePool<_ObjectType> tObjReusePool;
-    typedef AObjBlock<_ObjectType>     tObjBlock;
-
   // Common Methods
 
     AObjReusePool(uint32_t initial_size, uint32_t expand_size);
@@ -149,12 +163,18 @@ class AObjReusePool
     void          append_all(_ObjectType ** objs_a, uint length);
 
     void          append_block(uint32_t size);
+    void          reserve(uint32_t count);
     void          empty();
     void          remove_expanded();
     void          repool();
+    uint32_t      trim(uint32_t keep_free, uint32_t max_blocks = 1u);
 
 
   protected:
+  // Internal Methods
+
+    uint32_t find_exp_block_pos(const _ObjectType * obj_p) const;
+
   // Data Members
 
     // Pool of previously constructed objects that are ready for use.
@@ -399,6 +419,32 @@ void AObjReusePool<_ObjectType>::append_block(uint32_t size)
     }
   }
 
+//---------------------------------------------------------------------------------------
+// Ensures that the pool has capacity for at least the specified number of objects so
+// that it does not need to grow while they are in use - adding expansion blocks as
+// needed.
+// Arg         count - number of objects to have room for - for example a high-water mark
+//             recorded by a previous session.
+// # See:      AObjPoolProfile
+// # Notes:    Added blocks are m_expand_size objects like any other expansion block so
+//             the pool may end up with up to m_expand_size - 1 more objects than asked for.
+template<class _ObjectType>
+void AObjReusePool<_ObjectType>::reserve(uint32_t count)
+  {
+  if (m_expand_size == 0u)
+    {
+    return;
+    }
+
+  uint32_t capacity = get_count_capacity();
+
+  while (capacity < count)
+    {
+    append_block(m_expand_size);
+    capacity += m_expand_size;
+    }
+  }
+
 //---------------------------------------------------------------------------------------
 // Clears out pools
 // # See:      remove_expanded()
@@ -469,6 +515,200 @@ void AObjReusePool<_ObjectType>::repool()
   m_pool.append_all(m_block_p->m_objects_a, m_block_p->m_size);
   }
 
+//---------------------------------------------------------------------------------------
+// Frees the memory of expansion blocks that have all of their objects back in the pool
+// while leaving at least keep_free objects available.  Unlike remove_expanded() this may
+// be called at any time - objects that are still in use are never touched.
+//
+// # Returns:  number of expansion blocks freed
+// Arg         keep_free - minimum number of available objects that must remain in the
+//             pool afterwards so that it does not just need to grow again.
+// Arg         max_blocks - maximum number of blocks to free.  Freeing a block calls the
+//             destructors of its objects and releases its memory so this limits the cost
+//             of any single call.
+// # See:      remove_expanded()
+// # Notes:    Cost is O(available expanded * log(expansion blocks)) to tally the free
+//             objects in each block plus the cost of freeing the blocks - more than
+//             AObjReusePool_trim_tally_max blocks take a pass per group of that many.
+//             Nothing is allocated and the expansion blocks are left sorted by address.
+//             Blocks at higher addresses are freed first.
+template<class _ObjectType>
+uint32_t AObjReusePool<_ObjectType>::trim(
+  uint32_t keep_free,
+  uint32_t max_blocks // = 1u
+  )
+  {
+  uint32_t block_count = m_exp_blocks.get_length();
+  uint32_t available   = get_count_available();
+
+  if ((block_count == 0u) || (max_blocks == 0u) || (available <= keep_free))
+    {
+    return 0u;
+    }
+
+  tObjBlock *  block_p;
+  tObjBlock ** blocks_a     = m_exp_blocks.get_array();
+  tObjBlock ** blocks_end_a = blocks_a + block_count;
+  tObjBlock ** block_pp;
+  tObjBlock ** sorted_pp;
+
+  // Sort the expansion blocks by address so that the block owning an object can be found
+  // with a binary search - there are usually only a few so an insertion sort is used.
+  for (block_pp = blocks_a + 1; block_pp < blocks_end_a; block_pp++)
+    {
+    block_p   = *block_pp;
+    sorted_pp = block_pp;
+
+    while ((sorted_pp > blocks_a) && (sorted_pp[-1]->m_objects_a > block_p->m_objects_a))
+      {
+      *sorted_pp = sorted_pp[-1];
+      sorted_pp--;
+      }
+
+    *sorted_pp = block_p;
+    }
+
+  // Free objects are tallied for a group of blocks at a time (highest addresses first) so
+  // that the tally fits in a fixed size buffer on the stack.
+  uint32_t       free_counts_a[AObjReusePool_trim_tally_max];
+  uint32_t       free_blocks = 0u;
+  uint32_t       tally_end   = block_count;
+  uint32_t       tally_start;
+  uint32_t       idx;
+  uint32_t       pos;
+  _ObjectType *  obj_p;
+  _ObjectType ** objs_a = m_exp_pool.get_array();
+  _ObjectType ** objs_end_a;
+  _ObjectType ** obj_pp;
+  _ObjectType ** keep_pp;
+
+  while ((tally_end > 0u) && (free_blocks < max_blocks) && (available > keep_free))
+    {
+    tally_start = (tally_end > AObjReusePool_trim_tally_max) ? (tally_end - AObjReusePool_trim_tally_max) : 0u;
+    ::memset(free_counts_a, 0, (tally_end - tally_start) * sizeof(uint32_t));
+
+    // Tally the free objects in each expansion block of the group.  Objects that are not
+    // in an expansion block (such as ones given to append() from elsewhere) are skipped.
+    objs_end_a = objs_a + m_exp_pool.get_length();
+
+    for (obj_pp = objs_a; obj_pp < objs_end_a; obj_pp++)
+      {
+      obj_p = *obj_pp;
+      pos   = find_exp_block_pos(obj_p);
+
+      if ((pos > tally_start) && (pos <= tally_end))
+        {
+        block_p = blocks_a[pos - 1u];
+
+        if (obj_p < (block_p->m_objects_a + block_p->m_size))
+          {
+          free_counts_a[pos - 1u - tally_start]++;
+          }
+        }
+      }
+
+    // Pick blocks to free - their free count is left non-zero and all others are zeroed
+    uint32_t group_free = 0u;
+
+    for (idx = tally_end; idx > tally_start; )
+      {
+      idx--;
+      block_p = blocks_a[idx];
+
+      if ((free_blocks < max_blocks)
+        && (free_counts_a[idx - tally_start] == block_p->m_size)
+        && ((available - block_p->m_size) >= keep_free))
+        {
+        available -= block_p->m_size;
+        free_blocks++;
+        group_free++;
+        }
+      else
+        {
+        free_counts_a[idx - tally_start] = 0u;
+        }
+      }
+
+    if (group_free)
+      {
+      // Remove the objects of the blocks to be freed from the available pool
+      keep_pp = objs_a;
+
+      for (obj_pp = objs_a; obj_pp < objs_end_a; obj_pp++)
+        {
+        obj_p = *obj_pp;
+        pos   = find_exp_block_pos(obj_p);
+
+        if ((pos <= tally_start)
+          || (pos > tally_end)
+          || (free_counts_a[pos - 1u - tally_start] == 0u)
+          || (obj_p >= (blocks_a[pos - 1u]->m_objects_a + blocks_a[pos - 1u]->m_size)))
+          {
+          *keep_pp = obj_p;
+          keep_pp++;
+          }
+        }
+
+      m_exp_pool.set_length_unsafe(uint32_t(keep_pp - objs_a));
+
+      // Free the blocks - the remaining blocks stay in address order and the blocks below
+      // this group keep their positions.
+      uint32_t keep_count = tally_start;
+
+      for (idx = tally_start; idx < block_count; idx++)
+        {
+        block_p = blocks_a[idx];
+
+        if ((idx < tally_end) && free_counts_a[idx - tally_start])
+          {
+          delete block_p;
+          }
+        else
+          {
+          blocks_a[keep_count] = block_p;
+          keep_count++;
+          }
+        }
+
+      block_count = keep_count;
+      m_exp_blocks.set_length_unsafe(block_count);
+      }
+
+    tally_end = tally_start;
+    }
+
+  return free_blocks;
+  }
+
+//---------------------------------------------------------------------------------------
+// Binary searches the expansion blocks which must be sorted by address - see trim().
+// # Returns:  number of expansion blocks that start at or before obj_p - so if obj_p is
+//             from an expansion block it is the index of its block + 1.
+template<class _ObjectType>
+uint32_t AObjReusePool<_ObjectType>::find_exp_block_pos(const _ObjectType * obj_p) const
+  {
+  tObjBlock ** blocks_a = m_exp_blocks.get_array();
+  uint32_t     first    = 0u;
+  uint32_t     last     = m_exp_blocks.get_length();
+  uint32_t     middle;
+
+  while (first < last)
+    {
+    middle = (first + last) >> 1;
+
+    if (blocks_a[middle]->m_objects_a <= obj_p)
+      {
+      first = middle + 1u;
+      }
+    else
+      {
+      last = middle;
+      }
+    }
+
+  return first;
+  }
+
 
 #define __AOBJREUSEPOOL_HPP
   
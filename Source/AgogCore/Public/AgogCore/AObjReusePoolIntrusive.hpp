@@ -0,0 +1,497 @@
+//=======================================================================================
+// Agog Labs C++ library.
+// Copyright (c) 2015 Agog Labs Inc.,
+// All rights reserved.
+//
+//  Object Reuse Pool class template using an intrusive free list
+// # Notes:
+//=======================================================================================
+
+
+#ifndef __AOBJREUSEPOOLINTRUSIVE_HPP
+#define __AOBJREUSEPOOLINTRUSIVE_HPP
+
+
+//=======================================================================================
+// Includes
+//=======================================================================================
+
+#include "AgogCore/AObjReusePool.hpp"
+
+
+//=======================================================================================
+// Global Structures
+//=======================================================================================
+
+//---------------------------------------------------------------------------------------
+// Free list link accessor for AObjReusePoolIntrusive<> that stores the link in the first
+// pointer-sized bytes of each free object.
+//
+// Only use with types that have no virtual table and whose data members are all set
+// again after being popped from the pool - such as AStringRef or ASymbolRef.
+template<class _ObjectType>
+struct AObjPoolLinkOverlay
+  {
+  static _ObjectType *& get_next(_ObjectType * obj_p)  { return *reinterpret_cast<_ObjectType **>(obj_p); }
+  };
+
+//---------------------------------------------------------------------------------------
+// Free list link accessor for AObjReusePoolIntrusive<> that uses a data member supplied
+// by the object type.  _ObjectType must have a method:
+//   _ObjectType *& get_pool_link()
+// that returns a pointer data member which is not used while the object is in the pool.
+template<class _ObjectType>
+struct AObjPoolLinkMember
+  {
+  static _ObjectType *& get_next(_ObjectType * obj_p)  { return obj_p->get_pool_link(); }
+  };
+
+
+//---------------------------------------------------------------------------------------
+// Notes    Version of AObjReusePool<> that threads its free lists through the free objects
+//          themselves rather than storing pointers to them in separate arrays.  pop() and
+//          append() are O(1) with no array growth.  The objects of a new block are not
+//          linked into a free list up front - they are handed out sequentially on demand
+//          and only linked in once they are returned with append() (or, for any left over
+//          in the last expansion block, when the next expansion block is added).
+//
+//          The primary and expansion blocks still have separate free lists so the
+//          usage and overflow accounting is the same as AObjReusePool<> and it can be
+//          switched to with a typedef.
+//
+//          Any modifications to this template should be compile-tested by adding an
+//          explicit instantiation declaration such as:
+//            template class AObjReusePoolIntrusive<AStringRef>;
+// Arg      _ObjectType - the class/type of objects stored in the pool.
+// Arg      _LinkClass - accessor for the free list link stored in each free object.  See
+//          AObjPoolLinkOverlay<> and AObjPoolLinkMember<>.
+// See      AObjReusePool<>, AObjReusePoolMT<>
+template<class _ObjectType, class _LinkClass = AObjPoolLinkOverlay<_ObjectType> >
+class AObjReusePoolIntrusive
+  {
+  public:
+
+  // Public Data Members
+
+    #ifdef AORPOOL_USAGE_COUNT
+
+      // Number of objects currently used / outstanding
+      uint32_t m_count_now;
+
+      // Maximum number of objects used at once - i.e. peak usage
+      uint32_t m_count_max;
+
+      // Optional callback that is called just prior to adding
+      void (* m_grow_f)(const AObjReusePoolIntrusive & pool);
+
+    #endif
+
+  // Common types
+
+    // Local shorthand for templates
+    typedef AObjReusePoolIntrusive<_ObjectType, _LinkClass> tObjReusePool;
+    typedef AObjBlock<_ObjectType>                          tObjBlock;
+
+  // Common Methods
+
+    AObjReusePoolIntrusive(uint32_t initial_size, uint32_t expand_size);
+    ~AObjReusePoolIntrusive();
+
+
+  // Accessor Methods
+
+    uint32_t get_block_count() const     { return 1u + m_exp_blocks.get_length(); }
+    uint32_t get_bytes_allocated() const { return get_count_capacity() * sizeof(_ObjectType); }
+    uint32_t get_expand_size() const     { return m_expand_size; }
+    uint32_t get_count_initial() const   { return m_block_p->m_size; }
+    uint32_t get_count_available() const;
+    uint32_t get_count_expanded() const;
+    uint32_t get_count_capacity() const  { return m_block_p->m_size + get_count_expanded(); }
+    uint32_t get_count_used() const;
+    uint32_t get_count_max() const;
+    uint32_t get_count_overflow() const;
+
+
+  // Modifying Methods
+
+    _ObjectType * pop();
+    void          append(_ObjectType * obj_p);
+    void          append_all(_ObjectType ** objs_a, uint length);
+
+    void          append_block(uint32_t size);
+    void          empty();
+    void          remove_expanded();
+    void          repool();
+
+
+  protected:
+
+  // Internal Methods
+
+    bool is_primary(const _ObjectType * obj_p) const  { return (obj_p >= m_block_p->m_objects_a) && (obj_p < (m_block_p->m_objects_a + m_block_p->m_size)); }
+
+  // Data Members
+
+    // Free list of objects from the initial block
+    _ObjectType * m_free_p;
+    uint32_t      m_free_count;
+
+    // Objects from the initial block that have never been handed out
+    _ObjectType * m_carve_p;
+    _ObjectType * m_carve_end_p;
+
+    // Initial object block - i.e. the block of memory where the objects are actually
+    // stored.
+    tObjBlock * m_block_p;
+
+
+    // These expansion data structures are separate so that they can be easily cleared.
+
+    // Free list of objects from expansion blocks
+    _ObjectType * m_exp_free_p;
+    uint32_t      m_exp_free_count;
+
+    // Objects from the most recent expansion block that have never been handed out
+    _ObjectType * m_exp_carve_p;
+    _ObjectType * m_exp_carve_end_p;
+
+    // This is the array of expanded object blocks - i.e. if the initial block is not
+    // sufficient these additional blocks are added.
+    APArray<tObjBlock> m_exp_blocks;
+
+    // If there is need of additional objects, this is the size to use for additional
+    // object blocks.
+    uint32_t m_expand_size;
+
+  };  // AObjReusePoolIntrusive
+
+
+//=======================================================================================
+// Methods
+//=======================================================================================
+
+//---------------------------------------------------------------------------------------
+// Constructor
+// # Returns:  itself
+// Arg         initial_size - initial object population for the reuse pool
+// Arg         expand_size - additional number of objects to allocate if all the objects
+//             in the reuse pool are in use and more objects are required.
+template<class _ObjectType, class _LinkClass>
+inline AObjReusePoolIntrusive<_ObjectType, _LinkClass>::AObjReusePoolIntrusive(
+  uint32_t initial_size,
+  uint32_t expand_size
+  ) :
+  #ifdef AORPOOL_USAGE_COUNT
+    m_count_now(0u), m_count_max(0u), m_grow_f(nullptr),
+  #endif
+  m_free_p(nullptr),
+  m_free_count(0u),
+  m_carve_p(nullptr),
+  m_carve_end_p(nullptr),
+  m_block_p(nullptr),
+  m_exp_free_p(nullptr),
+  m_exp_free_count(0u),
+  m_exp_carve_p(nullptr),
+  m_exp_carve_end_p(nullptr),
+  m_expand_size(expand_size)
+  {
+  append_block(initial_size);
+  }
+
+//---------------------------------------------------------------------------------------
+// Destructor
+template<class _ObjectType, class _LinkClass>
+inline AObjReusePoolIntrusive<_ObjectType, _LinkClass>::~AObjReusePoolIntrusive()
+  {
+  m_exp_blocks.free_all();
+  delete m_block_p;
+  }
+
+//---------------------------------------------------------------------------------------
+// Determines number of objects ready to be popped without growing the pool.
+// # Returns:  number of objects available
+template<class _ObjectType, class _LinkClass>
+inline uint32_t AObjReusePoolIntrusive<_ObjectType, _LinkClass>::get_count_available() const
+  {
+  return m_free_count + m_exp_free_count
+    + uint32_t(m_carve_end_p - m_carve_p) + uint32_t(m_exp_carve_end_p - m_exp_carve_p);
+  }
+
+//---------------------------------------------------------------------------------------
+// Determines number of objects in all the expansion blocks.  Blocks may differ in size
+// since append_block() may be called with any size.
+// # Returns:  number of objects above and beyond the initial block
+template<class _ObjectType, class _LinkClass>
+uint32_t AObjReusePoolIntrusive<_ObjectType, _LinkClass>::get_count_expanded() const
+  {
+  uint32_t     count         = 0u;
+  tObjBlock ** blocks_pp     = m_exp_blocks.get_array();
+  tObjBlock ** blocks_end_pp = blocks_pp + m_exp_blocks.get_length();
+
+  for (; blocks_pp < blocks_end_pp; blocks_pp++)
+    {
+    count += (*blocks_pp)->m_size;
+    }
+
+  return count;
+  }
+
+//---------------------------------------------------------------------------------------
+// Determines number of objects currently used / outstanding.
+// # Returns:  number of objects currently used
+template<class _ObjectType, class _LinkClass>
+inline uint32_t AObjReusePoolIntrusive<_ObjectType, _LinkClass>::get_count_used() const
+  {
+  #ifdef AORPOOL_USAGE_COUNT
+    return m_count_now;
+  #else
+    return get_count_capacity() - get_count_available();
+  #endif
+  }
+
+//---------------------------------------------------------------------------------------
+// Determines maximum number of objects used at once.
+// # Returns:  peak number of objects used
+template<class _ObjectType, class _LinkClass>
+inline uint32_t AObjReusePoolIntrusive<_ObjectType, _LinkClass>::get_count_max() const
+  {
+  #ifdef AORPOOL_USAGE_COUNT
+    return m_count_max;
+  #else
+    // Approximate
+    return get_count_capacity();
+  #endif
+  }
+
+//---------------------------------------------------------------------------------------
+// Determines number of objects used above and beyond the initial amount that
+//             was allocated.
+// # Returns:  number of objects that have overflowed initial allocation
+template<class _ObjectType, class _LinkClass>
+inline uint32_t AObjReusePoolIntrusive<_ObjectType, _LinkClass>::get_count_overflow() const
+  {
+  #ifdef AORPOOL_USAGE_COUNT
+    return (m_count_max <= m_block_p->m_size) ? 0u : (m_count_max - m_block_p->m_size);
+  #else
+    // Approximate
+    return get_count_expanded();
+  #endif
+  }
+
+//---------------------------------------------------------------------------------------
+// Retrieves a previously allocated object from the pool.  Objects from the initial
+//             block are preferred over objects from expansion blocks.
+// # Returns:  a dynamic object
+// # See:      append()
+// # Notes:    To 'deallocate' an object that was retrieved with this method, use
+//             'append()' rather than 'delete'.
+template<class _ObjectType, class _LinkClass>
+inline _ObjectType * AObjReusePoolIntrusive<_ObjectType, _LinkClass>::pop()
+  {
+  #ifdef AORPOOL_USAGE_COUNT
+    m_count_now++;
+
+    if (m_count_now > m_count_max)
+      {
+      m_count_max = m_count_now;
+      }
+  #endif
+
+  _ObjectType * obj_p = m_free_p;
+
+  if (obj_p)
+    {
+    m_free_p = _LinkClass::get_next(obj_p);
+    m_free_count--;
+
+    return obj_p;
+    }
+
+  if (m_carve_p < m_carve_end_p)
+    {
+    return m_carve_p++;
+    }
+
+  obj_p = m_exp_free_p;
+
+  if (obj_p)
+    {
+    m_exp_free_p = _LinkClass::get_next(obj_p);
+    m_exp_free_count--;
+
+    return obj_p;
+    }
+
+  if (m_exp_carve_p == m_exp_carve_end_p)
+    {
+    // No free objects, so make more
+    append_block(m_expand_size);
+    }
+
+  return m_exp_carve_p++;
+  }
+
+//---------------------------------------------------------------------------------------
+// Frees up an Object and returns it into the pool ready for its next use.
+// Arg         obj_p - pointer to object to free up and put into the pool.
+// # See:      pop(), append_all()
+template<class _ObjectType, class _LinkClass>
+inline void AObjReusePoolIntrusive<_ObjectType, _LinkClass>::append(_ObjectType * obj_p)
+  {
+  #ifdef AORPOOL_USAGE_COUNT
+    m_count_now--;
+  #endif
+
+  if (is_primary(obj_p))
+    {
+    _LinkClass::get_next(obj_p) = m_free_p;
+    m_free_p = obj_p;
+    m_free_count++;
+    }
+  else
+    {
+    _LinkClass::get_next(obj_p) = m_exp_free_p;
+    m_exp_free_p = obj_p;
+    m_exp_free_count++;
+    }
+  }
+
+//---------------------------------------------------------------------------------------
+// Frees up 'length' Objects and returns them into the pool ready for their next use.
+// Arg         objs_a - pointer to the array of objects to put into the pool.
+// # See:      append(), pop()
+template<class _ObjectType, class _LinkClass>
+void AObjReusePoolIntrusive<_ObjectType, _LinkClass>::append_all(
+  _ObjectType ** objs_a,
+  uint           length
+  )
+  {
+  _ObjectType ** objs_end_a = objs_a + length;
+
+  while (objs_a < objs_end_a)
+    {
+    append(*objs_a);
+    objs_a++;
+    }
+  }
+
+//---------------------------------------------------------------------------------------
+// Creates and appends a block of objects to the object pool.  The objects are not
+//             linked into a free list - they are handed out in order by pop().
+// Arg         size - number of objects to allocate in the block
+// # Notes:    Any objects remaining from the previous expansion block that were never
+//             handed out are moved to the expansion free list.
+template<class _ObjectType, class _LinkClass>
+void AObjReusePoolIntrusive<_ObjectType, _LinkClass>::append_block(uint32_t size)
+  {
+  #ifdef AORPOOL_USAGE_COUNT
+    // Notify that the pool has grown
+    if (m_block_p && m_grow_f)
+      {
+      (m_grow_f)(*this);
+      }
+  #endif
+
+  tObjBlock * obj_block_p = new ("tObjBlock") tObjBlock(size);
+
+  A_VERIFY_MEMORY(obj_block_p != nullptr, tObjReusePool);
+
+  if (m_block_p)
+    {
+    // Keep any never used objects of the last expansion block
+    while (m_exp_carve_p < m_exp_carve_end_p)
+      {
+      _LinkClass::get_next(m_exp_carve_p) = m_exp_free_p;
+      m_exp_free_p = m_exp_carve_p;
+      m_exp_free_count++;
+      m_exp_carve_p++;
+      }
+
+    m_exp_blocks.append(*obj_block_p);
+    m_exp_carve_p     = obj_block_p->m_objects_a;
+    m_exp_carve_end_p = m_exp_carve_p + size;
+    }
+  else
+    {
+    m_block_p     = obj_block_p;
+    m_carve_p     = obj_block_p->m_objects_a;
+    m_carve_end_p = m_carve_p + size;
+    }
+  }
+
+//---------------------------------------------------------------------------------------
+// Clears out pools
+// # See:      remove_expanded()
+template<class _ObjectType, class _LinkClass>
+void AObjReusePoolIntrusive<_ObjectType, _LinkClass>::empty()
+  {
+  #ifdef AORPOOL_USAGE_COUNT
+    m_count_now = 0u;
+  #endif
+
+  m_free_p      = nullptr;
+  m_free_count  = 0u;
+  m_carve_p     = nullptr;
+  m_carve_end_p = nullptr;
+  delete m_block_p;
+  m_block_p = nullptr;
+
+  m_exp_free_p      = nullptr;
+  m_exp_free_count  = 0u;
+  m_exp_carve_p     = nullptr;
+  m_exp_carve_end_p = nullptr;
+  m_exp_blocks.free_all();
+  m_exp_blocks.compact();
+  }
+
+//---------------------------------------------------------------------------------------
+// Removes / frees memory of all expanded / grown objects above and beyond
+//             the initial object block.
+// # See:      empty()
+template<class _ObjectType, class _LinkClass>
+void AObjReusePoolIntrusive<_ObjectType, _LinkClass>::remove_expanded()
+  {
+  uint32_t exp_available = m_exp_free_count + uint32_t(m_exp_carve_end_p - m_exp_carve_p);
+
+  #ifdef AORPOOL_USAGE_COUNT
+    m_count_now = m_block_p->m_size - m_free_count - uint32_t(m_carve_end_p - m_carve_p);
+  #endif
+
+  // Ensure that all objects have been returned to the pool for reuse before they are
+  // deleted.
+  A_ASSERT(
+    exp_available == get_count_expanded(),
+    "AObjReusePoolIntrusive<>::remove_expanded() - Not all of the expanded objects have been returned,\nso they probably should not all be deleted!",
+    AErrId_generic,
+    tObjReusePool);
+
+  m_exp_free_p      = nullptr;
+  m_exp_free_count  = 0u;
+  m_exp_carve_p     = nullptr;
+  m_exp_carve_end_p = nullptr;
+  m_exp_blocks.free_all();
+  m_exp_blocks.compact();
+  }
+
+//---------------------------------------------------------------------------------------
+// Removes / frees memory of all expanded / grown objects above and beyond
+//             the initial object block and ensures that all of the objects in the
+//             initial pool are available whether they were returned for use or not.
+// # See:      empty()
+template<class _ObjectType, class _LinkClass>
+void AObjReusePoolIntrusive<_ObjectType, _LinkClass>::repool()
+  {
+  remove_expanded();
+
+  #ifdef AORPOOL_USAGE_COUNT
+    m_count_now = 0u;
+  #endif
+
+  m_free_p      = nullptr;
+  m_free_count  = 0u;
+  m_carve_p     = m_block_p->m_objects_a;
+  m_carve_end_p = m_carve_p + m_block_p->m_size;
+  }
+
+
+#endif  // __AOBJREUSEPOOLINTRUSIVE_HPP
@@ -0,0 +1,745 @@
+//=======================================================================================
+// Agog Labs C++ library.
+// Copyright (c) 2015 Agog Labs Inc.,
+// All rights reserved.
+//
+//  Thread-safe Object Reuse Pool class template
+// # Notes:
+//=======================================================================================
+
+
+#ifndef __AOBJREUSEPOOLMT_HPP
+#define __AOBJREUSEPOOLMT_HPP
+
+
+//=======================================================================================
+// Includes
+//=======================================================================================
+
+#include "AgogCore/AObjReusePool.hpp"
+#include <atomic>   // Uses: std::atomic
+#include <mutex>    // Uses: std::mutex, std::lock_guard
+
+
+//=======================================================================================
+// Global Macros / Defines
+//=======================================================================================
+
+enum
+  {
+  // Number of object pointers stored in each magazine - the unit of exchange between
+  // the per-thread caches and the shared depot.
+  AORPoolMT_magazine_size     = 32u,
+
+  // Number of threads that get their own lock-free cache.  Any additional threads share
+  // a single cache protected by a lock.
+  AORPoolMT_thread_max        = 64u,
+
+  // Magazines are allocated in chunks of this many and referred to by index so that
+  // the lock-free depot can use tagged indexes to avoid ABA problems.
+  AORPoolMT_mag_chunk_shift   = 8u,
+  AORPoolMT_mag_chunk_size    = 1u << AORPoolMT_mag_chunk_shift,
+  AORPoolMT_mag_chunk_max     = 1024u
+  };
+
+
+//=======================================================================================
+// Global Structures
+//=======================================================================================
+
+//---------------------------------------------------------------------------------------
+// Non-template portion of AObjReusePoolMT<> - hands out a small unique index to each
+// thread that uses any thread-safe pool.  Indexes of threads that have exited are handed
+// out again on platforms with thread exit notification (Windows fibre local storage and
+// pthread keys).
+class AObjReusePoolMTBase
+  {
+  public:
+
+  // Class Methods
+
+    static uint32_t get_thread_idx();
+    static void     release_thread_idx(uint32_t idx);
+
+  protected:
+
+  // Class Data
+
+    // 1-based index of the current thread - 0 if not assigned yet
+    static A_THREAD_LOCAL uint32_t ms_thread_idx;
+
+    // Number of thread indexes handed out so far
+    static std::atomic<uint32_t> ms_thread_count;
+
+    // Out of line portion of get_thread_idx()
+    static uint32_t assign_thread_idx();
+
+  };
+
+
+//---------------------------------------------------------------------------------------
+// Notes    Thread-safe version of AObjReusePool<> - any pool may be switched over to it
+//          with a typedef since it has the same pop() / append() / append_all() interface
+//          and the same AORPOOL_USAGE_COUNT statistics.
+//
+//          Free objects are kept in fixed size magazines.  Each thread has its own pair
+//          of magazines (loaded and previous) so that pop() and append() need no
+//          synchronization in the common case.  Only when both of a thread's magazines
+//          are empty (for pop) or full (for append) is a whole magazine exchanged with
+//          the shared depot - a pair of lock-free stacks of full and empty magazines.
+//          New object blocks are added under a mutex when the depot runs out of full
+//          magazines.
+//
+//          Objects may be popped on one thread and appended on another.
+//
+//          empty() and the destructor must not be called while other threads are
+//          using the pool.
+//
+//          Thread indexes are recycled when threads exit so that thread churn does not
+//          use up the per-thread caches - a new thread takes over any objects left in
+//          the cache of the exited thread it replaces.  On platforms without thread exit
+//          notification indexes are never recycled and short lived threads eventually
+//          fall back to the shared locked cache.
+//
+//          If expand_size is 0 the pool still grows when it runs out of objects - by
+//          one magazine's worth of objects at a time.
+//
+//          Any modifications to this template should be compile-tested by adding an
+//          explicit instantiation declaration such as:
+//            template class AObjReusePoolMT<AStringRef>;
+// Arg      _ObjectType - the class/type of objects stored in the pool.
+// See      AObjReusePool<>
+template<class _ObjectType>
+class AObjReusePoolMT : public AObjReusePoolMTBase
+  {
+  public:
+
+  // Common types
+
+    // Local shorthand for templates
+    typedef AObjReusePoolMT<_ObjectType> tObjReusePool;
+    typedef AObjBlock<_ObjectType>       tObjBlock;
+
+    // Callback called just prior to the pool growing - same form as
+    // AObjReusePool<>::tGrowFunc so callbacks templated on the pool type work with both
+    typedef void (* tGrowFunc)(const tObjReusePool & pool);
+
+  // Public Data Members
+
+    #ifdef AORPOOL_USAGE_COUNT
+
+      // Number of objects currently used / outstanding
+      std::atomic<uint32_t> m_count_now;
+
+      // Maximum number of objects used at once - i.e. peak usage
+      std::atomic<uint32_t> m_count_max;
+
+      // Optional callback that is called just prior to adding
+      tGrowFunc m_grow_f;
+
+    #endif
+
+  // Common Methods
+
+    AObjReusePoolMT(uint32_t initial_size, uint32_t expand_size);
+    ~AObjReusePoolMT();
+
+
+  // Accessor Methods
+
+    uint32_t get_block_count() const     { return m_blocks.get_length(); }
+    uint32_t get_bytes_allocated() const { return get_count_capacity() * sizeof(_ObjectType); }
+    uint32_t get_expand_size() const     { return m_expand_size; }
+    uint32_t get_count_initial() const   { return m_initial_size; }
+    uint32_t get_count_available() const { return get_count_capacity() - get_count_used(); }
+    uint32_t get_count_expanded() const  { return get_count_capacity() - m_initial_size; }
+    uint32_t get_count_capacity() const  { return m_capacity.load(std::memory_order_relaxed); }
+    uint32_t get_count_used() const;
+    uint32_t get_count_max() const;
+    uint32_t get_count_overflow() const;
+
+
+  // Modifying Methods
+
+    _ObjectType * pop();
+    void          append(_ObjectType * obj_p);
+    void          append_all(_ObjectType ** objs_a, uint length);
+
+    void          append_block(uint32_t size);
+    void          reserve(uint32_t count);
+    void          empty();
+
+
+  protected:
+
+  // Internal Structures
+
+    // Fixed size stack of free objects
+    struct Magazine
+      {
+      // Index of this magazine
+      uint32_t m_idx;
+
+      // 1-based index of next magazine in depot stack - 0 if last
+      std::atomic<uint32_t> m_next_idx;
+
+      // Number of objects in m_objs_a
+      uint32_t m_count;
+
+      _ObjectType * m_objs_a[AORPoolMT_magazine_size];
+      };
+
+    // Per-thread magazine pair
+    struct ThreadCache
+      {
+      Magazine * m_loaded_p;
+      Magazine * m_previous_p;
+      };
+
+  // Internal Methods
+
+    _ObjectType * pop_cache(ThreadCache * cache_p);
+    void          append_cache(ThreadCache * cache_p, _ObjectType * obj_p);
+
+    Magazine *    get_magazine(uint32_t idx) const   { return m_mag_chunks_a[idx >> AORPoolMT_mag_chunk_shift] + (idx & (AORPoolMT_mag_chunk_size - 1u)); }
+    Magazine *    get_magazine_empty();
+    Magazine *    get_magazine_full();
+    Magazine *    make_magazine();
+    Magazine *    depot_pop(std::atomic<uint64_t> & depot);
+    void          depot_push(std::atomic<uint64_t> & depot, Magazine * mag_p);
+    void          append_block_locked(uint32_t size);
+
+  // Data Members
+
+    // Lock-free stacks of magazines - low 32 bits is 1-based index of top magazine (0 if
+    // empty) and high 32 bits is a tag that is incremented on every change.
+    std::atomic<uint64_t> m_depot_full;
+    std::atomic<uint64_t> m_depot_empty;
+
+    // Caches for the first AORPoolMT_thread_max threads
+    ThreadCache m_caches_a[AORPoolMT_thread_max];
+
+    // Cache shared by any additional threads - protected by m_shared_mutex
+    ThreadCache m_shared_cache;
+    std::mutex  m_shared_mutex;
+
+    // Protects object block and magazine creation
+    std::mutex m_grow_mutex;
+
+    // Object blocks - first one is the initial block
+    APArray<tObjBlock> m_blocks;
+
+    // Magazine storage
+    Magazine * m_mag_chunks_a[AORPoolMT_mag_chunk_max];
+    uint32_t   m_mag_count;
+
+    // Total number of objects in all blocks
+    std::atomic<uint32_t> m_capacity;
+
+    uint32_t m_initial_size;
+
+    // If there is need of additional objects, this is the size to use for additional
+    // object blocks.
+    uint32_t m_expand_size;
+
+  };  // AObjReusePoolMT
+
+
+//=======================================================================================
+// AObjReusePoolMTBase Inline Methods
+//=======================================================================================
+
+//---------------------------------------------------------------------------------------
+// Returns a small index unique to the calling thread - 0 for first thread to call it,
+// 1 for the next, etc.
+inline uint32_t AObjReusePoolMTBase::get_thread_idx()
+  {
+  uint32_t idx = ms_thread_idx;
+
+  return idx ? (idx - 1u) : assign_thread_idx();
+  }
+
+
+//=======================================================================================
+// AObjReusePoolMT Methods
+//=======================================================================================
+
+//---------------------------------------------------------------------------------------
+// Constructor
+// # Returns:  itself
+// Arg         initial_size - initial object population for the reuse pool
+// Arg         expand_size - additional number of objects to allocate if all the objects
+//             in the reuse pool are in use and more objects are required.
+template<class _ObjectType>
+AObjReusePoolMT<_ObjectType>::AObjReusePoolMT(
+  uint32_t initial_size,
+  uint32_t expand_size
+  ) :
+  #ifdef AORPOOL_USAGE_COUNT
+    m_count_now(0u), m_count_max(0u), m_grow_f(nullptr),
+  #endif
+  m_depot_full(0u),
+  m_depot_empty(0u),
+  m_mag_count(0u),
+  m_capacity(0u),
+  m_initial_size(initial_size),
+  m_expand_size(expand_size)
+  {
+  memset(m_caches_a, 0, sizeof(m_caches_a));
+  memset(m_mag_chunks_a, 0, sizeof(m_mag_chunks_a));
+  m_shared_cache.m_loaded_p   = nullptr;
+  m_shared_cache.m_previous_p = nullptr;
+
+  std::lock_guard<std::mutex> lock(m_grow_mutex);
+
+  append_block_locked(initial_size);
+  }
+
+//---------------------------------------------------------------------------------------
+// Destructor
+template<class _ObjectType>
+AObjReusePoolMT<_ObjectType>::~AObjReusePoolMT()
+  {
+  empty();
+  }
+
+//---------------------------------------------------------------------------------------
+// Determines number of objects currently used / outstanding.
+// # Returns:  number of objects currently used
+// # Notes:    Objects sitting in per-thread caches cannot be counted without racing so
+//             this is only an approximation if AORPOOL_USAGE_COUNT is not defined.
+template<class _ObjectType>
+inline uint32_t AObjReusePoolMT<_ObjectType>::get_count_used() const
+  {
+  #ifdef AORPOOL_USAGE_COUNT
+    return m_count_now.load(std::memory_order_relaxed);
+  #else
+    // Approximate
+    return get_count_capacity();
+  #endif
+  }
+
+//---------------------------------------------------------------------------------------
+// Determines maximum number of objects used at once.
+// # Returns:  peak number of objects used
+template<class _ObjectType>
+inline uint32_t AObjReusePoolMT<_ObjectType>::get_count_max() const
+  {
+  #ifdef AORPOOL_USAGE_COUNT
+    return m_count_max.load(std::memory_order_relaxed);
+  #else
+    // Approximate
+    return get_count_capacity();
+  #endif
+  }
+
+//---------------------------------------------------------------------------------------
+// Determines number of objects used above and beyond the initial amount that
+//             was allocated.
+// # Returns:  number of objects that have overflowed initial allocation
+template<class _ObjectType>
+inline uint32_t AObjReusePoolMT<_ObjectType>::get_count_overflow() const
+  {
+  #ifdef AORPOOL_USAGE_COUNT
+    uint32_t count_max = get_count_max();
+
+    return (count_max <= m_initial_size) ? 0u : (count_max - m_initial_size);
+  #else
+    // Approximate
+    return get_count_expanded();
+  #endif
+  }
+
+//---------------------------------------------------------------------------------------
+// Retrieves a previously allocated object from the pool - may be called from any thread.
+// # Returns:  a dynamic object
+// # See:      append()
+// # Notes:    To 'deallocate' an object that was retrieved with this method, use
+//             'append()' rather than 'delete'.
+template<class _ObjectType>
+inline _ObjectType * AObjReusePoolMT<_ObjectType>::pop()
+  {
+  #ifdef AORPOOL_USAGE_COUNT
+    uint32_t count_now = m_count_now.fetch_add(1u, std::memory_order_relaxed) + 1u;
+    uint32_t count_max = m_count_max.load(std::memory_order_relaxed);
+
+    while ((count_now > count_max)
+      && !m_count_max.compare_exchange_weak(count_max, count_now, std::memory_order_relaxed))
+      {
+      }
+  #endif
+
+  uint32_t thread_idx = get_thread_idx();
+
+  if (thread_idx < AORPoolMT_thread_max)
+    {
+    return pop_cache(&m_caches_a[thread_idx]);
+    }
+
+  std::lock_guard<std::mutex> lock(m_shared_mutex);
+
+  return pop_cache(&m_shared_cache);
+  }
+
+//---------------------------------------------------------------------------------------
+// Returns an object to the pool ready for its next use - may be called from any thread
+// and not necessarily the same thread that popped it.
+// Arg         obj_p - pointer to object to free up and put into the pool.
+// # See:      pop(), append_all()
+template<class _ObjectType>
+inline void AObjReusePoolMT<_ObjectType>::append(_ObjectType * obj_p)
+  {
+  #ifdef AORPOOL_USAGE_COUNT
+    m_count_now.fetch_sub(1u, std::memory_order_relaxed);
+  #endif
+
+  uint32_t thread_idx = get_thread_idx();
+
+  if (thread_idx < AORPoolMT_thread_max)
+    {
+    append_cache(&m_caches_a[thread_idx], obj_p);
+
+    return;
+    }
+
+  std::lock_guard<std::mutex> lock(m_shared_mutex);
+
+  append_cache(&m_shared_cache, obj_p);
+  }
+
+//---------------------------------------------------------------------------------------
+// Returns 'length' objects to the pool ready for their next use.
+// Arg         objs_a - pointer to the array of objects to put into the pool.
+// # See:      append(), pop()
+template<class _ObjectType>
+void AObjReusePoolMT<_ObjectType>::append_all(
+  _ObjectType ** objs_a,
+  uint           length
+  )
+  {
+  #ifdef AORPOOL_USAGE_COUNT
+    m_count_now.fetch_sub(length, std::memory_order_relaxed);
+  #endif
+
+  uint32_t      thread_idx = get_thread_idx();
+  ThreadCache * cache_p    = &m_shared_cache;
+
+  if (thread_idx < AORPoolMT_thread_max)
+    {
+    cache_p = &m_caches_a[thread_idx];
+    }
+  else
+    {
+    m_shared_mutex.lock();
+    }
+
+  _ObjectType ** objs_end_a = objs_a + length;
+
+  while (objs_a < objs_end_a)
+    {
+    append_cache(cache_p, *objs_a);
+    objs_a++;
+    }
+
+  if (cache_p == &m_shared_cache)
+    {
+    m_shared_mutex.unlock();
+    }
+  }
+
+//---------------------------------------------------------------------------------------
+// Creates and appends a block of objects to the object pool
+// Arg         size - number of objects to allocate in the block
+template<class _ObjectType>
+void AObjReusePoolMT<_ObjectType>::append_block(uint32_t size)
+  {
+  std::lock_guard<std::mutex> lock(m_grow_mutex);
+
+  append_block_locked(size);
+  }
+
+//---------------------------------------------------------------------------------------
+// Ensures that the pool has a capacity of at least count objects - such as a high-water
+// mark recorded by AObjPoolProfile - so it does not need to grow while in use.
+// Arg         count - number of objects to have room for
+template<class _ObjectType>
+void AObjReusePoolMT<_ObjectType>::reserve(uint32_t count)
+  {
+  std::lock_guard<std::mutex> lock(m_grow_mutex);
+
+  uint32_t capacity = get_count_capacity();
+
+  if (count > capacity)
+    {
+    append_block_locked(count - capacity);
+    }
+  }
+
+//---------------------------------------------------------------------------------------
+// Frees all objects and magazines.
+// # Notes:    Must not be called while any other thread is using the pool.
+template<class _ObjectType>
+void AObjReusePoolMT<_ObjectType>::empty()
+  {
+  #ifdef AORPOOL_USAGE_COUNT
+    m_count_now = 0u;
+  #endif
+
+  m_blocks.free_all();
+  m_blocks.compact();
+
+  uint32_t chunk_count = (m_mag_count + AORPoolMT_mag_chunk_size - 1u) >> AORPoolMT_mag_chunk_shift;
+
+  for (uint32_t chunk_idx = 0u; chunk_idx < chunk_count; chunk_idx++)
+    {
+    AMemory::delete_array(m_mag_chunks_a[chunk_idx], AORPoolMT_mag_chunk_size);
+    m_mag_chunks_a[chunk_idx] = nullptr;
+    }
+
+  memset(m_caches_a, 0, sizeof(m_caches_a));
+  m_shared_cache.m_loaded_p   = nullptr;
+  m_shared_cache.m_previous_p = nullptr;
+  m_depot_full                = 0u;
+  m_depot_empty               = 0u;
+  m_mag_count                 = 0u;
+  m_capacity                  = 0u;
+  }
+
+//---------------------------------------------------------------------------------------
+// Gets an object from the specified thread cache, exchanging magazines with the depot
+// as needed.
+template<class _ObjectType>
+_ObjectType * AObjReusePoolMT<_ObjectType>::pop_cache(ThreadCache * cache_p)
+  {
+  Magazine * mag_p = cache_p->m_loaded_p;
+
+  if ((mag_p == nullptr) || (mag_p->m_count == 0u))
+    {
+    Magazine * prev_p = cache_p->m_previous_p;
+
+    if (prev_p && prev_p->m_count)
+      {
+      // Swap loaded and previous
+      cache_p->m_previous_p = mag_p;
+      mag_p                 = prev_p;
+      }
+    else
+      {
+      // Trade an empty magazine for a full one from the depot
+      if (prev_p)
+        {
+        depot_push(m_depot_empty, prev_p);
+        }
+
+      cache_p->m_previous_p = mag_p;
+      mag_p                 = get_magazine_full();
+      }
+
+    cache_p->m_loaded_p = mag_p;
+    }
+
+  mag_p->m_count--;
+
+  return mag_p->m_objs_a[mag_p->m_count];
+  }
+
+//---------------------------------------------------------------------------------------
+// Puts an object into the specified thread cache, exchanging magazines with the depot
+// as needed.
+template<class _ObjectType>
+void AObjReusePoolMT<_ObjectType>::append_cache(
+  ThreadCache * cache_p,
+  _ObjectType * obj_p
+  )
+  {
+  Magazine * mag_p = cache_p->m_loaded_p;
+
+  if ((mag_p == nullptr) || (mag_p->m_count == AORPoolMT_magazine_size))
+    {
+    Magazine * prev_p = cache_p->m_previous_p;
+
+    if (prev_p && (prev_p->m_count < AORPoolMT_magazine_size))
+      {
+      // Swap loaded and previous
+      cache_p->m_previous_p = mag_p;
+      mag_p                 = prev_p;
+      }
+    else
+      {
+      // Trade a full magazine for an empty one from the depot
+      if (prev_p)
+        {
+        depot_push(m_depot_full, prev_p);
+        }
+
+      cache_p->m_previous_p = mag_p;
+      mag_p                 = get_magazine_empty();
+      }
+
+    cache_p->m_loaded_p = mag_p;
+    }
+
+  mag_p->m_objs_a[mag_p->m_count] = obj_p;
+  mag_p->m_count++;
+  }
+
+//---------------------------------------------------------------------------------------
+// Gets an empty magazine from the depot or makes a new one.
+template<class _ObjectType>
+typename AObjReusePoolMT<_ObjectType>::Magazine * AObjReusePoolMT<_ObjectType>::get_magazine_empty()
+  {
+  Magazine * mag_p = depot_pop(m_depot_empty);
+
+  if (mag_p == nullptr)
+    {
+    std::lock_guard<std::mutex> lock(m_grow_mutex);
+
+    mag_p = make_magazine();
+    }
+
+  return mag_p;
+  }
+
+//---------------------------------------------------------------------------------------
+// Gets a magazine with at least one object in it from the depot - growing the pool if
+// there are none available.
+template<class _ObjectType>
+typename AObjReusePoolMT<_ObjectType>::Magazine * AObjReusePoolMT<_ObjectType>::get_magazine_full()
+  {
+  Magazine * mag_p = depot_pop(m_depot_full);
+
+  while (mag_p == nullptr)
+    {
+    std::lock_guard<std::mutex> lock(m_grow_mutex);
+
+    // Another thread may have grown the pool while waiting for the lock
+    mag_p = depot_pop(m_depot_full);
+
+    if (mag_p == nullptr)
+      {
+      // An expand size of 0 would never add any objects
+      append_block_locked(m_expand_size ? m_expand_size : uint32_t(AORPoolMT_magazine_size));
+      mag_p = depot_pop(m_depot_full);
+      }
+    }
+
+  return mag_p;
+  }
+
+//---------------------------------------------------------------------------------------
+// Creates a new empty magazine.
+// # Notes:    m_grow_mutex must be locked by caller.
+template<class _ObjectType>
+typename AObjReusePoolMT<_ObjectType>::Magazine * AObjReusePoolMT<_ObjectType>::make_magazine()
+  {
+  uint32_t idx       = m_mag_count;
+  uint32_t chunk_idx = idx >> AORPoolMT_mag_chunk_shift;
+
+  A_VERIFY(
+    chunk_idx < AORPoolMT_mag_chunk_max,
+    "AObjReusePoolMT<> - out of magazines!",
+    AErrId_low_memory,
+    tObjReusePool);
+
+  if (m_mag_chunks_a[chunk_idx] == nullptr)
+    {
+    m_mag_chunks_a[chunk_idx] = AMemory::new_array<Magazine>(AORPoolMT_mag_chunk_size, "AObjReusePoolMT.Magazine");
+    A_VERIFY_MEMORY(m_mag_chunks_a[chunk_idx] != nullptr, tObjReusePool);
+    }
+
+  Magazine * mag_p = get_magazine(idx);
+
+  mag_p->m_idx   = idx;
+  mag_p->m_count = 0u;
+  mag_p->m_next_idx.store(0u, std::memory_order_relaxed);
+  m_mag_count++;
+
+  return mag_p;
+  }
+
+//---------------------------------------------------------------------------------------
+// Pops a magazine off the specified lock-free depot stack
+// # Returns:  magazine or nullptr if depot stack is empty
+template<class _ObjectType>
+typename AObjReusePoolMT<_ObjectType>::Magazine * AObjReusePoolMT<_ObjectType>::depot_pop(
+  std::atomic<uint64_t> & depot
+  )
+  {
+  uint64_t head = depot.load(std::memory_order_acquire);
+
+  while (uint32_t(head))
+    {
+    Magazine * mag_p = get_magazine(uint32_t(head) - 1u);
+    uint64_t   next  = (((head >> 32u) + 1u) << 32u) | mag_p->m_next_idx.load(std::memory_order_relaxed);
+
+    if (depot.compare_exchange_weak(head, next, std::memory_order_acquire, std::memory_order_acquire))
+      {
+      return mag_p;
+      }
+    }
+
+  return nullptr;
+  }
+
+//---------------------------------------------------------------------------------------
+// Pushes a magazine on the specified lock-free depot stack
+template<class _ObjectType>
+void AObjReusePoolMT<_ObjectType>::depot_push(
+  std::atomic<uint64_t> & depot,
+  Magazine *              mag_p
+  )
+  {
+  uint64_t head = depot.load(std::memory_order_relaxed);
+  uint64_t next;
+
+  do
+    {
+    mag_p->m_next_idx.store(uint32_t(head), std::memory_order_relaxed);
+    next = (((head >> 32u) + 1u) << 32u) | (mag_p->m_idx + 1u);
+    }
+  while (!depot.compare_exchange_weak(head, next, std::memory_order_release, std::memory_order_relaxed));
+  }
+
+//---------------------------------------------------------------------------------------
+// Creates a block of objects and puts them in the depot as full magazines.
+// # Notes:    m_grow_mutex must be locked by caller.
+template<class _ObjectType>
+void AObjReusePoolMT<_ObjectType>::append_block_locked(uint32_t size)
+  {
+  #ifdef AORPOOL_USAGE_COUNT
+    // Notify that the pool has grown
+    if (m_blocks.is_filled() && m_grow_f)
+      {
+      (m_grow_f)(*this);
+      }
+  #endif
+
+  tObjBlock * obj_block_p = new ("tObjBlock") tObjBlock(size);
+
+  A_VERIFY_MEMORY(obj_block_p != nullptr, tObjReusePool);
+
+  m_blocks.append(*obj_block_p);
+
+  _ObjectType * obj_p     = obj_block_p->m_objects_a;
+  _ObjectType * obj_end_p = obj_p + size;
+  Magazine *    mag_p;
+
+  while (obj_p < obj_end_p)
+    {
+    mag_p = make_magazine();
+
+    while ((obj_p < obj_end_p) && (mag_p->m_count < AORPoolMT_magazine_size))
+      {
+      mag_p->m_objs_a[mag_p->m_count] = obj_p;
+      mag_p->m_count++;
+      obj_p++;
+      }
+
+    depot_push(m_depot_full, mag_p);
+    }
+
+  m_capacity.fetch_add(size, std::memory_order_relaxed);
+  }
+
+
+#endif  // __AOBJREUSEPOOLMT_HPP
@@ -21,8 +21,8 @@
 
 #include "AgogCore/APSizedArrayBase.hpp"
 #include "AgogCore/ACompareBase.hpp"  // Uses: ACompareAddress<>, ACompareLogical<>
+#include "AgogCore/ASort.hpp"
 #include <stdarg.h>          // Uses: va_array, va_start, va_arg, va_end
-#include <stdlib.h>          // Uses: qsort
 
 
 //=======================================================================================
@@ -110,9 +110,11 @@ template<
     APArray();
     APArray(const APArray & array);
     APArray(tAPSizedArrayBase * array_p);
+    APArray(APArray && array);
     ~APArray();
     APArray & operator=(const APArray & array);
     APArray & operator=(const APArrayBase<_ElementType> & array);
+    APArray & operator=(APArray && array);
 
 
   // Converter Methods
@@ -173,12 +175,6 @@ template<
     _ElementType * next(const _KeyType & key) const;
     _ElementType * next_equiv(const _ElementType & elem) const;
 
-
-  protected:
-  // Internal Class Methods
-
-    static int sort_compare(const void * lhs_p, const void * rhs_p);
-
   };  // APArray
 
 
@@ -201,11 +197,16 @@ class APArrayLogical : public APArray<_ElementType, _KeyType, ACompareLogical<_K
   // All the constructors are hidden (stupid!), so make appropriate links
 
     APArrayLogical();
+    APArrayLogical(const APArrayLogical & array);
     APArrayLogical(const APArray<_ElementType, _KeyType, ACompareLogical<_KeyType> > & array);
     APArrayLogical(APSizedArrayBase<_ElementType> * array_p);
+    APArrayLogical(APArrayLogical && array);
     explicit APArrayLogical(const _ElementType ** elems_p, uint32_t elem_count, uint32_t buffer_size = 0u);
     explicit APArrayLogical(const _ElementType * elems_p, uint32_t elem_count);
     explicit APArrayLogical(uint32_t elem_count, ...);
+
+    APArrayLogical & operator=(const APArrayLogical & array)  { tAPArray::operator=(array); return *this; }
+    APArrayLogical & operator=(APArrayLogical && array)       { tAPArray::operator=(static_cast<tAPArray &&>(array)); return *this; }
   };
 
 //---------------------------------------------------------------------------------------
@@ -229,13 +230,18 @@ class APArrayFree : public APArray<_ElementType, _KeyType, _CompareClass>
   // All the constructors are hidden (stupid!), so make appropriate links
 
     APArrayFree();
+    APArrayFree(const APArrayFree & array);
     APArrayFree(const APArray<_ElementType, _KeyType, _CompareClass> & array);
     APArrayFree(APSizedArrayBase<_ElementType> * array_p);
+    APArrayFree(APArrayFree && array);
     explicit APArrayFree(const _ElementType ** elems_p, uint32_t elem_count, uint32_t buffer_size = 0u);
     //explicit APArrayFree(const _ElementType * elems_p, uint32_t elem_count);
     //explicit APArrayFree(uint32_t elem_count, ...);
 
     ~APArrayFree();
+
+    APArrayFree & operator=(const APArrayFree & array)  { tAPArray::operator=(array); return *this; }
+    APArrayFree & operator=(APArrayFree && array)       { if (this != &array) { this->free_all(); tAPArray::operator=(static_cast<tAPArray &&>(array)); } return *this; }
   };
 
 
@@ -290,6 +296,18 @@ inline APArray<_ElementType, _KeyType, _CompareClass>::APArray(tAPSizedArrayBase
   {
   }
 
+//---------------------------------------------------------------------------------------
+// Move constructor - takes over the internal buffer of a temporary array and empties it.
+// # Returns:   itself
+// Arg          array - temporary array to take over the contents of
+// # Examples:  APArray<SomeClass> array(get_elems());  // no buffer copy
+// # See:       APArray(tAPSizedArrayBase *), operator=(APArray &&)
+template<class _ElementType, class _KeyType, class _CompareClass>
+inline APArray<_ElementType, _KeyType, _CompareClass>::APArray(APArray && array) :
+  tAPSizedArrayBase(&array)
+  {
+  }
+
 //---------------------------------------------------------------------------------------
 //  Destructor - deallocates internal C-string character buffer.
 // # Author(s):  Conan Reis
@@ -376,6 +394,29 @@ APArray<_ElementType, _KeyType, _CompareClass> & APArray<_ElementType, _KeyType,
   return *this;
   }
 
+//---------------------------------------------------------------------------------------
+// Move assignment operator - frees the existing buffer and takes over the buffer of a
+// temporary array.
+// # Returns:  reference to itself to allow for stringization
+// Arg         array - temporary array to take over the contents of and empty
+// # Examples: array = get_elems();  // no buffer copy
+// # Notes:    Just replaces any existing elements - if it is a *Free version of the class
+//             the elements are not freed first - free_all() must be called prior to this
+//             method if any existing items are to be freed.
+// # See:      assign()
+template<class _ElementType, class _KeyType, class _CompareClass>
+inline APArray<_ElementType, _KeyType, _CompareClass> & APArray<_ElementType, _KeyType, _CompareClass>::operator=(
+  APArray && array
+  )
+  {
+  if (this != &array)
+    {
+    this->assign(&array);
+    }
+
+  return *this;
+  }
+
 
 //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
 // Converter Methods
@@ -1620,13 +1661,12 @@ void APArray<_ElementType, _KeyType, _CompareClass>::set_all(
 //              set to last index position of the array (length - 1).
 //              (Default ALength_remainder)
 // # Examples:  array.sort();
-// # Notes:     calls sort_compare() which calls _CompareClass::comparison()
+// # Notes:     uses a_sort() which inlines _CompareClass::comparison()
 //              This method performs index range checking when A_BOUNDS_CHECK is defined.
 //              If an index is out of bounds, a AEx<APArray<>> exception is thrown.
 //              A_BOUNDS_CHECK is defined by default in debug mode and turned off in
 //              release mode.
 // # Author(s):  Conan Reis
-// Efficiency   Could probably get more speed by writing a custom version of qsort.
 template<class _ElementType, class _KeyType, class _CompareClass>
 inline void APArray<_ElementType, _KeyType, _CompareClass>::sort(
   uint32_t start_pos, // = 0u
@@ -1642,7 +1682,7 @@ inline void APArray<_ElementType, _KeyType, _CompareClass>::sort(
 
     APARRAY_BOUNDS_CHECK_RANGE(start_pos, end_pos);
 
-    ::qsort(this->m_array_p + start_pos, end_pos - start_pos + 1, sizeof(_ElementType *), sort_compare);
+    a_sort(this->m_array_p + start_pos, this->m_array_p + end_pos + 1u, ASortLessPtr<_ElementType, _CompareClass>());
     }
   }
 
@@ -2213,32 +2253,28 @@ APArray<_ElementType, _KeyType, _CompareClass>::next_equiv(
   }
 
 
-//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
-// Class Internal Methods
-//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+//#######################################################################################
+// APArrayLogical
+//#######################################################################################
 
 //---------------------------------------------------------------------------------------
-//  Used by qsort() in the sort() method
 // # Author(s):  Conan Reis
-template<class _ElementType, class _KeyType, class _CompareClass>
-int APArray<_ElementType, _KeyType, _CompareClass>::sort_compare(
-  const void * lhs_p,
-  const void * rhs_p
-  )
+template<class _ElementType, class _KeyType>
+inline APArrayLogical<_ElementType, _KeyType>::APArrayLogical()
   {
-  return A_INT_AS_DIFF32(
-    _CompareClass::comparison(**((_ElementType **)lhs_p), **((_ElementType **)rhs_p)));
   }
 
-
-//#######################################################################################
-// APArrayLogical
-//#######################################################################################
+//---------------------------------------------------------------------------------------
+template<class _ElementType, class _KeyType>
+inline APArrayLogical<_ElementType, _KeyType>::APArrayLogical(const APArrayLogical & array) :
+  tAPArray(array)
+  {
+  }
 
 //---------------------------------------------------------------------------------------
-// # Author(s):  Conan Reis
 template<class _ElementType, class _KeyType>
-inline APArrayLogical<_ElementType, _KeyType>::APArrayLogical()
+inline APArrayLogical<_ElementType, _KeyType>::APArrayLogical(APArrayLogical && array) :
+  tAPArray(static_cast<tAPArray &&>(array))
   {
   }
   
@@ -2333,6 +2369,20 @@ template<class _ElementType, class _KeyType, class _CompareClass>
 inline APArrayFree<_ElementType, _KeyType, _CompareClass>::APArrayFree()
   {
   }
+
+//---------------------------------------------------------------------------------------
+template<class _ElementType, class _KeyType, class _CompareClass>
+inline APArrayFree<_ElementType, _KeyType, _CompareClass>::APArrayFree(const APArrayFree & array) :
+  tAPArray(array)
+  {
+  }
+
+//---------------------------------------------------------------------------------------
+template<class _ElementType, class _KeyType, class _CompareClass>
+inline APArrayFree<_ElementType, _KeyType, _CompareClass>::APArrayFree(APArrayFree && array) :
+  tAPArray(static_cast<tAPArray &&>(array))
+  {
+  }
   
 //---------------------------------------------------------------------------------------
 // # Author(s):  Conan Reis
@@ -21,8 +21,8 @@
 
 #include "AgogCore/APCompactArrayBase.hpp"
 #include "AgogCore/ACompareBase.hpp"  // Uses: ACompareAddress<>, ACompareLogical<>
+#include "AgogCore/ASort.hpp"
 #include <stdarg.h>          // Uses: va_array, va_start, va_arg, va_end
-#include <stdlib.h>          // Uses: qsort
 
 
 //=======================================================================================
@@ -75,6 +75,7 @@
 //       APCompactArray<>          - Ordered array of pointers to elements with retrieval by key type
 //         APCompactArrayFree<>    - Same as APCompactArray<>, but calls free_all() on its destruction
 //         APCompactArrayLogical<> - Same as APCompactArray<>, but uses the comparison operators < and == to sort elements
+//       APCompactArrayInline<>    - Like APCompactArray<>, but stores up to N element pointers without a heap allocation
 //     
 // Author   Conan Reis
 template<
@@ -90,6 +91,7 @@ template<
     // Local shorthand
     typedef APCompactArray<_ElementType, _KeyType, _CompareClass>  tAPCompactArray;
     typedef APCompactArrayBase<_ElementType>                       tAPCompactArrayBase;
+    typedef APArrayBase<_ElementType>                              tAPArrayBase;
 
     // Unhide Inherited Methods
 
@@ -109,9 +111,11 @@ template<
     APCompactArray();
     APCompactArray(const APCompactArray & array);
     APCompactArray(APCompactArrayBase<_ElementType> * array_p);
+    APCompactArray(APCompactArray && array);
     ~APCompactArray();
     APCompactArray & operator=(const APCompactArray & array);
     APCompactArray & operator=(const APArrayBase<_ElementType> & array);
+    APCompactArray & operator=(APCompactArray && array);
 
 
   // Converter Methods
@@ -173,12 +177,6 @@ template<
     void             get_all(APCompactArray * collected_p, const APCompactArray & array, uint32_t start_pos = 0u, uint32_t end_pos = ALength_remainder) const;
     uint32_t         get_instance(uint32_t index) const;
 
-
-  protected:
-  // Internal Class Methods
-
-    static int sort_compare(const void * lhs_p, const void * rhs_p);
-
   };  // APCompactArray
 
 
@@ -197,15 +195,21 @@ class APCompactArrayLogical : public APCompactArray<_ElementType, _KeyType, ACom
     // Local shorthand
     typedef APCompactArray<_ElementType, _KeyType, ACompareLogical<_KeyType> >  tAPCompactArray;
     typedef APCompactArrayBase<_ElementType>                                    tAPCompactArrayBase;
+    typedef APArrayBase<_ElementType>                                           tAPArrayBase;
 
   // All the constructors are hidden (stupid!), so make appropriate links
 
     APCompactArrayLogical();
+    APCompactArrayLogical(const APCompactArrayLogical & array);
     APCompactArrayLogical(const APCompactArray<_ElementType, _KeyType, ACompareLogical<_KeyType> > & array);
     APCompactArrayLogical(APCompactArrayBase<_ElementType> * array_p);
+    APCompactArrayLogical(APCompactArrayLogical && array);
     explicit APCompactArrayLogical(const _ElementType ** elems_p, uint32_t elem_count);
     explicit APCompactArrayLogical(const _ElementType * elems_p, uint32_t elem_count);
     explicit APCompactArrayLogical(uint32_t elem_count, ...);
+
+    APCompactArrayLogical & operator=(const APCompactArrayLogical & array)  { tAPCompactArray::operator=(array); return *this; }
+    APCompactArrayLogical & operator=(APCompactArrayLogical && array)       { tAPCompactArray::operator=(static_cast<tAPCompactArray &&>(array)); return *this; }
   };
 
 //---------------------------------------------------------------------------------------
@@ -225,17 +229,142 @@ class APCompactArrayFree : public APCompactArray<_ElementType, _KeyType, _Compar
     // Local shorthand
     typedef APCompactArray<_ElementType, _KeyType, _CompareClass>  tAPCompactArray;
     typedef APCompactArrayBase<_ElementType>                       tAPCompactArrayBase;
+    typedef APArrayBase<_ElementType>                              tAPArrayBase;
 
   // All the constructors are hidden (stupid!), so make appropriate links
 
     APCompactArrayFree();
+    APCompactArrayFree(const APCompactArrayFree & array);
     APCompactArrayFree(const APCompactArray<_ElementType, _KeyType, _CompareClass> & array);
     APCompactArrayFree(APCompactArrayBase<_ElementType> * array_p);
+    APCompactArrayFree(APCompactArrayFree && array);
     explicit APCompactArrayFree(const _ElementType ** elems_p, uint32_t elem_count, uint32_t buffer_size = 0u);
     //explicit APCompactArrayFree(const _ElementType * elems_p, uint32_t elem_count);
     //explicit APCompactArrayFree(uint32_t elem_count, ...);
 
     ~APCompactArrayFree();
+
+    APCompactArrayFree & operator=(const APCompactArrayFree & array)  { tAPCompactArray::operator=(array); return *this; }
+    APCompactArrayFree & operator=(APCompactArrayFree && array)       { if (this != &array) { this->free_all(); tAPCompactArray::operator=(static_cast<tAPCompactArray &&>(array)); } return *this; }
+  };
+
+//---------------------------------------------------------------------------------------
+// APCompactArrayInline is like APCompactArray though it has a buffer for _InlineSize
+// element pointers stored within the array object itself.  Whenever the array has no
+// more than _InlineSize elements they are kept in this inline buffer and only larger
+// arrays allocate a buffer on the heap.  Good for arrays that are almost always small and
+// that are members of objects which are allocated in large numbers - such as the
+// arguments of an expression.
+//
+// The inline buffer is known only to this class - APCompactArray<> and its base classes
+// are unchanged.  Their methods that resize the buffer would free the inline buffer so
+// APCompactArray<> is a protected base class and the methods that resize the buffer are
+// reimplemented here.  Its other methods are made public again.
+//
+// Since the inline buffer is within the object the array must not be relocated with a
+// raw memory copy - as it may be when stored by value in AVCompactArrayBase<>.
+template<
+  class _ElementType,
+  uint32_t _InlineSize,
+  class _KeyType      = _ElementType,
+  class _CompareClass = ACompareAddress<_KeyType>
+  >
+class APCompactArrayInline : protected APCompactArray<_ElementType, _KeyType, _CompareClass>
+  {
+  public:
+    // Common types
+
+    // Local shorthand
+    typedef APCompactArrayInline<_ElementType, _InlineSize, _KeyType, _CompareClass>  tAPCompactArrayInline;
+    typedef APCompactArray<_ElementType, _KeyType, _CompareClass>                     tAPCompactArray;
+    typedef APCompactArrayBase<_ElementType>                                          tAPCompactArrayBase;
+    typedef APArrayBase<_ElementType>                                                 tAPArrayBase;
+
+    static_assert(_InlineSize > 0u, "APCompactArrayInline<> inline size must be at least 1.");
+
+    // Unhide Inherited Methods
+
+    // Methods inherited from APCompactArray<> that do not resize the buffer.
+    using tAPCompactArray::get_array;
+    using tAPCompactArray::get_array_end;
+    using tAPCompactArray::get_at;
+    using tAPCompactArray::get_first;
+    using tAPCompactArray::get_last;
+    using tAPCompactArray::get_length;
+    using tAPCompactArray::get_size;
+    using tAPCompactArray::is_empty;
+    using tAPCompactArray::is_filled;
+    using tAPCompactArray::set_at;
+    using tAPCompactArray::operator();
+    using tAPCompactArray::operator[];
+    using tAPCompactArray::null;
+    using tAPCompactArray::crop;
+    using tAPCompactArray::apply;
+    using tAPCompactArray::apply_method;
+    using tAPCompactArray::find_equiv;
+    using tAPCompactArray::find_equiv_reverse;
+    using tAPCompactArray::as_binary_elems;
+    using tAPCompactArray::as_binary;
+    using tAPCompactArray::as_binary8;
+    using tAPCompactArray::as_binary_elems_length;
+    using tAPCompactArray::as_binary_length;
+    using tAPCompactArray::as_binary_length8;
+    using tAPCompactArray::count;
+    using tAPCompactArray::as_new;
+    using tAPCompactArray::find;
+    using tAPCompactArray::find_reverse;
+    using tAPCompactArray::get;
+    using tAPCompactArray::get_all;
+    using tAPCompactArray::get_instance;
+
+  // Common methods
+
+    APCompactArrayInline();
+    APCompactArrayInline(const APCompactArrayInline & array);
+    APCompactArrayInline(const APArrayBase<_ElementType> & array);
+    APCompactArrayInline(APCompactArrayBase<_ElementType> * array_p);
+    APCompactArrayInline(APCompactArrayInline && array);
+    ~APCompactArrayInline();
+    APCompactArrayInline & operator=(const APCompactArrayInline & array);
+    APCompactArrayInline & operator=(const APArrayBase<_ElementType> & array);
+    APCompactArrayInline & operator=(APCompactArrayInline && array);
+
+  // Accessor methods
+
+    uint32_t get_size_buffer_bytes() const;
+    void     set_at_expand(uint32_t idx, const _ElementType * elem_p);
+
+  // Modifying Behaviour methods
+
+    void           append(const _ElementType & elem);
+    bool           append_absent(const _ElementType & elem);
+    void           append_null();
+    void           assign(APCompactArrayBase<_ElementType> * array_p);
+    void           assign(APCompactArrayInline * array_p);
+    void           empty();
+    void           ensure_length_null(uint32_t length_min);
+    void           free(uint32_t pos = 0u);
+    void           free_all();
+    void           free_all_last(uint32_t elem_count);
+    _ElementType * pop_last();
+    void           remove_last();
+
+  // Non-modifying Methods
+
+    uint32_t track_memory(AMemoryStats * mem_stats_p) const;
+
+  protected:
+  // Internal Methods
+
+    bool is_buffer_inline() const  { return this->m_array_p == m_inline_buffer; }
+    void set_length_buffer(uint32_t length);
+
+  // Data Members
+
+    // Buffer used instead of a heap allocation whenever there are _InlineSize elements
+    // or less.
+    _ElementType * m_inline_buffer[_InlineSize];
+
   };
 
 
@@ -290,6 +419,17 @@ inline APCompactArray<_ElementType, _KeyType, _CompareClass>::APCompactArray(APC
   {
   }
 
+//---------------------------------------------------------------------------------------
+// Move constructor - takes over the internal buffer of a temporary array and empties it.
+// # Returns:   itself
+// Arg          array - temporary array to take over the contents of
+// # See:       APCompactArray(APCompactArrayBase *), operator=(APCompactArray &&)
+template<class _ElementType, class _KeyType, class _CompareClass>
+inline APCompactArray<_ElementType, _KeyType, _CompareClass>::APCompactArray(APCompactArray && array) :
+  tAPCompactArrayBase(&array)
+  {
+  }
+
 //---------------------------------------------------------------------------------------
 //  Destructor - deallocates internal C-string character buffer.
 // # Author(s):  Conan Reis
@@ -322,19 +462,27 @@ APCompactArray<_ElementType, _KeyType, _CompareClass> & APCompactArray<_ElementT
   // addition to the version that takes the APArraybase<> below otherwise an erroneous
   // APCompactArray<> version will be auto generated.
 
-  uint32_t length = array.m_count;
+  return operator=(static_cast<const tAPArrayBase &>(array));
+  }
 
-  // $Note - CReis The GCC compiler cannot resolve inherited members without "this->" or "SourceClass::" prefixing them.
-  if (length != this->m_size)
+//---------------------------------------------------------------------------------------
+// Move assignment operator - frees the existing buffer and takes over the buffer of a
+// temporary array.
+// # Returns:  reference to itself to allow for stringization
+// Arg         array - temporary array to take over the contents of and empty
+// # Notes:    Just replaces any existing elements - if it is a *Free version of the class
+//             the elements are not freed first.
+// # See:      assign()
+template<class _ElementType, class _KeyType, class _CompareClass>
+inline APCompactArray<_ElementType, _KeyType, _CompareClass> & APCompactArray<_ElementType, _KeyType, _CompareClass>::operator=(
+  APCompactArray && array
+  )
+  {
+  if (this != &array)
     {
-    tAPArrayBase::free_array(this->m_array_p);
-    this->m_size    = AMemory::request_pointer_count(length);
-    this->m_array_p = tAPArrayBase::alloc_array(this->m_size);
+    this->assign(&array);
     }
 
-  this->m_count = length;
-  ::memcpy(this->m_array_p, array.m_array_p, length * sizeof(_ElementType *));
-
   return *this;
   }
 
@@ -1533,13 +1681,12 @@ void APCompactArray<_ElementType, _KeyType, _CompareClass>::set_all(
 //              set to last index position of the array (length - 1).
 //              (Default ALength_remainder)
 // # Examples:  array.sort();
-// # Notes:     calls sort_compare() which calls _CompareClass::comparison()
+// # Notes:     uses a_sort() which inlines _CompareClass::comparison()
 //              This method performs index range checking when A_BOUNDS_CHECK is defined.
 //              If an index is out of bounds, a AEx<APCompactArray<>> exception is thrown.
 //              A_BOUNDS_CHECK is defined by default in debug mode and turned off in
 //              release mode.
 // # Author(s):  Conan Reis
-// Efficiency   Could probably get more speed by writing a custom version of qsort.
 template<class _ElementType, class _KeyType, class _CompareClass>
 inline void APCompactArray<_ElementType, _KeyType, _CompareClass>::sort(
   uint32_t start_pos, // = 0u
@@ -1555,7 +1702,7 @@ inline void APCompactArray<_ElementType, _KeyType, _CompareClass>::sort(
 
     APARRAY_BOUNDS_CHECK_RANGE(start_pos, end_pos);
 
-    qsort(this->m_array_p + start_pos, end_pos - start_pos + 1, sizeof(_ElementType *), sort_compare);
+    a_sort(this->m_array_p + start_pos, this->m_array_p + end_pos + 1u, ASortLessPtr<_ElementType, _CompareClass>());
     }
   }
 
@@ -2050,32 +2197,28 @@ uint32_t APCompactArray<_ElementType, _KeyType, _CompareClass>::get_instance(uin
   }
 
 
-//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
-// Class Internal Methods
-//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+//#######################################################################################
+// APCompactArrayLogical
+//#######################################################################################
 
 //---------------------------------------------------------------------------------------
-//  Used by qsort() in the sort() method
 // # Author(s):  Conan Reis
-template<class _ElementType, class _KeyType, class _CompareClass>
-int APCompactArray<_ElementType, _KeyType, _CompareClass>::sort_compare(
-  const void * lhs_p,
-  const void * rhs_p
-  )
+template<class _ElementType, class _KeyType>
+inline APCompactArrayLogical<_ElementType, _KeyType>::APCompactArrayLogical()
   {
-  return A_INT_AS_DIFF32(
-    _CompareClass::comparison(**((_ElementType **)lhs_p), **((_ElementType **)rhs_p)));
   }
 
-
-//#######################################################################################
-// APCompactArrayLogical
-//#######################################################################################
+//---------------------------------------------------------------------------------------
+template<class _ElementType, class _KeyType>
+inline APCompactArrayLogical<_ElementType, _KeyType>::APCompactArrayLogical(const APCompactArrayLogical & array) :
+  tAPCompactArray(array)
+  {
+  }
 
 //---------------------------------------------------------------------------------------
-// # Author(s):  Conan Reis
 template<class _ElementType, class _KeyType>
-inline APCompactArrayLogical<_ElementType, _KeyType>::APCompactArrayLogical()
+inline APCompactArrayLogical<_ElementType, _KeyType>::APCompactArrayLogical(APCompactArrayLogical && array) :
+  tAPCompactArray(static_cast<tAPCompactArray &&>(array))
   {
   }
   
@@ -2169,6 +2312,20 @@ template<class _ElementType, class _KeyType, class _CompareClass>
 inline APCompactArrayFree<_ElementType, _KeyType, _CompareClass>::APCompactArrayFree()
   {
   }
+
+//---------------------------------------------------------------------------------------
+template<class _ElementType, class _KeyType, class _CompareClass>
+inline APCompactArrayFree<_ElementType, _KeyType, _CompareClass>::APCompactArrayFree(const APCompactArrayFree & array) :
+  tAPCompactArray(array)
+  {
+  }
+
+//---------------------------------------------------------------------------------------
+template<class _ElementType, class _KeyType, class _CompareClass>
+inline APCompactArrayFree<_ElementType, _KeyType, _CompareClass>::APCompactArrayFree(APCompactArrayFree && array) :
+  tAPCompactArray(static_cast<tAPCompactArray &&>(array))
+  {
+  }
   
 //---------------------------------------------------------------------------------------
 // # Author(s):  Conan Reis
@@ -2220,6 +2377,432 @@ inline APCompactArrayFree<_ElementType, _KeyType, _CompareClass>::~APCompactArra
   }
 
 
+//#######################################################################################
+// APCompactArrayInline
+//#######################################################################################
+
+//---------------------------------------------------------------------------------------
+// Default constructor
+// # Returns:   itself
+// # Examples:  APCompactArrayInline<SomeClass, 4u> array;
+template<class _ElementType, uint32_t _InlineSize, class _KeyType, class _CompareClass>
+inline APCompactArrayInline<_ElementType, _InlineSize, _KeyType, _CompareClass>::APCompactArrayInline()
+  {
+  }
+
+//---------------------------------------------------------------------------------------
+// Copy constructor
+// # Returns:   itself
+// Arg          array - array to copy
+template<class _ElementType, uint32_t _InlineSize, class _KeyType, class _CompareClass>
+inline APCompactArrayInline<_ElementType, _InlineSize, _KeyType, _CompareClass>::APCompactArrayInline(
+  const APCompactArrayInline & array
+  )
+  {
+  operator=(static_cast<const tAPArrayBase &>(array));
+  }
+
+//---------------------------------------------------------------------------------------
+// Converter constructor - copies the element pointers of any pointer array
+// # Returns:   itself
+// Arg          array - array to copy
+template<class _ElementType, uint32_t _InlineSize, class _KeyType, class _CompareClass>
+inline APCompactArrayInline<_ElementType, _InlineSize, _KeyType, _CompareClass>::APCompactArrayInline(
+  const APArrayBase<_ElementType> & array
+  )
+  {
+  operator=(array);
+  }
+
+//---------------------------------------------------------------------------------------
+// Transfer copy constructor - takes over internal buffer of given array and empties it.
+// # Returns:   itself
+// Arg          array_p - array to take over the contents of and empty
+// # Notes:     If array_p has no more than _InlineSize elements they are copied into the
+//              inline buffer of this array instead.
+template<class _ElementType, uint32_t _InlineSize, class _KeyType, class _CompareClass>
+inline APCompactArrayInline<_ElementType, _InlineSize, _KeyType, _CompareClass>::APCompactArrayInline(
+  APCompactArrayBase<_ElementType> * array_p
+  )
+  {
+  assign(array_p);
+  }
+
+//---------------------------------------------------------------------------------------
+// Move constructor - takes over the heap buffer of a temporary array or copies the
+// element pointers if they are in its inline buffer.
+// # Returns:   itself
+// Arg          array - temporary array to take over the contents of
+template<class _ElementType, uint32_t _InlineSize, class _KeyType, class _CompareClass>
+inline APCompactArrayInline<_ElementType, _InlineSize, _KeyType, _CompareClass>::APCompactArrayInline(
+  APCompactArrayInline && array
+  )
+  {
+  assign(&array);
+  }
+
+//---------------------------------------------------------------------------------------
+// Destructor - the APCompactArray<> destructor frees any heap buffer.
+template<class _ElementType, uint32_t _InlineSize, class _KeyType, class _CompareClass>
+inline APCompactArrayInline<_ElementType, _InlineSize, _KeyType, _CompareClass>::~APCompactArrayInline()
+  {
+  if (is_buffer_inline())
+    {
+    this->m_array_p = nullptr;
+    }
+  }
+
+//---------------------------------------------------------------------------------------
+// Assignment operator
+// # Returns:   reference to itself to allow for stringization
+// # See:       operator=(const APArrayBase<> &)
+template<class _ElementType, uint32_t _InlineSize, class _KeyType, class _CompareClass>
+inline APCompactArrayInline<_ElementType, _InlineSize, _KeyType, _CompareClass> &
+  APCompactArrayInline<_ElementType, _InlineSize, _KeyType, _CompareClass>::operator=(
+    const APCompactArrayInline & array
+    )
+  {
+  return operator=(static_cast<const tAPArrayBase &>(array));
+  }
+
+//---------------------------------------------------------------------------------------
+// Assignment operator - copies the element pointers of any pointer array
+// # Returns:   reference to itself to allow for stringization
+// Arg          array - array to copy
+template<class _ElementType, uint32_t _InlineSize, class _KeyType, class _CompareClass>
+APCompactArrayInline<_ElementType, _InlineSize, _KeyType, _CompareClass> &
+  APCompactArrayInline<_ElementType, _InlineSize, _KeyType, _CompareClass>::operator=(
+    const APArrayBase<_ElementType> & array
+    )
+  {
+  if (static_cast<const tAPArrayBase *>(this) != &array)
+    {
+    uint32_t length = array.get_length();
+
+    if (length != this->m_count)
+      {
+      empty();
+      set_length_buffer(length);
+      }
+
+    ::memcpy(this->m_array_p, array.get_array(), length * sizeof(_ElementType *));
+    }
+
+  return *this;
+  }
+
+//---------------------------------------------------------------------------------------
+// Move assignment operator
+// # Returns:   reference to itself to allow for stringization
+// Arg          array - temporary array to take over the contents of
+// # See:       assign()
+template<class _ElementType, uint32_t _InlineSize, class _KeyType, class _CompareClass>
+inline APCompactArrayInline<_ElementType, _InlineSize, _KeyType, _CompareClass> &
+  APCompactArrayInline<_ElementType, _InlineSize, _KeyType, _CompareClass>::operator=(
+    APCompactArrayInline && array
+    )
+  {
+  if (this != &array)
+    {
+    assign(&array);
+    }
+
+  return *this;
+  }
+
+//---------------------------------------------------------------------------------------
+// Returns the size of the heap buffer in bytes - 0 if the elements are in the inline
+// buffer since it is part of the array object itself.
+// # See:       APCompactArrayBase<>::get_size_buffer_bytes()
+template<class _ElementType, uint32_t _InlineSize, class _KeyType, class _CompareClass>
+inline uint32_t APCompactArrayInline<_ElementType, _InlineSize, _KeyType, _CompareClass>::get_size_buffer_bytes() const
+  {
+  return is_buffer_inline() ? 0u : uint32_t(this->m_count * sizeof(void *));
+  }
+
+//---------------------------------------------------------------------------------------
+// Sets the element pointer at index idx - growing the array with nullptr elements if it
+// is not long enough.
+// # See:       APCompactArray<>::set_at_expand()
+template<class _ElementType, uint32_t _InlineSize, class _KeyType, class _CompareClass>
+inline void APCompactArrayInline<_ElementType, _InlineSize, _KeyType, _CompareClass>::set_at_expand(
+  uint32_t             idx,
+  const _ElementType * elem_p
+  )
+  {
+  ensure_length_null(idx + 1u);
+  this->m_array_p[idx] = const_cast<_ElementType *>(elem_p);
+  }
+
+//---------------------------------------------------------------------------------------
+// Appends an element to the end of the array.
+// # See:       APCompactArray<>::append()
+template<class _ElementType, uint32_t _InlineSize, class _KeyType, class _CompareClass>
+inline void APCompactArrayInline<_ElementType, _InlineSize, _KeyType, _CompareClass>::append(const _ElementType & elem)
+  {
+  uint32_t length = this->m_count;
+
+  set_length_buffer(length + 1u);
+  this->m_array_p[length] = const_cast<_ElementType *>(&elem);
+  }
+
+//---------------------------------------------------------------------------------------
+// Appends an element to the array if it is not already present in the array
+// # Returns:   true if element appended, false if not
+// # See:       APCompactArray<>::append_absent()
+template<class _ElementType, uint32_t _InlineSize, class _KeyType, class _CompareClass>
+inline bool APCompactArrayInline<_ElementType, _InlineSize, _KeyType, _CompareClass>::append_absent(const _ElementType & elem)
+  {
+  if (!this->find(elem))
+    {
+    append(elem);
+
+    return true;
+    }
+
+  return false;
+  }
+
+//---------------------------------------------------------------------------------------
+// Appends a nullptr element pointer to the end of the array.
+// # See:       APCompactArrayBase<>::append_null()
+template<class _ElementType, uint32_t _InlineSize, class _KeyType, class _CompareClass>
+inline void APCompactArrayInline<_ElementType, _InlineSize, _KeyType, _CompareClass>::append_null()
+  {
+  uint32_t length = this->m_count;
+
+  set_length_buffer(length + 1u);
+  this->m_array_p[length] = nullptr;
+  }
+
+//---------------------------------------------------------------------------------------
+// Transfer ownership assignment
+// Arg          array_p - address of array to take contents from and then empty
+// # Notes:     If array_p has no more than _InlineSize elements they are copied into the
+//              inline buffer rather than taking over its buffer.
+template<class _ElementType, uint32_t _InlineSize, class _KeyType, class _CompareClass>
+void APCompactArrayInline<_ElementType, _InlineSize, _KeyType, _CompareClass>::assign(
+  APCompactArrayBase<_ElementType> * array_p
+  )
+  {
+  uint32_t length = array_p->get_length();
+
+  empty();
+
+  if (length > _InlineSize)
+    {
+    // Takes over the heap buffer - this array no longer has a buffer to free
+    tAPCompactArray::assign(array_p);
+
+    return;
+    }
+
+  set_length_buffer(length);
+  ::memcpy(this->m_array_p, array_p->get_array(), length * sizeof(_ElementType *));
+  array_p->empty();
+  }
+
+//---------------------------------------------------------------------------------------
+// Transfer ownership assignment from another inline array
+// Arg          array_p - address of array to take contents from and then empty
+// # Notes:     The element pointers are copied if they are in the inline buffer of
+//              array_p.
+template<class _ElementType, uint32_t _InlineSize, class _KeyType, class _CompareClass>
+void APCompactArrayInline<_ElementType, _InlineSize, _KeyType, _CompareClass>::assign(
+  APCompactArrayInline * array_p
+  )
+  {
+  uint32_t length = array_p->m_count;
+
+  empty();
+
+  if (array_p->is_buffer_inline())
+    {
+    set_length_buffer(length);
+    ::memcpy(this->m_array_p, array_p->m_array_p, length * sizeof(_ElementType *));
+    }
+  else
+    {
+    this->m_array_p = array_p->m_array_p;
+    this->m_count   = length;
+    }
+
+  array_p->m_array_p = nullptr;
+  array_p->m_count   = 0u;
+  }
+
+//---------------------------------------------------------------------------------------
+// Removes all elements from the array
+// # See:       free_all()
+template<class _ElementType, uint32_t _InlineSize, class _KeyType, class _CompareClass>
+inline void APCompactArrayInline<_ElementType, _InlineSize, _KeyType, _CompareClass>::empty()
+  {
+  set_length_buffer(0u);
+  }
+
+//---------------------------------------------------------------------------------------
+// Ensures that the length of the array is at least length_min by appending nullptr
+// elements as needed.
+// # See:       APCompactArrayBase<>::ensure_length_null()
+template<class _ElementType, uint32_t _InlineSize, class _KeyType, class _CompareClass>
+inline void APCompactArrayInline<_ElementType, _InlineSize, _KeyType, _CompareClass>::ensure_length_null(uint32_t length_min)
+  {
+  uint32_t length = this->m_count;
+
+  if (length < length_min)
+    {
+    set_length_buffer(length_min);
+    ::memset(this->m_array_p + length, 0, (length_min - length) * sizeof(_ElementType *));
+    }
+  }
+
+//---------------------------------------------------------------------------------------
+// Frees (removes and deletes) element at index pos.
+// # See:       APCompactArrayBase<>::free()
+template<class _ElementType, uint32_t _InlineSize, class _KeyType, class _CompareClass>
+void APCompactArrayInline<_ElementType, _InlineSize, _KeyType, _CompareClass>::free(
+  uint32_t pos // = 0u
+  )
+  {
+  APARRAY_BOUNDS_CHECK(pos);
+
+  _ElementType * elem_p = this->m_array_p[pos];
+  uint32_t       length = this->m_count - 1u;
+
+  // Remove element first
+  ::memmove(this->m_array_p + pos, this->m_array_p + pos + 1u, (length - pos) * sizeof(_ElementType *));
+  set_length_buffer(length);
+
+  // Then delete element
+  delete elem_p;
+  }
+
+//---------------------------------------------------------------------------------------
+// Frees (removes and deletes) all the elements in the array.
+// # See:       APCompactArrayBase<>::free_all()
+template<class _ElementType, uint32_t _InlineSize, class _KeyType, class _CompareClass>
+void APCompactArrayInline<_ElementType, _InlineSize, _KeyType, _CompareClass>::free_all()
+  {
+  _ElementType ** old_array_p = this->m_array_p;
+  _ElementType ** array_p     = old_array_p;
+  _ElementType ** array_end_p = array_p + this->m_count;
+
+  // Remove elements first
+  this->m_array_p = nullptr;
+  this->m_count   = 0u;
+
+  // Then delete elements
+  for (; array_p < array_end_p; array_p++)
+    {
+    delete (*array_p);
+    }
+
+  if (old_array_p != m_inline_buffer)
+    {
+    tAPArrayBase::free_array(old_array_p);
+    }
+  }
+
+//---------------------------------------------------------------------------------------
+// Removes and deletes elem_count elements from the end of the array
+// # See:       APCompactArrayBase<>::free_all_last()
+template<class _ElementType, uint32_t _InlineSize, class _KeyType, class _CompareClass>
+void APCompactArrayInline<_ElementType, _InlineSize, _KeyType, _CompareClass>::free_all_last(uint32_t elem_count)
+  {
+  if (elem_count)
+    {
+    APARRAY_BOUNDS_LENGTH(elem_count);
+
+    _ElementType ** array_end_p = this->m_array_p + this->m_count;
+    _ElementType ** array_p     = array_end_p - elem_count;
+
+    for (; array_p < array_end_p; array_p++)
+      {
+      delete (*array_p);
+      }
+
+    set_length_buffer(this->m_count - elem_count);
+    }
+  }
+
+//---------------------------------------------------------------------------------------
+// Removes and returns the element from the last index position.
+// # Returns:   a pointer to the popped element or nullptr if there are no elements
+// # See:       APCompactArrayBase<>::pop_last()
+template<class _ElementType, uint32_t _InlineSize, class _KeyType, class _CompareClass>
+inline _ElementType * APCompactArrayInline<_ElementType, _InlineSize, _KeyType, _CompareClass>::pop_last()
+  {
+  uint32_t length = this->m_count;
+
+  if (length == 0u)
+    {
+    return nullptr;
+    }
+
+  _ElementType * elem_p = this->m_array_p[length - 1u];
+
+  set_length_buffer(length - 1u);
+
+  return elem_p;
+  }
+
+//---------------------------------------------------------------------------------------
+// Removes the element from the last index position.
+// # See:       APCompactArrayBase<>::remove_last()
+template<class _ElementType, uint32_t _InlineSize, class _KeyType, class _CompareClass>
+inline void APCompactArrayInline<_ElementType, _InlineSize, _KeyType, _CompareClass>::remove_last()
+  {
+  APARRAY_BOUNDS_CHECK(0u);
+
+  set_length_buffer(this->m_count - 1u);
+  }
+
+//---------------------------------------------------------------------------------------
+// Tracks memory used by the elements and returns the size of the heap buffer in bytes.
+// # See:       APCompactArrayBase<>::track_memory()
+template<class _ElementType, uint32_t _InlineSize, class _KeyType, class _CompareClass>
+inline uint32_t APCompactArrayInline<_ElementType, _InlineSize, _KeyType, _CompareClass>::track_memory(AMemoryStats * mem_stats_p) const
+  {
+  tAPCompactArray::track_memory(mem_stats_p);
+
+  return get_size_buffer_bytes();
+  }
+
+//---------------------------------------------------------------------------------------
+// Sets the number of elements and resizes the buffer to match - using the inline buffer
+// whenever length fits in it.  The first element pointers (up to length) are kept and
+// any new element pointers are left uninitialized for the caller to set.
+// # Modifiers: protected
+template<class _ElementType, uint32_t _InlineSize, class _KeyType, class _CompareClass>
+void APCompactArrayInline<_ElementType, _InlineSize, _KeyType, _CompareClass>::set_length_buffer(uint32_t length)
+  {
+  _ElementType ** old_array_p = this->m_array_p;
+  _ElementType ** array_p     = nullptr;
+
+  if (length)
+    {
+    array_p = (length <= _InlineSize) ? m_inline_buffer : tAPArrayBase::alloc_array(length);
+    }
+
+  if (array_p != old_array_p)
+    {
+    uint32_t keep_count = (length < this->m_count) ? length : this->m_count;
+
+    if (keep_count)
+      {
+      ::memcpy(array_p, old_array_p, keep_count * sizeof(_ElementType *));
+      }
+
+    if (old_array_p != m_inline_buffer)
+      {
+      tAPArrayBase::free_array(old_array_p);
+      }
+    }
+
+  this->m_array_p = array_p;
+  this->m_count   = length;
+  }
+
 
 #endif  // __APCOMPACTARRAY_HPP
 
@@ -20,8 +20,8 @@
 
 #include "AgogCore/APSizedArrayBase.hpp"
 #include "AgogCore/ACompareBase.hpp"
+#include "AgogCore/ASort.hpp"
 #include <stdarg.h>          // Uses: va_array, va_start(), va_arg(), va_end()
-#include <stdlib.h>          // Uses: qsort()
 
 
 //=======================================================================================
@@ -108,8 +108,10 @@ class APSorted : public APSizedArrayBase<_ElementType>
 
     APSorted();
     APSorted(const APSorted & sorted);
+    APSorted(APSorted && sorted);
     ~APSorted();
     APSorted & operator=(const APSorted & sorted);
+    APSorted & operator=(APSorted && sorted);
 
   // Converter Methods
 
@@ -162,13 +164,19 @@ class APSorted : public APSizedArrayBase<_ElementType>
 
 
   protected:
+  // Internal Types
+
+    // Called by merge_all() for an element that matches one already in the array
+    typedef void (* tMergeDupeFunc)(_ElementType ** match_pp, _ElementType * elem_p);
+
   // Internal Methods
 
     bool find_instance(const _KeyType & key, uint32_t instance, uint32_t * find_pos_p, _ElementType ** first_p, _ElementType ** last_p) const;
+    void merge_all(_ElementType * const * elems_pp, uint32_t elem_count, tMergeDupeFunc dupe_f = nullptr);
 
-  // Internal Class Methods
-
-    static int sort_compare(const void * lhs_p, const void * rhs_p);
+    static void merge_dupe_skip(_ElementType ** match_pp, _ElementType * elem_p);
+    static void merge_dupe_free(_ElementType ** match_pp, _ElementType * elem_p);
+    static void merge_dupe_replace_free(_ElementType ** match_pp, _ElementType * elem_p);
 
   };  // APSorted
 
@@ -190,12 +198,17 @@ class APSortedFree : public APSorted<_ElementType, _KeyType>
     
   // All the constructors are hidden (stupid!), so make appropriate links
     APSortedFree() : tAPSorted() {}
+    APSortedFree(const APSortedFree & sorted) : tAPSorted(sorted) {}
     APSortedFree(const APSorted<_ElementType, _KeyType, ACompareLogical<_KeyType> > & sorted) : tAPSorted(sorted) {}
+    APSortedFree(APSortedFree && sorted) : tAPSorted(static_cast<tAPSorted &&>(sorted)) {}
     explicit APSortedFree(const _ElementType ** elems_p, uint32_t elem_count, uint32_t buffer_size, bool pre_sorted = false);
     explicit APSortedFree(const _ElementType * elems_p, uint32_t elem_count, bool pre_sorted);
     explicit APSortedFree(int elem_count, ...);
 
     ~APSortedFree() { this->free_all(); }
+
+    APSortedFree & operator=(const APSortedFree & sorted)  { tAPSorted::operator=(sorted); return *this; }
+    APSortedFree & operator=(APSortedFree && sorted)       { if (this != &sorted) { this->free_all(); tAPSorted::operator=(static_cast<tAPSorted &&>(sorted)); } return *this; }
   };
 
 
@@ -216,10 +229,15 @@ class APSortedLogical : public APSorted<_ElementType, _KeyType, ACompareLogical<
     
   // All the constructors are hidden (stupid!), so make appropriate links
     APSortedLogical() : tAPSorted() {}
+    APSortedLogical(const APSortedLogical & sorted) : tAPSorted(sorted) {}
     APSortedLogical(const APSorted<_ElementType, _KeyType, ACompareLogical<_KeyType> > & sorted) : tAPSorted(sorted) {}
+    APSortedLogical(APSortedLogical && sorted) : tAPSorted(static_cast<tAPSorted &&>(sorted)) {}
     explicit APSortedLogical(const _ElementType ** elems_p, uint32_t elem_count, uint32_t buffer_size, bool pre_sorted = false);
     explicit APSortedLogical(const _ElementType * elems_p, uint32_t elem_count, bool pre_sorted);
     explicit APSortedLogical(int elem_count, ...);
+
+    APSortedLogical & operator=(const APSortedLogical & sorted)  { tAPSorted::operator=(sorted); return *this; }
+    APSortedLogical & operator=(APSortedLogical && sorted)       { tAPSorted::operator=(static_cast<tAPSorted &&>(sorted)); return *this; }
   };
 
 
@@ -240,12 +258,17 @@ class APSortedLogicalFree : public APSortedLogical<_ElementType, _KeyType>
     
   // All the constructors are hidden (stupid!), so make appropriate links
     APSortedLogicalFree() : tAPSortedLogical() {}
+    APSortedLogicalFree(const APSortedLogicalFree & sorted) : tAPSortedLogical(sorted) {}
     APSortedLogicalFree(const APSorted<_ElementType, _KeyType, ACompareLogical<_KeyType> > & sorted) : tAPSortedLogical(sorted) {}
+    APSortedLogicalFree(APSortedLogicalFree && sorted) : tAPSortedLogical(static_cast<tAPSortedLogical &&>(sorted)) {}
     explicit APSortedLogicalFree(const _ElementType ** elems_p, uint32_t elem_count, uint32_t buffer_size, bool pre_sorted = false);
     explicit APSortedLogicalFree(const _ElementType * elems_p, uint32_t elem_count, bool pre_sorted);
     explicit APSortedLogicalFree(int elem_count, ...);
 
     ~APSortedLogicalFree();
+
+    APSortedLogicalFree & operator=(const APSortedLogicalFree & sorted)  { tAPSortedLogical::operator=(sorted); return *this; }
+    APSortedLogicalFree & operator=(APSortedLogicalFree && sorted)       { if (this != &sorted) { this->free_all(); tAPSortedLogical::operator=(static_cast<tAPSortedLogical &&>(sorted)); } return *this; }
   };
 
 
@@ -285,6 +308,18 @@ inline APSorted<_ElementType, _KeyType, _CompareClass>::APSorted(const tAPSorted
   ::memcpy(this->m_array_p, sorted.m_array_p, this->m_count * sizeof(_ElementType *));
   }
 
+//---------------------------------------------------------------------------------------
+// Move constructor - takes over the internal buffer of a temporary sorted array and
+// empties it.
+// # Returns:   itself
+// Arg          sorted - temporary sorted array to take over the contents of
+// # See:       operator=(APSorted &&)
+template<class _ElementType, class _KeyType, class _CompareClass>
+inline APSorted<_ElementType, _KeyType, _CompareClass>::APSorted(tAPSorted && sorted) :
+  tAPSizedArrayBase(&sorted)
+  {
+  }
+
 //---------------------------------------------------------------------------------------
 //  Destructor
 // # Author(s):  Conan Reis
@@ -320,6 +355,25 @@ APSorted<_ElementType, _KeyType, _CompareClass> & APSorted<_ElementType, _KeyTyp
   return *this;
   }
 
+//---------------------------------------------------------------------------------------
+// Move assignment operator - frees the existing buffer and takes over the buffer of a
+// temporary sorted array.
+// # Returns:   reference to itself to allow for stringization
+// Arg          sorted - temporary sorted array to take over the contents of and empty
+// # Notes:     Just replaces any existing elements - if it is a *Free version of the
+//              class the elements are not freed first.
+// # See:       assign()
+template<class _ElementType, class _KeyType, class _CompareClass>
+inline APSorted<_ElementType, _KeyType, _CompareClass> & APSorted<_ElementType, _KeyType, _CompareClass>::operator=(tAPSorted && sorted)
+  {
+  if (this != &sorted)
+    {
+    this->assign(&sorted);
+    }
+
+  return *this;
+  }
+
 
 //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
 // Converter Methods
@@ -549,8 +603,7 @@ bool APSorted<_ElementType, _KeyType, _CompareClass>::append_absent(
 //
 // #Notes
 //   This is essentially a 'set union'.
-//   [Efficiency] Instead of just sort() - sort only the new elements then do merge sort
-//   of previous elements and new elements.
+//   Done as a single linear merge - O(n + m) - see merge_all().
 //
 // #See Also
 //   get_all() - 'set intersection', remove_all() - 'set subtraction',
@@ -563,50 +616,10 @@ void APSorted<_ElementType, _KeyType, _CompareClass>::append_absent_all(
   const tAPSorted & sorted
   )
   {
-  uint32_t sorted_length = sorted.m_count;
-
-  if (sorted_length)
+  // Appending to itself adds nothing
+  if (&sorted != this)
     {
-    uint32_t length = this->m_count;
-    uint32_t size   = this->m_size;
-
-    // An ensure_size() before all the appends could needlessly expand the size of the
-    // array if the elements are already present.
-
-    uint32_t        pos;
-    _ElementType ** array_pp     = this->m_array_p;  // for faster than data member access
-    _ElementType ** elems_pp     = sorted.m_array_p;
-    _ElementType ** elems_end_pp = elems_pp + sorted_length;
-    _ElementType ** old_array_pp;
-
-    for (; elems_pp < elems_end_pp; elems_pp++)
-      {
-      if (!find(**elems_pp, AMatch_first_found, &pos))
-        {
-        // Resize needed?
-        if (size < length + 1u)  // Needs more space
-          {
-          old_array_pp = this->m_array_p;
-
-          size            = AMemory::request_pointer_count_expand(length + 1u);
-          this->m_size    = size;
-          array_pp        = tAPArrayBase::alloc_array(this->m_size);
-          this->m_array_p = array_pp;
-          ::memcpy(array_pp, old_array_pp, pos * sizeof(_ElementType *));
-          ::memcpy(array_pp + pos + 1u, old_array_pp + pos, (length - pos) * sizeof(_ElementType *));
-          tAPArrayBase::free_array(old_array_pp);
-          }
-        else  // enough size in existing array
-          {
-          ::memmove(array_pp + pos + 1u, array_pp + pos, (length - pos) * sizeof(_ElementType *));
-          }
-
-        array_pp[pos] = const_cast<_ElementType *>(*elems_pp);  // insert element
-        length++;
-
-        this->m_count = length;
-        }
-      }
+    merge_all(sorted.m_array_p, sorted.m_count, merge_dupe_skip);
     }
   }
 
@@ -626,19 +639,17 @@ void APSorted<_ElementType, _KeyType, _CompareClass>::append_all(
   bool                              pre_sorted // = false
   )
   {
-  uint32_t length = array.get_length();
+  // Appending to itself - the merge source must not be this array's own buffer
+  if (array.get_array() == this->m_array_p)
+    {
+    tAPSorted copy(*this);
 
-  this->ensure_size(this->m_count + length);
-  ::memcpy(this->m_array_p + this->m_count, array.get_array(), length * sizeof(_ElementType *));
-  this->m_count += length;
+    merge_all(copy.m_array_p, copy.m_count);
 
-  // Check for special case where no merge is necessary
-  if ((!pre_sorted) || (this->m_count != length))
-    {
-    // $Revisit - CReis [Efficiency] Instead of just sort() - sort only the new elements if
-    // presorted, then do merge sort of previous elements and new elements.
-    sort();
+    return;
     }
+
+  append_all(const_cast<const _ElementType **>(array.get_array()), array.get_length(), pre_sorted);
   }
 
 //---------------------------------------------------------------------------------------
@@ -649,19 +660,16 @@ void APSorted<_ElementType, _KeyType, _CompareClass>::append_all(
 template<class _ElementType, class _KeyType, class _CompareClass>
 void APSorted<_ElementType, _KeyType, _CompareClass>::append_all(const tAPSorted & sorted)
   {
-  uint32_t length = sorted.get_length();
+  if (&sorted == this)
+    {
+    tAPSorted copy(sorted);
 
-  this->ensure_size(this->m_count + length);
-  ::memcpy(this->m_array_p + this->m_count, sorted.get_array(), length * sizeof(_ElementType *));
-  this->m_count += length;
+    merge_all(copy.m_array_p, copy.m_count);
 
-  // Check for special case where no merge is necessary
-  if (this->m_count != length)
-    {
-    // $Revisit - CReis [Efficiency] Instead of just sort() - sort only the new elements
-    // then do merge sort of previous elements and new elements.
-    sort();
+    return;
     }
+
+  merge_all(sorted.m_array_p, sorted.m_count);
   }
 
 //---------------------------------------------------------------------------------------
@@ -684,17 +692,39 @@ void APSorted<_ElementType, _KeyType, _CompareClass>::append_all(
   bool                  pre_sorted // = false
   )
   {
-  this->ensure_size(this->m_count + elem_count);
-  ::memcpy(this->m_array_p + this->m_count, elems_p, elem_count * sizeof(_ElementType *));
-  this->m_count += elem_count;
+  if (elem_count == 0u)
+    {
+    return;
+    }
+
+  uint32_t length = this->m_count;
 
-  // Check for special case where no merge is necessary
-  if ((!pre_sorted) || (this->m_count != elem_count))
+  // If already sorted then they can be merged straight in
+  if (pre_sorted)
     {
-    // $Revisit - CReis [Efficiency] Instead of just sort() - sort only the new elements if
-    // presorted, then do merge sort of previous elements and new elements.
+    merge_all(const_cast<_ElementType * const *>(elems_p), elem_count);
+
+    return;
+    }
+
+  // Nothing to merge with - just copy and sort
+  if (length == 0u)
+    {
+    this->ensure_size(elem_count);
+    ::memcpy(this->m_array_p, elems_p, elem_count * sizeof(_ElementType *));
+    this->m_count = elem_count;
     sort();
+
+    return;
     }
+
+  // Sort only the new elements then merge them with the existing sorted elements
+  _ElementType ** sorted_pp = tAPSizedArrayBase::alloc_array(elem_count);
+
+  ::memcpy(sorted_pp, elems_p, elem_count * sizeof(_ElementType *));
+  a_sort(sorted_pp, sorted_pp + elem_count, ASortLessPtr<_ElementType, _CompareClass>());
+  merge_all(sorted_pp, elem_count);
+  tAPSizedArrayBase::free_array(sorted_pp);
   }
 
 //---------------------------------------------------------------------------------------
@@ -719,22 +749,24 @@ void APSorted<_ElementType, _KeyType, _CompareClass>::append_all(
   {
   if (elem_count)
     {
-    this->ensure_size(this->m_count + elem_count);
-
-    uint32_t           find_pos;
+    // Gather pointers to the elements, sort them if needed and merge them in
+    _ElementType **      sorted_pp   = tAPSizedArrayBase::alloc_array(elem_count);
+    _ElementType **      dest_pp     = sorted_pp;
     const _ElementType * elem_p      = elems_p;
     const _ElementType * elems_end_p = elems_p + elem_count;
-    _ElementType **      array_p     = this->m_array_p;  // For quick access
 
-    // $Revisit - CReis [Efficiency] Appropriately use 'pre_sorted'
+    for (; elem_p < elems_end_p; elem_p++, dest_pp++)
+      {
+      *dest_pp = const_cast<_ElementType *>(elem_p);
+      }
 
-    for(; elem_p < elems_end_p; elem_p++)
+    if (!pre_sorted)
       {
-      find(*elem_p, AMatch_first_found, &find_pos);
-      ::memmove(array_p + find_pos + 1u, array_p + find_pos, (this->m_count - find_pos) * sizeof(_ElementType *));
-      array_p[find_pos] = const_cast<_ElementType *>(elem_p);  // insert element
-      this->m_count++;
+      a_sort(sorted_pp, sorted_pp + elem_count, ASortLessPtr<_ElementType, _CompareClass>());
       }
+
+    merge_all(sorted_pp, elem_count);
+    tAPSizedArrayBase::free_array(sorted_pp);
     }
   }
 
@@ -787,6 +819,7 @@ _ElementType * APSorted<_ElementType, _KeyType, _CompareClass>::append_replace(
 //
 // #Notes
 //   This is essentially a form of a 'set union'.
+//   Done as a single linear merge - O(n + m) - see merge_all().
 //
 // #See Also
 //   get_all() - 'set intersection', remove_all() - 'set subtraction',
@@ -799,56 +832,10 @@ void APSorted<_ElementType, _KeyType, _CompareClass>::append_replace_free_all(
   const tAPSorted & sorted
   )
   {
-  uint32_t sorted_length = sorted.m_count;
-
-  if (sorted_length)
+  // Replacing elements with themselves would free them
+  if (&sorted != this)
     {
-    uint32_t length = this->m_count;
-    uint32_t size   = this->m_size;
-
-    // An ensure_size() before all the appends could needlessly expand the size of the
-    // array if the elements are already present.
-
-    uint32_t        pos;
-    _ElementType ** array_pp     = this->m_array_p;  // for faster than data member access
-    _ElementType ** elems_pp     = sorted.m_array_p;
-    _ElementType ** elems_end_pp = elems_pp + sorted_length;
-    _ElementType ** old_array_pp;
-
-    for (; elems_pp < elems_end_pp; elems_pp++)
-      {
-      if (!find(**elems_pp, AMatch_first_found, &pos))
-        {
-        // Resize needed?
-        if (size < length + 1u)  // Needs more space
-          {
-          old_array_pp = this->m_array_p;
-
-          size            = AMemory::request_pointer_count_expand(length + 1u);
-          this->m_size    = size;
-          array_pp        = tAPArrayBase::alloc_array(this->m_size);
-          this->m_array_p = array_pp;
-          ::memcpy(array_pp, old_array_pp, pos * sizeof(_ElementType *));
-          ::memcpy(array_pp + pos + 1u, old_array_pp + pos, (length - pos) * sizeof(_ElementType *));
-          tAPArrayBase::free_array(old_array_pp);
-          }
-        else  // enough size in existing array
-          {
-          ::memmove(array_pp + pos + 1u, array_pp + pos, (length - pos) * sizeof(_ElementType *));
-          }
-
-        array_pp[pos] = const_cast<_ElementType *>(*elems_pp);  // insert element
-        length++;
-
-        this->m_count = length;
-        }
-      else
-        {
-        // Element already present - free it and replace with new element
-        delete array_pp[pos];
-        array_pp[pos] = *elems_pp;
-        }
-      }
+    merge_all(sorted.m_array_p, sorted.m_count, merge_dupe_replace_free);
     }
   }
 
@@ -1479,6 +1466,7 @@ uint32_t APSorted<_ElementType, _KeyType, _CompareClass>::remove_all(
 // # See:       pop_all(), free_all()
 //              get_all() - 'set intersection', append_absent_all() - 'set union'
 // # Notes:     This method is effectively a 'set subtraction'.
+//              Both arrays are sorted so this is done in a single linear pass - O(n + m).
 //              This method performs index range checking when A_BOUNDS_CHECK is defined.
 //              If an index is out of bounds, a AEx<APSorted<>> exception is thrown.
 //              A_BOUNDS_CHECK is defined by default in debug mode and turned off in
@@ -1495,8 +1483,12 @@ uint32_t APSorted<_ElementType, _KeyType, _CompareClass>::remove_all(
 
   if (this->m_count && sorted.m_count)
     {
-    _ElementType ** array_p     = sorted.m_array_p;  // for faster than data member access
-    _ElementType ** array_end_p = array_p + sorted.m_count;
+    if (&sorted == this)
+      {
+      tAPSorted copy(sorted);
+
+      return remove_all(copy, start_pos, end_pos);
+      }
 
     if (end_pos == ALength_remainder)
       {
@@ -1505,14 +1497,40 @@ uint32_t APSorted<_ElementType, _KeyType, _CompareClass>::remove_all(
 
     APARRAY_BOUNDS_CHECK_RANGE(start_pos, end_pos);
 
-    for (; array_p < array_end_p; array_p++)
+    ptrdiff_t       result;
+    _ElementType ** keys_pp      = sorted.m_array_p;  // for faster than data member access
+    _ElementType ** keys_end_pp  = keys_pp + sorted.m_count;
+    _ElementType ** array_pp     = this->m_array_p + start_pos;
+    _ElementType ** array_end_pp = this->m_array_p + end_pos + 1u;
+    _ElementType ** dest_pp      = array_pp;
+
+    // Each key removes at most one matching element - kept elements are compacted in place
+    for (; array_pp < array_end_pp; array_pp++)
       {
-      if (remove(**array_p, AMatch_first_found, nullptr, start_pos, end_pos))
+      result = 1;
+
+      while ((keys_pp < keys_end_pp) && ((result = _CompareClass::comparison(**keys_pp, **array_pp)) < 0))
         {
-        end_pos--;
-        total_removed++;
+        keys_pp++;
+        }
+
+      if (result == 0)
+        {
+        keys_pp++;
+        }
+      else
+        {
+        *dest_pp++ = *array_pp;
         }
       }
+
+    total_removed = uint32_t(array_end_pp - dest_pp);
+
+    if (total_removed)
+      {
+      ::memmove(dest_pp, array_end_pp, (this->m_count - end_pos - 1u) * sizeof(_ElementType *));
+      this->m_count -= total_removed;
+      }
     }
      
   return total_removed;
@@ -1531,6 +1549,7 @@ uint32_t APSorted<_ElementType, _KeyType, _CompareClass>::remove_all(
 // # See:       pop_all(), free_all()
 //              get_all() - 'set intersection', append_absent_all() - 'set union'
 // # Notes:     This method is effectively a 'set subtraction'.
+//              Both arrays are sorted so this is done in a single linear pass - O(n + m).
 //              This method performs index range checking when A_BOUNDS_CHECK is defined.
 //              If an index is out of bounds, a AEx<APSorted<>> exception is thrown.
 //              A_BOUNDS_CHECK is defined by default in debug mode and turned off in
@@ -1547,9 +1566,12 @@ uint32_t APSorted<_ElementType, _KeyType, _CompareClass>::remove_all_all(
 
   if (this->m_count && sorted.m_count)
     {
-    uint32_t        remove_count;
-    _ElementType ** array_p     = sorted.m_array_p;  // for faster than data member access
-    _ElementType ** array_end_p = array_p + sorted.m_count;
+    if (&sorted == this)
+      {
+      tAPSorted copy(sorted);
+
+      return remove_all_all(copy, start_pos, end_pos);
+      }
 
     if (end_pos == ALength_remainder)
       {
@@ -1558,13 +1580,38 @@ uint32_t APSorted<_ElementType, _KeyType, _CompareClass>::remove_all_all(
 
     APARRAY_BOUNDS_CHECK_RANGE(start_pos, end_pos);
 
-    for (; array_p < array_end_p; array_p++)
+    ptrdiff_t       result;
+    _ElementType ** keys_pp      = sorted.m_array_p;  // for faster than data member access
+    _ElementType ** keys_end_pp  = keys_pp + sorted.m_count;
+    _ElementType ** array_pp     = this->m_array_p + start_pos;
+    _ElementType ** array_end_pp = this->m_array_p + end_pos + 1u;
+    _ElementType ** dest_pp      = array_pp;
+
+    // A key removes every matching element - kept elements are compacted in place
+    for (; array_pp < array_end_pp; array_pp++)
+      {
+      result = 1;
+
+      while ((keys_pp < keys_end_pp) && ((result = _CompareClass::comparison(**keys_pp, **array_pp)) < 0))
+        {
+        keys_pp++;
+        }
+
+      if (result != 0)
+        {
+        *dest_pp++ = *array_pp;
+        }
+      }
+
+    total_removed = uint32_t(array_end_pp - dest_pp);
+
+    if (total_removed)
       {
-      remove_count   = remove_all(**array_p, start_pos, end_pos);
-      end_pos       -= remove_count;
-      total_removed += remove_count;
+      ::memmove(dest_pp, array_end_pp, (this->m_count - end_pos - 1u) * sizeof(_ElementType *));
+      this->m_count -= total_removed;
       }
     }
+
   return total_removed;
   }
 
@@ -1586,55 +1633,9 @@ void APSorted<_ElementType, _KeyType, _CompareClass>::xfer_absent_all_free_dupes
   tAPSorted * sorted_p
   )
   {
-  uint32_t sorted_length = sorted_p->m_count;
-
-  if (sorted_length)
+  if (sorted_p->m_count && (sorted_p != this))
     {
-    uint32_t length = this->m_count;
-    uint32_t size   = this->m_size;
-
-    // An ensure_size() before all the appends could needlessly expand the size of the
-    // array if the elements are already present.
-
-    uint32_t        pos;
-    _ElementType ** array_pp     = this->m_array_p;  // for faster than data member access
-    _ElementType ** elems_pp     = sorted_p->m_array_p;
-    _ElementType ** elems_end_pp = elems_pp + sorted_length;
-    _ElementType ** old_array_pp;
-
-    for (; elems_pp < elems_end_pp; elems_pp++)
-      {
-      if (!find(**elems_pp, AMatch_first_found, &pos))
-        {
-        // Resize needed?
-        if (size < length + 1u)  // Needs more space
-          {
-          old_array_pp = this->m_array_p;
-
-          size            = AMemory::request_pointer_count_expand(length + 1u);
-          this->m_size    = size;
-          array_pp        = tAPArrayBase::alloc_array(this->m_size);
-          this->m_array_p = array_pp;
-          ::memcpy(array_pp, old_array_pp, pos * sizeof(_ElementType *));
-          ::memcpy(array_pp + pos + 1u, old_array_pp + pos, (length - pos) * sizeof(_ElementType *));
-          tAPArrayBase::free_array(old_array_pp);
-          }
-        else  // enough size in existing array
-          {
-          ::memmove(array_pp + pos + 1u, array_pp + pos, (length - pos) * sizeof(_ElementType *));
-          }
-
-        array_pp[pos] = const_cast<_ElementType *>(*elems_pp);  // insert element
-        length++;
-
-        this->m_count = length;
-        }
-      else
-        {
-        // Element already in array so free it
-        delete *elems_pp;
-        }
-      }
+    merge_all(sorted_p->m_array_p, sorted_p->m_count, merge_dupe_free);
 
     // Empty originating array
     sorted_p->m_count = 0u;
@@ -2319,6 +2320,163 @@ bool APSorted<_ElementType, _KeyType, _CompareClass>::find_instance(
   return true;
   }
 
+//---------------------------------------------------------------------------------------
+// #Description
+//   Merges elem_count sorted elements into the current array with a single linear pass
+//   - O(n + m) rather than a binary search and memmove for each element.
+//
+// #Notes
+//   The buffer is only reallocated if the merged count exceeds the current size.
+//   Otherwise the existing elements are shifted to the end of the buffer and merged
+//   forward in place - the write position never passes the next unread existing element.
+//
+//   If dupe_f is nullptr all elements are added and new elements go after any existing
+//   matching elements.  Otherwise an element matching one already in the array (or one
+//   just merged in) is not added and dupe_f() is called with it and the address of the
+//   match instead.
+//
+// #Modifiers protected
+// #See Also  append_all(), append_absent_all(), xfer_absent_all_free_dupes()
+template<class _ElementType, class _KeyType, class _CompareClass>
+void APSorted<_ElementType, _KeyType, _CompareClass>::merge_all(
+  // sorted array of pointers to elements to merge - must not be this array's own buffer
+  _ElementType * const * elems_pp,
+  // number of elements in elems_pp
+  uint32_t elem_count,
+  // function called for matching elements or nullptr to keep all elements
+  tMergeDupeFunc dupe_f // = nullptr
+  )
+  {
+  if (elem_count == 0u)
+    {
+    return;
+    }
+
+  uint32_t        length       = this->m_count;
+  uint32_t        needed       = length + elem_count;
+  _ElementType ** old_array_pp = nullptr;
+  _ElementType ** src_pp;
+
+  if (needed > this->m_size)
+    {
+    // Merge into a new buffer
+    old_array_pp    = this->m_array_p;
+    src_pp          = old_array_pp;
+    this->m_size    = AMemory::request_pointer_count_expand(needed);
+    this->m_array_p = tAPSizedArrayBase::alloc_array(this->m_size);
+    }
+  else
+    {
+    // Merge in place - move existing elements out of the way to the end of the buffer
+    src_pp = this->m_array_p + this->m_size - length;
+
+    if (length)
+      {
+      ::memmove(src_pp, this->m_array_p, length * sizeof(_ElementType *));
+      }
+    }
+
+  ptrdiff_t              result;
+  bool                   added_last   = false;
+  _ElementType *         elem_p;
+  _ElementType **        src_end_pp   = src_pp + length;
+  _ElementType **        dest_pp      = this->m_array_p;
+  _ElementType * const * elems_end_pp = elems_pp + elem_count;
+
+  while (elems_pp < elems_end_pp)
+    {
+    elem_p = *elems_pp;
+    result = (src_pp < src_end_pp) ? _CompareClass::comparison(**src_pp, *elem_p) : 1;
+
+    // Existing element comes first
+    if ((result < 0) || ((result == 0) && (dupe_f == nullptr)))
+      {
+      *dest_pp++ = *src_pp++;
+      added_last = false;
+      continue;
+      }
+
+    elems_pp++;
+
+    if (dupe_f)
+      {
+      // Matches existing element
+      if (result == 0)
+        {
+        (dupe_f)(src_pp, elem_p);
+        continue;
+        }
+
+      // Matches element just merged in
+      if (added_last && _CompareClass::equals(**(dest_pp - 1), *elem_p))
+        {
+        (dupe_f)(dest_pp - 1, elem_p);
+        continue;
+        }
+      }
+
+    *dest_pp++ = elem_p;
+    added_last = true;
+    }
+
+  // Any remaining existing elements
+  if (src_pp < src_end_pp)
+    {
+    length = uint32_t(src_end_pp - src_pp);
+
+    if (dest_pp != src_pp)
+      {
+      ::memmove(dest_pp, src_pp, length * sizeof(_ElementType *));
+      }
+
+    dest_pp += length;
+    }
+
+  this->m_count = uint32_t(dest_pp - this->m_array_p);
+
+  if (old_array_pp)
+    {
+    tAPSizedArrayBase::free_array(old_array_pp);
+    }
+  }
+
+//---------------------------------------------------------------------------------------
+// Matching element handler for merge_all() - the new element is not added.
+// #Modifiers protected, static
+template<class _ElementType, class _KeyType, class _CompareClass>
+void APSorted<_ElementType, _KeyType, _CompareClass>::merge_dupe_skip(
+  _ElementType ** /*match_pp*/,
+  _ElementType *  /*elem_p*/
+  )
+  {
+  }
+
+//---------------------------------------------------------------------------------------
+// Matching element handler for merge_all() - the new element is freed.
+// #Modifiers protected, static
+template<class _ElementType, class _KeyType, class _CompareClass>
+void APSorted<_ElementType, _KeyType, _CompareClass>::merge_dupe_free(
+  _ElementType ** /*match_pp*/,
+  _ElementType *  elem_p
+  )
+  {
+  delete elem_p;
+  }
+
+//---------------------------------------------------------------------------------------
+// Matching element handler for merge_all() - the matching element is freed and replaced
+// with the new element.
+// #Modifiers protected, static
+template<class _ElementType, class _KeyType, class _CompareClass>
+void APSorted<_ElementType, _KeyType, _CompareClass>::merge_dupe_replace_free(
+  _ElementType ** match_pp,
+  _ElementType *  elem_p
+  )
+  {
+  delete *match_pp;
+  *match_pp = elem_p;
+  }
+
 //---------------------------------------------------------------------------------------
 //  Sorts the elements in the APSorted from start_pos to end_pos.
 // Arg          start_pos - first position to start sorting  (Default 0)
@@ -2326,7 +2484,7 @@ bool APSorted<_ElementType, _KeyType, _CompareClass>::find_instance(
 //              set to last index position of the array (length - 1).
 //              (Default ALength_remainder)
 // # Examples:  sorted.sort();
-// # Notes:     calls sort_compare() which calls _CompareClass::comparison()
+// # Notes:     uses a_sort() which inlines _CompareClass::comparison()
 //              This method performs index range checking when A_BOUNDS_CHECK is defined.
 //              If an index is out of bounds, a AEx<APSorted<>> exception is thrown.
 //              A_BOUNDS_CHECK is defined by default in debug mode and turned off in
@@ -2338,7 +2496,6 @@ inline void APSorted<_ElementType, _KeyType, _CompareClass>::sort(
   uint32_t end_pos    // = ALength_remainder
   )
   {
-  // $Revisit - CReis Efficiency: Could probably get more speed by writing a custom version of qsort.
   if (this->m_count > 1u)
     {
     if (end_pos == ALength_remainder)
@@ -2348,29 +2505,11 @@ inline void APSorted<_ElementType, _KeyType, _CompareClass>::sort(
 
     APARRAY_BOUNDS_CHECK_RANGE(start_pos, end_pos);
   
-    qsort(this->m_array_p + start_pos, end_pos - start_pos + 1, sizeof(_ElementType *), sort_compare);
+    a_sort(this->m_array_p + start_pos, this->m_array_p + end_pos + 1u, ASortLessPtr<_ElementType, _CompareClass>());
     }
   }
 
 
-//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
-// Class Internal Methods
-//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
-
-//---------------------------------------------------------------------------------------
-//  Used by qsort() in the sort() method
-// # Author(s):  Conan Reis
-template<class _ElementType, class _KeyType, class _CompareClass>
-int APSorted<_ElementType, _KeyType, _CompareClass>::sort_compare(
-  const void * lhs_p,
-  const void * rhs_p
-  )
-  {
-  return A_INT_AS_DIFF32(
-    _CompareClass::comparison(**((_ElementType **)lhs_p), **((_ElementType **)rhs_p)));
-  }
-
-
 //#######################################################################################
 // APSortedLogical
 //#######################################################################################
@@ -0,0 +1,124 @@
+//=======================================================================================
+// Agog Labs C++ library.
+// Copyright (c) 2015 Agog Labs Inc.,
+// All rights reserved.
+//
+// Size-class slab allocator that may be plugged into AMemory
+// # Notes:
+//=======================================================================================
+
+
+#ifndef __ASLABALLOCATOR_HPP
+#define __ASLABALLOCATOR_HPP
+
+
+//=======================================================================================
+// Includes
+//=======================================================================================
+
+#include "AgogCore/AMemory.hpp"
+
+
+//=======================================================================================
+// Global Macros / Defines
+//=======================================================================================
+
+enum
+  {
+  // Largest request that is slab allocated - anything larger goes to backing allocator
+  ASlab_size_max      = 2048u,
+
+  // Number of size classes from 16 bytes up to ASlab_size_max bytes
+  ASlab_class_count   = 24u,
+
+  // Each page holds objects of a single size class
+  ASlab_page_shift    = 14u,
+  ASlab_page_bytes    = 1u << ASlab_page_shift,  // 16KB
+
+  // Pages are obtained from the backing allocator a region at a time
+  ASlab_region_pages  = 64u,
+  ASlab_region_bytes  = ASlab_region_pages * ASlab_page_bytes,  // 1MB
+
+  // Maximum number of regions - once reached, small requests go to backing allocator
+  ASlab_region_max    = 512u
+  };
+
+
+//=======================================================================================
+// Global Structures
+//=======================================================================================
+
+//---------------------------------------------------------------------------------------
+// Segregated-fit slab allocator.
+//
+// Small requests (up to ASlab_size_max bytes) are rounded up to one of a fixed set of
+// size classes and carved out of pages that each hold objects of only one size class.
+// Freed objects are threaded onto an intrusive per-class free list so that both
+// malloc() and free() are a handful of instructions in the common case.  Larger requests
+// are passed straight through to the backing allocator.
+//
+// Pages are grouped into regions which are obtained from the backing allocator on
+// demand.  Ownership of a pointer is determined by a binary search over the (sorted)
+// region address ranges so any memory that did not come from a region - for example
+// memory allocated before install() was called - is correctly handed back to the
+// backing free function.
+//
+// Since request_byte_size() reports the true rounded size of each size class, growable
+// structures such as AString and APArray will automatically use the slack at the end of
+// each allocation and is_using_fixed_size_pools() will return true once installed.
+//
+// # Examples:
+//   // Use the current AMemory functions as the backing allocator
+//   ASlabAllocator::install();
+//
+//   // Layer on top of an engine allocator
+//   ASlabAllocator::install(&Agog::malloc_func, &Agog::free_func);
+//
+// # Notes:
+//   malloc() and free() are thread-safe - each size class has its own lock so threads
+//   only contend when they use the same size class, and the region list has a separate
+//   lock that is held just long enough to find which region a freed pointer is in.
+//   install() and deinitialize() are not thread-safe.
+//   Memory handed out by the allocator must not be freed after it has been replaced by a
+//   different set of AMemory functions so it should generally be installed once at
+//   startup and left in place.
+class ASlabAllocator
+  {
+  public:
+
+  // Class Methods
+
+    static void     install(tAMallocFunc backing_malloc_func = AMemory::get_malloc_func(), tAFreeFunc backing_free_func = AMemory::get_free_func());
+    static void     deinitialize();
+    static bool     is_installed()                                  { return ms_backing_malloc_func != nullptr; }
+
+    // AMemory functions - see AMemory::override_functions()
+
+    static void *   malloc(size_t size, const char * name_p);
+    static void     free(void * mem_p);
+    static uint32_t request_byte_size(uint32_t size_requested);
+
+    // Statistics
+
+    static uint32_t get_bytes_reserved();
+    static uint32_t get_bytes_used();
+    static uint32_t get_region_count();
+    static void     print_stats();
+
+  protected:
+
+  // Class Data
+
+    // Allocator used to get regions and for any requests too large to be slab allocated
+    static tAMallocFunc ms_backing_malloc_func;
+    static tAFreeFunc   ms_backing_free_func;
+
+    // AMemory functions that were in place before install() - restored by deinitialize()
+    static tAMallocFunc      ms_prev_malloc_func;
+    static tAFreeFunc        ms_prev_free_func;
+    static tAReqByteSizeFunc ms_prev_req_byte_size_func;
+
+  };  // ASlabAllocator
+
+
+#endif  // __ASLABALLOCATOR_HPP
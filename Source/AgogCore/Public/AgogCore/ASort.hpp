@@ -0,0 +1,506 @@
+//=======================================================================================
+// Agog Labs C++ library.
+// Copyright (c) 2015 Agog Labs Inc.,
+// All rights reserved.
+//
+// In-place sorting function templates used by the array classes
+// # Notes:
+//=======================================================================================
+
+
+#ifndef __ASORT_HPP
+#define __ASORT_HPP
+
+
+//=======================================================================================
+// Includes
+//=======================================================================================
+
+#include "AgogCore/AMath.hpp"
+
+
+//=======================================================================================
+// Global Macros / Defines
+//=======================================================================================
+
+enum
+  {
+  // Ranges smaller than this are insertion sorted
+  ASort_insertion_max    = 24,
+
+  // Ranges larger than this use the pseudo median of 9 elements as the pivot rather than
+  // the median of 3
+  ASort_ninther_min      = 128,
+
+  // Number of element moves after which a partial insertion sort gives up
+  ASort_partial_move_max = 8
+  };
+
+
+//=======================================================================================
+// Global Structures
+//=======================================================================================
+
+//---------------------------------------------------------------------------------------
+// Less-than functor for arrays of pointers to elements such as APArray and APSorted -
+// wraps _CompareClass::comparison() so that it can be inlined by a_sort().
+template<class _ElementType, class _CompareClass>
+struct ASortLessPtr
+  {
+  bool operator()(const _ElementType * lhs_p, const _ElementType * rhs_p) const
+    {
+    return _CompareClass::comparison(*lhs_p, *rhs_p) < 0;
+    }
+  };
+
+//---------------------------------------------------------------------------------------
+// Less-than functor for arrays of elements such as AVCompactSorted - wraps
+// _CompareClass::comparison() so that it can be inlined by a_sort().
+template<class _ElementType, class _CompareClass>
+struct ASortLess
+  {
+  bool operator()(const _ElementType & lhs, const _ElementType & rhs) const
+    {
+    return _CompareClass::comparison(lhs, rhs) < 0;
+    }
+  };
+
+
+//=======================================================================================
+// Function Templates
+//=======================================================================================
+
+//---------------------------------------------------------------------------------------
+// Insertion sorts the range [first_p, end_p).
+template<class _ElementType, class _LessType>
+inline void a_sort_insertion(
+  _ElementType * first_p,
+  _ElementType * end_p,
+  _LessType      is_less
+  )
+  {
+  _ElementType * cur_p;
+  _ElementType * sift_p;
+
+  for (cur_p = first_p + 1; cur_p < end_p; cur_p++)
+    {
+    if (is_less(*cur_p, cur_p[-1]))
+      {
+      _ElementType elem(*cur_p);
+
+      sift_p = cur_p;
+
+      do
+        {
+        *sift_p = sift_p[-1];
+        sift_p--;
+        }
+      while ((sift_p != first_p) && is_less(elem, sift_p[-1]));
+
+      *sift_p = elem;
+      }
+    }
+  }
+
+//---------------------------------------------------------------------------------------
+// Insertion sorts the range [first_p, end_p) assuming that the element before first_p is
+// not greater than any element in the range - so the inner loop needs no bounds test.
+template<class _ElementType, class _LessType>
+inline void a_sort_insertion_unguarded(
+  _ElementType * first_p,
+  _ElementType * end_p,
+  _LessType      is_less
+  )
+  {
+  _ElementType * cur_p;
+  _ElementType * sift_p;
+
+  for (cur_p = first_p + 1; cur_p < end_p; cur_p++)
+    {
+    if (is_less(*cur_p, cur_p[-1]))
+      {
+      _ElementType elem(*cur_p);
+
+      sift_p = cur_p;
+
+      do
+        {
+        *sift_p = sift_p[-1];
+        sift_p--;
+        }
+      while (is_less(elem, sift_p[-1]));
+
+      *sift_p = elem;
+      }
+    }
+  }
+
+//---------------------------------------------------------------------------------------
+// Attempts to insertion sort the range [first_p, end_p) - giving up if more than a few
+// elements need to be moved.
+// # Returns:  true if the range is now sorted and false if it gave up
+template<class _ElementType, class _LessType>
+inline bool a_sort_insertion_partial(
+  _ElementType * first_p,
+  _ElementType * end_p,
+  _LessType      is_less
+  )
+  {
+  ptrdiff_t      moves = 0;
+  _ElementType * cur_p;
+  _ElementType * sift_p;
+
+  for (cur_p = first_p + 1; cur_p < end_p; cur_p++)
+    {
+    if (moves > ASort_partial_move_max)
+      {
+      return false;
+      }
+
+    if (is_less(*cur_p, cur_p[-1]))
+      {
+      _ElementType elem(*cur_p);
+
+      sift_p = cur_p;
+
+      do
+        {
+        *sift_p = sift_p[-1];
+        sift_p--;
+        }
+      while ((sift_p != first_p) && is_less(elem, sift_p[-1]));
+
+      *sift_p = elem;
+      moves  += cur_p - sift_p;
+      }
+    }
+
+  return true;
+  }
+
+//---------------------------------------------------------------------------------------
+// Heap sorts the range [first_p, end_p) - used when quicksort partitioning keeps going
+// badly so that the worst case stays O(n log n).
+template<class _ElementType, class _LessType>
+void a_sort_heap(
+  _ElementType * first_p,
+  _ElementType * end_p,
+  _LessType      is_less
+  )
+  {
+  ptrdiff_t length = end_p - first_p;
+  ptrdiff_t idx    = length >> 1;
+  ptrdiff_t parent;
+  ptrdiff_t child;
+
+  // Build max heap and then repeatedly move the largest element to the end
+  while (length > 1)
+    {
+    if (idx > 0)
+      {
+      idx--;
+      }
+    else
+      {
+      length--;
+      a_swap(first_p[0], first_p[length]);
+      }
+
+    _ElementType elem(first_p[idx]);
+
+    parent = idx;
+    child  = (parent << 1) + 1;
+
+    while (child < length)
+      {
+      if (((child + 1) < length) && is_less(first_p[child], first_p[child + 1]))
+        {
+        child++;
+        }
+
+      if (!is_less(elem, first_p[child]))
+        {
+        break;
+        }
+
+      first_p[parent] = first_p[child];
+      parent          = child;
+      child           = (parent << 1) + 1;
+      }
+
+    first_p[parent] = elem;
+    }
+  }
+
+//---------------------------------------------------------------------------------------
+// Sorts 3 elements in place.
+template<class _ElementType, class _LessType>
+inline void a_sort3(
+  _ElementType * a_p,
+  _ElementType * b_p,
+  _ElementType * c_p,
+  _LessType      is_less
+  )
+  {
+  if (is_less(*b_p, *a_p)) { a_swap(*a_p, *b_p); }
+  if (is_less(*c_p, *b_p)) { a_swap(*b_p, *c_p); }
+  if (is_less(*b_p, *a_p)) { a_swap(*a_p, *b_p); }
+  }
+
+//---------------------------------------------------------------------------------------
+// Partitions [first_p, end_p) around the pivot *first_p with the elements equal to the
+// pivot going to the right.
+// # Returns:  final position of the pivot
+// Arg         partitioned_p - set to true if no elements needed to be swapped
+template<class _ElementType, class _LessType>
+_ElementType * a_sort_partition_right(
+  _ElementType * first_p,
+  _ElementType * end_p,
+  _LessType      is_less,
+  bool *         partitioned_p
+  )
+  {
+  _ElementType   pivot(*first_p);
+  _ElementType * left_p  = first_p;
+  _ElementType * right_p = end_p;
+
+  // The median of 3 pivot selection guarantees that an element not less than the pivot
+  // exists on the right so the first scan needs no bounds test.
+  while (is_less(*++left_p, pivot)) {}
+
+  // If nothing has moved yet there may be no element less than the pivot on the left
+  if ((left_p - 1) == first_p)
+    {
+    while ((left_p < right_p) && !is_less(*--right_p, pivot)) {}
+    }
+  else
+    {
+    while (!is_less(*--right_p, pivot)) {}
+    }
+
+  *partitioned_p = left_p >= right_p;
+
+  while (left_p < right_p)
+    {
+    a_swap(*left_p, *right_p);
+    while (is_less(*++left_p, pivot)) {}
+    while (!is_less(*--right_p, pivot)) {}
+    }
+
+  _ElementType * pivot_p = left_p - 1;
+
+  *first_p = *pivot_p;
+  *pivot_p = pivot;
+
+  return pivot_p;
+  }
+
+//---------------------------------------------------------------------------------------
+// Partitions [first_p, end_p) around the pivot *first_p with the elements equal to the
+// pivot going to the left.  Used when the range is known to have many elements equal to
+// the pivot - they then need no further sorting.
+// # Returns:  final position of the pivot
+template<class _ElementType, class _LessType>
+_ElementType * a_sort_partition_left(
+  _ElementType * first_p,
+  _ElementType * end_p,
+  _LessType      is_less
+  )
+  {
+  _ElementType   pivot(*first_p);
+  _ElementType * left_p  = first_p;
+  _ElementType * right_p = end_p;
+
+  while (is_less(pivot, *--right_p)) {}
+
+  if ((right_p + 1) == end_p)
+    {
+    while ((left_p < right_p) && !is_less(pivot, *++left_p)) {}
+    }
+  else
+    {
+    while (!is_less(pivot, *++left_p)) {}
+    }
+
+  while (left_p < right_p)
+    {
+    a_swap(*left_p, *right_p);
+    while (is_less(pivot, *--right_p)) {}
+    while (!is_less(pivot, *++left_p)) {}
+    }
+
+  *first_p = *right_p;
+  *right_p = pivot;
+
+  return right_p;
+  }
+
+//---------------------------------------------------------------------------------------
+// Main pattern-defeating quicksort loop - see a_sort().
+// Arg         bad_allowed - number of badly unbalanced partitions allowed before switching
+//             to heap sort
+// Arg         leftmost - true if [first_p, end_p) is the leftmost range - otherwise the
+//             element before first_p is not greater than any element in the range.
+template<class _ElementType, class _LessType>
+void a_sort_loop(
+  _ElementType * first_p,
+  _ElementType * end_p,
+  _LessType      is_less,
+  uint32_t       bad_allowed,
+  bool           leftmost
+  )
+  {
+  ptrdiff_t      length;
+  ptrdiff_t      half;
+  ptrdiff_t      left_length;
+  ptrdiff_t      right_length;
+  bool           partitioned;
+  _ElementType * pivot_p;
+
+  while (true)
+    {
+    length = end_p - first_p;
+
+    if (length < ASort_insertion_max)
+      {
+      if (leftmost)
+        {
+        a_sort_insertion(first_p, end_p, is_less);
+        }
+      else
+        {
+        a_sort_insertion_unguarded(first_p, end_p, is_less);
+        }
+
+      return;
+      }
+
+    // Choose pivot as median of 3 or pseudo median of 9 (Tukey's ninther) and move it to
+    // the start of the range.
+    half = length >> 1;
+
+    if (length > ASort_ninther_min)
+      {
+      a_sort3(first_p, first_p + half, end_p - 1, is_less);
+      a_sort3(first_p + 1, first_p + (half - 1), end_p - 2, is_less);
+      a_sort3(first_p + 2, first_p + (half + 1), end_p - 3, is_less);
+      a_sort3(first_p + (half - 1), first_p + half, first_p + (half + 1), is_less);
+      a_swap(*first_p, first_p[half]);
+      }
+    else
+      {
+      a_sort3(first_p + half, first_p, end_p - 1, is_less);
+      }
+
+    // If the element before this range is equal to the pivot then all the elements equal
+    // to the pivot can be put on the left where they need no more sorting.  Prevents
+    // quadratic behaviour with many equal elements.
+    if (!leftmost && !is_less(first_p[-1], *first_p))
+      {
+      first_p = a_sort_partition_left(first_p, end_p, is_less) + 1;
+      continue;
+      }
+
+    pivot_p      = a_sort_partition_right(first_p, end_p, is_less, &partitioned);
+    left_length  = pivot_p - first_p;
+    right_length = end_p - (pivot_p + 1);
+
+    if ((left_length < (length >> 3)) || (right_length < (length >> 3)))
+      {
+      // Highly unbalanced partition - after too many switch to heap sort
+      if (--bad_allowed == 0u)
+        {
+        a_sort_heap(first_p, end_p, is_less);
+
+        return;
+        }
+
+      // Otherwise shuffle some elements to break up any patterns causing it
+      if (left_length >= ASort_insertion_max)
+        {
+        a_swap(*first_p, first_p[left_length >> 2]);
+        a_swap(pivot_p[-1], pivot_p[-(left_length >> 2)]);
+
+        if (left_length > ASort_ninther_min)
+          {
+          a_swap(first_p[1], first_p[(left_length >> 2) + 1]);
+          a_swap(first_p[2], first_p[(left_length >> 2) + 2]);
+          a_swap(pivot_p[-2], pivot_p[-((left_length >> 2) + 1)]);
+          a_swap(pivot_p[-3], pivot_p[-((left_length >> 2) + 2)]);
+          }
+        }
+
+      if (right_length >= ASort_insertion_max)
+        {
+        a_swap(pivot_p[1], pivot_p[1 + (right_length >> 2)]);
+        a_swap(end_p[-1], end_p[-(right_length >> 2)]);
+
+        if (right_length > ASort_ninther_min)
+          {
+          a_swap(pivot_p[2], pivot_p[2 + (right_length >> 2)]);
+          a_swap(pivot_p[3], pivot_p[3 + (right_length >> 2)]);
+          a_swap(end_p[-2], end_p[-(1 + (right_length >> 2))]);
+          a_swap(end_p[-3], end_p[-(2 + (right_length >> 2))]);
+          }
+        }
+      }
+    else
+      {
+      // If already partitioned the range is likely already sorted (or nearly so) - try
+      // cheap insertion sorts which give up if there is too much to do.
+      if (partitioned
+        && a_sort_insertion_partial(first_p, pivot_p, is_less)
+        && a_sort_insertion_partial(pivot_p + 1, end_p, is_less))
+        {
+        return;
+        }
+      }
+
+    // Recurse into the left part and loop on the right part
+    a_sort_loop(first_p, pivot_p, is_less, bad_allowed, leftmost);
+    first_p  = pivot_p + 1;
+    leftmost = false;
+    }
+  }
+
+//---------------------------------------------------------------------------------------
+// Sorts the range [first_p, end_p) in place using pattern-defeating quicksort - an
+// introsort variant that is O(n log n) in the worst case, O(n) for ranges that are
+// already sorted, reverse sorted or all equal and that does not degrade with many equal
+// elements.  It is not stable.
+//
+// Unlike ::qsort() the comparison is a functor that is inlined rather than called
+// indirectly for each comparison and elements are moved with their own copy operator.
+//
+// Arg         first_p - first element to sort
+// Arg         end_p - one past the last element to sort
+// Arg         is_less - functor or function that takes two elements and returns true if
+//             the first should be sorted before the second - see ASortLessPtr and
+//             ASortLess
+// # Examples:
+//   a_sort(elems_pp, elems_pp + count, ASortLessPtr<SSClass, ACompareLogical<SSClass> >());
+template<class _ElementType, class _LessType>
+inline void a_sort(
+  _ElementType * first_p,
+  _ElementType * end_p,
+  _LessType      is_less
+  )
+  {
+  ptrdiff_t length = end_p - first_p;
+
+  if (length > 1)
+    {
+    // Allow about log2(length) bad partitions
+    uint32_t bad_allowed = 0u;
+
+    for (; length; length >>= 1)
+      {
+      bad_allowed++;
+      }
+
+    a_sort_loop(first_p, end_p, is_less, bad_allowed, true);
+    }
+  }
+
+
+#endif  // __ASORT_HPP
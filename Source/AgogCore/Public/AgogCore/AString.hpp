@@ -26,6 +26,7 @@
 #include "AgogCore/AConstructDestruct.hpp"
 #include "AgogCore/ACompareBase.hpp"
 #include "AgogCore/AMemory.hpp"
+#include <utility>   // Uses: std::move(), std::swap()
 
 
 //=======================================================================================
@@ -42,6 +43,7 @@
 // Pre-declarations
 struct AStringRef;       
 class  AStringBM;
+class  AString;
 class  ASymbol;
 
 #ifdef A_PLAT_PC
@@ -55,15 +57,18 @@ class  ASymbol;
 // AString enumerated constants
 enum
   {
-  AString_indent_spaces_def     = 2,        // Default indentation amount in spaces
-  AString_tab_stop_def          = 4,        // Default tab stop amount in spaces
-  AString_def_alloc             = 8,        // Default C-String buffer allocation amount
-  AString_real_extra_chars      = 10,       // Extra space above and beyond significant digits for sign, exponent, etc.
-  AString_float_sig_digits_def  = FLT_DIG,  // Default significant digits for f32 (6)
-  AString_double_sig_digits_def = DBL_DIG,  // Default significant digits for f64 (15)
-  AString_int32_max_chars       = 40,
-  AString_ansi_charset_length   = 256,
-  AString_input_stream_max      = 256
+  AString_indent_spaces_def            = 2,        // Default indentation amount in spaces
+  AString_tab_stop_def                 = 4,        // Default tab stop amount in spaces
+  AString_def_alloc                    = 8,        // Default C-String buffer allocation amount
+  AString_real_extra_chars             = 10,       // Extra space above and beyond significant digits for sign, exponent, etc.
+  AString_float_sig_digits_def         = FLT_DIG,  // Default significant digits for f32 (6)
+  AString_double_sig_digits_def        = DBL_DIG,  // Default significant digits for f64 (15)
+  AString_float_sig_digits_round_trip  = 9,        // Significant digits so any f32 converts back exactly
+  AString_double_sig_digits_round_trip = 17,       // Significant digits so any f64 converts back exactly
+  AString_int32_max_chars              = 40,
+  AString_builder_reserve_def          = 256,      // Default initial buffer size of AStringBuilder
+  AString_ansi_charset_length          = 256,
+  AString_input_stream_max             = 256
   };
 
 
@@ -219,6 +224,99 @@ struct AFindStrArgs : public AStrArgs
 }; // AFindStrArgs
 
 
+//---------------------------------------------------------------------------------------
+// Notes      Lightweight view of a run of characters - just a pointer and a length - that
+//            does not own or copy them.  It is a cheap alternative to creating a new
+//            AString for every substring while parsing, and like AStrArgs it is small
+//            enough to pass and return by value.
+//
+//            The characters viewed are *not* necessarily null terminated - a view of the
+//            middle of a string is not - so never pass get_cstr() to a C-String function.
+//            The viewed characters must outlive the view: a view into an AString is only
+//            valid while that string is alive and unmodified.
+//
+//            AString::get_view(), AString::get_token_view() and the AStringView version of
+//            AString::tokenize() return views into the source string's buffer rather than
+//            allocating new strings.
+// See Also   AString, AStrArgs
+// # Examples:
+//              AString     line("width = 640");
+//              AStringView value(line.get_token_view(1u, "="));
+//
+//              value.crop();                // Trim white space
+//              int width = value.as_int();  // = 640
+class AStringView
+  {
+  public:
+
+  // Public Class Data Members
+
+    // For default tokenization
+    static const AStringView ms_comma;
+
+  // Common Methods
+
+    AStringView()                                   : m_cstr_p(""), m_length(0u) {}
+    AStringView(const char * cstr_p, uint32_t length) : m_cstr_p(cstr_p), m_length(length) {}
+    AStringView(const char * cstr_p);
+    AStringView(const AString & str);
+    AStringView(const AString & str, uint32_t pos, uint32_t char_count = ALength_remainder);
+
+  // Converter Methods
+
+    AString  as_string() const;
+    f64      as_float64(uint32_t start_pos = 0u, uint32_t * stop_pos_p = nullptr) const;
+    f32      as_float32(uint32_t start_pos = 0u, uint32_t * stop_pos_p = nullptr) const;
+    int      as_int(uint32_t start_pos = 0u, uint32_t * stop_pos_p = nullptr, uint32_t base = AString_determine_base) const;
+    uint     as_uint(uint32_t start_pos = 0u, uint32_t * stop_pos_p = nullptr, uint32_t base = AString_determine_base) const;
+    uint32_t as_crc32(uint32_t prev_crc = UINT32_MAX) const;
+
+  // Comparison Methods
+
+    eAEquate compare(const AStringView & view, eAStrCase case_check = AStrCase_sensitive) const;
+    bool     is_equal(const AStringView & view, eAStrCase case_check = AStrCase_sensitive) const;
+    bool     is_match(const AStringView & view, eAStrMatch match_type, eAStrCase case_check = AStrCase_sensitive) const;
+    bool     operator==(const AStringView & view) const  { return is_equal(view); }
+    bool     operator!=(const AStringView & view) const  { return !is_equal(view); }
+    bool     operator<(const AStringView & view) const   { return compare(view) == AEquate_less; }
+
+  // Accessor Methods
+
+    const char * get_cstr() const                   { return m_cstr_p; }
+    char         get_at(uint32_t pos) const;
+    uint32_t     get_length() const                 { return m_length; }
+    bool         is_empty() const                   { return m_length == 0u; }
+    bool         is_filled() const                  { return m_length != 0u; }
+    char         operator()(uint32_t pos) const     { return get_at(pos); }
+
+  // Modifying Methods - these only change which characters are viewed
+
+    void          crop(uint32_t pos, uint32_t char_count = ALength_remainder);
+    AStringView & crop(eACharMatch match_type = ACharMatch_white_space);
+    bool          pop_token(AStringView * token_p, const AStringView & separator = ms_comma, eAStrCase case_check = AStrCase_sensitive);
+
+  // Non-modifying Methods
+
+    bool        find(char ch, uint32_t instance = 1u, uint32_t * find_pos_p = nullptr, uint32_t start_pos = 0u, uint32_t end_pos = ALength_remainder) const;
+    bool        find(eACharMatch match_type, uint32_t instance = 1u, uint32_t * find_pos_p = nullptr, uint32_t start_pos = 0u, uint32_t end_pos = ALength_remainder) const;
+    bool        find(const AStringView & str, uint32_t instance = 1u, uint32_t * find_pos_p = nullptr, uint32_t start_pos = 0u, uint32_t end_pos = ALength_remainder, eAStrCase case_check = AStrCase_sensitive) const;
+    bool        find_reverse(char ch, uint32_t instance = 1u, uint32_t * find_pos_p = nullptr, uint32_t start_pos = 0u, uint32_t end_pos = ALength_remainder) const;
+    AStringView get(uint32_t pos = 0u, uint32_t char_count = ALength_remainder) const;
+    AStringView get_token(uint32_t index = 0u, const AStringView & separator = ms_comma, uint32_t * find_pos_p = nullptr, uint32_t start_pos = 0u, uint32_t end_pos = ALength_remainder, eAStrCase case_check = AStrCase_sensitive) const;
+    uint32_t    tokenize(AStringView * tokens_p, uint32_t token_max, const AStringView & separator = ms_comma, uint32_t start_pos = 0u, uint32_t end_pos = ALength_remainder, eAStrCase case_check = AStrCase_sensitive) const;
+
+  protected:
+  // Data Members
+
+    // First character viewed - not necessarily null terminated
+    const char * m_cstr_p;
+
+    // Number of characters viewed
+    uint32_t m_length;
+
+  };  // AStringView
+
+
 //---------------------------------------------------------------------------------------
 // Notes      Dynamic AString class which should be used in the place of standard C-String
 //            character array pointers.
@@ -244,6 +342,7 @@ struct AFindStrArgs : public AStrArgs
 class AString
   {
   friend class AStringBM;
+  friend class AStringView;
   friend class ASymbol;
   friend class ASymbolTable;
 
@@ -295,8 +394,10 @@ class AString
     AString(const AString & str);
     AString(const AString & str, eATerm term);
     AString(const AString & str, uint32_t extra_space);
+    AString(AString && str);
     ~AString();
     AString & operator=(const AString & str);
+    AString & operator=(AString && str);
 
   // Converter Methods
 
@@ -408,6 +509,10 @@ class AString
     void      append(char ch);
     void      append(char ch, uint32_t char_count);
     void      append_format(const char * format_str_p, ...);
+    void      append_int(int integer, uint base = AString_def_base);
+    void      append_uint(uint natural, uint base = AString_def_base);
+    void      append_float(f32 real, uint significant = AString_float_sig_digits_def, bool point_zero = true);
+    void      append_float64(f64 real, uint significant = AString_double_sig_digits_def);
     void      compact();
     void      crop(uint32_t pos, uint32_t char_count = ALength_remainder);
     AString & crop(eACharMatch match_type = ACharMatch_white_space);
@@ -518,6 +623,12 @@ class AString
     void      tokenize(APArrayLogical<AString> * collect_p, const AString & separator = ms_comma, uint32_t start_pos = 0u, uint32_t end_pos = ALength_remainder, eAStrCase case_check = AStrCase_sensitive) const;
     void      tokenize(APArrayLogical<AString> * collect_p, const AStringBM & separator, uint32_t start_pos = 0u, uint32_t end_pos = ALength_remainder) const;
 
+    // View Methods - return views into this string's buffer rather than new strings
+
+      AStringView get_view(uint32_t pos = 0u, uint32_t char_count = ALength_remainder) const;
+      AStringView get_token_view(uint32_t index = 0u, const AStringView & separator = AStringView::ms_comma, uint32_t * find_pos_p = nullptr, uint32_t start_pos = 0u, uint32_t end_pos = ALength_remainder, eAStrCase case_check = AStrCase_sensitive) const;
+      uint32_t    tokenize(AStringView * tokens_p, uint32_t token_max, const AStringView & separator = AStringView::ms_comma, uint32_t start_pos = 0u, uint32_t end_pos = ALength_remainder, eAStrCase case_check = AStrCase_sensitive) const;
+
     // Row & Column Methods
 
       uint find_indent_column(uint tab_stops = AString_tab_stop_def, uint * indent_idx_p = nullptr, uint start_pos = 0u, uint end_pos = ALength_remainder) const;
@@ -570,6 +681,9 @@ class AString
     friend AString   operator+(const AString & str1, const AString & str2);
     friend AString   operator+(const AString & str, const char * cstr_p);
     friend AString   operator+(const AString & str, char ch);
+    friend AString   operator+(AString && str1, const AString & str2);
+    friend AString   operator+(AString && str, const char * cstr_p);
+    friend AString   operator+(AString && str, char ch);
 
     // Future methods
       //friend istream & operator>>(istream & strm, AString & str);
@@ -671,6 +785,86 @@ class AStringBM : public AString
   };
 
 
+//---------------------------------------------------------------------------------------
+// Notes      Accumulates the characters of a string that is built up over many appends -
+//            callstack and list dumps, debug output, etc.
+//
+//            An AString only ever grows its buffer to the exact size requested so a long
+//            series of appends can reallocate and copy on nearly every call.  This
+//            builder instead grows its buffer geometrically (and uses whatever slack
+//            AMemory::request_byte_size() reports) so n appends cost amortized linear
+//            time.  When done, pop_string() hands the buffer over to an AString without
+//            copying the characters.
+// See Also   AString, AStringView
+// # Examples:
+//              AStringBuilder builder;
+//
+//              builder.append("Count: ");
+//              builder.append_int(count);
+//              builder.append('\n');
+//
+//              AString str(builder.pop_string());
+class AStringBuilder
+  {
+  public:
+
+  // Common Methods
+
+    explicit AStringBuilder(uint32_t reserve_chars = AString_builder_reserve_def);
+    ~AStringBuilder();
+
+  // Converter Methods
+
+    const char * as_cstr() const                    { return m_cstr_p; }
+    AString      as_string() const;
+    AStringView  as_view() const                    { return AStringView(m_cstr_p, m_length); }
+    AString      pop_string();
+
+  // Accessor Methods
+
+    uint32_t get_length() const                     { return m_length; }
+    uint32_t get_size() const                       { return m_size; }
+    bool     is_empty() const                       { return m_length == 0u; }
+    bool     is_filled() const                      { return m_length != 0u; }
+
+  // Modifying Methods
+
+    void append(const AStringView & view);
+    void append(const char * cstr_p, uint32_t length);
+    void append(char ch);
+    void append(char ch, uint32_t char_count);
+    void append_format(const char * format_str_p, ...);
+    void append_int(int integer, uint base = AString_def_base);
+    void append_uint(uint natural, uint base = AString_def_base);
+    void append_float(f32 real, uint significant = AString_float_sig_digits_def);
+    void append_float64(f64 real, uint significant = AString_double_sig_digits_def);
+    void empty();
+    void ensure_size(uint32_t needed_chars);
+
+  protected:
+  // Internal Methods
+
+    // Not copyable - declared but not defined
+    AStringBuilder(const AStringBuilder & builder);
+    AStringBuilder & operator=(const AStringBuilder & builder);
+
+    void grow(uint32_t needed_chars);
+
+  // Data Members
+
+    // Null terminated character buffer - allocated with AStringRef::alloc_buffer() so
+    // that it can be handed over to an AString
+    char * m_cstr_p;
+
+    // Number of characters not including the null terminator
+    uint32_t m_length;
+
+    // Size of m_cstr_p in bytes including space for the null terminator
+    uint32_t m_size;
+
+  };  // AStringBuilder
+
+
 //=======================================================================================
 // Inline Functions
 //=======================================================================================
@@ -66,16 +66,16 @@ A_INLINE AString operator+(
   {
   // This is a AString friend function
 
-  uint32_t length_str1 = str1.m_str_ref_p->m_length;
-  uint32_t length_str2 = str2.m_str_ref_p->m_length;
-  uint32_t length_new  = length_str1 + length_str2;
-  uint32_t size        = AStringRef::request_char_count(length_new);
-  char *   buffer_p    = AStringRef::alloc_buffer(size);
+  uint32_t     length_str1 = str1.m_str_ref_p->m_length;
+  uint32_t     length_str2 = str2.m_str_ref_p->m_length;
+  uint32_t     length_new  = length_str1 + length_str2;
+  AStringRef * str_ref_p   = AStringRef::pool_new_buffer(length_new, length_new, 0u);
+  char *       buffer_p    = str_ref_p->m_cstr_p;
 
   ::memcpy(buffer_p, str1.m_str_ref_p->m_cstr_p, size_t(length_str1));  
   ::memcpy(buffer_p + length_str1, str2.m_str_ref_p->m_cstr_p, size_t(length_str2 + 1u));  // +1 to include nullptr character
 
-  return AStringRef::pool_new(buffer_p, length_new, size, 0u, true, false);
+  return str_ref_p;
   }
 
 //---------------------------------------------------------------------------------------
@@ -98,16 +98,16 @@ A_INLINE AString operator+(
   {
   // This is a AString friend function
 
-  uint32_t length_str  = str.m_str_ref_p->m_length;
-  uint32_t length_cstr = uint32_t(::strlen(cstr_p));
-  uint32_t length_new  = length_str + length_cstr;
-  uint32_t size        = AStringRef::request_char_count(length_new);
-  char *   buffer_p    = AStringRef::alloc_buffer(size);
+  uint32_t     length_str  = str.m_str_ref_p->m_length;
+  uint32_t     length_cstr = uint32_t(::strlen(cstr_p));
+  uint32_t     length_new  = length_str + length_cstr;
+  AStringRef * str_ref_p   = AStringRef::pool_new_buffer(length_new, length_new, 0u);
+  char *       buffer_p    = str_ref_p->m_cstr_p;
 
   ::memcpy(buffer_p, str.m_str_ref_p->m_cstr_p, size_t(length_str));  
   ::memcpy(buffer_p + length_str, cstr_p, size_t(length_cstr + 1u));  // +1 to include nullptr character
 
-  return AStringRef::pool_new(buffer_p, length_new, size, 0u, true, false);
+  return str_ref_p;
   }
 
 //---------------------------------------------------------------------------------------
@@ -129,15 +129,84 @@ A_INLINE AString operator+(
   char            ch
   )
   {
-  uint32_t length_str = str.m_str_ref_p->m_length;
-  uint32_t size       = AStringRef::request_char_count(length_str + 1u);
-  char *   buffer_p   = AStringRef::alloc_buffer(size);
+  uint32_t     length_str = str.m_str_ref_p->m_length;
+  AStringRef * str_ref_p  = AStringRef::pool_new_buffer(length_str + 1u, length_str + 1u, 0u);
+  char *       buffer_p   = str_ref_p->m_cstr_p;
 
   ::memcpy(buffer_p, str.m_str_ref_p->m_cstr_p, size_t(length_str));  
   buffer_p[length_str]      = ch;
   buffer_p[length_str + 1u] = '\0';  // Put in null-terminator
 
-  return AStringRef::pool_new(buffer_p, length_str + 1u, size, 0u, true, false);
+  return str_ref_p;
+  }
+
+//---------------------------------------------------------------------------------------
+// Add/plus operator - concatenate str2 onto temporary str1.
+// # Returns:  New concatenated string
+// Arg         str1 - temporary string for first part of concatenation - its buffer is
+//             appended to and then moved to the result.
+// Arg         str2 - string for second part of concatenation
+// # Examples: AString cat_str = str1 + str2 + str3;  // only allocates for (str1 + str2)
+// # Notes:    Chained concatenations pick this version for every + after the first so
+//             the result of each step is grown in place rather than copied to a new
+//             buffer.
+A_INLINE AString operator+(
+  AString &&      str1,
+  const AString & str2
+  )
+  {
+  // This is a AString friend function
+
+  str1.append(str2);
+
+  return std::move(str1);
+  }
+
+//---------------------------------------------------------------------------------------
+// Add/plus operator - concatenate cstr_p onto temporary str.
+// # Returns:  New concatenated string
+// Arg         str - temporary string for first part of concatenation - its buffer is
+//             appended to and then moved to the result.
+// Arg         cstr_p - C-string for second part of concatenation
+// # Examples: AString cat_str = str1 + str2 + "str";
+A_INLINE AString operator+(
+  AString &&   str,
+  const char * cstr_p
+  )
+  {
+  // This is a AString friend function
+
+  str.append(cstr_p);
+
+  return std::move(str);
+  }
+
+//---------------------------------------------------------------------------------------
+// Add/plus operator - concatenate ch onto temporary str.
+// # Returns:  New concatenated string
+// Arg         str - temporary string for first part of concatenation - its buffer is
+//             appended to and then moved to the result.
+// Arg         ch - character for second part of concatenation
+// # Examples: AString str_ch = str1 + str2 + 'c';
+// # Notes:    Unlike append(ch) a null character is added just like operator+(str, ch).
+A_INLINE AString operator+(
+  AString && str,
+  char       ch
+  )
+  {
+  // This is a AString friend function
+
+  uint32_t length_str = str.m_str_ref_p->m_length;
+
+  str.ensure_size(length_str + 1u);
+
+  char * buffer_p = str.m_str_ref_p->m_cstr_p;
+
+  buffer_p[length_str]      = ch;
+  buffer_p[length_str + 1u] = '\0';  // Put in null-terminator
+  str.m_str_ref_p->m_length = length_str + 1u;
+
+  return std::move(str);
   }
 
 
@@ -307,6 +376,19 @@ A_INLINE AString::AString(const AString & str) :
   m_str_ref_p->m_ref_count++;
   }
 
+//---------------------------------------------------------------------------------------
+// Move constructor - takes the string reference of str without changing its reference
+// count and leaves str as an empty string.
+// # Returns:  itself
+// Arg         str - temporary string to take
+// # See:      AString(str), other AString constructors
+A_INLINE AString::AString(AString && str) :
+  m_str_ref_p(str.m_str_ref_p)
+  {
+  str.m_str_ref_p = AStringRef::get_empty();
+  str.m_str_ref_p->m_ref_count++;
+  }
+
 //---------------------------------------------------------------------------------------
 // Copy constructor - specifies whether str to copy is persistent or not.
 // # Returns:  itself
@@ -349,15 +431,10 @@ A_INLINE AString::AString(
   {
   if (extra_space)
     {
-    uint32_t size = AStringRef::request_char_count(str.m_str_ref_p->m_length + extra_space);
-
-    m_str_ref_p = AStringRef::pool_new(
-      AStringRef::alloc_buffer(size),  // C-String
-      str.m_str_ref_p->m_length,       // Length
-      size,                            // Size
-      1u,                              // References
-      true,                            // Deallocate
-      false);                          // Not Read-Only
+    m_str_ref_p = AStringRef::pool_new_buffer(
+      str.m_str_ref_p->m_length + extra_space,  // Needed
+      str.m_str_ref_p->m_length,                // Length
+      1u);                                      // References
 
     ::memcpy(m_str_ref_p->m_cstr_p, str.m_str_ref_p->m_cstr_p, size_t(m_str_ref_p->m_length + 1u));  // +1 to include nullptr character
     }
@@ -405,9 +482,7 @@ A_INLINE AString::AString(const char * cstr_p)
 // # Author(s):  Conan Reis
 A_INLINE AString::AString(char ch)
   {
-  uint32_t size = AStringRef::request_char_count(2u);
-
-  m_str_ref_p = AStringRef::pool_new(AStringRef::alloc_buffer(2u), 1u, size, 1u, true, false);
+  m_str_ref_p = AStringRef::pool_new_buffer(1u, 1u, 1u);
   m_str_ref_p->m_cstr_p[0u] = ch;
   m_str_ref_p->m_cstr_p[1u] = '\0';
   }
@@ -425,15 +500,7 @@ A_INLINE AString::AString(
   uint32_t char_count // = 1u
   )
   {
-  uint32_t size = AStringRef::request_char_count(char_count);
-
-  m_str_ref_p = AStringRef::pool_new(
-    AStringRef::alloc_buffer(size),
-    char_count,
-    size,
-    1u,
-    true,
-    false);
+  m_str_ref_p = AStringRef::pool_new_buffer(char_count, char_count, 1u);
 
   memset(m_str_ref_p->m_cstr_p, ch, char_count);
   m_str_ref_p->m_cstr_p[char_count] = '\0';
@@ -472,6 +539,17 @@ A_INLINE AString & AString::operator=(const AString & str)
   return *this;
   }
 
+//---------------------------------------------------------------------------------------
+// Move assignment operator - swaps string references with str so no reference counts
+// change and the previous string of this object is released when str is destroyed.
+// # Returns:  a reference to itself
+// Arg         str - temporary string to take
+A_INLINE AString & AString::operator=(AString && str)
+  {
+  std::swap(m_str_ref_p, str.m_str_ref_p);
+  return *this;
+  }
+
 //---------------------------------------------------------------------------------------
 //  C-String assignment.
 // # Returns:   a reference to itself
@@ -1125,8 +1203,8 @@ A_INLINE void AString::append(const AString & str)
 
     ensure_size(total_length);
     
-    // concatenate new string
-    memcpy(m_str_ref_p->m_cstr_p + m_str_ref_p->m_length, str.m_str_ref_p->m_cstr_p, size_t(str_length + 1u));
+    // concatenate new string - memmove() since str may be this string
+    memmove(m_str_ref_p->m_cstr_p + m_str_ref_p->m_length, str.m_str_ref_p->m_cstr_p, size_t(str_length + 1u));
     
     m_str_ref_p->m_length = total_length;
     }
@@ -1256,9 +1334,7 @@ A_INLINE void AString::ensure_size_buffer(uint32_t needed_chars)
   if ((needed_chars >= str_ref_p->m_size)
     || ((str_ref_p->m_ref_count + str_ref_p->m_read_only) != 1u))
     {
-    uint32_t size = AStringRef::request_char_count(needed_chars);
-
-    m_str_ref_p = m_str_ref_p->reuse_or_new(AStringRef::alloc_buffer(size), 0u, size);
+    m_str_ref_p = m_str_ref_p->reuse_or_new_buffer(needed_chars, str_ref_p->m_cstr_p, 0u);
     }
   }
 
@@ -1278,9 +1354,7 @@ A_INLINE bool AString::ensure_size_empty(uint32_t needed_chars)
   if ((needed_chars >= str_ref_p->m_size)
     || ((str_ref_p->m_ref_count + str_ref_p->m_read_only) != 1u))
     {
-    uint32_t size = AStringRef::request_char_count(needed_chars);
-
-    m_str_ref_p = m_str_ref_p->reuse_or_new(AStringRef::alloc_buffer(size), 0u, size);
+    m_str_ref_p = m_str_ref_p->reuse_or_new_buffer(needed_chars, str_ref_p->m_cstr_p, 0u);
     resized = true;
     }
 
@@ -2114,3 +2188,283 @@ A_INLINE char AStringBM::operator[](int index) const
 
 
 
+//#######################################################################################
+// AStringView Class
+//#######################################################################################
+
+
+//=======================================================================================
+// Inline Functions
+//=======================================================================================
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// Common Methods
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+//---------------------------------------------------------------------------------------
+// Constructor from null terminated C-String.
+// Arg         cstr_p - C-String to view - it must outlive this view
+// # Examples: AStringView view("hello");
+A_INLINE AStringView::AStringView(const char * cstr_p) :
+  m_cstr_p(cstr_p),
+  m_length(uint32_t(::strlen(cstr_p)))
+  {
+  }
+
+//---------------------------------------------------------------------------------------
+// Constructor viewing all of a string.
+// Arg         str - string to view - the view is only valid while str is not modified
+// # Examples: AStringView view(str);
+A_INLINE AStringView::AStringView(const AString & str) :
+  m_cstr_p(str.m_str_ref_p->m_cstr_p),
+  m_length(str.m_str_ref_p->m_length)
+  {
+  }
+
+//---------------------------------------------------------------------------------------
+// Constructor viewing part of a string.
+// Arg         str - string to view - the view is only valid while str is not modified
+// Arg         pos - index of first character to view
+// Arg         char_count - number of characters to view.  If it is ALength_remainder,
+//             all the characters from pos to the end of str are viewed.
+// # Examples: AStringView view(str, 3u, 4u);
+A_INLINE AStringView::AStringView(
+  const AString & str,
+  uint32_t        pos,
+  uint32_t        char_count // = ALength_remainder
+  ) :
+  m_cstr_p(str.m_str_ref_p->m_cstr_p + pos),
+  m_length((char_count == ALength_remainder) ? str.m_str_ref_p->m_length - pos : char_count)
+  {
+  #ifdef A_BOUNDS_CHECK
+    A_VERIFY(
+      (pos + m_length) <= str.m_str_ref_p->m_length,
+      a_cstr_format("AStringView(str, pos %u, char_count %u) - invalid index(es)\nLength is %u", pos, m_length, str.m_str_ref_p->m_length),
+      AErrId_invalid_index_span,
+      AString);
+  #endif
+  }
+
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// Converter Methods
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+//---------------------------------------------------------------------------------------
+// Generates a CRC32 of the viewed characters - the same value AString::as_crc32() gives
+// for a string with the same characters, so views may be used to look up symbols.
+// # Returns:  CRC32 checksum
+// Arg         prev_crc - previous CRC32 to continue from
+A_INLINE uint32_t AStringView::as_crc32(
+  uint32_t prev_crc // = UINT32_MAX
+  ) const
+  {
+  return AChecksum::generate_crc32_cstr(m_cstr_p, m_length, prev_crc);
+  }
+
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// Comparison Methods
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+//---------------------------------------------------------------------------------------
+// Determines if the viewed characters are the same as the ones given.
+// # Returns:  true if equal, false if not
+// Arg         view - characters to compare
+// Arg         case_check - AStrCase_sensitive or AStrCase_ignore
+// # See:      compare()
+A_INLINE bool AStringView::is_equal(
+  const AStringView & view,
+  eAStrCase           case_check // = AStrCase_sensitive
+  ) const
+  {
+  return (m_length == view.m_length)
+    && ((case_check == AStrCase_sensitive)
+      ? (::memcmp(m_cstr_p, view.m_cstr_p, m_length) == 0)
+      : (compare(view, AStrCase_ignore) == AEquate_equal));
+  }
+
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// Accessor Methods
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+//---------------------------------------------------------------------------------------
+// Gets the character at the specified index.
+// # Returns:  character at pos
+// Arg         pos - index of character
+A_INLINE char AStringView::get_at(uint32_t pos) const
+  {
+  #ifdef A_BOUNDS_CHECK
+    A_VERIFY(pos < m_length, a_cstr_format("AStringView::get_at(%u) - invalid index\nLength is %u", pos, m_length), AErrId_invalid_index, AString);
+  #endif
+
+  return m_cstr_p[pos];
+  }
+
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// Non-modifying Methods
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+//---------------------------------------------------------------------------------------
+// Gets a view of a subrange of this view - no characters are copied.
+// # Returns:  view of the specified characters
+// Arg         pos - index of first character
+// Arg         char_count - number of characters.  If it is ALength_remainder, all the
+//             characters from pos to the end of this view are used.
+// # See:      crop(), AString::get_view()
+A_INLINE AStringView AStringView::get(
+  uint32_t pos,       // = 0u
+  uint32_t char_count // = ALength_remainder
+  ) const
+  {
+  if (char_count == ALength_remainder)
+    {
+    char_count = m_length - pos;
+    }
+
+  #ifdef A_BOUNDS_CHECK
+    A_VERIFY(
+      (pos + char_count) <= m_length,
+      a_cstr_format("AStringView::get(pos %u, char_count %u) - invalid index(es)\nLength is %u", pos, char_count, m_length),
+      AErrId_invalid_index_span,
+      AString);
+  #endif
+
+  return AStringView(m_cstr_p + pos, char_count);
+  }
+
+
+//#######################################################################################
+// AString Class - View Methods
+//#######################################################################################
+
+//---------------------------------------------------------------------------------------
+// Gets a view of a range of this string - no characters are copied.
+// # Returns:  view of the specified characters.  It is only valid while this string is
+//             not modified or destroyed.
+// Arg         pos - index of first character
+// Arg         char_count - number of characters.  If it is ALength_remainder, all the
+//             characters from pos to the end of the string are used.
+// # See:      get(), get_token_view()
+A_INLINE AStringView AString::get_view(
+  uint32_t pos,       // = 0u
+  uint32_t char_count // = ALength_remainder
+  ) const
+  {
+  return AStringView(*this, pos, char_count);
+  }
+
+//---------------------------------------------------------------------------------------
+// Same as get_token(), but returns a view into this string rather than a new string.
+// # Returns:  view of substring at index position in between separators.  It is only
+//             valid while this string is not modified or destroyed.
+// # See:      AStringView::get_token() for argument descriptions
+A_INLINE AStringView AString::get_token_view(
+  uint32_t            index,      // = 0u
+  const AStringView & separator,  // = AStringView::ms_comma
+  uint32_t *          find_pos_p, // = nullptr
+  uint32_t            start_pos,  // = 0u
+  uint32_t            end_pos,    // = ALength_remainder
+  eAStrCase           case_check  // = AStrCase_sensitive
+  ) const
+  {
+  return AStringView(*this).get_token(index, separator, find_pos_p, start_pos, end_pos, case_check);
+  }
+
+//---------------------------------------------------------------------------------------
+// Same as tokenize() except that views into this string are stored in a caller supplied
+// array rather than newly allocated strings being appended to a pointer array.
+// # Returns:  number of tokens in the range - may be more than token_max
+// # See:      AStringView::tokenize() for argument descriptions
+A_INLINE uint32_t AString::tokenize(
+  AStringView *       tokens_p,
+  uint32_t            token_max,
+  const AStringView & separator,  // = AStringView::ms_comma
+  uint32_t            start_pos,  // = 0u
+  uint32_t            end_pos,    // = ALength_remainder
+  eAStrCase           case_check  // = AStrCase_sensitive
+  ) const
+  {
+  return AStringView(*this).tokenize(tokens_p, token_max, separator, start_pos, end_pos, case_check);
+  }
+
+
+//#######################################################################################
+// AStringBuilder Class
+//#######################################################################################
+
+
+//=======================================================================================
+// Inline Functions
+//=======================================================================================
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// Modifying Methods
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+//---------------------------------------------------------------------------------------
+// Appends characters - an AString, a C-String or an AStringView may be given.
+// Arg         view - characters to append
+// # See:      append_format(), append_int(), etc.
+A_INLINE void AStringBuilder::append(const AStringView & view)
+  {
+  append(view.get_cstr(), view.get_length());
+  }
+
+//---------------------------------------------------------------------------------------
+// Appends the specified number of characters.
+// Arg         cstr_p - characters to append - need not be null terminated
+// Arg         length - number of characters to append
+A_INLINE void AStringBuilder::append(
+  const char * cstr_p,
+  uint32_t     length
+  )
+  {
+  uint32_t new_length = m_length + length;
+
+  ensure_size(new_length);
+  ::memcpy(m_cstr_p + m_length, cstr_p, length);
+  m_cstr_p[new_length] = '\0';
+  m_length             = new_length;
+  }
+
+//---------------------------------------------------------------------------------------
+// Appends a character.
+// Arg         ch - character to append
+A_INLINE void AStringBuilder::append(char ch)
+  {
+  ensure_size(m_length + 1u);
+  m_cstr_p[m_length++] = ch;
+  m_cstr_p[m_length]   = '\0';
+  }
+
+//---------------------------------------------------------------------------------------
+// Removes all the characters but keeps the current buffer for reuse.
+// # See:      pop_string()
+A_INLINE void AStringBuilder::empty()
+  {
+  if (m_size)
+    {
+    m_cstr_p[0u] = '\0';
+    }
+
+  m_length = 0u;
+  }
+
+//---------------------------------------------------------------------------------------
+// Ensures that the buffer can store at least needed_chars characters plus a null
+// terminator - growing it geometrically if it cannot.
+// Arg         needed_chars - total number of characters (not including the null
+//             terminator) that need to fit
+// # See:      grow()
+A_INLINE void AStringBuilder::ensure_size(uint32_t needed_chars)
+  {
+  if (needed_chars >= m_size)
+    {
+    grow(needed_chars);
+    }
+  }
+
+
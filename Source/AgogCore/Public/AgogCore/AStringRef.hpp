@@ -21,6 +21,18 @@
 
 #include "AgogCore/AgogCore.hpp"
 
+//=======================================================================================
+// Global Macros / Defines
+//=======================================================================================
+
+enum
+  {
+  // Size in bytes (including the null terminator) of the character buffer embedded in
+  // each AStringRef.  Strings that fit use it rather than a separately allocated buffer.
+  AStringRef_small_size = 16u
+  };
+
+
 //=======================================================================================
 // Global Structures
 //=======================================================================================
@@ -40,6 +52,11 @@ struct AStringRef
     AStringRef(const char * cstr_p, uint32_t length, uint32_t size, uint16_t ref_count, bool deallocate, bool read_only);
 
     AStringRef * reuse_or_new(const char * cstr_p, uint32_t length, uint32_t size, bool deallocate = true);
+    AStringRef * reuse_or_new_buffer(uint32_t needed_chars, const char * cstr_p, uint32_t length);
+
+  // Accessor Methods
+
+    bool is_small() const  { return m_cstr_p == m_small_a; }
 
   // Comparison Methods
 
@@ -61,6 +78,7 @@ struct AStringRef
     static void         pool_delete(AStringRef * str_ref_p);
     static AStringRef * pool_new(const char * cstr_p, uint32_t length, uint32_t size, uint16_t ref_count, bool deallocate, bool read_only);
     static AStringRef * pool_new_copy(const char * cstr_p, uint32_t length, uint16_t ref_count = 1u, bool read_only = false);
+    static AStringRef * pool_new_buffer(uint32_t needed_chars, uint32_t length, uint16_t ref_count);
     static AStringRef * get_empty();
 
     static AObjReusePool<AStringRef> & get_pool();
@@ -75,6 +93,11 @@ struct AStringRef
     bool     m_deallocate;  // Specifies whether m_cstr_p should be deallocated or not
     bool     m_read_only;   // Indicates whether m_cstr_p is read-only
 
+    // Embedded buffer for short strings - m_cstr_p points here (with m_deallocate false)
+    // when the string fits.  It is placed last so that the offsets of the members above
+    // are unchanged.
+    char     m_small_a[AStringRef_small_size];
+
     // $Revisit - CReis [Efficiency] Note that 'm_deallocate' and 'm_read_only' could be
     // combined into one enumerated type (using just a uint8_t or uint16_t) with three possible
     // states: writable_deallocate, writable, and read_only.
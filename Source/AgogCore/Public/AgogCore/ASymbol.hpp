@@ -19,6 +19,7 @@
 //=======================================================================================
 
 #include "AgogCore/AObjReusePool.hpp"
+#include <type_traits>  // Uses: std::integral_constant
 
 
 //=======================================================================================
@@ -82,6 +83,12 @@
   #define A_SYMBOL_REF_COUNT
 #endif
 
+#if defined(A_SYMBOL_REF_COUNT)
+  // Symbol reference counts are atomic since symbols may be created and copied by worker
+  // threads - see ASymbolTableMT
+  #include <atomic>
+#endif
+
 
 //---------------------------------------------------------------------------------------
 // Id access: use sym.ASYM_MBR_ID instead of sym.m_ref_p->m_uid or sym.m_uid
@@ -104,6 +111,15 @@
   #define ASYMBOL_CSTR_STORE(_sym_id, _cstr_p, _length, _term)  ASymbolTable::ms_main_p->symbol_reference(_sym_id, _cstr_p, _length, _term)
   #define ASYMBOL_CSTR_TO_ID(_cstr_p, _char_count)              AChecksum::generate_crc32_cstr(_cstr_p, _char_count)
 
+  // Id of a string literal - same as ASYMBOL_CSTR_TO_ID() though computed at compile time
+  // if the compiler supports constexpr and at run-time if not (Visual Studio 2013).  Both
+  // only accept character arrays so a pointer cannot be given by mistake.
+  #if !defined(A_NO_CONSTEXPR)
+    #define ASYMBOL_LITERAL_TO_ID(_cstr)                        std::integral_constant<uint32_t, AChecksum::generate_crc32_literal(_cstr)>::value
+  #else
+    #define ASYMBOL_LITERAL_TO_ID(_cstr)                        AChecksum::generate_crc32_literal(_cstr)
+  #endif
+
   #ifdef A_SYMBOL_STR_DB_AGOG
     #define ASYMBOL_ID_TO_STR(_sym_id)                          ASymbolTable::ms_main_p->translate_id(_sym_id)
     #define ASYMBOL_ID_TO_CSTR(_sym_id)                         ASymbolTable::ms_main_p->translate_id(_sym_id)
@@ -118,8 +134,8 @@
   #define ASYMBOL_STR_TO_ID_CONCAT(_root_id, _str_suffix)       AChecksum::generate_crc32(_str_suffix, _root_id)
   #define ASYMBOL_STR_TO_SYM_IF_EXIST(_str)                     ASymbolTable::ms_main_p->translate_str(ident_str)
 
-  #define A_SYMID_DEREF(_sym)                                   ((_sym).m_ref_p)->m_ref_count--
-  #define A_SYMID_REF(_sym)                                     ((_sym).m_ref_p)->m_ref_count++
+  #define A_SYMID_DEREF(_sym)                                   ((_sym).m_ref_p)->m_ref_count.fetch_sub(1u, std::memory_order_relaxed)
+  #define A_SYMID_REF(_sym)                                     ((_sym).m_ref_p)->m_ref_count.fetch_add(1u, std::memory_order_relaxed)
 
 #endif
 
@@ -142,8 +158,15 @@
 #define ASYMBOL_DECLARE(_prefix, _id)             extern const ASymbol _prefix##_##_id;
 
 #if !defined(ASYMBOL_DEFINE_STR)
-  // Define for identifier definition
-  #define ASYMBOL_DEFINE_STR(_prefix, _id, _str)  const ASymbol _prefix##_##_id(ASymbol::create(_str));
+  // Define for identifier definition - _str must be a string literal.  Its id is computed
+  // at compile time and if there is no string database the symbol is constant initialized
+  // so there is no work done at startup at all.  Otherwise the string is registered with
+  // the symbol table at global initialization time.
+  #if defined(A_SYMBOL_STR_DB) || defined(A_NO_CONSTEXPR)
+    #define ASYMBOL_DEFINE_STR(_prefix, _id, _str)  const ASymbol _prefix##_##_id(ASymbol::create_with_id(ASYMBOL_LITERAL_TO_ID(_str), _str, uint32_t(sizeof(_str) - 1u)));
+  #else
+    #define ASYMBOL_DEFINE_STR(_prefix, _id, _str)  const ASymbol _prefix##_##_id(ASymbolConst_id, ASYMBOL_LITERAL_TO_ID(_str));
+  #endif
 #endif
 
 // Define for identifier definition
@@ -155,6 +178,12 @@
 const uint32_t ASymbol_id_null     = UINT32_MAX;  // Same as ~0u
 const uint32_t ASymbol_length_max  = 255u;
 
+// Selects the compile-time id constructor of ASymbol - see ASYMBOL_DEFINE_STR()
+enum eASymbolConst
+  {
+  ASymbolConst_id
+  };
+
 
 //=======================================================================================
 // Global Structures
@@ -181,7 +210,9 @@ struct ASymbolRef
 
     #if defined(A_SYMBOL_REF_COUNT)
       // Number of references to this symbol.  See A_SYMBOL_REF_COUNT.
-      uint32_t m_ref_count;
+      // Relaxed ordering is sufficient since unreferenced symbols are only removed by
+      // ASymbolTable::remove_unreferenced() when no other threads are using symbols.
+      std::atomic<uint32_t> m_ref_count;
     #endif
 
     // The string reference that this symbol is based on - this allows quick translation 
@@ -224,7 +255,8 @@ struct ASymbolRef
 // they can have significant memory savings over strings.
 class ASymbol
   {
-  friend class ASymbolTable;  // ASymbolTable needs access to ASymbol internal structures
+  friend class ASymbolTable;    // ASymbolTable needs access to ASymbol internal structures
+  friend class ASymbolTableMT;  // ASymbolTableMT creates symbols from its own references
   friend class ANamed;
 
   public:
@@ -243,6 +275,11 @@ class ASymbol
     ASymbol(const ASymbol & source);
     ~ASymbol();
 
+    #if !defined(A_SYMBOL_REF_LINK) && !defined(A_NO_CONSTEXPR)
+      // Compile-time constant symbol - the id should be from ASYMBOL_LITERAL_TO_ID()
+      constexpr ASymbol(eASymbolConst, uint32_t uid) : m_uid(uid) {}
+    #endif
+
   // Creation Methods
 
     // These are class/static functions rather than constructors to underline the fact
@@ -254,6 +291,7 @@ class ASymbol
 
     static ASymbol create(const AString & str, eATerm term = ATerm_long);
     static ASymbol create(const char * cstr_p, uint32_t length = ALength_calculate, eATerm term = ATerm_long);
+    static ASymbol create_with_id(uint32_t sym_id, const char * cstr_p, uint32_t length, eATerm term = ATerm_long);
     static ASymbol create_from_binary(const void ** sym_binary_pp);
     static ASymbol create_existing(uint32_t id);
     static ASymbol create_existing(const AString & str);
@@ -328,6 +366,7 @@ class ASymbol
       static bool is_tracking_serialized()    { return (ms_serialized_syms_p != nullptr); }
       static void track_serialized(ASymbolTable * used_syms_p = nullptr);
       static void table_from_binary(const void ** binary_pp);
+      static void table_from_binary_resident(const void ** binary_pp);
     #endif
 
   protected:
@@ -26,11 +26,22 @@
 // Defines
 //=======================================================================================
 
+enum
+  {
+  // First 4 bytes of a binary made by as_binary_resident() - "ASYR" in a byte stream
+  ASymbolTable_resident_tag = 0x52595341
+  };
+
 
 //=======================================================================================
 // Global Structures
 //=======================================================================================
 
+// Pre-declarations
+class AStringView;
+class AStringBuilder;
+
+
 #if defined(A_SYMBOLTABLE_CLASSES)
 
 //---------------------------------------------------------------------------------------
@@ -39,7 +50,8 @@
 // See the ASymbol class for more info.
 class ASymbolTable
   {
-  friend class ASymbol;  // ASymbol needs access to ASymbol internal structures
+  friend class ASymbol;          // ASymbol needs access to ASymbol internal structures
+  friend class ASymbolTableMT;  // Merges its symbols in with symbol_reference()
 
   public:
 
@@ -56,12 +68,19 @@ class ASymbolTable
     explicit ASymbolTable(bool sharing_symbols = false, uint32_t initial_size = 0u);
     ~ASymbolTable();
 
+  // Accessor Methods
+
+    uint32_t get_length() const  { return m_sym_refs.get_length(); }
+
   // Converter / Serialization Methods
 
     void     as_binary(void ** binary_pp) const;
     uint32_t as_binary_length() const;
     void     assign_binary(const void ** binary_pp);
     void     merge_binary(const void ** binary_pp);
+    void     as_binary_resident(void ** binary_pp) const;
+    uint32_t as_binary_resident_length() const;
+    void     merge_binary_resident(const void ** binary_pp);
 
     #if defined(A_SYMBOL_STR_DB_AGOG)
       void append_shared(const ASymbol & shared_symbol);
@@ -71,6 +90,7 @@ class ASymbolTable
 
     bool    is_registered(uint32_t sym_id) const;
     bool    translate_ids(AString * str_p) const;
+    bool    translate_ids(const AStringView & str, AStringBuilder * out_p) const;
     AString translate_id(uint32_t sym_id) const;
     bool    translate_known_id(uint32_t sym_id, AString * str_p) const;
     ASymbol translate_str(const AString & str) const;
@@ -0,0 +1,172 @@
+//=======================================================================================
+// Agog Labs C++ library.
+// Copyright (c) 2000 Agog Labs Inc.,
+// All rights reserved.
+//
+// ASymbolTableMT class declaration header - thread-safe symbol table for worker threads
+// # Notes:
+//=======================================================================================
+
+
+#ifndef __ASYMBOLTABLEMT_HPP
+#define __ASYMBOLTABLEMT_HPP
+
+
+//=======================================================================================
+// Includes
+//=======================================================================================
+
+#include "AgogCore/ASymbolTable.hpp"
+#include "AgogCore/APArray.hpp"
+#include <mutex>  // Uses: std::mutex
+
+
+//=======================================================================================
+// Defines
+//=======================================================================================
+
+enum
+  {
+  // Minimum number of slots in the symbol id hash index of a shard - always a power of 2
+  ASymbolTableMT_hash_size_min = 16u,
+
+  // Number of high bits of a symbol id used to select the shard that it is stored in
+  ASymbolTableMT_shard_bits = 4u,
+  ASymbolTableMT_shard_count = 1u << ASymbolTableMT_shard_bits,
+
+  // Byte size of the blocks that symbols are stored in
+  ASymbolTableMT_block_size = 65536u
+  };
+
+
+//=======================================================================================
+// Global Structures
+//=======================================================================================
+
+#if defined(A_SYMBOLTABLE_CLASSES)
+
+//---------------------------------------------------------------------------------------
+// Symbol table that worker threads (such as async loaders) may create and look up
+// symbols in at the same time as each other.  It is separate from ASymbolTable so that
+// the main table pays nothing for locking - use it only where symbols must be created
+// off the main thread and call merge_into() from the main thread to make the symbols
+// known to the main table.
+//
+// # Examples:
+//   // Worker threads
+//   ASymbol name = loader_syms.create(name_cstr_p, name_length);
+//
+//   // Main thread once the workers are done
+//   loader_syms.merge_into(ASymbolTable::ms_main_p);
+//
+// # Notes:
+//   Symbols are split into ASymbolTableMT_shard_count shards by the high bits of their
+//   ids and each shard is guarded by its own lock so threads rarely contend.  Each shard
+//   looks up ids with an open-addressing hash index.
+//
+//   Symbols do not use the ASymbolRef and AStringRef object pools since they are not
+//   thread-safe - instead they are stored in blocks owned by this table that are only
+//   freed when it is destructed.  So with A_SYMBOL_REF_LINK this table must outlive any
+//   ASymbol objects created by it.  AMemory must be using thread-safe allocation functions
+//   (which the default functions are).
+//
+//   Only create(), is_registered() and get_length() are thread-safe.
+class ASymbolTableMT
+  {
+  public:
+
+  // Common Methods
+
+    ASymbolTableMT();
+    ~ASymbolTableMT();
+
+  // Accessor Methods
+
+    uint32_t get_length() const;
+
+  // Methods
+
+    ASymbol create(const char * cstr_p, uint32_t length = ALength_calculate);
+    bool    is_registered(uint32_t sym_id) const;
+    void    merge_into(ASymbolTable * table_p) const;
+
+  protected:
+
+  // Internal Structures
+
+    // Slot in symbol id hash index - m_id is ASymbol_id_null if slot is unused
+    struct HashSlot
+      {
+      uint32_t m_id;   // Symbol id
+      uint32_t m_idx;  // Index of symbol in m_sym_refs
+      };
+
+    // Symbols whose ids share the same high ASymbolTableMT_shard_bits bits
+    struct Shard
+      {
+      // Symbols (strings and ids) in this shard in the order that they were added
+      APArray<ASymbolRef> m_sym_refs;
+
+      // Open-addressing (linear probing) hash index keyed on symbol id into m_sym_refs.
+      // It is kept at most half full so that misses end quickly.
+      HashSlot * m_hash_p;
+
+      // Number of hash slots - 1 (number of slots is a power of 2)
+      uint32_t m_hash_mask;
+
+      // Shift used to get hash slot from multiplicative hash of symbol id
+      uint32_t m_hash_shift;
+
+      // Guards this shard
+      mutable std::mutex m_mutex;
+
+      Shard();
+      ~Shard();
+
+      ASymbolRef * find_ref(uint32_t sym_id) const;
+      void         append_ref(ASymbolRef * sym_ref_p);
+      void         hash_insert(uint32_t sym_id, uint32_t idx);
+      void         hash_rebuild(uint32_t needed);
+      };
+
+    // Block of memory that symbols are stored in
+    struct Block
+      {
+      uint8_t m_bytes_a[ASymbolTableMT_block_size];
+      };
+
+  // Internal Methods
+
+    Shard &       get_shard(uint32_t sym_id)        { return m_shards[sym_id >> (32u - ASymbolTableMT_shard_bits)]; }
+    const Shard & get_shard(uint32_t sym_id) const  { return m_shards[sym_id >> (32u - ASymbolTableMT_shard_bits)]; }
+
+    ASymbolRef * symbol_reference(uint32_t sym_id, const char * cstr_p, uint32_t length);
+    ASymbolRef * block_new(uint32_t sym_id, const char * cstr_p, uint32_t length);
+
+  // Data Members
+
+    // Symbols split up by the high bits of their ids
+    Shard m_shards[ASymbolTableMT_shard_count];
+
+    // Blocks holding symbols (ASymbolRef, AStringRef and characters) - see block_new()
+    APArray<Block> m_blocks;
+
+    // Bytes used in the last block of m_blocks
+    uint32_t m_block_used;
+
+    // Guards m_blocks and m_block_used
+    std::mutex m_block_mutex;
+
+  private:
+
+    // Disallow copying
+    ASymbolTableMT(const ASymbolTableMT &);
+    ASymbolTableMT & operator=(const ASymbolTableMT &);
+
+  };  // ASymbolTableMT
+
+#endif // A_SYMBOLTABLE_CLASSES
+
+
+#endif  // __ASYMBOLTABLEMT_HPP
+
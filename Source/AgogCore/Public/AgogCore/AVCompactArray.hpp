@@ -21,8 +21,8 @@
 
 #include "AgogCore/AVCompactArrayBase.hpp"
 #include "AgogCore/ACompareBase.hpp"  // Uses: ACompareAddress<>, ACompareLogical<>
+#include "AgogCore/ASort.hpp"
 #include <stdarg.h>          // Uses: va_array, va_start, va_arg, va_end
-#include <stdlib.h>          // Uses: qsort
 
 
 //=======================================================================================
@@ -193,11 +193,6 @@ template<
     //AVCompactArray * operator-(const _ElementType & elem) const;
 
 
-  protected:
-  // Internal Class Methods
-
-    static int sort_compare(const void * lhs_p, const void * rhs_p);
-
     // Inherited from AVCompactArrayBase<>
     //static _ElementType ** alloc_array(uint32_t needed);
 
@@ -1543,13 +1538,12 @@ void AVCompactArray<_ElementType, _KeyType, _CompareClass>::set_all(
 //              set to last index position of the array (length - 1).
 //              (Default ALength_remainder)
 // # Examples:  array.sort();
-// # Notes:     calls sort_compare() which calls _CompareClass::comparison()
+// # Notes:     uses a_sort() which inlines _CompareClass::comparison()
 //              This method performs index range checking when A_BOUNDS_CHECK is defined.
 //              If an index is out of bounds, a AEx<AVCompactArray<>> exception is thrown.
 //              A_BOUNDS_CHECK is defined by default in debug mode and turned off in
 //              release mode.
 // # Author(s):  Conan Reis
-// Efficiency   Could probably get more speed by writing a custom version of qsort.
 template<class _ElementType, class _KeyType, class _CompareClass>
 inline void AVCompactArray<_ElementType, _KeyType, _CompareClass>::sort(
   uint32_t start_pos, // = 0u
@@ -1565,7 +1559,7 @@ inline void AVCompactArray<_ElementType, _KeyType, _CompareClass>::sort(
 
     APCOMPACTARRAY_BOUNDS_CHECK_RANGE(start_pos, end_pos);
 
-    qsort(this->m_array_p + start_pos, end_pos - start_pos + 1, sizeof(_ElementType *), sort_compare);
+    a_sort(this->m_array_p + start_pos, this->m_array_p + end_pos + 1u, ASortLess<_ElementType, _CompareClass>());
     }
   }
 
@@ -2060,24 +2054,6 @@ uint32_t AVCompactArray<_ElementType, _KeyType, _CompareClass>::get_instance(uin
   }
 
 
-//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
-// Class Internal Methods
-//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
-
-//---------------------------------------------------------------------------------------
-//  Used by qsort() in the sort() method
-// # Author(s):  Conan Reis
-template<class _ElementType, class _KeyType, class _CompareClass>
-int AVCompactArray<_ElementType, _KeyType, _CompareClass>::sort_compare(
-  const void * lhs_p,
-  const void * rhs_p
-  )
-  {
-  return A_INT_AS_DIFF32(
-    _CompareClass::comparison(**((_ElementType **)lhs_p), **((_ElementType **)rhs_p)));
-  }
-
-
 //#######################################################################################
 // AVCompactArrayLogical
 //#######################################################################################
@@ -21,6 +21,7 @@
 #include "AgogCore/AgogCore.hpp"
 #include "AgogCore/AMemory.hpp"
 #include <string.h>      // Uses: memcpy()
+#include <utility>       // Uses: std::move(), std::forward()
 
 
 //=======================================================================================
@@ -60,6 +61,7 @@
 //     ~AVCompactArrayLogical<>  - Same as AVCompactArray<>, but uses the comparison operators < and == to sort elements
 //   AVCompactSorted<>           - AVCompactSorted array of pointers to elements with retrieval and sorting by key type
 //     AVCompactSortedLogical<>  - Same as AVCompactSorted<>, but uses the comparison operators < and == to sort elements
+//   AVCompactArrayInline<>      - Stores up to N elements without a heap allocation
 // #Author   Conan Reis
 template<
   // the class/type of element objects in the array.
@@ -96,11 +98,16 @@ class AVCompactArrayBase
   // Modifying Behaviour methods
 
     void append_last_undef(const _ElementType & elem);
+    void append_last_undef(_ElementType && elem);
     void assign(AVCompactArrayBase * array_p);
     void empty();
     void empty_ensure_count_undef(uint32_t count);
     void insert(const _ElementType & elem, uint32_t pos = 0u);
+    void insert(_ElementType && elem, uint32_t pos = 0u);
     void remove(uint32_t pos = 0u);
+
+    template<class... _ArgTypes>
+      _ElementType & insert_emplace(uint32_t pos, _ArgTypes &&... args);
     void remove_last();
     void set_count_unsafe(uint32_t length);
 
@@ -124,6 +131,8 @@ class AVCompactArrayBase
 
     AVCompactArrayBase(uint32_t count = 0u, _ElementType * array_p = nullptr);
 
+    _ElementType * insert_undef(uint32_t pos);
+
   // Internal Class Methods
 
     static _ElementType * alloc_array(uint32_t count);
@@ -402,6 +411,22 @@ inline void AVCompactArrayBase<_ElementType>::append_last_undef(
   m_count++;
   }
 
+//---------------------------------------------------------------------------------------
+// #Description
+//   Same as append_last_undef(const _ElementType &) though elem is a temporary so it is
+//   moved into the array rather than copied.
+//
+// #See Also  empty_ensure_count_undef()
+template<class _ElementType>
+inline void AVCompactArrayBase<_ElementType>::append_last_undef(
+  // the element to move to the end of the array
+  _ElementType && elem
+  )
+  {
+  new (m_array_p + m_count) _ElementType(std::move(elem));
+  m_count++;
+  }
+
 //---------------------------------------------------------------------------------------
 // Transfer ownership assignment
 // Arg         array_p - address of array to take contents from and then empty
@@ -491,7 +516,7 @@ inline void AVCompactArrayBase<_ElementType>::empty_ensure_count_undef(uint32_t
 // #See Also  operator[], append*()
 // #Author(s) Conan Reis
 template<class _ElementType>
-void AVCompactArrayBase<_ElementType>::insert(
+inline void AVCompactArrayBase<_ElementType>::insert(
   // element to insert
   const _ElementType & elem,
   // index position to insert element before.  Any element currently at this index is
@@ -499,6 +524,75 @@ void AVCompactArrayBase<_ElementType>::insert(
   uint32_t pos // = 0u
   )
   {
+  new (insert_undef(pos)) _ElementType(elem);
+  }
+
+//---------------------------------------------------------------------------------------
+// #Description
+//   Inserts temporary elem at index pos - moving it into the array rather than copying
+//   it.
+//
+// #Examples
+//   array.insert(AString(buffer_p), 5u);
+//
+// #Notes
+//   Same cautions as insert(const _ElementType &).
+//
+// #See Also  insert_emplace(), append*()
+template<class _ElementType>
+inline void AVCompactArrayBase<_ElementType>::insert(
+  // temporary element to insert
+  _ElementType && elem,
+  // index position to insert element before.  Any element currently at this index is
+  // pushed one index higher.
+  uint32_t pos // = 0u
+  )
+  {
+  new (insert_undef(pos)) _ElementType(std::move(elem));
+  }
+
+//---------------------------------------------------------------------------------------
+// #Description
+//   Constructs an element in place at index pos using args as its constructor arguments
+//   so no temporary element needs to be made and then copied or moved.
+//
+// #Examples
+//   array.insert_emplace(5u, name, 42);
+//
+// #Notes
+//   Same cautions as insert(const _ElementType &).
+//
+// #See Also  insert(), append*()
+template<class _ElementType>
+template<class... _ArgTypes>
+inline _ElementType & AVCompactArrayBase<_ElementType>::insert_emplace(
+  // index position to construct element at.  Any element currently at this index is
+  // pushed one index higher.
+  uint32_t pos,
+  // arguments passed on to the _ElementType constructor
+  _ArgTypes &&... args
+  )
+  {
+  return *new (insert_undef(pos)) _ElementType(std::forward<_ArgTypes>(args)...);
+  }
+
+//---------------------------------------------------------------------------------------
+// #Description
+//   Makes room for a new element at index pos and increments the count though it does
+//   *not* construct the element - the caller must do that immediately afterwards.
+//
+// #Notes
+//   This method performs index range checking when A_BOUNDS_CHECK is defined.
+//
+// #Modifiers protected
+// #See Also  insert(), insert_emplace()
+template<class _ElementType>
+_ElementType * AVCompactArrayBase<_ElementType>::insert_undef(
+  // index position to make room at.  Any element currently at this index is pushed one
+  // index higher.
+  uint32_t pos
+  )
+  {
   AVCOMPACTARRAY_BOUNDS_LENGTH(pos);
 
   uint32_t       old_count = m_count;
@@ -531,8 +625,7 @@ void AVCompactArrayBase<_ElementType>::insert(
   m_count   = new_count;
   m_array_p = array_p;
 
-  // insert element
-  new (m_array_p + pos) _ElementType(elem);
+  return array_p + pos;
   }
 
 //---------------------------------------------------------------------------------------
@@ -0,0 +1,565 @@
+//=======================================================================================
+// Agog Labs C++ library.
+// Copyright (c) 2015 Agog Labs Inc.,
+// All rights reserved.
+//
+//  AVCompactArrayInline class template
+// # Notes:
+//=======================================================================================
+
+
+#ifndef __AVCOMPACTARRAYINLINE_HPP
+#define __AVCOMPACTARRAYINLINE_HPP
+#pragma once
+
+
+//=======================================================================================
+// Includes
+//=======================================================================================
+
+#include "AgogCore/AVCompactArrayBase.hpp"
+#include <type_traits>   // Uses: std::aligned_storage<>, std::alignment_of<>
+
+
+//=======================================================================================
+// Global Structures
+//=======================================================================================
+
+//---------------------------------------------------------------------------------------
+// #Description
+//   AVCompactArrayInline is like AVCompactArrayBase though it has a buffer for
+//   _InlineSize elements stored within the array object itself.  Whenever the array has
+//   no more than _InlineSize elements they are kept in this inline buffer and only larger
+//   arrays allocate a buffer on the heap.  Good for arrays that are almost always small
+//   and that are members of objects which are allocated in large numbers - such as the
+//   temporary variable names of a code block.
+//
+//   The inline buffer is known only to this class - AVCompactArrayBase is unchanged.  Its
+//   methods that resize the buffer would free the inline buffer so it is a protected base
+//   class and the methods that resize the buffer are reimplemented here.  Its other
+//   methods are made public again.
+//
+//   Since the inline buffer is within the object the array must not be relocated with a
+//   raw memory copy - as it may be when itself stored by value in an AVCompactArrayBase<>.
+//
+// #See Also
+//   AVCompactArrayBase<>, APCompactArrayInline<>
+template<
+  // the class/type of element objects in the array.
+  class _ElementType,
+  // number of elements that can be stored without a heap allocation
+  uint32_t _InlineSize
+  >
+class AVCompactArrayInline : protected AVCompactArrayBase<_ElementType>
+  {
+  public:
+  // Common types
+
+    // Local shorthand
+    typedef AVCompactArrayInline<_ElementType, _InlineSize> tAVCompactArrayInline;
+    typedef AVCompactArrayBase<_ElementType>                tAVCompactArrayBase;
+
+    static_assert(_InlineSize > 0u, "AVCompactArrayInline<> inline size must be at least 1.");
+
+  // Unhide Inherited Methods
+
+    // Methods inherited from AVCompactArrayBase<> that do not resize the buffer.
+    using tAVCompactArrayBase::as_binary;
+    using tAVCompactArrayBase::as_binary_length;
+    using tAVCompactArrayBase::get_array;
+    using tAVCompactArrayBase::get_array_end;
+    using tAVCompactArrayBase::get_at;
+    using tAVCompactArrayBase::get_first;
+    using tAVCompactArrayBase::get_last;
+    using tAVCompactArrayBase::get_count;
+    using tAVCompactArrayBase::is_empty;
+    using tAVCompactArrayBase::is_filled;
+    using tAVCompactArrayBase::set_at;
+    using tAVCompactArrayBase::operator();
+    using tAVCompactArrayBase::append_last_undef;
+    using tAVCompactArrayBase::apply;
+    using tAVCompactArrayBase::apply_method;
+
+  // Common methods
+
+    AVCompactArrayInline();
+    AVCompactArrayInline(const AVCompactArrayInline & array);
+    AVCompactArrayInline(AVCompactArrayBase<_ElementType> * array_p);
+    AVCompactArrayInline(AVCompactArrayInline && array);
+    ~AVCompactArrayInline();
+    AVCompactArrayInline & operator=(const AVCompactArrayInline & array);
+    AVCompactArrayInline & operator=(AVCompactArrayInline && array);
+
+  // Converter methods
+
+    uint32_t get_size_buffer_bytes() const;
+    uint32_t track_memory(AMemoryStats * mem_stats_p) const;
+
+  // Modifying Behaviour methods
+
+    void append(const _ElementType & elem);
+    void append(_ElementType && elem);
+    void assign(AVCompactArrayBase<_ElementType> * array_p);
+    void assign(AVCompactArrayInline * array_p);
+    void empty();
+    void empty_ensure_count_undef(uint32_t count);
+    void insert(const _ElementType & elem, uint32_t pos = 0u);
+    void insert(_ElementType && elem, uint32_t pos = 0u);
+    void remove(uint32_t pos = 0u);
+    void remove_last();
+
+    template<class... _ArgTypes>
+      _ElementType & append_emplace(_ArgTypes &&... args);
+
+    template<class... _ArgTypes>
+      _ElementType & insert_emplace(uint32_t pos, _ArgTypes &&... args);
+
+  protected:
+  // Internal Methods
+
+    _ElementType * alloc_buffer(uint32_t count);
+    void           free_buffer(_ElementType * array_p);
+    _ElementType * get_inline_buffer()             { return reinterpret_cast<_ElementType *>(&m_inline_buffer); }
+    _ElementType * insert_undef(uint32_t pos);
+    bool           is_buffer_inline() const        { return this->m_array_p == reinterpret_cast<const _ElementType *>(&m_inline_buffer); }
+
+  // Data Members
+
+    // Uninitialized storage used instead of a heap allocation whenever there are
+    // _InlineSize elements or less.
+    typename std::aligned_storage<sizeof(_ElementType) * _InlineSize, std::alignment_of<_ElementType>::value>::type m_inline_buffer;
+
+  };  // AVCompactArrayInline
+
+
+//=======================================================================================
+// Methods
+//=======================================================================================
+
+//---------------------------------------------------------------------------------------
+// Default constructor
+// # Returns:   itself
+// # Examples:  AVCompactArrayInline<ASymbol, 4u> array;
+template<class _ElementType, uint32_t _InlineSize>
+inline AVCompactArrayInline<_ElementType, _InlineSize>::AVCompactArrayInline()
+  {
+  }
+
+//---------------------------------------------------------------------------------------
+// Copy constructor - makes copies of the elements with calls to their copy constructors.
+// # Returns:   itself
+// Arg          array - array to copy
+template<class _ElementType, uint32_t _InlineSize>
+inline AVCompactArrayInline<_ElementType, _InlineSize>::AVCompactArrayInline(
+  const AVCompactArrayInline & array
+  )
+  {
+  operator=(array);
+  }
+
+//---------------------------------------------------------------------------------------
+// Transfer constructor - takes data from array_p and empties it.
+// # Returns:   itself
+// Arg          array_p - array to take data from
+// # Notes:     If array_p has no more than _InlineSize elements they are moved into the
+//              inline buffer of this array.
+template<class _ElementType, uint32_t _InlineSize>
+inline AVCompactArrayInline<_ElementType, _InlineSize>::AVCompactArrayInline(
+  AVCompactArrayBase<_ElementType> * array_p
+  )
+  {
+  assign(array_p);
+  }
+
+//---------------------------------------------------------------------------------------
+// Move constructor - takes the heap buffer of a temporary array or moves its elements
+// if they are stored in its inline buffer.
+// # Returns:   itself
+// Arg          array - temporary array to take data from
+template<class _ElementType, uint32_t _InlineSize>
+inline AVCompactArrayInline<_ElementType, _InlineSize>::AVCompactArrayInline(
+  AVCompactArrayInline && array
+  )
+  {
+  assign(&array);
+  }
+
+//---------------------------------------------------------------------------------------
+// Destructor
+template<class _ElementType, uint32_t _InlineSize>
+inline AVCompactArrayInline<_ElementType, _InlineSize>::~AVCompactArrayInline()
+  {
+  tAVCompactArrayBase::dtor_elems(this->m_array_p, this->m_count);
+  free_buffer(this->m_array_p);
+  }
+
+//---------------------------------------------------------------------------------------
+// Assignment operator.  ***Watch out*** - does a deep copy of the elements.
+// # Returns:   reference to itself to allow for stringization
+// Arg          array - array to copy
+template<class _ElementType, uint32_t _InlineSize>
+AVCompactArrayInline<_ElementType, _InlineSize> & AVCompactArrayInline<_ElementType, _InlineSize>::operator=(
+  const AVCompactArrayInline & array
+  )
+  {
+  if (this != &array)
+    {
+    uint32_t count = array.m_count;
+
+    empty();
+    empty_ensure_count_undef(count);
+
+    const _ElementType * elems_p     = array.m_array_p;
+    const _ElementType * elems_end_p = elems_p + count;
+
+    for (; elems_p < elems_end_p; elems_p++)
+      {
+      this->append_last_undef(*elems_p);
+      }
+    }
+
+  return *this;
+  }
+
+//---------------------------------------------------------------------------------------
+// Move assignment operator - destructs any existing elements and then takes the data of
+// a temporary array.
+// # Returns:   reference to itself to allow for stringization
+// Arg          array - temporary array to take data from
+// # See:       assign()
+template<class _ElementType, uint32_t _InlineSize>
+inline AVCompactArrayInline<_ElementType, _InlineSize> & AVCompactArrayInline<_ElementType, _InlineSize>::operator=(
+  AVCompactArrayInline && array
+  )
+  {
+  if (this != &array)
+    {
+    assign(&array);
+    }
+
+  return *this;
+  }
+
+//---------------------------------------------------------------------------------------
+// Returns the size of the heap buffer in bytes - 0 if the elements are in the inline
+// buffer since it is part of the array object itself.
+// # See:       AVCompactArrayBase<>::get_size_buffer_bytes()
+template<class _ElementType, uint32_t _InlineSize>
+inline uint32_t AVCompactArrayInline<_ElementType, _InlineSize>::get_size_buffer_bytes() const
+  {
+  return is_buffer_inline() ? 0u : uint32_t(this->m_count * sizeof(_ElementType));
+  }
+
+//---------------------------------------------------------------------------------------
+// Tracks memory used by the elements and returns the size of the heap buffer in bytes.
+// # See:       AVCompactArrayBase<>::track_memory()
+template<class _ElementType, uint32_t _InlineSize>
+inline uint32_t AVCompactArrayInline<_ElementType, _InlineSize>::track_memory(AMemoryStats * mem_stats_p) const
+  {
+  tAVCompactArrayBase::track_memory(mem_stats_p);
+
+  return get_size_buffer_bytes();
+  }
+
+//---------------------------------------------------------------------------------------
+// Appends a copy of elem to the end of the array.
+// Arg          elem - the element to append a copy of
+// # See:       insert()
+template<class _ElementType, uint32_t _InlineSize>
+inline void AVCompactArrayInline<_ElementType, _InlineSize>::append(const _ElementType & elem)
+  {
+  new (insert_undef(this->m_count)) _ElementType(elem);
+  }
+
+//---------------------------------------------------------------------------------------
+// Moves temporary elem to the end of the array.
+// Arg          elem - the element to move
+// # See:       append_emplace(), insert()
+template<class _ElementType, uint32_t _InlineSize>
+inline void AVCompactArrayInline<_ElementType, _InlineSize>::append(_ElementType && elem)
+  {
+  new (insert_undef(this->m_count)) _ElementType(std::move(elem));
+  }
+
+//---------------------------------------------------------------------------------------
+// Transfer ownership assignment - destructs any existing elements and then takes the
+// data of array_p and empties it.
+// Arg          array_p - address of array to take data from
+// # Notes:     If array_p has no more than _InlineSize elements they are moved into the
+//              inline buffer rather than taking over its buffer.
+template<class _ElementType, uint32_t _InlineSize>
+void AVCompactArrayInline<_ElementType, _InlineSize>::assign(
+  AVCompactArrayBase<_ElementType> * array_p
+  )
+  {
+  empty();
+
+  // This array no longer has a buffer to free so the base version can take the buffer
+  tAVCompactArrayBase::assign(array_p);
+
+  uint32_t count = this->m_count;
+
+  if (count && (count <= _InlineSize))
+    {
+    _ElementType * heap_array_p = this->m_array_p;
+
+    this->m_array_p = get_inline_buffer();
+    ::memcpy(this->m_array_p, heap_array_p, count * sizeof(_ElementType));
+    tAVCompactArrayBase::free_array(heap_array_p);
+    }
+  }
+
+//---------------------------------------------------------------------------------------
+// Transfer ownership assignment from another inline array - destructs any existing
+// elements and then takes the data of array_p and empties it.
+// Arg          array_p - address of array to take data from
+// # Notes:     The elements are moved if they are in the inline buffer of array_p.
+template<class _ElementType, uint32_t _InlineSize>
+void AVCompactArrayInline<_ElementType, _InlineSize>::assign(
+  AVCompactArrayInline * array_p
+  )
+  {
+  empty();
+
+  uint32_t count = array_p->m_count;
+
+  if (array_p->is_buffer_inline())
+    {
+    this->m_array_p = get_inline_buffer();
+    ::memcpy(this->m_array_p, array_p->m_array_p, count * sizeof(_ElementType));
+    }
+  else
+    {
+    this->m_array_p = array_p->m_array_p;
+    }
+
+  this->m_count      = count;
+  array_p->m_count   = 0u;
+  array_p->m_array_p = nullptr;
+  }
+
+//---------------------------------------------------------------------------------------
+// Destructs all the elements and frees any heap buffer.
+// # See:       AVCompactArrayBase<>::empty()
+template<class _ElementType, uint32_t _InlineSize>
+inline void AVCompactArrayInline<_ElementType, _InlineSize>::empty()
+  {
+  if (this->m_count)
+    {
+    tAVCompactArrayBase::dtor_elems(this->m_array_p, this->m_count);
+    free_buffer(this->m_array_p);
+
+    this->m_array_p = nullptr;
+    this->m_count   = 0u;
+    }
+  }
+
+//---------------------------------------------------------------------------------------
+// Destructs all the elements and ensures the buffer holds count elements though the
+// element count is set to 0 - follow with count calls to append_last_undef().
+// # See:       AVCompactArrayBase<>::empty_ensure_count_undef()
+template<class _ElementType, uint32_t _InlineSize>
+inline void AVCompactArrayInline<_ElementType, _InlineSize>::empty_ensure_count_undef(uint32_t count)
+  {
+  if (this->m_count == 0u)
+    {
+    if (count)
+      {
+      this->m_array_p = alloc_buffer(count);
+      }
+    }
+  else
+    {
+    tAVCompactArrayBase::dtor_elems(this->m_array_p, this->m_count);
+
+    if (this->m_count != count)
+      {
+      free_buffer(this->m_array_p);
+      this->m_array_p = alloc_buffer(count);
+      }
+    }
+
+  this->m_count = 0u;
+  }
+
+//---------------------------------------------------------------------------------------
+// Inserts copy of elem at index pos
+// # See:       AVCompactArrayBase<>::insert()
+template<class _ElementType, uint32_t _InlineSize>
+inline void AVCompactArrayInline<_ElementType, _InlineSize>::insert(
+  const _ElementType & elem,
+  uint32_t             pos // = 0u
+  )
+  {
+  new (insert_undef(pos)) _ElementType(elem);
+  }
+
+//---------------------------------------------------------------------------------------
+// Inserts temporary elem at index pos - moving it into the array rather than copying it.
+// # See:       AVCompactArrayBase<>::insert()
+template<class _ElementType, uint32_t _InlineSize>
+inline void AVCompactArrayInline<_ElementType, _InlineSize>::insert(
+  _ElementType && elem,
+  uint32_t        pos // = 0u
+  )
+  {
+  new (insert_undef(pos)) _ElementType(std::move(elem));
+  }
+
+//---------------------------------------------------------------------------------------
+// Destructs and removes the element at index pos
+// # See:       AVCompactArrayBase<>::remove()
+template<class _ElementType, uint32_t _InlineSize>
+void AVCompactArrayInline<_ElementType, _InlineSize>::remove(
+  uint32_t pos // = 0u
+  )
+  {
+  AVCOMPACTARRAY_BOUNDS_CHECK(pos);
+
+  _ElementType * old_array_p = this->m_array_p;
+
+  // Call destructor on removed element
+  old_array_p[pos].~_ElementType();
+
+  uint32_t new_count = this->m_count - 1u;
+
+  // May be the same inline buffer so memmove() rather than memcpy()
+  _ElementType * array_p = alloc_buffer(new_count);
+
+  if (new_count)
+    {
+    // Copy any elements prior to removed pos
+    if (pos && (array_p != old_array_p))
+      {
+      ::memmove(array_p, old_array_p, pos * sizeof(_ElementType));
+      }
+
+    // Copy any elements following removed pos
+    uint32_t post_count = new_count - pos;
+
+    if (post_count)
+      {
+      ::memmove(array_p + pos, old_array_p + pos + 1u, post_count * sizeof(_ElementType));
+      }
+    }
+
+  free_buffer(old_array_p);
+  this->m_array_p = array_p;
+  this->m_count   = new_count;
+  }
+
+//---------------------------------------------------------------------------------------
+// Destructs and removes the last element
+// # See:       remove()
+template<class _ElementType, uint32_t _InlineSize>
+inline void AVCompactArrayInline<_ElementType, _InlineSize>::remove_last()
+  {
+  AVCOMPACTARRAY_BOUNDS_CHECK(0u);
+
+  remove(this->m_count - 1u);
+  }
+
+//---------------------------------------------------------------------------------------
+// Constructs an element at the end of the array in place using args as its constructor
+// arguments.
+// # Returns:   the new element
+// Arg          args - arguments passed on to the _ElementType constructor
+// # Examples:  names.append_emplace(cstr_p, length, false);
+// # See:       append(), insert_emplace()
+template<class _ElementType, uint32_t _InlineSize>
+template<class... _ArgTypes>
+inline _ElementType & AVCompactArrayInline<_ElementType, _InlineSize>::append_emplace(_ArgTypes &&... args)
+  {
+  return *new (insert_undef(this->m_count)) _ElementType(std::forward<_ArgTypes>(args)...);
+  }
+
+//---------------------------------------------------------------------------------------
+// Constructs an element in place at index pos using args as its constructor arguments.
+// # Returns:   the new element
+// # See:       AVCompactArrayBase<>::insert_emplace()
+template<class _ElementType, uint32_t _InlineSize>
+template<class... _ArgTypes>
+inline _ElementType & AVCompactArrayInline<_ElementType, _InlineSize>::insert_emplace(
+  uint32_t         pos,
+  _ArgTypes &&...  args
+  )
+  {
+  return *new (insert_undef(pos)) _ElementType(std::forward<_ArgTypes>(args)...);
+  }
+
+//---------------------------------------------------------------------------------------
+// Returns a buffer for the specified number of elements - the inline buffer if count
+// fits in it, nullptr if count is 0 or otherwise a new heap buffer.
+// # Notes:     If the inline buffer is already in use then the same buffer is returned
+//              so callers must use memmove() rather than memcpy() when moving elements
+//              from the old buffer to the new one.
+// # Modifiers: protected
+// # See:       free_buffer()
+template<class _ElementType, uint32_t _InlineSize>
+inline _ElementType * AVCompactArrayInline<_ElementType, _InlineSize>::alloc_buffer(uint32_t count)
+  {
+  if (count <= _InlineSize)
+    {
+    return count ? get_inline_buffer() : nullptr;
+    }
+
+  return tAVCompactArrayBase::alloc_array(count);
+  }
+
+//---------------------------------------------------------------------------------------
+// Frees a buffer returned by alloc_buffer() - ignores the inline buffer.  Does not call
+// destructors.
+// # Modifiers: protected
+// # See:       alloc_buffer()
+template<class _ElementType, uint32_t _InlineSize>
+inline void AVCompactArrayInline<_ElementType, _InlineSize>::free_buffer(_ElementType * array_p)
+  {
+  if (array_p != get_inline_buffer())
+    {
+    tAVCompactArrayBase::free_array(array_p);
+    }
+  }
+
+//---------------------------------------------------------------------------------------
+// Makes room for a new element at index pos and increments the count though it does
+// *not* construct the element - the caller must do that immediately afterwards.
+// # Modifiers: protected
+// # See:       AVCompactArrayBase<>::insert_undef()
+template<class _ElementType, uint32_t _InlineSize>
+_ElementType * AVCompactArrayInline<_ElementType, _InlineSize>::insert_undef(uint32_t pos)
+  {
+  AVCOMPACTARRAY_BOUNDS_LENGTH(pos);
+
+  uint32_t       old_count   = this->m_count;
+  _ElementType * old_array_p = this->m_array_p;
+  _ElementType * array_p     = alloc_buffer(old_count + 1u);
+
+  if (old_count)
+    {
+    // May be the same inline buffer so memmove() rather than memcpy()
+
+    // Copy any elements following insert pos
+    uint32_t post_count = old_count - pos;
+
+    if (post_count)
+      {
+      ::memmove(array_p + pos + 1u, old_array_p + pos, post_count * sizeof(_ElementType));
+      }
+
+    // Copy any elements prior to insert pos
+    if (pos && (array_p != old_array_p))
+      {
+      ::memcpy(array_p, old_array_p, pos * sizeof(_ElementType));
+      }
+
+    free_buffer(old_array_p);
+    }
+
+  this->m_count   = old_count + 1u;
+  this->m_array_p = array_p;
+
+  return array_p + pos;
+  }
+
+
+#endif  // __AVCOMPACTARRAYINLINE_HPP
@@ -19,8 +19,8 @@
 
 #include "AgogCore/AVCompactArrayBase.hpp"
 #include "AgogCore/ACompareBase.hpp"
+#include "AgogCore/ASort.hpp"
 #include <stdarg.h>          // Uses: va_array, va_start(), va_arg(), va_end()
-#include <stdlib.h>          // Uses: qsort()
 
 
 //=======================================================================================
@@ -92,8 +92,10 @@ class AVCompactSorted : public AVCompactArrayBase<_ElementType>
     AVCompactSorted();
     AVCompactSorted(const AVCompactSorted & sorted);
     AVCompactSorted(AVCompactSorted * sorted_p);
+    AVCompactSorted(AVCompactSorted && sorted);
     ~AVCompactSorted();
     AVCompactSorted & operator=(const AVCompactSorted & sorted);
+    AVCompactSorted & operator=(AVCompactSorted && sorted);
 
   // Converter Methods
 
@@ -104,8 +106,11 @@ class AVCompactSorted : public AVCompactArrayBase<_ElementType>
   // Modifying Behaviour methods
 
     bool           append(const _ElementType & elem, uint32_t * insert_pos_p = nullptr);
+    bool           append(_ElementType && elem, uint32_t * insert_pos_p = nullptr);
     bool           append_absent(const _ElementType & elem, uint32_t * insert_pos_p = nullptr);
+    bool           append_absent(_ElementType && elem, uint32_t * insert_pos_p = nullptr);
     bool           append_replace(const _ElementType & elem, uint32_t * insert_pos_p = nullptr);
+    bool           append_replace(_ElementType && elem, uint32_t * insert_pos_p = nullptr);
     bool           remove(const _KeyType & key, uint32_t instance = AMatch_first_found, uint32_t * find_pos_p = nullptr, uint32_t start_pos = 0u, uint32_t end_pos = ALength_remainder);
     void           sort(uint32_t start_pos = 0u, uint32_t end_pos = ALength_remainder);
 
@@ -136,10 +141,6 @@ class AVCompactSorted : public AVCompactArrayBase<_ElementType>
 
     bool find_instance(const _KeyType & key, uint32_t instance, uint32_t * find_pos_p, _ElementType * first_p, _ElementType * last_p) const;
 
-  // Internal Class Methods
-
-    static int sort_compare(const void * lhs_p, const void * rhs_p);
-
 
   // Data members
 
@@ -169,9 +170,13 @@ class AVCompactSortedLogical : public AVCompactSorted<_ElementType, _KeyType, AC
     AVCompactSortedLogical() : tAVCompactSorted() {}
     AVCompactSortedLogical(const AVCompactSorted<_ElementType, _KeyType, ACompareLogical<_KeyType> > & sorted) : tAVCompactSorted(sorted) {}
     AVCompactSortedLogical(AVCompactSortedLogical<_ElementType, _KeyType> & sorted_p) : tAVCompactSorted(sorted_p) {}
+    AVCompactSortedLogical(AVCompactSortedLogical && sorted) : tAVCompactSorted(static_cast<tAVCompactSorted &&>(sorted)) {}
     explicit AVCompactSortedLogical(const _ElementType ** elems_p, uint32_t elem_count, bool pre_sorted = false);
     explicit AVCompactSortedLogical(const _ElementType * elems_p, uint32_t elem_count, bool pre_sorted);
     //explicit AVCompactSortedLogical(int elem_count, ...);
+
+    AVCompactSortedLogical & operator=(const AVCompactSortedLogical & sorted)  { tAVCompactSorted::operator=(sorted); return *this; }
+    AVCompactSortedLogical & operator=(AVCompactSortedLogical && sorted)       { tAVCompactSorted::operator=(static_cast<tAVCompactSorted &&>(sorted)); return *this; }
   };
 
 
@@ -240,6 +245,22 @@ inline AVCompactSorted<_ElementType, _KeyType, _CompareClass>::AVCompactSorted(
   sorted_p->m_array_p = nullptr;
   }
 
+//---------------------------------------------------------------------------------------
+// Move constructor - takes the elements of a temporary sorted array without copying
+// them.
+// # Returns:   itself
+// Arg          sorted - temporary sorted array to take data from
+// # See:       AVCompactSorted(AVCompactSorted *)
+template<class _ElementType, class _KeyType, class _CompareClass>
+inline AVCompactSorted<_ElementType, _KeyType, _CompareClass>::AVCompactSorted(
+  tAVCompactSorted && sorted
+  ) :
+  tAVCompactArrayBase(sorted.m_count, sorted.m_array_p)
+  {
+  sorted.m_count = 0u;
+  sorted.m_array_p = nullptr;
+  }
+
 //---------------------------------------------------------------------------------------
 //  Destructor
 // # Author(s):  Conan Reis
@@ -316,6 +337,26 @@ AVCompactSorted<_ElementType, _KeyType, _CompareClass>::operator=(
   return *this;
   }
 
+//---------------------------------------------------------------------------------------
+// Move assignment operator - destructs any existing elements and then takes the
+// elements of a temporary sorted array without copying them.
+// # Returns:   reference to itself to allow for stringization
+// Arg          sorted - temporary sorted array to take data from
+// # See:       AVCompactArrayBase<>::assign()
+template<class _ElementType, class _KeyType, class _CompareClass>
+  inline AVCompactSorted<_ElementType, _KeyType, _CompareClass> &
+AVCompactSorted<_ElementType, _KeyType, _CompareClass>::operator=(
+  tAVCompactSorted && sorted
+  )
+  {
+  if (this != &sorted)
+    {
+    this->assign(&sorted);
+    }
+
+  return *this;
+  }
+
 
 //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
 // Converter Methods
@@ -484,6 +525,34 @@ bool AVCompactSorted<_ElementType, _KeyType, _CompareClass>::append(
   return !found;
   }
 
+//---------------------------------------------------------------------------------------
+// Same as append(const _ElementType &) though elem is a temporary so it is moved into
+// the array rather than copied.
+// # Returns:   true if element has unique key false if one or more elements have the
+//              same key.
+// Arg          elem - the temporary element to append
+// Arg          insert_pos_p - address to store the append insertion index position.  If
+//              this pointer is set to nullptr, it is ignored.  (Default nullptr)
+// # See:       append_absent(), append_replace()
+template<class _ElementType, class _KeyType, class _CompareClass>
+bool AVCompactSorted<_ElementType, _KeyType, _CompareClass>::append(
+  _ElementType && elem,
+  uint32_t *      insert_pos_p // = nullptr
+  )
+  {
+  uint32_t pos;
+  bool found = this->find(elem, AMatch_first_found, &pos);
+
+  this->insert(std::move(elem), pos);
+
+  if (insert_pos_p)
+    {
+    *insert_pos_p = pos;
+    }
+
+  return !found;
+  }
+
 //---------------------------------------------------------------------------------------
 //  Appends an element to the AVCompactSorted array if it is not already present.
 // # Returns:   true if element appended, false if not
@@ -515,6 +584,36 @@ bool AVCompactSorted<_ElementType, _KeyType, _CompareClass>::append_absent(
   return !found;
   }
 
+//---------------------------------------------------------------------------------------
+// Same as append_absent(const _ElementType &) though elem is a temporary so it is moved
+// into the array rather than copied.
+// # Returns:   true if element appended, false if not
+// Arg          elem - temporary element to append
+// Arg          insert_pos_p - address to store the index position that elem was inserted
+//              or found.  If insert_pos_p is nullptr, it is not modified.  (Default nullptr)
+// # See:       append(), append_replace()
+template<class _ElementType, class _KeyType, class _CompareClass>
+bool AVCompactSorted<_ElementType, _KeyType, _CompareClass>::append_absent(
+  _ElementType && elem,
+  uint32_t *      insert_pos_p // = nullptr
+  )
+  {
+  uint32_t pos;
+  bool found = this->find(elem, AMatch_first_found, &pos);
+
+  if (!found)
+    {
+    this->insert(std::move(elem), pos);
+    }
+
+  if (insert_pos_p)
+    {
+    *insert_pos_p = pos;
+    }
+
+  return !found;
+  }
+
 //---------------------------------------------------------------------------------------
 // #Description
 //   Appends a copy of an object to the sorted array if it is not already present or
@@ -556,6 +655,43 @@ AVCompactSorted<_ElementType, _KeyType, _CompareClass>::append_replace(
   return !found;
   }
 
+//---------------------------------------------------------------------------------------
+// #Description
+//   Same as append_replace(const _ElementType &) though elem is a temporary so it is
+//   moved into the array rather than copied.
+//
+// #See Also  append_absent(), append()
+template<class _ElementType, class _KeyType, class _CompareClass>
+  // true if element appended, false if not
+  bool
+AVCompactSorted<_ElementType, _KeyType, _CompareClass>::append_replace(
+  // temporary element to append
+  _ElementType && elem,
+  // address to store the index position that elem was inserted or found.  If it is nullptr,
+  // it is not modified.
+  uint32_t * insert_pos_p // = nullptr
+  )
+  {
+  uint32_t pos;
+  bool found = this->find(elem, AMatch_first_found, &pos);
+
+  if (found)
+    {
+    this->m_array_p[pos] = std::move(elem);
+    }
+  else
+    {
+    this->insert(std::move(elem), pos);
+    }
+
+  if (insert_pos_p)
+    {
+    *insert_pos_p = pos;
+    }
+
+  return !found;
+  }
+
 //---------------------------------------------------------------------------------------
 //  Removes instance of element matching key between start_pos and end_pos,
 //              returning true if found, false if not.
@@ -1555,7 +1691,7 @@ bool AVCompactSorted<_ElementType, _KeyType, _CompareClass>::find_instance(
 //              set to last index position of the array (length - 1).
 //              (Default ALength_remainder)
 // # Examples:  sorted.sort();
-// # Notes:     calls sort_compare() which calls _CompareClass::comparison()
+// # Notes:     uses a_sort() which inlines _CompareClass::comparison()
 //              This method performs index range checking when A_BOUNDS_CHECK is defined.
 //              If an index is out of bounds, a AEx<AVCompactSorted<>> exception is thrown.
 //              A_BOUNDS_CHECK is defined by default in debug mode and turned off in
@@ -1567,7 +1703,6 @@ inline void AVCompactSorted<_ElementType, _KeyType, _CompareClass>::sort(
   uint32_t end_pos    // = ALength_remainder
   )
   {
-  // $Revisit - CReis Efficiency: Could probably get more speed by writing a custom version of qsort.
   if (this->m_count > 1u)
     {
     if (end_pos == ALength_remainder)
@@ -1577,29 +1712,11 @@ inline void AVCompactSorted<_ElementType, _KeyType, _CompareClass>::sort(
 
     AVCOMPACTARRAY_BOUNDS_CHECK_RANGE(start_pos, end_pos);
   
-    qsort(this->m_array_p + start_pos, end_pos - start_pos + 1, sizeof(_ElementType), sort_compare);
+    a_sort(this->m_array_p + start_pos, this->m_array_p + end_pos + 1u, ASortLess<_ElementType, _CompareClass>());
     }
   }
 
 
-//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
-// Class Internal Methods
-//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
-
-//---------------------------------------------------------------------------------------
-//  Used by qsort() in the sort() method
-// # Author(s):  Conan Reis
-template<class _ElementType, class _KeyType, class _CompareClass>
-int AVCompactSorted<_ElementType, _KeyType, _CompareClass>::sort_compare(
-  const void * lhs_p,
-  const void * rhs_p
-  )
-  {
-  return A_INT_AS_DIFF32(
-    _CompareClass::comparison(*((_ElementType *)lhs_p), *((_ElementType *)rhs_p)));
-  }
-
-
 //#######################################################################################
 // AVCompactSortedLogical
 //#######################################################################################
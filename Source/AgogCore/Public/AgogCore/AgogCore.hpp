@@ -393,6 +393,20 @@
 // This acts as an intention comment for a non-terminating (i.e. infinite) loop.
 #define A_LOOP_INFINITE for (;;)
 
+// Storage class specifier for thread-local variables.  Only use with POD types - the
+// older compilers that are supported do not run constructors for thread-local data.
+#if defined(_MSC_VER)
+  #define A_THREAD_LOCAL  __declspec(thread)
+#else
+  #define A_THREAD_LOCAL  __thread
+#endif
+
+// Visual Studio 2013 and earlier do not support constexpr - any compile-time values then
+// fall back to being computed at run-time.
+#if defined(_MSC_VER) && (_MSC_VER < 1900) && !defined(A_NO_CONSTEXPR)
+  #define A_NO_CONSTEXPR
+#endif
+
 
 
 //=======================================================================================
@@ -370,25 +370,25 @@ namespace SSUEActor
     return coro_on_event<EventHandler_OnDestroyed, false>(scope_p);
     }
 
-  static const SSClass::MethodInitializerFunc methods_c2[] =
+  static const SSClass::MethodInitializerFuncId methods_c2[] =
     {
-      { "find_named",       mthdc_find_named },
-      { "named",            mthdc_named },
-      { "instances",        mthdc_instances },
-      { "instances_first",  mthdc_instances_first },
+      { ASYMBOL_LITERAL_TO_ID("find_named"),       mthdc_find_named },
+      { ASYMBOL_LITERAL_TO_ID("named"),            mthdc_named },
+      { ASYMBOL_LITERAL_TO_ID("instances"),        mthdc_instances },
+      { ASYMBOL_LITERAL_TO_ID("instances_first"),  mthdc_instances_first },
     };
 
-  static const SSClass::CoroutineInitializerFunc coroutines_i[] =
+  static const SSClass::CoroutineInitializerFuncId coroutines_i[] =
     {
-      { "_on_begin_overlap_do", coro_on_begin_overlap_do },
-      { "_on_begin_overlap_do_until", coro_on_begin_overlap_do_until },
-      { "_on_end_overlap_do", coro_on_end_overlap_do },
-      { "_on_end_overlap_do_until", coro_on_end_overlap_do_until },
-      { "_on_take_any_damage_do", coro_on_take_any_damage_do },
-      { "_on_take_any_damage_do_until", coro_on_take_any_damage_do_until },
-      { "_on_take_point_damage_do", coro_on_take_point_damage_do },
-      { "_on_take_point_damage_do_until", coro_on_take_point_damage_do_until },
-      { "_on_destroyed_do", coro_on_destroyed_do },
+      { ASYMBOL_LITERAL_TO_ID("_on_begin_overlap_do"), coro_on_begin_overlap_do },
+      { ASYMBOL_LITERAL_TO_ID("_on_begin_overlap_do_until"), coro_on_begin_overlap_do_until },
+      { ASYMBOL_LITERAL_TO_ID("_on_end_overlap_do"), coro_on_end_overlap_do },
+      { ASYMBOL_LITERAL_TO_ID("_on_end_overlap_do_until"), coro_on_end_overlap_do_until },
+      { ASYMBOL_LITERAL_TO_ID("_on_take_any_damage_do"), coro_on_take_any_damage_do },
+      { ASYMBOL_LITERAL_TO_ID("_on_take_any_damage_do_until"), coro_on_take_any_damage_do_until },
+      { ASYMBOL_LITERAL_TO_ID("_on_take_point_damage_do"), coro_on_take_point_damage_do },
+      { ASYMBOL_LITERAL_TO_ID("_on_take_point_damage_do_until"), coro_on_take_point_damage_do_until },
+      { ASYMBOL_LITERAL_TO_ID("_on_destroyed_do"), coro_on_destroyed_do },
     };
 
   void register_bindings2()
@@ -171,21 +171,21 @@ namespace SSUEEntity
     return !this_p || !this_p->IsValidLowLevel();
     }
 
-  static const SSClass::MethodInitializerFunc methods_i2[] =
+  static const SSClass::MethodInitializerFuncId methods_i2[] =
     {
-      { "String", mthd_String },
-      { "name", mthd_name },
-      { "entity_class", mthd_entity_class },
-      { "equal?", mthd_op_equals },
-      { "not_equal?", mthd_op_not_equal },
+      { ASYMBOL_LITERAL_TO_ID("String"), mthd_String },
+      { ASYMBOL_LITERAL_TO_ID("name"), mthd_name },
+      { ASYMBOL_LITERAL_TO_ID("entity_class"), mthd_entity_class },
+      { ASYMBOL_LITERAL_TO_ID("equal?"), mthd_op_equals },
+      { ASYMBOL_LITERAL_TO_ID("not_equal?"), mthd_op_not_equal },
     };
 
-  static const SSClass::MethodInitializerFunc methods_c2[] =
+  static const SSClass::MethodInitializerFuncId methods_c2[] =
     {
-      { "static_class", mthdc_static_class },
-      { "load", mthdc_load },
-      { "default", mthdc_default },
-      { "null", mthdc_null },
+      { ASYMBOL_LITERAL_TO_ID("static_class"), mthdc_static_class },
+      { ASYMBOL_LITERAL_TO_ID("load"), mthdc_load },
+      { ASYMBOL_LITERAL_TO_ID("default"), mthdc_default },
+      { ASYMBOL_LITERAL_TO_ID("null"), mthdc_null },
     };
 
   void register_bindings2()
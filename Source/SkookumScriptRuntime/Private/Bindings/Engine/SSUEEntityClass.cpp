@@ -46,9 +46,9 @@ namespace SSUEEntityClass
       }
     }
 
-  static const SSClass::MethodInitializerFunc methods_i2[] =
+  static const SSClass::MethodInitializerFuncId methods_i2[] =
     {
-      { "String", mthd_String },
+      { ASYMBOL_LITERAL_TO_ID("String"), mthd_String },
     };
 
   //---------------------------------------------------------------------------------------
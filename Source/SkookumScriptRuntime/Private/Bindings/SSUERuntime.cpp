@@ -18,6 +18,9 @@
 #include "SSUERemote.hpp"
 #include "SSUEBindings.hpp"
 
+#include <AgogCore/AObjPoolProfile.hpp>
+#include <SkookumScript/SSDataInstance.hpp>
+
 #include "GenericPlatformProcess.h"
 #include <chrono>
 
@@ -183,12 +186,74 @@ void SSUERuntime::deinit()
     //return;
     }
 
+  #if (SKOOKUM & SS_DEBUG)
+    // Record pool high-water marks for pools_profile_load() in later sessions
+    pools_profile_save();
+  #endif
+
   //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
   // Unloads SkookumScript and cleans-up
   SkookumScript::deinitialize_session();
   SkookumScript::deinitialize();
   }
 
+//---------------------------------------------------------------------------------------
+// Determine the pool profile file path
+//   - usually Content\SkookumScript\Compiled[bits]\PoolProfile.txt
+// 
+// Stored with the compiled binaries so that it is packaged along with them and pool
+// counts are kept separately for 32 and 64 bit builds.
+// 
+// #See:  pools_profile_load(), pools_profile_save(), get_compiled_path()
+FString SSUERuntime::get_pool_profile_path()
+  {
+  return get_singleton()->get_compiled_path() / TEXT("PoolProfile.txt");
+  }
+
+//---------------------------------------------------------------------------------------
+// Loads object pool high-water marks recorded by a previous session (if any) and
+// reserves that many objects in each pool so that they do not need to grow mid-frame.
+// 
+// #See:  pools_profile_save(), AObjPoolProfile
+void SSUERuntime::pools_profile_load()
+  {
+  FString profile_str;
+
+  if (FFileHelper::LoadFileToString(profile_str, *get_pool_profile_path()))
+    {
+    FTCHARToUTF8 profile_utf8(*profile_str);
+
+    AObjPoolProfile::parse(profile_utf8.Get(), profile_utf8.Length());
+    }
+
+  // Registering reserves any loaded counts
+  AObjPoolProfile::register_pool("AStringRef",          AStringRef::get_pool());
+  AObjPoolProfile::register_pool("ASymbolRef",          ASymbolRef::get_pool());
+  AObjPoolProfile::register_pool("ADatum",              ADatum::get_pool());
+  AObjPoolProfile::register_pool("SSData",              SSData::get_pool());
+  AObjPoolProfile::register_pool("SSInstance",          SSInstance::get_pool());
+  AObjPoolProfile::register_pool("SSDataInstance",      SSDataInstance::get_pool());
+  AObjPoolProfile::register_pool("SSBoolean",           SSBoolean::get_pool());
+  AObjPoolProfile::register_pool("SSInvokedExpression", SSInvokedExpression::get_pool());
+  AObjPoolProfile::register_pool("SSInvokedMethod",     SSInvokedMethod::get_pool());
+  AObjPoolProfile::register_pool("SSInvokedCoroutine",  SSInvokedCoroutine::get_pool());
+  }
+
+//---------------------------------------------------------------------------------------
+// Saves the high-water marks of the object pools registered by pools_profile_load().
+// Counts are merged with the loaded profile so they accumulate over several sessions.
+// 
+// #See:  pools_profile_load(), AObjPoolProfile
+void SSUERuntime::pools_profile_save()
+  {
+  AString profile_str;
+
+  AObjPoolProfile::update_counts();
+  AObjPoolProfile::as_string(&profile_str);
+
+  FFileHelper::SaveStringToFile(FString(profile_str.as_cstr()), *get_pool_profile_path());
+  }
+
 //---------------------------------------------------------------------------------------
 // Determine the compiled file path
 //   - usually Content\SkookumScript\Compiled[bits]\Classes.sk-bin
@@ -285,6 +350,9 @@ bool SSUERuntime::load_compiled_scripts(
   // Enable SkookumScript evaluation
   SkookumScript::enable_flag(SkookumScript::Flag_evaluate);
 
+  // Pre-size pools to their recorded high-water marks
+  pools_profile_load();
+
   A_DPRINT("SkookumScript initializing session...\n");
   SkookumScript::initialize_session();
   A_DPRINT("  ...done!\n\n");
@@ -78,6 +78,10 @@ class SSUERuntime : public SkookumRuntimeBase
 
       static void deinit();
 
+      static FString get_pool_profile_path();
+      static void    pools_profile_load();
+      static void    pools_profile_save();
+
     // Data Members
 
       mutable bool        m_compiled_file_b;
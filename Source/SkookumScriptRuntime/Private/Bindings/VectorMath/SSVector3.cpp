@@ -136,7 +136,16 @@ namespace SSVector3
     if (result_pp)
       {
       FVector * vector_p = scope_p->this_as<FVector>();
-      AString   str(128u, "(%g, %g, %g)", double(vector_p->X), double(vector_p->Y), double(vector_p->Z));
+      AString   str(nullptr, 64u, 0u);
+
+      // Same output as "(%g, %g, %g)" - so no ".0" on integral components
+      str.append('(');
+      str.append_float(vector_p->X, AString_float_sig_digits_def, false);
+      str.append(", ", 2u);
+      str.append_float(vector_p->Y, AString_float_sig_digits_def, false);
+      str.append(", ", 2u);
+      str.append_float(vector_p->Z, AString_float_sig_digits_def, false);
+      str.append(')');
 
       *result_pp = SSString::as_instance(str);
       }
@@ -640,58 +649,58 @@ namespace SSVector3
     }
   */
 
-  static const SSClass::MethodInitializerFunc methods_i[] = 
-    {
-      { "!",                mthd_ctor },
-      { "!copy",            mthd_ctor_copy },
-      { "!xyz",             mthd_ctor_xyz },
-      { "!xy",              mthd_ctor_xy },
-      { "!!",               mthd_dtor },
-
-      { "String",           mthd_String },
-
-      { "assign",           mthd_op_assign },
-      { "equal?",           mthd_op_equals },
-      { "not_equal?",       mthd_op_not_equal },
-      { "add",              mthd_op_add },
-      { "add_assign",       mthd_op_add_assign },
-      { "subtract",         mthd_op_subtract },
-      { "subtract_assign",  mthd_op_subtract_assign },
-      { "multiply",         mthd_op_multiply },
-      { "multiply_assign",  mthd_op_multiply_assign },
-      { "divide",           mthd_op_divide },
-      { "divide_assign",    mthd_op_divide_assign },
-
-      { "rotate_by",        mthd_rotate_by },
-      { "unrotate_by",      mthd_unrotate_by },
-      { "transform_by",     mthd_transform_by },
-      { "untransform_by",   mthd_untransform_by },
-
-      { "x",                mthd_x },
-      { "y",                mthd_y },
-      { "z",                mthd_z },
-      { "xyz_set",          mthd_xyz_set },
-      { "x_set",            mthd_x_set },
-      { "y_set",            mthd_y_set },
-      { "z_set",            mthd_z_set },
-      { "zero?",            mthd_zeroQ },
-      { "zero",             mthd_zero },
-
-      { "cross",            mthd_cross },
-      { "distance",         mthd_distance },
-      { "distance_squared", mthd_distance_squared },
-      { "dot",              mthd_dot },
-      { "length",           mthd_length },
-      { "length_squared",   mthd_length_squared },
-      { "near?",            mthd_nearQ },
-      //{ "angle",            mthd_angle },
-      //{ "normalize",        mthd_normalize },
+  static const SSClass::MethodInitializerFuncId methods_i[] = 
+    {
+      { ASYMBOL_LITERAL_TO_ID("!"),                mthd_ctor },
+      { ASYMBOL_LITERAL_TO_ID("!copy"),            mthd_ctor_copy },
+      { ASYMBOL_LITERAL_TO_ID("!xyz"),             mthd_ctor_xyz },
+      { ASYMBOL_LITERAL_TO_ID("!xy"),              mthd_ctor_xy },
+      { ASYMBOL_LITERAL_TO_ID("!!"),               mthd_dtor },
+
+      { ASYMBOL_LITERAL_TO_ID("String"),           mthd_String },
+
+      { ASYMBOL_LITERAL_TO_ID("assign"),           mthd_op_assign },
+      { ASYMBOL_LITERAL_TO_ID("equal?"),           mthd_op_equals },
+      { ASYMBOL_LITERAL_TO_ID("not_equal?"),       mthd_op_not_equal },
+      { ASYMBOL_LITERAL_TO_ID("add"),              mthd_op_add },
+      { ASYMBOL_LITERAL_TO_ID("add_assign"),       mthd_op_add_assign },
+      { ASYMBOL_LITERAL_TO_ID("subtract"),         mthd_op_subtract },
+      { ASYMBOL_LITERAL_TO_ID("subtract_assign"),  mthd_op_subtract_assign },
+      { ASYMBOL_LITERAL_TO_ID("multiply"),         mthd_op_multiply },
+      { ASYMBOL_LITERAL_TO_ID("multiply_assign"),  mthd_op_multiply_assign },
+      { ASYMBOL_LITERAL_TO_ID("divide"),           mthd_op_divide },
+      { ASYMBOL_LITERAL_TO_ID("divide_assign"),    mthd_op_divide_assign },
+
+      { ASYMBOL_LITERAL_TO_ID("rotate_by"),        mthd_rotate_by },
+      { ASYMBOL_LITERAL_TO_ID("unrotate_by"),      mthd_unrotate_by },
+      { ASYMBOL_LITERAL_TO_ID("transform_by"),     mthd_transform_by },
+      { ASYMBOL_LITERAL_TO_ID("untransform_by"),   mthd_untransform_by },
+
+      { ASYMBOL_LITERAL_TO_ID("x"),                mthd_x },
+      { ASYMBOL_LITERAL_TO_ID("y"),                mthd_y },
+      { ASYMBOL_LITERAL_TO_ID("z"),                mthd_z },
+      { ASYMBOL_LITERAL_TO_ID("xyz_set"),          mthd_xyz_set },
+      { ASYMBOL_LITERAL_TO_ID("x_set"),            mthd_x_set },
+      { ASYMBOL_LITERAL_TO_ID("y_set"),            mthd_y_set },
+      { ASYMBOL_LITERAL_TO_ID("z_set"),            mthd_z_set },
+      { ASYMBOL_LITERAL_TO_ID("zero?"),            mthd_zeroQ },
+      { ASYMBOL_LITERAL_TO_ID("zero"),             mthd_zero },
+
+      { ASYMBOL_LITERAL_TO_ID("cross"),            mthd_cross },
+      { ASYMBOL_LITERAL_TO_ID("distance"),         mthd_distance },
+      { ASYMBOL_LITERAL_TO_ID("distance_squared"), mthd_distance_squared },
+      { ASYMBOL_LITERAL_TO_ID("dot"),              mthd_dot },
+      { ASYMBOL_LITERAL_TO_ID("length"),           mthd_length },
+      { ASYMBOL_LITERAL_TO_ID("length_squared"),   mthd_length_squared },
+      { ASYMBOL_LITERAL_TO_ID("near?"),            mthd_nearQ },
+      //{ ASYMBOL_LITERAL_TO_ID("angle"),            mthd_angle },
+      //{ ASYMBOL_LITERAL_TO_ID("normalize"),        mthd_normalize },
     };
 
   //---------------------------------------------------------------------------------------
   void register_bindings()
     {
-    g_class_name = ASymbol::create_existing("Vector3");
+    g_class_name = ASymbol::create_existing(ASYMBOL_LITERAL_TO_ID("Vector3"));
     g_class_p = SSBrain::get_class(g_class_name);
 
     SS_ASSERTX(g_class_p, "Tried to register bindings for class 'Vector3' but it is unknown!");
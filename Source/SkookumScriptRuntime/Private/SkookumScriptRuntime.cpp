@@ -9,6 +9,10 @@
 #include "Runtime/Engine/Public/Tickable.h"
 #include "Engine/World.h"
 
+#include <AgogCore/AFrameArena.hpp>
+#include <AgogCore/AFunction.hpp>
+#include <AgogCore/AMemoryTagTracker.hpp>
+
 #ifdef A_PLAT_PC
   #include <windows.h>  // Uses: IsDebuggerPresent(), OutputDebugStringA()
 #endif
@@ -413,6 +417,16 @@ void FSkookumScriptRuntime::StartupModule()
   // Hook up Unreal memory allocator
   AMemory::override_functions(&Agog::malloc_func, &Agog::free_func, &Agog::req_byte_size_func);
 
+  #if !UE_BUILD_SHIPPING
+    // Optionally track live allocations per AMemory tag (-SkookumTrackMemory) and include
+    // them in SSDebug::print_memory()
+    if (FParse::Param(FCommandLine::Get(), TEXT("SkookumTrackMemory")))
+      {
+      AMemoryTagTracker::install();
+      SSDebug::set_print_memory_ext_func(new AFunction(AMemoryTagTracker::print_stats));
+      }
+  #endif
+
   //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
   // Start up SkookumScript
   m_runtime.on_init();
@@ -536,6 +550,9 @@ void FSkookumScriptRuntime::Tick(float deltaTime)
     {
     // Intentionally still called even when paused and deltaTime is 0.0f
     m_runtime.update(deltaTime);
+
+    // Release transient memory used during the update
+    AFrameArena::get_frame().reset();
     }
   }
 